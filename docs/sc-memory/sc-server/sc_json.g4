@@ -22,7 +22,10 @@ sc_json_command_type_and_payload
   | sc_json_command_handle_link_contents
   | sc_json_command_search_template
   | sc_json_command_generate_template
+  | sc_json_command_prepare_template
+  | sc_json_command_release_template
   | sc_json_command_handle_events
+  | sc_json_command_batch
   | sc_json_command_answer_init_event
   ;
 
@@ -44,7 +47,10 @@ sc_json_command_answer_payload
   | sc_json_command_answer_handle_link_contents
   | sc_json_command_answer_search_template
   | sc_json_command_answer_generate_template
+  | sc_json_command_answer_prepare_template
+  | sc_json_command_answer_release_template
   | sc_json_command_answer_handle_events
+  | sc_json_command_answer_batch
   ;
 
 sc_json_command_healthcheck
@@ -238,7 +244,7 @@ sc_json_command_answer_handle_link_contents
 
 sc_json_command_search_template
   : '"type"' ':' '"search_template"' ','
-    sc_json_command_template_payload
+    (sc_json_command_template_payload | sc_json_command_prepared_template_payload)
   ;
 
 sc_json_command_template_payload
@@ -313,7 +319,7 @@ sc_json_command_answer_search_template
 
 sc_json_command_generate_template
   : '"type"' ':' '"generate_template"' ','
-    sc_json_command_template_payload
+    (sc_json_command_template_payload | sc_json_command_prepared_template_payload)
   ;
 
 sc_json_command_answer_generate_template
@@ -330,6 +336,46 @@ sc_json_command_answer_generate_template
     '}' ','
   ;
 
+// Template is built once and is stored for session until it is released or session is closed.
+sc_json_command_prepare_template
+  : '"type"' ':' '"prepare_template"' ','
+    sc_json_command_template_payload
+  ;
+
+sc_json_command_answer_prepare_template
+  : '"payload"' ':'
+    '{'
+        '"handle"' ':' NUMBER ','
+    '}' ','
+  ;
+
+// Params of prepared template are bound on each request. Constructions found by search are filtered by them.
+sc_json_command_prepared_template_payload
+  : '"payload"' ':'
+    '{'
+        '"handle"' ':' NUMBER ','
+        ('"params"' ':'
+        '{'
+            (SC_ALIAS ':' (SC_ADDR_HASH | SC_ALIAS) ',')*
+        '}' ',')?
+    '}' ','
+  ;
+
+sc_json_command_release_template
+  : '"type"' ':' '"release_template"' ','
+    '"payload"' ':'
+    '['
+        (NUMBER ',')*
+    ']' ','
+  ;
+
+sc_json_command_answer_release_template
+  : '"payload"' ':'
+    '['
+        (BOOL ',')*
+    ']' ','
+  ;
+
 sc_json_command_handle_events
   : '"type"' ':' '"events"' ','
     '"payload"' ':'
@@ -355,6 +401,35 @@ sc_json_command_answer_handle_events
     ']' ','
   ;
 
+// Sub-requests are completed in order in one dispatch. Any value in payload of sub-request can be replaced by
+// object `{"$ref": "<json-pointer>"}` that refers to value in responses of earlier sub-requests, for example,
+// `{"$ref": "/0/payload/1"}` refers to the second value in payload of the first sub-request response.
+sc_json_command_batch
+  : '"type"' ':' '"batch"' ','
+    '"payload"' ':'
+    '{'
+        ('"abort_on_error"' ':' BOOL ',')?
+        '"requests"' ':'
+        '['
+            ('{'
+                sc_json_command_type_and_payload
+            '}' ',')*
+        ']' ','
+    '}' ','
+  ;
+
+// If `abort_on_error` is set, sub-requests after the first failed one aren't completed and aren't listed in answer.
+sc_json_command_answer_batch
+  : '"payload"' ':'
+    '['
+        ('{'
+            '"status"' ':' BOOL ','
+            '"errors"' ':' (STRING_CONTENT | '[]') ','
+            sc_json_command_answer_payload
+        '}' ',')*
+    ']' ','
+  ;
+
 sc_json_command_answer_init_event
   : '"event"' ':' '1' ','
     '"payload"' ':'
@@ -4,6 +4,8 @@
  * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
  */
 
+#include <sc-memory/sc_keynodes.hpp>
+
 #include "CommonUtils.hpp"
 
 #include "keynodes/coreKeynodes.hpp"
@@ -59,6 +61,9 @@ ScAddr IteratorUtils::getNextFromSet(
   SC_CHECK_PARAM(previous, "Invalid previous element address passed to `getNextFromSet`");
   SC_CHECK_PARAM(sequenceRelation, "Invalid sequence relation address passed to `getNextFromSet`");
 
+  if (sequenceRelation == ScKeynodes::kNrelBasicSequence)
+    return ms_context->HelperGetNextOrderedSetElement(set, previous);
+
   ScAddr nextElement;
   ScIterator3Ptr const & previousElementIterator = ms_context->Iterator3(set, ScType::EdgeAccessConstPosPerm, previous);
   if (previousElementIterator->Next())
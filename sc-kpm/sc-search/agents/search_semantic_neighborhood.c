@@ -6,6 +6,7 @@
 
 #include "search_semantic_neighborhood.h"
 #include "search_keynodes.h"
+#include "search_cache.h"
 #include "search_utils.h"
 #include "search_defines.h"
 #include "search.h"
@@ -278,12 +279,15 @@ void search_element_identifiers(sc_addr el, sc_addr answer)
 
 sc_result agent_search_full_semantic_neighborhood(sc_event const * event, sc_addr arg)
 {
-  sc_addr question, answer;
+  sc_addr question, answer, argument;
   sc_iterator3 *it1, *it2, *it3, *it4, *it6;
   sc_iterator5 *it5, *it_order, *it_order2;
   sc_type el_type;
   sc_bool sys_off = SC_TRUE;
   sc_bool key_order_found = SC_FALSE;
+  sc_bool has_argument;
+  sc_int64 start_time = 0;
+  sc_uint64 search_id = 0;
 
   if (!sc_memory_get_arc_end(s_default_ctx, arg, &question))
     return SC_RESULT_ERROR_INVALID_PARAMS;
@@ -294,13 +298,28 @@ sc_result agent_search_full_semantic_neighborhood(sc_event const * event, sc_add
       == SC_FALSE)
     return SC_RESULT_ERROR_INVALID_TYPE;
 
-  answer = create_answer_node();
-
   // get question argument
   it1 = sc_iterator3_f_a_a_new(s_default_ctx, question, sc_type_arc_pos_const_perm, 0);
-  if (sc_iterator3_next(it1) == SC_TRUE)
+  has_argument = sc_iterator3_next(it1);
+  if (has_argument == SC_TRUE
+      && search_cache_answer_question(
+             keynode_question_full_semantic_neighborhood,
+             question,
+             sc_iterator3_value(it1, 2),
+             &start_time,
+             &search_id)
+             == SC_TRUE)
+  {
+    sc_iterator3_free(it1);
+    return SC_RESULT_OK;
+  }
+
+  answer = create_answer_node();
+
+  if (has_argument == SC_TRUE)
   {
     sc_addr const element = sc_iterator3_value(it1, 2);
+    argument = element;
 
     appendIntoAnswer(answer, element);
 
@@ -316,6 +335,9 @@ sc_result agent_search_full_semantic_neighborhood(sc_event const * event, sc_add
 
       search_element_identifiers(element, answer);
 
+      search_cache_add_answer(
+          keynode_question_full_semantic_neighborhood, argument, answer, sys_off, start_time, search_id);
+
       connect_answer_to_question(question, answer);
       finish_question(question);
       sc_iterator3_free(sysElementIt3);
@@ -565,6 +587,10 @@ sc_result agent_search_full_semantic_neighborhood(sc_event const * event, sc_add
   }
   sc_iterator3_free(it1);
 
+  if (has_argument == SC_TRUE)
+    search_cache_add_answer(
+        keynode_question_full_semantic_neighborhood, argument, answer, sys_off, start_time, search_id);
+
   connect_answer_to_question(question, answer);
   finish_question(question);
 
@@ -6,6 +6,7 @@
 
 #include "search_structure.h"
 #include "search_keynodes.h"
+#include "search_cache.h"
 #include "search_utils.h"
 #include "search_defines.h"
 #include "search.h"
@@ -15,10 +16,13 @@
 
 sc_result agent_search_decomposition(sc_event const * event, sc_addr arg)
 {
-  sc_addr question, answer;
+  sc_addr question, answer, argument;
   sc_iterator3 *it1, *it2, *it3;
   sc_iterator5 *it5, *it_order;
   sc_bool sys_off = SC_TRUE;
+  sc_bool has_argument;
+  sc_int64 start_time = 0;
+  sc_uint64 search_id = 0;
   sc_type el_type;
 
   if (!sc_memory_get_arc_end(s_default_ctx, arg, &question))
@@ -29,13 +33,24 @@ sc_result agent_search_decomposition(sc_event const * event, sc_addr arg)
       == SC_FALSE)
     return SC_RESULT_ERROR_INVALID_TYPE;
 
-  answer = create_answer_node();
-
   // get operation argument
   it1 = sc_iterator3_f_a_a_new(s_default_ctx, question, sc_type_arc_pos_const_perm, 0);
-  if (sc_iterator3_next(it1) == SC_TRUE)
+  has_argument = sc_iterator3_next(it1);
+  if (has_argument == SC_TRUE
+      && search_cache_answer_question(
+             keynode_question_decomposition, question, sc_iterator3_value(it1, 2), &start_time, &search_id)
+             == SC_TRUE)
   {
-    if (IS_SYSTEM_ELEMENT(sc_iterator3_value(it1, 2)))
+    sc_iterator3_free(it1);
+    return SC_RESULT_OK;
+  }
+
+  answer = create_answer_node();
+
+  if (has_argument == SC_TRUE)
+  {
+    argument = sc_iterator3_value(it1, 2);
+    if (IS_SYSTEM_ELEMENT(argument))
       sys_off = SC_FALSE;
 
     appendIntoAnswer(answer, sc_iterator3_value(it1, 2));
@@ -135,6 +150,9 @@ sc_result agent_search_decomposition(sc_event const * event, sc_addr arg)
   }
   sc_iterator3_free(it1);
 
+  if (has_argument == SC_TRUE)
+    search_cache_add_answer(keynode_question_decomposition, argument, answer, sys_off, start_time, search_id);
+
   connect_answer_to_question(question, answer);
   finish_question(question);
 
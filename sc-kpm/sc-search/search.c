@@ -7,6 +7,7 @@
 #include "search.h"
 #include "search_agents.h"
 #include "search_keynodes.h"
+#include "search_cache.h"
 
 #include "sc-core/sc_memory_headers.h"
 #include "sc-core/sc_memory_context_manager.h"
@@ -34,6 +35,8 @@ sc_result sc_module_initialize_with_init_memory_generated_structure(sc_addr cons
   if (search_keynodes_initialize(s_default_ctx, init_memory_generated_structure) != SC_RESULT_OK)
     return SC_RESULT_ERROR;
 
+  search_cache_initialize();
+
   event_question_search_all_output_arcs = sc_event_new(
       s_default_ctx, keynode_question_initiated, SC_EVENT_ADD_OUTPUT_ARC, 0, agent_search_all_const_pos_output_arc, 0);
   if (event_question_search_all_output_arcs == null_ptr)
@@ -152,5 +155,7 @@ sc_result sc_module_shutdown()
   if (event_question_search_links_of_relation_connected_with_element)
     sc_event_destroy(event_question_search_links_of_relation_connected_with_element);
 
+  search_cache_shutdown();
+
   return SC_RESULT_OK;
 }
@@ -0,0 +1,566 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "search_cache.h"
+#include "search_keynodes.h"
+#include "search_utils.h"
+#include "search_defines.h"
+#include "search.h"
+
+#include "sc-core/sc_helper.h"
+#include "sc-core/sc_memory_headers.h"
+#include "sc-core/sc-store/sc-base/sc_allocator.h"
+#include "sc-core/sc-store/sc-base/sc_monitor.h"
+#include "sc-core/sc-store/sc-container/sc-hash-table/sc_hash_table.h"
+
+#define SEARCH_CACHE_KEY(_question_class, _argument) \
+  (((sc_uint64)SC_ADDR_LOCAL_TO_INT(_question_class) << 32) | (sc_uint64)SC_ADDR_LOCAL_TO_INT(_argument))
+
+//! Maximum amount of sc-nodes connected with argument of memoized answer that can be checked to be questions
+#define SEARCH_CACHE_MAX_PENDING_SOURCES 16
+//! Amount of sc-events of argument of memoized answer
+#define SEARCH_CACHE_ARGUMENT_EVENTS_COUNT 5
+
+typedef struct _search_cache_entry
+{
+  sc_uint64 key;
+  sc_uint64 search_id;  // id of search of answer that entry has been created before
+  sc_addr answer;
+  sc_addr pending_sources[SEARCH_CACHE_MAX_PENDING_SOURCES];  // sc-nodes that can be new questions about argument
+  sc_uint32 pending_sources_count;
+  sc_event ** events;
+  sc_uint32 events_count;
+  sc_bool sys_off;     // SC_TRUE if system elements were skipped by search of answer
+  sc_bool is_valid;    // SC_FALSE if region of answer has been changed
+  sc_bool is_pending;  // SC_TRUE if answer is being searched and only argument is subscribed to
+  sc_bool is_removed;  // SC_TRUE if entry is removed from cache and its events are being destroyed
+} search_cache_entry;
+
+typedef struct _search_cache
+{
+  sc_bool enabled;
+  sc_hash_table * entries;
+  sc_monitor monitor;
+  sc_uint64 last_search_id;
+
+  sc_uint64 hits_count;
+  sc_uint64 misses_count;
+  sc_uint64 invalidations_count;
+  sc_uint64 total_hit_time;
+  sc_uint64 total_miss_time;
+} search_cache;
+
+search_cache s_search_cache;
+
+sc_result _search_cache_invalidate(sc_event const * event)
+{
+  search_cache_entry * entry = sc_event_get_data(event);
+  if (entry == null_ptr)
+    return SC_RESULT_OK;
+
+  sc_monitor_acquire_write(&s_search_cache.monitor);
+  if (entry->is_valid == SC_TRUE && entry->is_removed == SC_FALSE)
+  {
+    entry->is_valid = SC_FALSE;
+    ++s_search_cache.invalidations_count;
+  }
+  sc_monitor_release_write(&s_search_cache.monitor);
+
+  return SC_RESULT_OK;
+}
+
+sc_result _search_cache_on_region_changed(sc_event const * event, sc_addr connector_addr, sc_addr other_addr)
+{
+  search_cache_entry * entry = sc_event_get_data(event);
+  if (entry == null_ptr)
+    return SC_RESULT_OK;
+
+  // answers of questions and system marks are added as system elements, search agents skip them unless argument is
+  // system element
+  if (entry->sys_off == SC_TRUE && SC_ADDR_IS_NOT_EMPTY(other_addr)
+      && SC_ADDR_IS_NOT_EQUAL(other_addr, keynode_system_element) && IS_SYSTEM_ELEMENT(other_addr))
+    return SC_RESULT_OK;
+
+  return _search_cache_invalidate(event);
+}
+
+sc_result _search_cache_on_answer_changed(sc_event const * event, sc_addr connector_addr, sc_addr other_addr)
+{
+  return _search_cache_invalidate(event);
+}
+
+sc_result _search_cache_on_argument_input_arc_added(sc_event const * event, sc_addr connector_addr, sc_addr other_addr)
+{
+  search_cache_entry * entry = sc_event_get_data(event);
+  if (entry == null_ptr)
+    return SC_RESULT_OK;
+
+  // sc-nodes of new questions are connected with their arguments before questions are initiated, so it is checked
+  // whether these sc-nodes are questions when answer is requested
+  sc_type type;
+  if (sc_memory_get_element_type(s_default_ctx, connector_addr, &type) != SC_RESULT_OK
+      || type != sc_type_arc_pos_const_perm)
+    return _search_cache_on_region_changed(event, connector_addr, other_addr);
+
+  sc_monitor_acquire_write(&s_search_cache.monitor);
+  // argument is added into answer structure while answer is searched
+  if (entry->is_valid == SC_TRUE && entry->is_removed == SC_FALSE && SC_ADDR_IS_NOT_EQUAL(other_addr, entry->answer))
+  {
+    if (entry->pending_sources_count < SEARCH_CACHE_MAX_PENDING_SOURCES)
+      entry->pending_sources[entry->pending_sources_count++] = other_addr;
+    else
+    {
+      entry->is_valid = SC_FALSE;
+      ++s_search_cache.invalidations_count;
+    }
+  }
+  sc_monitor_release_write(&s_search_cache.monitor);
+
+  return SC_RESULT_OK;
+}
+
+void _search_cache_subscribe_ex(
+    search_cache_entry * entry,
+    sc_addr element,
+    sc_event_type type,
+    sc_event_callback_ext callback)
+{
+  sc_event * event = sc_event_new_ex(s_default_ctx, element, type, entry, callback, _search_cache_invalidate);
+  if (event != null_ptr)
+    entry->events[entry->events_count++] = event;
+}
+
+void _search_cache_subscribe(search_cache_entry * entry, sc_addr element, sc_event_type type)
+{
+  _search_cache_subscribe_ex(entry, element, type, _search_cache_on_region_changed);
+}
+
+/*! Checks pending sources of memoized answer, cache monitor must not be acquired. Memoized answer is invalidated if
+ * any of them isn't question.
+ * @returns Returns SC_TRUE if all pending sources are initiated questions
+ */
+sc_bool _search_cache_check_pending_sources(sc_uint64 key, sc_addr const * sources, sc_uint32 sources_count)
+{
+  sc_uint32 i;
+  for (i = 0; i < sources_count; ++i)
+  {
+    if (sc_helper_check_arc(s_default_ctx, keynode_question_initiated, sources[i], sc_type_arc_pos_const_perm) == SC_FALSE)
+      break;
+  }
+  sc_bool const are_questions = i == sources_count;
+
+  sc_monitor_acquire_write(&s_search_cache.monitor);
+  search_cache_entry * entry = sc_hash_table_get(s_search_cache.entries, &key);
+  // entry can be replaced while pending sources are checked
+  if (entry != null_ptr && entry->is_valid == SC_TRUE && entry->is_pending == SC_FALSE
+      && entry->pending_sources_count >= sources_count)
+  {
+    if (are_questions == SC_FALSE)
+    {
+      entry->is_valid = SC_FALSE;
+      ++s_search_cache.invalidations_count;
+    }
+    else
+    {
+      // sources added while checking stay pending
+      sc_uint32 const count = entry->pending_sources_count - sources_count;
+      for (i = 0; i < count; ++i)
+        entry->pending_sources[i] = entry->pending_sources[sources_count + i];
+      entry->pending_sources_count = count;
+    }
+  }
+  sc_monitor_release_write(&s_search_cache.monitor);
+
+  return are_questions;
+}
+
+void _search_cache_entry_free(search_cache_entry * entry)
+{
+  // sc-events are destroyed without cache monitor, because their callbacks acquire it
+  for (sc_uint32 i = 0; i < entry->events_count; ++i)
+    sc_event_destroy(entry->events[i]);
+
+  sc_mem_free(entry->events);
+  sc_mem_free(entry);
+}
+
+//! Frees entry taken out of cache, its sc-events destroyed after that don't invalidate it
+void _search_cache_entry_discard(search_cache_entry * entry)
+{
+  sc_monitor_acquire_write(&s_search_cache.monitor);
+  entry->is_removed = SC_TRUE;
+  sc_monitor_release_write(&s_search_cache.monitor);
+
+  _search_cache_entry_free(entry);
+}
+
+//! Removes entry from cache, cache monitor must be acquired. Entry must be freed after cache monitor is released
+void _search_cache_remove(search_cache_entry * entry)
+{
+  entry->is_removed = SC_TRUE;
+  sc_hash_table_remove(s_search_cache.entries, &entry->key);
+}
+
+/*! Removes all invalid entries or all entries from cache, cache monitor must be acquired. Removed entries must be
+ * freed after cache monitor is released.
+ * @param only_invalid SC_TRUE to remove only invalid entries
+ * @param[out] removed_count Amount of removed entries
+ * @returns Returns array of removed entries
+ */
+search_cache_entry ** _search_cache_remove_all(sc_bool only_invalid, sc_uint32 * removed_count)
+{
+  search_cache_entry ** removed_entries = sc_mem_new(search_cache_entry *, sc_hash_table_size(s_search_cache.entries));
+  *removed_count = 0;
+
+  sc_hash_table_iterator iterator;
+  sc_pointer key, value;
+  sc_hash_table_iterator_init(&iterator, s_search_cache.entries);
+  while (sc_hash_table_iterator_next(&iterator, &key, &value))
+  {
+    search_cache_entry * entry = value;
+    if (only_invalid == SC_TRUE && entry->is_valid == SC_TRUE)
+      continue;
+
+    entry->is_removed = SC_TRUE;
+    removed_entries[(*removed_count)++] = entry;
+    sc_hash_table_iterator_remove(&iterator);
+  }
+
+  return removed_entries;
+}
+
+void _search_cache_free_removed(search_cache_entry ** removed_entries, sc_uint32 removed_count)
+{
+  for (sc_uint32 i = 0; i < removed_count; ++i)
+    _search_cache_entry_free(removed_entries[i]);
+  sc_mem_free(removed_entries);
+}
+
+/*! Creates entry for question with specified class and argument before its answer is searched. Argument is subscribed
+ * to before search, so its changes made while answer is searched invalidate entry.
+ */
+search_cache_entry * _search_cache_entry_new(sc_uint64 key, sc_uint64 search_id, sc_addr argument)
+{
+  search_cache_entry * entry = sc_mem_new(search_cache_entry, 1);
+  entry->key = key;
+  entry->search_id = search_id;
+  SC_ADDR_MAKE_EMPTY(entry->answer);
+  entry->pending_sources_count = 0;
+  entry->sys_off = SC_FALSE;
+  entry->is_valid = SC_TRUE;
+  entry->is_pending = SC_TRUE;
+  entry->is_removed = SC_FALSE;
+
+  entry->events = sc_mem_new(sc_event *, SEARCH_CACHE_ARGUMENT_EVENTS_COUNT);
+  entry->events_count = 0;
+  _search_cache_subscribe(entry, argument, SC_EVENT_ADD_OUTPUT_ARC);
+  _search_cache_subscribe_ex(entry, argument, SC_EVENT_ADD_INPUT_ARC, _search_cache_on_argument_input_arc_added);
+  _search_cache_subscribe(entry, argument, SC_EVENT_REMOVE_OUTPUT_ARC);
+  _search_cache_subscribe(entry, argument, SC_EVENT_REMOVE_INPUT_ARC);
+  _search_cache_subscribe(entry, argument, SC_EVENT_CONTENT_CHANGED);
+
+  return entry;
+}
+
+/*! Inserts entry into cache if there is no other entry with the same key, invalid entries are removed if cache is
+ * full. Memoized answer replaces pending entry with the same key, because that answer is searched later.
+ * @returns Returns SC_TRUE if entry is inserted, otherwise it must be freed by caller
+ */
+sc_bool _search_cache_insert(search_cache_entry * entry)
+{
+  search_cache_entry ** removed_entries = null_ptr;
+  sc_uint32 removed_count = 0;
+  search_cache_entry * replaced_entry = null_ptr;
+
+  sc_monitor_acquire_write(&s_search_cache.monitor);
+  if (s_search_cache.enabled == SC_TRUE && sc_hash_table_size(s_search_cache.entries) >= SEARCH_CACHE_MAX_ENTRIES_COUNT)
+    removed_entries = _search_cache_remove_all(SC_TRUE, &removed_count);
+
+  search_cache_entry * const existing_entry = sc_hash_table_get(s_search_cache.entries, &entry->key);
+  if (s_search_cache.enabled == SC_TRUE && entry->is_pending == SC_FALSE && entry->is_valid == SC_TRUE
+      && existing_entry != null_ptr && existing_entry->is_pending == SC_TRUE)
+  {
+    replaced_entry = existing_entry;
+    _search_cache_remove(existing_entry);
+  }
+
+  sc_bool const is_inserted = s_search_cache.enabled == SC_TRUE && entry->is_valid == SC_TRUE
+                              && sc_hash_table_size(s_search_cache.entries) < SEARCH_CACHE_MAX_ENTRIES_COUNT
+                              && sc_hash_table_get(s_search_cache.entries, &entry->key) == null_ptr;
+  if (is_inserted == SC_TRUE)
+    sc_hash_table_insert(s_search_cache.entries, &entry->key, entry);
+  else
+    entry->is_removed = SC_TRUE;
+  sc_monitor_release_write(&s_search_cache.monitor);
+
+  _search_cache_free_removed(removed_entries, removed_count);
+  if (replaced_entry != null_ptr)
+    _search_cache_entry_free(replaced_entry);
+
+  return is_inserted;
+}
+
+void search_cache_initialize()
+{
+  s_search_cache.enabled = SC_FALSE;
+  s_search_cache.entries = sc_hash_table_init(g_int64_hash, g_int64_equal, null_ptr, null_ptr);
+  sc_monitor_init(&s_search_cache.monitor);
+  s_search_cache.last_search_id = 0;
+
+  s_search_cache.hits_count = 0;
+  s_search_cache.misses_count = 0;
+  s_search_cache.invalidations_count = 0;
+  s_search_cache.total_hit_time = 0;
+  s_search_cache.total_miss_time = 0;
+}
+
+void search_cache_shutdown()
+{
+  search_cache_set_enabled(SC_FALSE);
+
+  sc_hash_table_destroy(s_search_cache.entries);
+  s_search_cache.entries = null_ptr;
+  sc_monitor_destroy(&s_search_cache.monitor);
+}
+
+void search_cache_set_enabled(sc_bool enabled)
+{
+  search_cache_entry ** removed_entries = null_ptr;
+  sc_uint32 removed_count = 0;
+
+  sc_monitor_acquire_write(&s_search_cache.monitor);
+  s_search_cache.enabled = enabled;
+  if (enabled == SC_FALSE)
+    removed_entries = _search_cache_remove_all(SC_FALSE, &removed_count);
+  sc_monitor_release_write(&s_search_cache.monitor);
+
+  _search_cache_free_removed(removed_entries, removed_count);
+}
+
+void search_cache_get_stat(search_cache_stat * stat)
+{
+  sc_monitor_acquire_read(&s_search_cache.monitor);
+  stat->entries_count = s_search_cache.entries == null_ptr ? 0 : sc_hash_table_size(s_search_cache.entries);
+  stat->hits_count = s_search_cache.hits_count;
+  stat->misses_count = s_search_cache.misses_count;
+  stat->invalidations_count = s_search_cache.invalidations_count;
+  stat->average_hit_time = s_search_cache.hits_count == 0 ? 0 : s_search_cache.total_hit_time / s_search_cache.hits_count;
+  stat->average_miss_time =
+      s_search_cache.misses_count == 0 ? 0 : s_search_cache.total_miss_time / s_search_cache.misses_count;
+  sc_monitor_release_read(&s_search_cache.monitor);
+}
+
+sc_bool search_cache_answer_question(
+    sc_addr question_class,
+    sc_addr question,
+    sc_addr argument,
+    sc_int64 * start_time,
+    sc_uint64 * search_id)
+{
+  *start_time = g_get_monotonic_time();
+  *search_id = 0;
+
+  sc_uint64 const key = SEARCH_CACHE_KEY(question_class, argument);
+  search_cache_entry * invalid_entry = null_ptr;
+  sc_addr answer;
+  SC_ADDR_MAKE_EMPTY(answer);
+  sc_addr pending_sources[SEARCH_CACHE_MAX_PENDING_SOURCES];
+  sc_uint32 pending_sources_count = 0;
+
+  sc_monitor_acquire_write(&s_search_cache.monitor);
+  if (s_search_cache.enabled == SC_FALSE)
+  {
+    sc_monitor_release_write(&s_search_cache.monitor);
+    return SC_FALSE;
+  }
+
+  search_cache_entry * entry = sc_hash_table_get(s_search_cache.entries, &key);
+  sc_bool const is_searched = entry != null_ptr && entry->is_pending == SC_TRUE && entry->is_valid == SC_TRUE;
+  if (entry != null_ptr && entry->is_pending == SC_FALSE && entry->is_valid == SC_TRUE)
+  {
+    answer = entry->answer;
+    pending_sources_count = entry->pending_sources_count;
+    for (sc_uint32 i = 0; i < pending_sources_count; ++i)
+      pending_sources[i] = entry->pending_sources[i];
+  }
+  else
+  {
+    if (entry != null_ptr && is_searched == SC_FALSE)
+    {
+      invalid_entry = entry;
+      _search_cache_remove(entry);
+    }
+    ++s_search_cache.misses_count;
+    *search_id = is_searched == SC_TRUE ? entry->search_id : ++s_search_cache.last_search_id;
+  }
+  sc_monitor_release_write(&s_search_cache.monitor);
+
+  if (invalid_entry != null_ptr)
+    _search_cache_entry_free(invalid_entry);
+
+  if (SC_ADDR_IS_EMPTY(answer))
+  {
+    // answer of the same question can be being searched by another agent, then its entry is used
+    if (is_searched == SC_FALSE)
+    {
+      search_cache_entry * pending_entry = _search_cache_entry_new(key, *search_id, argument);
+      if (_search_cache_insert(pending_entry) == SC_FALSE)
+        _search_cache_entry_free(pending_entry);
+    }
+    return SC_FALSE;
+  }
+
+  if (pending_sources_count != 0
+      && _search_cache_check_pending_sources(key, pending_sources, pending_sources_count) == SC_FALSE)
+  {
+    // memoized answer is removed on the next request
+    sc_monitor_acquire_write(&s_search_cache.monitor);
+    ++s_search_cache.misses_count;
+    sc_monitor_release_write(&s_search_cache.monitor);
+    return SC_FALSE;
+  }
+
+  connect_answer_to_question(question, answer);
+  finish_question(question);
+
+  sc_uint64 const hit_time = g_get_monotonic_time() - *start_time;
+  sc_monitor_acquire_write(&s_search_cache.monitor);
+  ++s_search_cache.hits_count;
+  s_search_cache.total_hit_time += hit_time;
+  sc_monitor_release_write(&s_search_cache.monitor);
+
+  return SC_TRUE;
+}
+
+void search_cache_add_answer(
+    sc_addr question_class,
+    sc_addr argument,
+    sc_addr answer,
+    sc_bool sys_off,
+    sc_int64 start_time,
+    sc_uint64 search_id)
+{
+  sc_monitor_acquire_write(&s_search_cache.monitor);
+  sc_bool const enabled = s_search_cache.enabled;
+  if (enabled == SC_TRUE)
+    s_search_cache.total_miss_time += g_get_monotonic_time() - start_time;
+  sc_monitor_release_write(&s_search_cache.monitor);
+
+  if (enabled == SC_FALSE)
+    return;
+
+  // entry is taken out of cache while its region is subscribed to, so it isn't freed by other agents
+  sc_uint64 const key = SEARCH_CACHE_KEY(question_class, argument);
+  search_cache_entry * invalid_entry = null_ptr;
+  sc_monitor_acquire_write(&s_search_cache.monitor);
+  search_cache_entry * entry = sc_hash_table_get(s_search_cache.entries, &key);
+  if (entry != null_ptr && entry->is_pending == SC_TRUE && entry->search_id == search_id
+      && entry->is_valid == SC_FALSE)
+  {
+    _search_cache_remove(entry);
+    invalid_entry = entry;
+    entry = null_ptr;
+  }
+  else if (entry != null_ptr && entry->is_pending == SC_TRUE && entry->search_id == search_id)
+  {
+    sc_hash_table_remove(s_search_cache.entries, &entry->key);
+    entry->answer = answer;
+    entry->sys_off = sys_off;
+
+    // arc from answer structure to argument can be added to pending sources before answer is known
+    sc_uint32 pending_sources_count = 0;
+    for (sc_uint32 i = 0; i < entry->pending_sources_count; ++i)
+    {
+      if (SC_ADDR_IS_NOT_EQUAL(entry->pending_sources[i], answer))
+        entry->pending_sources[pending_sources_count++] = entry->pending_sources[i];
+    }
+    entry->pending_sources_count = pending_sources_count;
+  }
+  else
+    entry = null_ptr;
+  sc_monitor_release_write(&s_search_cache.monitor);
+
+  if (invalid_entry != null_ptr)
+    _search_cache_entry_free(invalid_entry);
+
+  // answer is memoized only if nothing has been changed in argument since its search was started
+  if (entry == null_ptr)
+    return;
+
+  // collect region of answer: sc-connectors traversed by search and sc-elements they connect
+  sc_addr * region = sc_mem_new(sc_addr, SEARCH_CACHE_MAX_ANSWER_SIZE);
+  sc_type * region_types = sc_mem_new(sc_type, SEARCH_CACHE_MAX_ANSWER_SIZE);
+  sc_uint32 region_size = 0;
+  sc_uint32 answer_size = 0;
+  sc_uint32 events_count = entry->events_count + 2;
+  sc_iterator3 * it = sc_iterator3_f_a_a_new(s_default_ctx, answer, sc_type_arc_pos_const_perm, 0);
+  while (sc_iterator3_next(it) == SC_TRUE)
+  {
+    if (++answer_size > SEARCH_CACHE_MAX_ANSWER_SIZE)
+      break;
+
+    sc_addr const element = sc_iterator3_value(it, 2);
+    sc_type type;
+    if (SC_ADDR_IS_EQUAL(element, argument)
+        || sc_memory_get_element_type(s_default_ctx, element, &type) != SC_RESULT_OK)
+      continue;
+
+    region[region_size] = element;
+    region_types[region_size++] = type;
+    if (type & sc_type_arc_mask)
+      events_count += 1;
+    else
+      events_count += (type & sc_type_link) ? 3 : 2;
+  }
+  sc_iterator3_free(it);
+
+  if (answer_size > SEARCH_CACHE_MAX_ANSWER_SIZE)
+  {
+    sc_mem_free(region_types);
+    sc_mem_free(region);
+    _search_cache_entry_discard(entry);
+    return;
+  }
+
+  // sc-connectors added to sc-elements of region can extend answer, but only removal of traversed sc-connectors can
+  // reduce it, so other sc-connectors removed from sc-elements of region don't invalidate it
+  entry->events = sc_mem_realloc(entry->events, events_count, sizeof(sc_event *));
+  for (sc_uint32 i = 0; i < region_size; ++i)
+  {
+    if (region_types[i] & sc_type_arc_mask)
+    {
+      _search_cache_subscribe_ex(entry, region[i], SC_EVENT_REMOVE_ELEMENT, _search_cache_on_answer_changed);
+      continue;
+    }
+
+    _search_cache_subscribe(entry, region[i], SC_EVENT_ADD_OUTPUT_ARC);
+    _search_cache_subscribe(entry, region[i], SC_EVENT_ADD_INPUT_ARC);
+    if (region_types[i] & sc_type_link)
+      _search_cache_subscribe(entry, region[i], SC_EVENT_CONTENT_CHANGED);
+  }
+  // any sc-element added to or removed from answer structure changes memoized answer
+  _search_cache_subscribe_ex(entry, answer, SC_EVENT_ADD_OUTPUT_ARC, _search_cache_on_answer_changed);
+  _search_cache_subscribe_ex(entry, answer, SC_EVENT_REMOVE_OUTPUT_ARC, _search_cache_on_answer_changed);
+
+  // traversed sc-connectors can be removed after they are found, but before they are subscribed to
+  sc_bool are_connectors_found = SC_TRUE;
+  for (sc_uint32 i = 0; i < region_size && are_connectors_found == SC_TRUE; ++i)
+  {
+    if (region_types[i] & sc_type_arc_mask)
+      are_connectors_found = sc_memory_is_element(s_default_ctx, region[i]);
+  }
+  sc_mem_free(region_types);
+  sc_mem_free(region);
+
+  sc_monitor_acquire_write(&s_search_cache.monitor);
+  if (are_connectors_found == SC_FALSE)
+    entry->is_valid = SC_FALSE;
+  entry->is_pending = SC_FALSE;
+  sc_monitor_release_write(&s_search_cache.monitor);
+
+  if (_search_cache_insert(entry) == SC_FALSE)
+    _search_cache_entry_free(entry);
+}
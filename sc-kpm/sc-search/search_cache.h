@@ -0,0 +1,84 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _search_cache_h_
+#define _search_cache_h_
+
+#include "sc-core/sc_memory.h"
+
+//! Maximum amount of answers that can be memoized at the same time
+#define SEARCH_CACHE_MAX_ENTRIES_COUNT 1024
+//! Maximum amount of sc-elements in answer that can be memoized, answers with more sc-elements are not memoized
+#define SEARCH_CACHE_MAX_ANSWER_SIZE 4096
+
+/*! Structure to store statistics of memoized answers of search agents
+ */
+typedef struct _search_cache_stat
+{
+  sc_uint64 entries_count;        // amount of memoized answers
+  sc_uint64 hits_count;           // amount of questions answered by memoized answers
+  sc_uint64 misses_count;         // amount of questions answered by search
+  sc_uint64 invalidations_count;  // amount of memoized answers invalidated by changes of their regions
+  sc_uint64 average_hit_time;     // average time of answering by memoized answer in microseconds
+  sc_uint64 average_miss_time;    // average time of answering by search in microseconds
+} search_cache_stat;
+
+void search_cache_initialize();
+
+void search_cache_shutdown();
+
+/*! Enables or disables memoization of search agents answers. It is disabled by default. Memoized answers are removed
+ * when memoization is disabled.
+ * @param enabled SC_TRUE to enable memoization
+ */
+_SC_EXT_EXTERN void search_cache_set_enabled(sc_bool enabled);
+
+/*! Collects statistics of memoized answers.
+ * @param[out] stat A pointer to structure to store statistics
+ */
+_SC_EXT_EXTERN void search_cache_get_stat(search_cache_stat * stat);
+
+/*! Answers question by memoized answer of question with the same class and argument, if nothing has been changed in
+ * region of this answer since it was memoized. Question is connected with memoized answer structure and is finished.
+ * Memoized answer structure is shared by all questions answered by it, changes of this structure invalidate memoized
+ * answer, so the next question is answered by search with new answer structure.
+ * @param question_class sc-addr of question class
+ * @param question sc-addr of question node
+ * @param argument sc-addr of question argument
+ * @param[out] start_time Time when question answering started, it should be passed to `search_cache_add_answer`
+ * @param[out] search_id Id of search of answer, it should be passed to `search_cache_add_answer`. Argument is
+ * subscribed to before search, so answer isn't memoized if argument is changed while answer is searched.
+ * @returns Returns SC_TRUE if question is answered, otherwise question should be answered by search
+ */
+sc_bool search_cache_answer_question(
+    sc_addr question_class,
+    sc_addr question,
+    sc_addr argument,
+    sc_int64 * start_time,
+    sc_uint64 * search_id);
+
+/*! Memoizes answer of question with specified class and argument. Region of answer is argument, sc-connectors of
+ * answer structure and other its sc-elements. Memoized answer is invalidated when sc-connectors are added to or removed
+ * from argument, sc-connectors are added to other sc-elements of region, sc-connectors of region are erased, contents
+ * of sc-links of region are changed, or when answer structure itself is changed. Arcs from nodes of new questions to
+ * argument don't invalidate it. Answer isn't memoized if any sc-connector of region is erased before it is memoized.
+ * @param question_class sc-addr of question class
+ * @param argument sc-addr of question argument
+ * @param answer sc-addr of answer structure
+ * @param sys_off SC_TRUE if system elements were skipped by search of answer, then sc-connectors with system elements
+ * don't invalidate it
+ * @param start_time Time got from `search_cache_answer_question`
+ * @param search_id Id of search got from `search_cache_answer_question`
+ */
+void search_cache_add_answer(
+    sc_addr question_class,
+    sc_addr argument,
+    sc_addr answer,
+    sc_bool sys_off,
+    sc_int64 start_time,
+    sc_uint64 search_id);
+
+#endif
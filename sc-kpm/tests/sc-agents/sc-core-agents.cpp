@@ -7,6 +7,7 @@ extern "C"
 #include "sc-search/search.h"
 #include "sc-search/search_keynodes.h"
 #include "sc-search/search_agents.h"
+#include "sc-search/search_cache.h"
 #include "sc-utils/utils_keynodes.h"
 }
 
@@ -561,3 +562,139 @@ TEST_F(ScMemoryTest, agent_search_decomposition)
 
   sc_module_shutdown();
 }
+
+sc_addr test_get_question_answer(sc_memory_context * context, sc_addr const question)
+{
+  sc_addr answer;
+  SC_ADDR_MAKE_EMPTY(answer);
+
+  sc_iterator5 * it5 = sc_iterator5_f_a_a_a_f_new(
+      context,
+      question,
+      sc_type_arc_common | sc_type_const,
+      sc_type_node | sc_type_const,
+      sc_type_arc_pos_const_perm,
+      keynode_nrel_answer);
+  if (sc_iterator5_next(it5))
+    answer = sc_iterator5_value(it5, 2);
+  sc_iterator5_free(it5);
+
+  return answer;
+}
+
+sc_addr test_ask_decomposition_question(sc_memory_context * context, sc_addr const setAddr)
+{
+  sc_addr const question = sc_memory_node_new(context, sc_type_node | sc_type_const);
+  sc_memory_arc_new(context, sc_type_arc_pos_const_perm, question, setAddr);
+  sc_memory_arc_new(context, sc_type_arc_pos_const_perm, keynode_question_decomposition, question);
+  sc_memory_arc_new(context, sc_type_arc_pos_const_perm, keynode_question_initiated, question);
+
+  sleep(2);
+  EXPECT_TRUE(sc_helper_check_arc(context, keynode_question_finished, question, sc_type_arc_pos_const_perm));
+  return test_get_question_answer(context, question);
+}
+
+TEST_F(ScMemoryTest, agent_search_decomposition_with_memoized_answers)
+{
+  sc_memory_context * context = m_ctx->GetRealContext();
+
+  sc_addr init_memory_generated_structure;
+  SC_ADDR_MAKE_EMPTY(init_memory_generated_structure);
+
+  EXPECT_EQ(sc_module_initialize_with_init_memory_generated_structure(init_memory_generated_structure), SC_RESULT_OK);
+  search_cache_set_enabled(SC_TRUE);
+
+  sc_addr const setAddr = sc_memory_node_new(context, sc_type_node | sc_type_const);
+
+  sc_addr const noroleAddr = sc_memory_node_new(context, sc_type_node | sc_type_const | sc_type_node_norole);
+  sc_memory_arc_new(context, sc_type_arc_pos_const_perm, keynode_decomposition_relation, noroleAddr);
+
+  sc_addr const decompositionAddr = sc_memory_node_new(context, sc_type_node | sc_type_const);
+  sc_addr const edge1 = sc_memory_arc_new(context, sc_type_arc_common | sc_type_const, decompositionAddr, setAddr);
+  sc_memory_arc_new(context, sc_type_arc_pos_const_perm, noroleAddr, edge1);
+
+  sc_addr const addr1 = sc_memory_node_new(context, sc_type_node | sc_type_const);
+  sc_memory_arc_new(context, sc_type_arc_pos_const_perm, decompositionAddr, addr1);
+
+  sc_addr const answer1 = test_ask_decomposition_question(context, setAddr);
+  EXPECT_TRUE(SC_ADDR_IS_NOT_EMPTY(answer1));
+
+  sc_addr const answer2 = test_ask_decomposition_question(context, setAddr);
+  EXPECT_TRUE(SC_ADDR_IS_EQUAL(answer1, answer2));
+
+  search_cache_stat stat;
+  search_cache_get_stat(&stat);
+  EXPECT_EQ(stat.entries_count, 1u);
+  EXPECT_EQ(stat.hits_count, 1u);
+  EXPECT_EQ(stat.misses_count, 1u);
+
+  sc_addr const addr2 = sc_memory_node_new(context, sc_type_node | sc_type_const);
+  sc_memory_arc_new(context, sc_type_arc_pos_const_perm, decompositionAddr, addr2);
+  sleep(1);
+
+  sc_addr const answer3 = test_ask_decomposition_question(context, setAddr);
+  EXPECT_TRUE(SC_ADDR_IS_NOT_EMPTY(answer3));
+  EXPECT_TRUE(SC_ADDR_IS_NOT_EQUAL(answer1, answer3));
+  EXPECT_TRUE(sc_helper_check_arc(context, answer3, addr2, sc_type_arc_pos_const_perm));
+
+  search_cache_get_stat(&stat);
+  EXPECT_EQ(stat.hits_count, 1u);
+  EXPECT_EQ(stat.misses_count, 2u);
+  EXPECT_GE(stat.invalidations_count, 1u);
+
+  search_cache_set_enabled(SC_FALSE);
+  search_cache_get_stat(&stat);
+  EXPECT_EQ(stat.entries_count, 0u);
+
+  sc_module_shutdown();
+}
+
+TEST_F(ScMemoryTest, agent_search_decomposition_with_shared_memoized_answer)
+{
+  sc_memory_context * context = m_ctx->GetRealContext();
+
+  sc_addr init_memory_generated_structure;
+  SC_ADDR_MAKE_EMPTY(init_memory_generated_structure);
+
+  EXPECT_EQ(sc_module_initialize_with_init_memory_generated_structure(init_memory_generated_structure), SC_RESULT_OK);
+  search_cache_set_enabled(SC_TRUE);
+
+  sc_addr const setAddr = sc_memory_node_new(context, sc_type_node | sc_type_const);
+
+  sc_addr const noroleAddr = sc_memory_node_new(context, sc_type_node | sc_type_const | sc_type_node_norole);
+  sc_memory_arc_new(context, sc_type_arc_pos_const_perm, keynode_decomposition_relation, noroleAddr);
+
+  sc_addr const decompositionAddr = sc_memory_node_new(context, sc_type_node | sc_type_const);
+  sc_addr const edge1 = sc_memory_arc_new(context, sc_type_arc_common | sc_type_const, decompositionAddr, setAddr);
+  sc_memory_arc_new(context, sc_type_arc_pos_const_perm, noroleAddr, edge1);
+
+  sc_addr const addr1 = sc_memory_node_new(context, sc_type_node | sc_type_const);
+  sc_memory_arc_new(context, sc_type_arc_pos_const_perm, decompositionAddr, addr1);
+
+  sc_addr const answer1 = test_ask_decomposition_question(context, setAddr);
+  EXPECT_TRUE(SC_ADDR_IS_NOT_EMPTY(answer1));
+
+  // the same answer structure is connected with both questions
+  sc_addr const answer2 = test_ask_decomposition_question(context, setAddr);
+  EXPECT_TRUE(SC_ADDR_IS_EQUAL(answer1, answer2));
+
+  // change of shared answer structure by one of questions authors isn't seen by the next question
+  sc_addr const foreignAddr = sc_memory_node_new(context, sc_type_node | sc_type_const);
+  sc_memory_arc_new(context, sc_type_arc_pos_const_perm, answer1, foreignAddr);
+  sleep(1);
+
+  sc_addr const answer3 = test_ask_decomposition_question(context, setAddr);
+  EXPECT_TRUE(SC_ADDR_IS_NOT_EMPTY(answer3));
+  EXPECT_TRUE(SC_ADDR_IS_NOT_EQUAL(answer1, answer3));
+  EXPECT_FALSE(sc_helper_check_arc(context, answer3, foreignAddr, sc_type_arc_pos_const_perm));
+  EXPECT_TRUE(sc_helper_check_arc(context, answer3, addr1, sc_type_arc_pos_const_perm));
+
+  search_cache_stat stat;
+  search_cache_get_stat(&stat);
+  EXPECT_EQ(stat.hits_count, 1u);
+  EXPECT_EQ(stat.misses_count, 2u);
+  EXPECT_GE(stat.invalidations_count, 1u);
+
+  search_cache_set_enabled(SC_FALSE);
+  sc_module_shutdown();
+}
@@ -0,0 +1,59 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_allocator.h"
+
+#include "sc_atomic.h"
+
+static gsize allocations_live_bytes[SC_ALLOCATIONS_SUBSYSTEMS_COUNT];
+static gsize allocations_live_objects[SC_ALLOCATIONS_SUBSYSTEMS_COUNT];
+
+static sc_char const * allocations_subsystems_names[SC_ALLOCATIONS_SUBSYSTEMS_COUNT] = {
+    "segments",
+    "dictionaries",
+    "monitors",
+    "events",
+    "contexts",
+    "server sessions",
+};
+
+void sc_mem_account_new(sc_allocations_subsystem subsystem, sc_uint64 objects_count, sc_uint64 bytes_count)
+{
+  if (subsystem < 0 || subsystem >= SC_ALLOCATIONS_SUBSYSTEMS_COUNT)
+    return;
+
+  sc_atomic_pointer_add(&allocations_live_objects[subsystem], (gssize)objects_count);
+  sc_atomic_pointer_add(&allocations_live_bytes[subsystem], (gssize)bytes_count);
+}
+
+void sc_mem_account_free(sc_allocations_subsystem subsystem, sc_uint64 objects_count, sc_uint64 bytes_count)
+{
+  if (subsystem < 0 || subsystem >= SC_ALLOCATIONS_SUBSYSTEMS_COUNT)
+    return;
+
+  sc_atomic_pointer_add(&allocations_live_objects[subsystem], -(gssize)objects_count);
+  sc_atomic_pointer_add(&allocations_live_bytes[subsystem], -(gssize)bytes_count);
+}
+
+void sc_mem_get_allocations_stat(sc_allocations_stat * stat)
+{
+  if (stat == null_ptr)
+    return;
+
+  for (sc_uint32 i = 0; i < SC_ALLOCATIONS_SUBSYSTEMS_COUNT; ++i)
+  {
+    stat->live_objects[i] = (sc_uint64)(gsize)sc_atomic_pointer_get(&allocations_live_objects[i]);
+    stat->live_bytes[i] = (sc_uint64)(gsize)sc_atomic_pointer_get(&allocations_live_bytes[i]);
+  }
+}
+
+sc_char const * sc_mem_get_allocations_subsystem_name(sc_allocations_subsystem subsystem)
+{
+  if (subsystem < 0 || subsystem >= SC_ALLOCATIONS_SUBSYSTEMS_COUNT)
+    return "unknown";
+
+  return allocations_subsystems_names[subsystem];
+}
@@ -10,6 +10,8 @@
 #include <glib.h>
 #include <memory.h>
 
+#include "../sc_types.h"
+
 typedef gpointer sc_pointer;
 typedef gconstpointer sc_const_pointer;
 
@@ -23,4 +25,41 @@ typedef gconstpointer sc_const_pointer;
 
 #define sc_mem_free(pointer) g_free((sc_pointer)pointer)
 
+/*!
+ * @brief Accounts allocation of objects of the specified subsystem.
+ * @param subsystem A subsystem which objects are allocated.
+ * @param objects_count A count of allocated objects.
+ * @param bytes_count A count of allocated bytes.
+ * @note This function is thread-safe.
+ */
+_SC_EXTERN void sc_mem_account_new(
+    sc_allocations_subsystem subsystem,
+    sc_uint64 objects_count,
+    sc_uint64 bytes_count);
+
+/*!
+ * @brief Accounts freeing of objects of the specified subsystem.
+ * @param subsystem A subsystem which objects are freed.
+ * @param objects_count A count of freed objects.
+ * @param bytes_count A count of freed bytes.
+ * @note This function is thread-safe.
+ */
+_SC_EXTERN void sc_mem_account_free(
+    sc_allocations_subsystem subsystem,
+    sc_uint64 objects_count,
+    sc_uint64 bytes_count);
+
+/*!
+ * @brief Gets live bytes and objects counts of all accounted subsystems.
+ * @param stat A pointer to structure to store counts.
+ */
+_SC_EXTERN void sc_mem_get_allocations_stat(sc_allocations_stat * stat);
+
+/*!
+ * @brief Gets name of the specified subsystem to be used in logs and reports.
+ * @param subsystem A subsystem which name is got.
+ * @returns Returns name of subsystem or "unknown" if it is not valid.
+ */
+_SC_EXTERN sc_char const * sc_mem_get_allocations_subsystem_name(sc_allocations_subsystem subsystem);
+
 #endif
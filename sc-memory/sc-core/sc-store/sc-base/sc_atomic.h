@@ -43,4 +43,19 @@
 
 #define sc_atomic_pointer_xor(atomic, val) g_atomic_pointer_xor(atomic, val)
 
+//! Loads value without ordering, it is used for data guarded by other atomic values
+#define sc_atomic_load_relaxed(atomic) __atomic_load_n(atomic, __ATOMIC_RELAXED)
+
+//! Orders previous loads before next loads and stores
+#define sc_atomic_thread_fence_acquire() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+
+//! Hints processor that thread is spinning in wait loop
+#if defined(__x86_64__) || defined(__i386__)
+#  define sc_atomic_spin_pause() __builtin_ia32_pause()
+#elif defined(__aarch64__)
+#  define sc_atomic_spin_pause() __asm__ __volatile__("yield")
+#else
+#  define sc_atomic_spin_pause() ((void)0)
+#endif
+
 #endif
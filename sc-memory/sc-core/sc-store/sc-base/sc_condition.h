@@ -15,6 +15,8 @@ typedef GCond sc_condition;
 
 #define sc_cond_wait(condition, mutex) g_cond_wait(condition, mutex)
 
+#define sc_cond_wait_until(condition, mutex, end_time) g_cond_wait_until(condition, mutex, end_time)
+
 #define sc_cond_signal(condition) g_cond_signal(condition)
 
 #define sc_cond_broadcast(condition) g_cond_broadcast(condition)
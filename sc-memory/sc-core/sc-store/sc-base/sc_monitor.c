@@ -5,6 +5,7 @@
  */
 
 #include "sc_monitor.h"
+#include "sc_monitor_profiler.h"
 #include "sc_allocator.h"
 
 #define SC_MONITOR_FREE_PERIOD_CHECK 10
@@ -19,6 +20,7 @@ void sc_monitor_init(sc_monitor * monitor)
 {
   sc_mutex_init(&monitor->rw_mutex);
   monitor->id = 1;
+  monitor->addr_hash = 0;
   monitor->active_readers = 0;
   monitor->active_writer = 0;
   sc_queue_init(&monitor->queue);
@@ -75,8 +77,14 @@ void sc_monitor_acquire_read(sc_monitor * monitor)
 
   sc_request current_request = (sc_request){.thread = sc_thread_self()};
   sc_cond_init(&current_request.condition);
+  sc_uint32 const waiters_count = (sc_uint32)monitor->queue.size;
   sc_queue_push(&monitor->queue, &current_request);
 
+  // contended acquisitions are sampled only, so uncontended ones aren't slowed down
+  sc_int64 wait_start_time = 0;
+  if (sc_queue_front(&monitor->queue) != &current_request || monitor->active_writer)
+    wait_start_time = _sc_monitor_profiler_start_wait(monitor);
+
   while (sc_queue_front(&monitor->queue) != &current_request || monitor->active_writer)
     sc_cond_wait(&current_request.condition, &monitor->rw_mutex);
 
@@ -85,6 +93,9 @@ void sc_monitor_acquire_read(sc_monitor * monitor)
   ++monitor->active_readers;
 
   sc_mutex_unlock(&monitor->rw_mutex);
+
+  if (wait_start_time != 0)
+    _sc_monitor_profiler_end_wait(monitor, wait_start_time, waiters_count);
 }
 
 void sc_monitor_release_read(sc_monitor * monitor)
@@ -117,8 +128,14 @@ void sc_monitor_acquire_write(sc_monitor * monitor)
 
   sc_request current_request = (sc_request){.thread = sc_thread_self()};
   sc_cond_init(&current_request.condition);
+  sc_uint32 const waiters_count = (sc_uint32)monitor->queue.size;
   sc_queue_push(&monitor->queue, &current_request);
 
+  // contended acquisitions are sampled only, so uncontended ones aren't slowed down
+  sc_int64 wait_start_time = 0;
+  if (sc_queue_front(&monitor->queue) != &current_request || monitor->active_writer || monitor->active_readers > 0)
+    wait_start_time = _sc_monitor_profiler_start_wait(monitor);
+
   while (sc_queue_front(&monitor->queue) != &current_request || monitor->active_writer || monitor->active_readers > 0)
     sc_cond_wait(&current_request.condition, &monitor->rw_mutex);
 
@@ -127,6 +144,9 @@ void sc_monitor_acquire_write(sc_monitor * monitor)
   monitor->active_writer = 1;
 
   sc_mutex_unlock(&monitor->rw_mutex);
+
+  if (wait_start_time != 0)
+    _sc_monitor_profiler_end_wait(monitor, wait_start_time, waiters_count);
 }
 
 void sc_monitor_release_write(sc_monitor * monitor)
@@ -280,3 +300,34 @@ void sc_monitor_release_write_n(sc_uint32 n, ...)
 
   va_end(args);
 }
+
+sc_uint32 sc_monitor_acquire_write_array(sc_monitor ** monitors, sc_uint32 n)
+{
+  sc_uint32 unique_count = 0;
+  for (sc_uint32 i = 0; i < n; ++i)
+  {
+    if (monitors[i] != null_ptr)
+      monitors[unique_count++] = monitors[i];
+  }
+
+  qsort(monitors, unique_count, sizeof(sc_monitor *), compare_monitors);
+
+  n = unique_count;
+  unique_count = 0;
+  for (sc_uint32 i = 0; i < n; ++i)
+  {
+    if (unique_count == 0 || monitors[unique_count - 1]->id != monitors[i]->id)
+      monitors[unique_count++] = monitors[i];
+  }
+
+  for (sc_uint32 i = 0; i < unique_count; ++i)
+    sc_monitor_acquire_write(monitors[i]);
+
+  return unique_count;
+}
+
+void sc_monitor_release_write_array(sc_monitor ** monitors, sc_uint32 n)
+{
+  for (sc_int32 i = (sc_int32)n - 1; i >= 0; --i)
+    sc_monitor_release_write(monitors[i]);
+}
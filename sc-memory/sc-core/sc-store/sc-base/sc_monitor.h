@@ -22,6 +22,7 @@ typedef struct
   sc_uint32 active_readers;  // Number of readers currently accessing the data
   sc_uint32 active_writer;   // Flag to indicate if a writer is writing
   sc_uint32 id;              // Unique identifier of monitor
+  sc_addr_hash addr_hash;    // Hash of sc-element which monitor it is, 0 for other monitors
   sc_mutex ref_count_mutex;
   sc_uint32 ref_count;
 } sc_monitor;
@@ -90,4 +91,19 @@ _SC_EXTERN void sc_monitor_acquire_write_n(sc_uint32 n, ...);
  */
 _SC_EXTERN void sc_monitor_release_write_n(sc_uint32 n, ...);
 
+/*! Acquires write locks for an array of monitors
+ * @param monitors Array of pointers to sc_monitors
+ * @param n Count of monitors in array
+ * @returns Returns count of unique monitors that have been locked
+ * @remarks This function sorts monitors array by monitor ids and removes empty and duplicated monitors from it, so
+ * the same array with the returned count should be passed to `sc_monitor_release_write_array`
+ */
+_SC_EXTERN sc_uint32 sc_monitor_acquire_write_array(sc_monitor ** monitors, sc_uint32 n);
+
+/*! Releases write locks from an array of monitors
+ * @param monitors Array of pointers to sc_monitors that was prepared by `sc_monitor_acquire_write_array`
+ * @param n Count of unique monitors returned by `sc_monitor_acquire_write_array`
+ */
+_SC_EXTERN void sc_monitor_release_write_array(sc_monitor ** monitors, sc_uint32 n);
+
 #endif
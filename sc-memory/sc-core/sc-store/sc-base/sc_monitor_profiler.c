@@ -0,0 +1,153 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_monitor_profiler.h"
+
+#include "sc_allocator.h"
+#include "sc_atomic.h"
+#include "sc_mutex.h"
+
+#include "../sc-container/sc-hash-table/sc_hash_table.h"
+
+#include <stdlib.h>
+
+// amount of sc-elements which contention is recorded, contention on other sc-elements is ignored
+#define SC_MONITOR_PROFILER_MAX_ELEMENTS_COUNT 100000
+
+static gint monitor_profiler_sampling_period = 0;
+static gint monitor_profiler_contended_count = 0;
+
+static sc_mutex monitor_profiler_mutex;
+static sc_hash_table * monitor_profiler_stats = null_ptr;
+
+void _sc_monitor_profiler_stat_free(void * stat)
+{
+  sc_mem_free(stat);
+}
+
+void _sc_monitor_profiler_initialize(sc_uint32 sampling_period)
+{
+  sc_mutex_init(&monitor_profiler_mutex);
+  monitor_profiler_stats = sc_hash_table_init(
+      sc_hash_table_default_hash_func, sc_hash_table_default_equal_func, null_ptr, _sc_monitor_profiler_stat_free);
+  sc_atomic_int_set(&monitor_profiler_contended_count, 0);
+  sc_atomic_int_set(&monitor_profiler_sampling_period, (gint)sampling_period);
+}
+
+void _sc_monitor_profiler_shutdown()
+{
+  sc_atomic_int_set(&monitor_profiler_sampling_period, 0);
+
+  sc_mutex_lock(&monitor_profiler_mutex);
+  sc_hash_table_destroy(monitor_profiler_stats);
+  monitor_profiler_stats = null_ptr;
+  sc_mutex_unlock(&monitor_profiler_mutex);
+
+  sc_mutex_destroy(&monitor_profiler_mutex);
+}
+
+void sc_monitor_profiler_set_sampling_period(sc_uint32 sampling_period)
+{
+  sc_mutex_lock(&monitor_profiler_mutex);
+  if (monitor_profiler_stats != null_ptr)
+    sc_hash_table_remove_all(monitor_profiler_stats);
+  sc_atomic_int_set(&monitor_profiler_contended_count, 0);
+  sc_atomic_int_set(&monitor_profiler_sampling_period, (gint)sampling_period);
+  sc_mutex_unlock(&monitor_profiler_mutex);
+}
+
+sc_uint32 sc_monitor_profiler_get_sampling_period()
+{
+  return (sc_uint32)sc_atomic_int_get(&monitor_profiler_sampling_period);
+}
+
+sc_int64 _sc_monitor_profiler_start_wait(sc_monitor const * monitor)
+{
+  if (monitor->addr_hash == 0)
+    return 0;
+
+  sc_uint32 const sampling_period = (sc_uint32)sc_atomic_int_get(&monitor_profiler_sampling_period);
+  if (sampling_period == 0)
+    return 0;
+
+  if ((sc_uint32)sc_atomic_int_add(&monitor_profiler_contended_count, 1) % sampling_period != 0)
+    return 0;
+
+  return g_get_monotonic_time();
+}
+
+void _sc_monitor_profiler_end_wait(sc_monitor const * monitor, sc_int64 wait_start_time, sc_uint32 waiters_count)
+{
+  sc_uint64 const wait_time = (sc_uint64)(g_get_monotonic_time() - wait_start_time);
+  sc_pointer const key = (sc_pointer)(sc_uint64)monitor->addr_hash;
+
+  sc_mutex_lock(&monitor_profiler_mutex);
+  if (monitor_profiler_stats == null_ptr)
+    goto end;
+
+  sc_monitor_contention_stat * stat = sc_hash_table_get(monitor_profiler_stats, key);
+  if (stat == null_ptr)
+  {
+    if (sc_hash_table_size(monitor_profiler_stats) >= SC_MONITOR_PROFILER_MAX_ELEMENTS_COUNT)
+      goto end;
+
+    stat = sc_mem_new(sc_monitor_contention_stat, 1);
+    SC_ADDR_LOCAL_FROM_INT(monitor->addr_hash, stat->addr);
+    sc_hash_table_insert(monitor_profiler_stats, key, stat);
+  }
+
+  ++stat->contended_count;
+  stat->total_wait_time += wait_time;
+  if (wait_time > stat->max_wait_time)
+    stat->max_wait_time = wait_time;
+  if (waiters_count > stat->max_waiters_count)
+    stat->max_waiters_count = waiters_count;
+
+end:
+  sc_mutex_unlock(&monitor_profiler_mutex);
+}
+
+sc_int32 _sc_monitor_profiler_compare_stats(void const * a, void const * b)
+{
+  sc_monitor_contention_stat const * stat_a = a;
+  sc_monitor_contention_stat const * stat_b = b;
+  if (stat_a->total_wait_time == stat_b->total_wait_time)
+    return 0;
+
+  return stat_a->total_wait_time > stat_b->total_wait_time ? -1 : 1;
+}
+
+void sc_monitor_profiler_get_most_contended(
+    sc_uint32 max_count,
+    sc_monitor_contention_stat ** stats,
+    sc_uint32 * count)
+{
+  *stats = null_ptr;
+  *count = 0;
+
+  sc_mutex_lock(&monitor_profiler_mutex);
+  sc_uint32 const size = monitor_profiler_stats == null_ptr ? 0 : sc_hash_table_size(monitor_profiler_stats);
+  if (size == 0 || max_count == 0)
+  {
+    sc_mutex_unlock(&monitor_profiler_mutex);
+    return;
+  }
+
+  sc_monitor_contention_stat * all_stats = sc_mem_new(sc_monitor_contention_stat, size);
+  sc_uint32 i = 0;
+
+  sc_hash_table_iterator iterator;
+  sc_hash_table_iterator_init(&iterator, monitor_profiler_stats);
+  sc_pointer key, value;
+  while (sc_hash_table_iterator_next(&iterator, &key, &value))
+    all_stats[i++] = *(sc_monitor_contention_stat *)value;
+  sc_mutex_unlock(&monitor_profiler_mutex);
+
+  qsort(all_stats, size, sizeof(sc_monitor_contention_stat), _sc_monitor_profiler_compare_stats);
+
+  *stats = all_stats;
+  *count = size < max_count ? size : max_count;
+}
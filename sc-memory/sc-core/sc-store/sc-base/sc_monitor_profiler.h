@@ -0,0 +1,66 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_monitor_profiler_h_
+#define _sc_monitor_profiler_h_
+
+#include "../sc_types.h"
+
+#include "sc_monitor.h"
+
+/*! Initializes the profiler of contention on monitors of sc-elements
+ * @param sampling_period Every `sampling_period`-th contended acquisition is sampled, 0 disables sampling
+ * @remarks This function is called on sc-storage initialization (for internal usage)
+ */
+_SC_EXTERN void _sc_monitor_profiler_initialize(sc_uint32 sampling_period);
+
+/*! Shutdowns the profiler of contention on monitors of sc-elements and frees collected statistics
+ * @remarks This function is called on sc-storage shutdown (for internal usage)
+ */
+_SC_EXTERN void _sc_monitor_profiler_shutdown();
+
+/*! Sets sampling period of contended acquisitions of monitors of sc-elements and clears collected statistics
+ * @param sampling_period Every `sampling_period`-th contended acquisition is sampled, 0 disables sampling
+ * @note This function is thread-safe.
+ */
+_SC_EXTERN void sc_monitor_profiler_set_sampling_period(sc_uint32 sampling_period);
+
+/*! Gets sampling period of contended acquisitions of monitors of sc-elements
+ * @returns Returns sampling period, 0 if sampling is disabled
+ */
+_SC_EXTERN sc_uint32 sc_monitor_profiler_get_sampling_period();
+
+/*! Starts sampling of contended acquisition of monitor
+ * @param monitor Pointer to the contended sc_monitor
+ * @returns Returns start time of waiting in microseconds if acquisition is sampled, otherwise 0
+ * @remarks This function only reads sampling period if sampling is disabled (for internal usage)
+ */
+_SC_EXTERN sc_int64 _sc_monitor_profiler_start_wait(sc_monitor const * monitor);
+
+/*! Records sampled contended acquisition of monitor
+ * @param monitor Pointer to the acquired sc_monitor
+ * @param wait_start_time Start time returned by `_sc_monitor_profiler_start_wait`
+ * @param waiters_count Amount of requests queued before acquisition
+ * @remarks This function is called after monitor is acquired (for internal usage)
+ */
+_SC_EXTERN void _sc_monitor_profiler_end_wait(
+    sc_monitor const * monitor,
+    sc_int64 wait_start_time,
+    sc_uint32 waiters_count);
+
+/*! Gets the most contended monitors of sc-elements
+ * @param max_count Maximum amount of monitors to get
+ * @param[out] stats Pointer to array of statistics ordered by total wait time descending. It should be freed by
+ * `sc_mem_free`.
+ * @param[out] count Pointer to amount of got statistics
+ * @note This function is thread-safe.
+ */
+_SC_EXTERN void sc_monitor_profiler_get_most_contended(
+    sc_uint32 max_count,
+    sc_monitor_contention_stat ** stats,
+    sc_uint32 * count);
+
+#endif
@@ -14,6 +14,7 @@ void _sc_monitor_destroy(void * monitor)
 {
   sc_monitor_destroy((sc_monitor *)monitor);
   sc_mem_free(monitor);
+  sc_mem_account_free(SC_ALLOCATIONS_MONITORS, 1, sizeof(sc_monitor));
 }
 
 void * _sc_monitor_table_clean_periodic(void * arg)
@@ -84,13 +85,7 @@ void _sc_monitor_table_destroy(sc_monitor_table * table)
   table->global_monitor_id_counter = 1;
 }
 
-sc_monitor * sc_monitor_table_get_monitor_for_addr(sc_monitor_table * table, sc_addr addr)
-{
-  sc_pointer key = (sc_pointer)(sc_uint64)SC_ADDR_LOCAL_TO_INT(addr);
-  return key == null_ptr ? null_ptr : sc_monitor_table_get_monitor_from_table(table, key);
-}
-
-sc_monitor * sc_monitor_table_get_monitor_from_table(sc_monitor_table * table, sc_pointer key)
+sc_monitor * _sc_monitor_table_get_monitor(sc_monitor_table * table, sc_pointer key, sc_addr_hash addr_hash)
 {
   sc_mutex_lock(&table->rw_mutex);
 
@@ -101,6 +96,8 @@ sc_monitor * sc_monitor_table_get_monitor_from_table(sc_monitor_table * table, s
     monitor = sc_mem_new(sc_monitor, 1);
     sc_monitor_init(monitor);
     monitor->id = table->global_monitor_id_counter++;
+    monitor->addr_hash = addr_hash;
+    sc_mem_account_new(SC_ALLOCATIONS_MONITORS, 1, sizeof(sc_monitor));
     sc_hash_table_insert(table->monitors, key, monitor);
   }
 
@@ -108,3 +105,16 @@ sc_monitor * sc_monitor_table_get_monitor_from_table(sc_monitor_table * table, s
 
   return monitor;
 }
+
+sc_monitor * sc_monitor_table_get_monitor_for_addr(sc_monitor_table * table, sc_addr addr)
+{
+  sc_addr_hash const addr_hash = SC_ADDR_LOCAL_TO_INT(addr);
+  sc_pointer key = (sc_pointer)(sc_uint64)addr_hash;
+  // monitors of sc-elements know their sc-addrs, so contention on them can be profiled
+  return key == null_ptr ? null_ptr : _sc_monitor_table_get_monitor(table, key, addr_hash);
+}
+
+sc_monitor * sc_monitor_table_get_monitor_from_table(sc_monitor_table * table, sc_pointer key)
+{
+  return _sc_monitor_table_get_monitor(table, key, 0);
+}
@@ -13,4 +13,8 @@ typedef GThread sc_thread;
 
 #define sc_thread_self g_thread_self
 
+#define sc_thread_new(name, func, data) g_thread_new(name, func, data)
+
+#define sc_thread_join(thread) g_thread_join(thread)
+
 #endif
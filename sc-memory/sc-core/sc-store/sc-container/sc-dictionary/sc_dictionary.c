@@ -13,6 +13,10 @@
 #define SC_DICTIONARY_NODE_BUCKET_SIZE 16
 #define SC_DICTIONARY_GET_BUCKET_NUM(num) ((num) / SC_DICTIONARY_NODE_BUCKET_SIZE)
 #define SC_DICTIONARY_GET_CHILD_NUM(num) ((num) % SC_DICTIONARY_NODE_BUCKET_SIZE)
+#define SC_DICTIONARY_GET_BUCKETS_COUNT(children_size) ((children_size) / SC_DICTIONARY_NODE_BUCKET_SIZE + 1)
+#define SC_DICTIONARY_NODE_BYTES(children_size) \
+  (sizeof(sc_dictionary_node) + sizeof(sc_dictionary_node **) * SC_DICTIONARY_GET_BUCKETS_COUNT(children_size))
+#define SC_DICTIONARY_BUCKET_BYTES (sizeof(sc_dictionary_node *) * SC_DICTIONARY_NODE_BUCKET_SIZE)
 
 #define SC_DICTIONARY_NODE_IS_VALID(__node) ((__node) != null_ptr)
 #define SC_DICTIONARY_NODE_IS_NOT_VALID(__node) ((__node) == null_ptr)
@@ -35,8 +39,9 @@ inline sc_dictionary_node * _sc_dictionary_node_initialize(sc_uint8 children_siz
 {
   sc_dictionary_node * node = sc_mem_new(sc_dictionary_node, 1);
 
-  sc_uint64 const count = children_size / SC_DICTIONARY_NODE_BUCKET_SIZE + 1;
+  sc_uint64 const count = SC_DICTIONARY_GET_BUCKETS_COUNT(children_size);
   node->next = sc_mem_new(sc_dictionary_node **, count);
+  sc_mem_account_new(SC_ALLOCATIONS_DICTIONARIES, 1, SC_DICTIONARY_NODE_BYTES(children_size));
 
   node->data = null_ptr;
   node->offset = null_ptr;
@@ -45,18 +50,43 @@ inline sc_dictionary_node * _sc_dictionary_node_initialize(sc_uint8 children_siz
   return node;
 }
 
-void _sc_dictionary_node_destroy(sc_dictionary_node * node)
+void _sc_dictionary_node_destroy(sc_dictionary_node * node, sc_uint8 children_size)
 {
   node->data = null_ptr;
 
   sc_mem_free(node->next);
   node->next = null_ptr;
 
+  if (node->offset != null_ptr)
+    sc_mem_account_free(SC_ALLOCATIONS_DICTIONARIES, 0, node->offset_size + 1);
   sc_mem_free(node->offset);
   node->offset = null_ptr;
   node->offset_size = 0;
 
   sc_mem_free(node);
+  sc_mem_account_free(SC_ALLOCATIONS_DICTIONARIES, 1, SC_DICTIONARY_NODE_BYTES(children_size));
+}
+
+static void _sc_dictionary_bucket_destroy(sc_dictionary_node ** bucket)
+{
+  if (bucket == null_ptr)
+    return;
+
+  sc_mem_free(bucket);
+  sc_mem_account_free(SC_ALLOCATIONS_DICTIONARIES, 0, SC_DICTIONARY_BUCKET_BYTES);
+}
+
+static void _sc_dictionary_node_set_offset(sc_dictionary_node * node, sc_char const * offset, sc_uint32 offset_size)
+{
+  node->offset_size = offset_size;
+  sc_str_cpy(node->offset, offset, node->offset_size);
+  sc_mem_account_new(SC_ALLOCATIONS_DICTIONARIES, 0, node->offset_size + 1);
+}
+
+static sc_dictionary_node ** _sc_dictionary_bucket_new()
+{
+  sc_mem_account_new(SC_ALLOCATIONS_DICTIONARIES, 0, SC_DICTIONARY_BUCKET_BYTES);
+  return sc_mem_new(sc_dictionary_node *, SC_DICTIONARY_NODE_BUCKET_SIZE);
 }
 
 void _sc_dictionary_up_destroy_node(
@@ -69,7 +99,7 @@ void _sc_dictionary_up_destroy_node(
   {
     sc_uint64 const bucket_idx = SC_DICTIONARY_GET_BUCKET_NUM(num);
     if (prev_bucket_idx != bucket_idx)
-      sc_mem_free(next_bucket);
+      _sc_dictionary_bucket_destroy(next_bucket);
     prev_bucket_idx = bucket_idx;
 
     next_bucket = node->next[bucket_idx];
@@ -85,10 +115,10 @@ void _sc_dictionary_up_destroy_node(
 
     if (node_clear != null_ptr)
       node_clear(next);
-    _sc_dictionary_node_destroy(next);
+    _sc_dictionary_node_destroy(next, dictionary->size);
   }
 
-  sc_mem_free(next_bucket);
+  _sc_dictionary_bucket_destroy(next_bucket);
 }
 
 sc_bool sc_dictionary_destroy(sc_dictionary * dictionary, void (*node_clear)(sc_dictionary_node *))
@@ -100,7 +130,7 @@ sc_bool sc_dictionary_destroy(sc_dictionary * dictionary, void (*node_clear)(sc_
 
   if (node_clear != null_ptr)
     node_clear(dictionary->root);
-  _sc_dictionary_node_destroy(dictionary->root);
+  _sc_dictionary_node_destroy(dictionary->root, dictionary->size);
 
   sc_monitor_destroy(&dictionary->monitor);
 
@@ -139,7 +169,7 @@ sc_dictionary_node * sc_dictionary_append_to_node(sc_dictionary * dictionary, sc
     sc_uint64 child_idx = SC_DICTIONARY_GET_CHILD_NUM(num);
 
     if (SC_DICTIONARY_NODE_IS_NOT_VALID(node->next[bucket_idx]))
-      node->next[bucket_idx] = sc_mem_new(sc_dictionary_node *, SC_DICTIONARY_NODE_BUCKET_SIZE);
+      node->next[bucket_idx] = _sc_dictionary_bucket_new();
 
     // define prefix
     if (SC_DICTIONARY_NODE_IS_NOT_VALID(node->next[bucket_idx][child_idx]))
@@ -148,8 +178,7 @@ sc_dictionary_node * sc_dictionary_append_to_node(sc_dictionary * dictionary, sc
 
       sc_dictionary_node * temp = node->next[bucket_idx][child_idx];
 
-      temp->offset_size = size - i;
-      sc_str_cpy(temp->offset, string_ptr, temp->offset_size);
+      _sc_dictionary_node_set_offset(temp, string_ptr, size - i);
 
       node = temp;
 
@@ -172,8 +201,7 @@ sc_dictionary_node * sc_dictionary_append_to_node(sc_dictionary * dictionary, sc
 
         sc_dictionary_node * temp = node->next[bucket_idx][child_idx];
 
-        temp->offset_size = j;
-        sc_str_cpy(temp->offset, moving->offset, temp->offset_size);
+        _sc_dictionary_node_set_offset(temp, moving->offset, j);
       }
       node = node->next[bucket_idx][child_idx];
 
@@ -189,15 +217,15 @@ sc_dictionary_node * sc_dictionary_append_to_node(sc_dictionary * dictionary, sc
         sc_char * moving_offset_copy = moving->offset;
 
         if (SC_DICTIONARY_NODE_IS_NOT_VALID(node->next[bucket_idx]))
-          node->next[bucket_idx] = sc_mem_new(sc_dictionary_node *, SC_DICTIONARY_NODE_BUCKET_SIZE);
+          node->next[bucket_idx] = _sc_dictionary_bucket_new();
 
         node->next[bucket_idx][child_idx] = &*moving;
 
         sc_dictionary_node * temp = node->next[bucket_idx][child_idx];
 
-        temp->offset_size = saved_offset_size - j;
-        sc_str_cpy(temp->offset, offset_ptr, temp->offset_size);
+        _sc_dictionary_node_set_offset(temp, offset_ptr, saved_offset_size - j);
         sc_mem_free(moving_offset_copy);
+        sc_mem_account_free(SC_ALLOCATIONS_DICTIONARIES, 0, saved_offset_size + 1);
       }
     }
     else
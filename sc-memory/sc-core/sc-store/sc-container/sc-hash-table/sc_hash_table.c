@@ -0,0 +1,285 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_hash_table.h"
+
+#include "../../sc-base/sc_allocator.h"
+
+#include <string.h>
+
+//! Control byte of slot that has never been full
+#define SC_HASH_TABLE_EMPTY 0x80
+//! Control byte of slot which key has been removed
+#define SC_HASH_TABLE_DELETED 0xFE
+//! Control bytes of full slots have high bit unset, other bits are bits of key hash
+#define SC_HASH_TABLE_IS_FULL(control) (((control) & 0x80) == 0)
+
+//! Checks that sc-hash-table has no more than 7/8 of not empty slots after adding one more slot
+#define SC_HASH_TABLE_NEEDS_RESIZE(table) \
+  ((((sc_uint64)(table)->size + (table)->deleted_count + 1) << 3) > (sc_uint64)(table)->capacity * 7)
+
+#define SC_HASH_TABLE_NOT_FOUND ((sc_uint32)-1)
+
+/*! Mixes bits of hash so that both low bits, used as slot index, and high bits, stored in control byte, depend on all
+ * bits of it. Direct hashes of pointers and sc-addr hashes have low bits poorly distributed without it.
+ */
+static sc_uint64 _sc_hash_table_mix(sc_uint64 hash)
+{
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+static sc_uint64 _sc_hash_table_hash(sc_hash_table const * table, void const * key)
+{
+  if (table->is_direct)
+    return _sc_hash_table_mix((sc_uint64)GPOINTER_TO_SIZE(key));
+
+  return _sc_hash_table_mix(table->hash_func(key));
+}
+
+static sc_bool _sc_hash_table_keys_equal(sc_hash_table const * table, void const * key, void const * other_key)
+{
+  if (table->is_direct)
+    return key == other_key;
+
+  return table->key_equal_func(key, other_key) ? SC_TRUE : SC_FALSE;
+}
+
+static sc_uint8 _sc_hash_table_control(sc_uint64 hash)
+{
+  return (sc_uint8)(hash >> 57);
+}
+
+static void _sc_hash_table_allocate(sc_hash_table * table, sc_uint32 capacity)
+{
+  table->controls = sc_mem_new(sc_uint8, capacity);
+  memset(table->controls, SC_HASH_TABLE_EMPTY, capacity);
+  table->entries = sc_mem_new(sc_hash_table_entry, capacity);
+  table->capacity = capacity;
+  table->deleted_count = 0;
+}
+
+//! Finds the first empty or deleted slot in probe sequence of hash
+static sc_uint32 _sc_hash_table_find_free_slot(sc_hash_table const * table, sc_uint64 hash)
+{
+  sc_uint32 const mask = table->capacity - 1;
+  sc_uint32 index = hash & mask;
+  while (SC_HASH_TABLE_IS_FULL(table->controls[index]))
+    index = (index + 1) & mask;
+
+  return index;
+}
+
+//! Finds slot of key or returns SC_HASH_TABLE_NOT_FOUND
+static sc_uint32 _sc_hash_table_find(sc_hash_table const * table, void const * key, sc_uint64 hash)
+{
+  sc_uint32 const mask = table->capacity - 1;
+  sc_uint8 const control = _sc_hash_table_control(hash);
+
+  sc_uint32 index = hash & mask;
+  while (table->controls[index] != SC_HASH_TABLE_EMPTY)
+  {
+    if (table->controls[index] == control && _sc_hash_table_keys_equal(table, table->entries[index].key, key))
+      return index;
+
+    index = (index + 1) & mask;
+  }
+
+  return SC_HASH_TABLE_NOT_FOUND;
+}
+
+//! Moves full slots to new arrays, table grows twice if it is more than half full, otherwise deleted slots are purged
+static void _sc_hash_table_resize(sc_hash_table * table)
+{
+  sc_uint8 * const old_controls = table->controls;
+  sc_hash_table_entry * const old_entries = table->entries;
+  sc_uint32 const old_capacity = table->capacity;
+
+  sc_uint32 const capacity = ((sc_uint64)table->size << 1) >= old_capacity ? old_capacity << 1 : old_capacity;
+  _sc_hash_table_allocate(table, capacity);
+
+  for (sc_uint32 i = 0; i < old_capacity; ++i)
+  {
+    if (!SC_HASH_TABLE_IS_FULL(old_controls[i]))
+      continue;
+
+    sc_uint64 const hash = _sc_hash_table_hash(table, old_entries[i].key);
+    sc_uint32 const index = _sc_hash_table_find_free_slot(table, hash);
+    table->controls[index] = old_controls[i];
+    table->entries[index] = old_entries[i];
+  }
+
+  sc_mem_free(old_controls);
+  sc_mem_free(old_entries);
+}
+
+static void _sc_hash_table_free_entry(sc_hash_table const * table, sc_hash_table_entry const * entry)
+{
+  if (table->key_destroy_func != null_ptr)
+    table->key_destroy_func(entry->key);
+  if (table->value_destroy_func != null_ptr)
+    table->value_destroy_func(entry->value);
+}
+
+static void _sc_hash_table_remove_slot(sc_hash_table * table, sc_uint32 index)
+{
+  sc_hash_table_entry const entry = table->entries[index];
+
+  // probe sequences passing through this slot stop at the next one if it is empty, so this slot may be empty too
+  sc_uint32 const next_index = (index + 1) & (table->capacity - 1);
+  if (table->controls[next_index] == SC_HASH_TABLE_EMPTY)
+    table->controls[index] = SC_HASH_TABLE_EMPTY;
+  else
+  {
+    table->controls[index] = SC_HASH_TABLE_DELETED;
+    ++table->deleted_count;
+  }
+  table->entries[index].key = null_ptr;
+  table->entries[index].value = null_ptr;
+  --table->size;
+
+  _sc_hash_table_free_entry(table, &entry);
+}
+
+sc_hash_table * sc_hash_table_init(
+    GHashFunc hash_func,
+    GEqualFunc key_equal_func,
+    GDestroyNotify key_destroy_func,
+    GDestroyNotify value_destroy_func)
+{
+  sc_hash_table * table = sc_mem_new(sc_hash_table, 1);
+  table->hash_func = hash_func == null_ptr ? sc_hash_table_default_hash_func : hash_func;
+  table->key_equal_func = key_equal_func == null_ptr ? sc_hash_table_default_equal_func : key_equal_func;
+  table->key_destroy_func = key_destroy_func;
+  table->value_destroy_func = value_destroy_func;
+  table->is_direct = table->hash_func == sc_hash_table_default_hash_func
+                     && table->key_equal_func == sc_hash_table_default_equal_func;
+  table->size = 0;
+  _sc_hash_table_allocate(table, SC_HASH_TABLE_MIN_CAPACITY);
+
+  return table;
+}
+
+void sc_hash_table_destroy(sc_hash_table * table)
+{
+  if (table == null_ptr)
+    return;
+
+  sc_hash_table_remove_all(table);
+  sc_mem_free(table->controls);
+  sc_mem_free(table->entries);
+  sc_mem_free(table);
+}
+
+sc_uint32 sc_hash_table_size(sc_hash_table const * table)
+{
+  return table->size;
+}
+
+sc_uint64 sc_hash_table_get_bytes(sc_hash_table const * table)
+{
+  return sizeof(sc_hash_table) + (sc_uint64)table->capacity * (sizeof(sc_uint8) + sizeof(sc_hash_table_entry));
+}
+
+sc_bool sc_hash_table_insert(sc_hash_table * table, void * key, void * value)
+{
+  sc_uint64 const hash = _sc_hash_table_hash(table, key);
+
+  sc_uint32 index = _sc_hash_table_find(table, key, hash);
+  if (index != SC_HASH_TABLE_NOT_FOUND)
+  {
+    sc_hash_table_entry * entry = &table->entries[index];
+    if (table->key_destroy_func != null_ptr)
+      table->key_destroy_func(key);
+    if (table->value_destroy_func != null_ptr)
+      table->value_destroy_func(entry->value);
+    entry->value = value;
+    return SC_FALSE;
+  }
+
+  if (SC_HASH_TABLE_NEEDS_RESIZE(table))
+    _sc_hash_table_resize(table);
+
+  index = _sc_hash_table_find_free_slot(table, hash);
+  if (table->controls[index] == SC_HASH_TABLE_DELETED)
+    --table->deleted_count;
+  table->controls[index] = _sc_hash_table_control(hash);
+  table->entries[index].key = key;
+  table->entries[index].value = value;
+  ++table->size;
+
+  return SC_TRUE;
+}
+
+void * sc_hash_table_get(sc_hash_table const * table, void const * key)
+{
+  sc_uint32 const index = _sc_hash_table_find(table, key, _sc_hash_table_hash(table, key));
+  return index == SC_HASH_TABLE_NOT_FOUND ? null_ptr : table->entries[index].value;
+}
+
+sc_bool sc_hash_table_remove(sc_hash_table * table, void const * key)
+{
+  sc_uint32 const index = _sc_hash_table_find(table, key, _sc_hash_table_hash(table, key));
+  if (index == SC_HASH_TABLE_NOT_FOUND)
+    return SC_FALSE;
+
+  _sc_hash_table_remove_slot(table, index);
+  return SC_TRUE;
+}
+
+void sc_hash_table_remove_all(sc_hash_table * table)
+{
+  if (table->key_destroy_func != null_ptr || table->value_destroy_func != null_ptr)
+  {
+    for (sc_uint32 i = 0; i < table->capacity; ++i)
+    {
+      if (SC_HASH_TABLE_IS_FULL(table->controls[i]))
+        _sc_hash_table_free_entry(table, &table->entries[i]);
+    }
+  }
+
+  memset(table->controls, SC_HASH_TABLE_EMPTY, table->capacity);
+  memset(table->entries, 0, sizeof(sc_hash_table_entry) * table->capacity);
+  table->size = 0;
+  table->deleted_count = 0;
+}
+
+void sc_hash_table_iterator_init(sc_hash_table_iterator * iterator, sc_hash_table * table)
+{
+  iterator->table = table;
+  iterator->position = 0;
+}
+
+sc_bool sc_hash_table_iterator_next(sc_hash_table_iterator * iterator, void ** key, void ** value)
+{
+  sc_hash_table const * table = iterator->table;
+  while (iterator->position < table->capacity)
+  {
+    sc_uint32 const index = iterator->position++;
+    if (!SC_HASH_TABLE_IS_FULL(table->controls[index]))
+      continue;
+
+    if (key != null_ptr)
+      *key = table->entries[index].key;
+    if (value != null_ptr)
+      *value = table->entries[index].value;
+    return SC_TRUE;
+  }
+
+  return SC_FALSE;
+}
+
+void sc_hash_table_iterator_remove(sc_hash_table_iterator * iterator)
+{
+  if (iterator->position == 0)
+    return;
+
+  sc_uint32 const index = iterator->position - 1;
+  if (SC_HASH_TABLE_IS_FULL(iterator->table->controls[index]))
+    _sc_hash_table_remove_slot(iterator->table, index);
+}
@@ -9,24 +9,95 @@
 
 #include <glib.h>
 
-typedef GHashTable sc_hash_table;
+#include "../../sc_types.h"
+
+//! Minimal amount of slots in sc-hash-table, it is always a power of two
+#define SC_HASH_TABLE_MIN_CAPACITY 8
+
+//! A slot of sc-hash-table that stores key and value
+typedef struct _sc_hash_table_entry
+{
+  void * key;
+  void * value;
+} sc_hash_table_entry;
+
+/*! An open-addressing hash table. Keys and values are stored in one flat array of slots, a separate array stores
+ * a control byte for each slot: whether it is empty, deleted or full and, for full slots, 7 bits of key hash.
+ * Lookups probe slots linearly and compare keys only when control bytes match, so they rarely leave a cache line.
+ * Nothing is allocated on insert except when the table grows.
+ *
+ * Tables created with `sc_hash_table_default_hash_func` and `sc_hash_table_default_equal_func` don't call these
+ * functions, keys are mixed and compared as integers.
+ */
+typedef struct _sc_hash_table
+{
+  sc_uint8 * controls;                // control bytes of slots
+  sc_hash_table_entry * entries;      // slots
+  sc_uint32 capacity;                 // amount of slots
+  sc_uint32 size;                     // amount of full slots
+  sc_uint32 deleted_count;            // amount of deleted slots
+  sc_bool is_direct;                  // SC_TRUE if keys are hashed and compared as integers
+  GHashFunc hash_func;                // function to hash keys
+  GEqualFunc key_equal_func;          // function to compare keys
+  GDestroyNotify key_destroy_func;    // function to free keys, may be null_ptr
+  GDestroyNotify value_destroy_func;  // function to free values, may be null_ptr
+} sc_hash_table;
 
-#define sc_hash_table_init(hash_func, key_equal_func, key_destroy_func, value_destroy_func) \
-  g_hash_table_new_full(hash_func, key_equal_func, key_destroy_func, value_destroy_func)
+#define sc_hash_table_default_hash_func g_direct_hash
 
-#define sc_hash_table_destroy(table) g_hash_table_destroy(table)
+#define sc_hash_table_default_equal_func g_direct_equal
 
-#define sc_hash_table_size(table) g_hash_table_size(table)
+/*! Creates an empty sc-hash-table.
+ * @param hash_func A function to hash keys
+ * @param key_equal_func A function to compare keys
+ * @param key_destroy_func A function to free keys when they are removed from table, may be null_ptr
+ * @param value_destroy_func A function to free values when they are removed from table, may be null_ptr
+ * @returns Returns a pointer to created sc-hash-table.
+ */
+_SC_EXTERN sc_hash_table * sc_hash_table_init(
+    GHashFunc hash_func,
+    GEqualFunc key_equal_func,
+    GDestroyNotify key_destroy_func,
+    GDestroyNotify value_destroy_func);
+
+/*! Removes all keys and values from sc-hash-table and frees it.
+ * @param table A pointer to sc-hash-table
+ */
+_SC_EXTERN void sc_hash_table_destroy(sc_hash_table * table);
 
-#define sc_hash_table_insert(table, key, value) g_hash_table_insert(table, key, value)
+//! Returns amount of keys in sc-hash-table
+_SC_EXTERN sc_uint32 sc_hash_table_size(sc_hash_table const * table);
 
-#define sc_hash_table_get(table, key) g_hash_table_lookup(table, key)
+//! Returns amount of bytes allocated for sc-hash-table and its slots, keys and values aren't counted
+_SC_EXTERN sc_uint64 sc_hash_table_get_bytes(sc_hash_table const * table);
 
-#define sc_hash_table_remove(table, key) g_hash_table_remove(table, key)
+/*! Inserts value by key into sc-hash-table. If key is already in table, its value is freed and replaced, and the
+ * specified key is freed.
+ * @param table A pointer to sc-hash-table
+ * @param key A key to insert value by
+ * @param value A value to insert
+ * @returns Returns SC_TRUE, if key wasn't in table; otherwise return SC_FALSE.
+ */
+_SC_EXTERN sc_bool sc_hash_table_insert(sc_hash_table * table, void * key, void * value);
 
-#define sc_hash_table_default_hash_func g_direct_hash
+/*! Gets value by key from sc-hash-table.
+ * @param table A pointer to sc-hash-table
+ * @param key A key to get value by
+ * @returns Returns value, if key is in table; otherwise return null_ptr.
+ */
+_SC_EXTERN void * sc_hash_table_get(sc_hash_table const * table, void const * key);
 
-#define sc_hash_table_default_equal_func g_direct_equal
+/*! Removes key and its value from sc-hash-table and frees them.
+ * @param table A pointer to sc-hash-table
+ * @param key A key to remove
+ * @returns Returns SC_TRUE, if key was in table; otherwise return SC_FALSE.
+ */
+_SC_EXTERN sc_bool sc_hash_table_remove(sc_hash_table * table, void const * key);
+
+/*! Removes all keys and values from sc-hash-table and frees them. Table keeps its capacity.
+ * @param table A pointer to sc-hash-table
+ */
+_SC_EXTERN void sc_hash_table_remove_all(sc_hash_table * table);
 
 typedef GSList sc_hash_table_list;
 
@@ -38,10 +109,31 @@ typedef GSList sc_hash_table_list;
 
 #define sc_hash_table_list_remove_sublist(list, sublist) g_slist_delete_link(list, sublist)
 
-typedef GHashTableIter sc_hash_table_iterator;
+//! An iterator over keys and values of sc-hash-table in order of their slots
+typedef struct _sc_hash_table_iterator
+{
+  sc_hash_table * table;  // iterated sc-hash-table
+  sc_uint32 position;     // slot after the current one
+} sc_hash_table_iterator;
+
+/*! Initializes iterator over sc-hash-table. Table mustn't be changed while iterating, except by
+ * `sc_hash_table_iterator_remove`.
+ * @param iterator A pointer to iterator to initialize
+ * @param table A pointer to sc-hash-table to iterate
+ */
+_SC_EXTERN void sc_hash_table_iterator_init(sc_hash_table_iterator * iterator, sc_hash_table * table);
 
-#define sc_hash_table_iterator_init(iterator, hash_table) g_hash_table_iter_init(iterator, hash_table)
+/*! Moves iterator to the next key of sc-hash-table.
+ * @param iterator A pointer to iterator
+ * @param[out] key A pointer to store key, may be null_ptr
+ * @param[out] value A pointer to store value, may be null_ptr
+ * @returns Returns SC_FALSE, if all keys have been iterated; otherwise return SC_TRUE.
+ */
+_SC_EXTERN sc_bool sc_hash_table_iterator_next(sc_hash_table_iterator * iterator, void ** key, void ** value);
 
-#define sc_hash_table_iterator_next(iterator, key, value) g_hash_table_iter_next(iterator, key, value)
+/*! Removes the current key of iterator and its value from sc-hash-table and frees them.
+ * @param iterator A pointer to iterator
+ */
+_SC_EXTERN void sc_hash_table_iterator_remove(sc_hash_table_iterator * iterator);
 
 #endif
@@ -14,6 +14,25 @@
 
 #define SC_EVENT_REQUEST_DESTROY (1 << 31)
 
+/*! Structure that contains emitted events waiting to be delivered in batch
+ */
+typedef struct _sc_event_batch
+{
+  sc_mutex mutex;
+  //! Emitted events arguments in order of their emission
+  sc_event_batch_item * items;
+  sc_uint32 items_count;
+  sc_uint32 items_capacity;
+  //! Maximum amount of emitted events delivered in one batch
+  sc_uint32 max_size;
+  //! Maximum time in microseconds that emitted event waits for delivery
+  sc_int64 max_delay;
+  //! Monotonic time in microseconds when the first waiting event must be delivered
+  sc_int64 flush_time;
+  //! Whether batch delivery is scheduled, only one batch of sc-event is delivered at a time to preserve order
+  sc_bool is_scheduled;
+} sc_event_batch;
+
 /*! Structure that contains information about event
  */
 struct _sc_event
@@ -29,6 +48,12 @@ struct _sc_event
   //! Pointer to callback function, that calls on event emit
   sc_event_callback_ext callback_ext;
   sc_event_callback_with_user callback_with_user;
+  //! Pointer to callback function, that calls with batch of emitted events
+  sc_event_batch_callback batch_callback;
+  //! Emitted events waiting for delivery, it is null_ptr for events delivered one by one
+  sc_event_batch * batch;
+  //! Priority class of emitted events processing
+  sc_event_priority priority;
   //! Pointer to callback function, that calls, when subscribed sc-element deleted
   sc_event_delete_function delete_callback;
   sc_monitor monitor;
@@ -62,6 +87,8 @@ sc_result sc_event_emit(
     sc_addr other_addr);
 
 /*! Emit event immediately
+ * @param emit_time Monotonic time in microseconds when the event was emitted, it differs from the current time for
+ * pending events
  */
 sc_result sc_event_emit_impl(
     sc_memory_context const * ctx,
@@ -69,6 +96,12 @@ sc_result sc_event_emit_impl(
     sc_event_type type,
     sc_addr connector_addr,
     sc_type edge_type,
-    sc_addr other_addr);
+    sc_addr other_addr,
+    sc_int64 emit_time);
+
+/*! Frees emitted events waiting for delivery of batched sc-event.
+ * @param event Pointer to sc-event
+ */
+void sc_event_batch_destroy(sc_event * event);
 
 #endif
@@ -14,6 +14,19 @@
 #include "../../sc_memory_private.h"
 
 #include "../sc-base/sc_allocator.h"
+#include "../sc-container/sc-string/sc_string.h"
+
+//! Time in microseconds that the thread flushing batches waits, when there are no batches to deliver
+#define SC_EVENT_BATCHES_FLUSHER_IDLE_TIME 1000000
+//! Initial amount of emitted events that batch can store without reallocation
+#define SC_EVENT_BATCH_INITIAL_CAPACITY 16
+//! Time in microseconds that emitter waits for free space in full queue, before it queues sc-event over capacity
+#define SC_EVENTS_QUEUE_MAX_BLOCK_TIME 1000000
+//! How many times queue with spilled sc-events can exceed its capacity, sc-events emitted over this bound are dropped
+#define SC_EVENTS_QUEUE_MAX_SPILL_FACTOR 2
+
+//! Flag that is set in threads of the event emission pool, they never wait for free space in queue
+static GPrivate sc_event_emission_pool_thread = G_PRIVATE_INIT(null_ptr);
 
 /*! Structure representing data for a worker in the event emission pool.
  * @note This structure holds information required for processing events in a worker thread.
@@ -25,12 +38,18 @@ typedef struct
   sc_addr connector_addr;  ///< sc-address representing the sc-connector associated with the event.
   sc_type connector_type;  ///< sc-type of the sc-connector associated with the event.
   sc_addr other_addr;      ///< sc-address representing the other element associated with the event.
+  sc_event_type type;          ///< Type of the sc-event, it is saved because the sc-event can be destroyed.
+  sc_event_priority priority;  ///< Priority class of the sc-event subscription.
+  sc_uint64 sequence;          ///< Number of the event in queue, events of one priority are processed in this order.
+  sc_int64 emit_time;          ///< Monotonic time in microseconds when the event was emitted.
+  sc_int64 enqueue_time;       ///< Monotonic time in microseconds when the event was queued.
 } sc_event_emission_pool_worker_data;
 
 /*! Function that creates a new instance of sc_event_emission_pool_worker_data.
  * @param event Pointer to the sc-event associated with the worker.
  * @param connector_addr sc-address representing the sc-connector associated with the event.
  * @param other_addr sc-address representing the other element associated with the event.
+ * @param emit_time Monotonic time in microseconds when the event was emitted.
  * @returns Returns a pointer to the newly created sc_event_emission_pool_worker_data.
  */
 sc_event_emission_pool_worker_data * _sc_event_emission_pool_worker_data_new(
@@ -38,7 +57,8 @@ sc_event_emission_pool_worker_data * _sc_event_emission_pool_worker_data_new(
     sc_addr user_addr,
     sc_addr connector_addr,
     sc_type connector_type,
-    sc_addr other_addr)
+    sc_addr other_addr,
+    sc_int64 emit_time)
 {
   sc_event_emission_pool_worker_data * data = sc_mem_new(sc_event_emission_pool_worker_data, 1);
   data->event = event;
@@ -46,6 +66,9 @@ sc_event_emission_pool_worker_data * _sc_event_emission_pool_worker_data_new(
   data->connector_addr = connector_addr;
   data->connector_type = connector_type;
   data->other_addr = other_addr;
+  data->type = event == null_ptr ? SC_EVENT_UNKNOWN : event->type;
+  data->priority = event == null_ptr ? SC_EVENT_PRIORITY_NORMAL : event->priority;
+  data->emit_time = emit_time;
 
   return data;
 }
@@ -58,6 +81,265 @@ void _sc_event_emission_pool_worker_data_destroy(sc_event_emission_pool_worker_d
   sc_mem_free(data);
 }
 
+/*! Function that orders events in the event emission pool by priority of their subscriptions and then by their
+ * emission order.
+ */
+sc_int32 _sc_event_emission_pool_worker_data_compare(sc_const_pointer a, sc_const_pointer b, sc_pointer user_data)
+{
+  sc_unused(user_data);
+
+  sc_event_emission_pool_worker_data const * data = a;
+  sc_event_emission_pool_worker_data const * other_data = b;
+  if (data->priority != other_data->priority)
+    return data->priority < other_data->priority ? -1 : 1;
+
+  return data->sequence < other_data->sequence ? -1 : (data->sequence > other_data->sequence ? 1 : 0);
+}
+
+/*! Function that queues an event for processing in the event emission pool.
+ * @param manager Pointer to the sc_event_emission_manager managing the event emission.
+ * @param data Pointer to the sc_event_emission_pool_worker_data to be queued.
+ * @param is_bounded Whether overflow policy is applied to the event, batch deliveries are queued in any case,
+ * because their schedulers hold batch locks.
+ */
+void _sc_event_emission_manager_push(
+    sc_event_emission_manager * manager,
+    sc_event_emission_pool_worker_data * data,
+    sc_bool is_bounded)
+{
+  sc_mutex_lock(&manager->queue_mutex);
+  if (is_bounded && manager->max_events_queue_size != 0 && manager->stat.size >= manager->max_events_queue_size)
+  {
+    sc_events_queue_overflow_policy policy = manager->overflow_policy;
+    // threads of the pool process queue, so they can't wait for free space in it
+    if (policy == SC_EVENTS_QUEUE_OVERFLOW_BLOCK && g_private_get(&sc_event_emission_pool_thread) != null_ptr)
+      policy = SC_EVENTS_QUEUE_OVERFLOW_SPILL;
+
+    switch (policy)
+    {
+    case SC_EVENTS_QUEUE_OVERFLOW_BLOCK:
+    {
+      // emitters hold monitors of sc-elements, so they wait limited time not to lock workers needing these monitors
+      sc_int64 const end_time = g_get_monotonic_time() + SC_EVENTS_QUEUE_MAX_BLOCK_TIME;
+      ++manager->stat.blocked_count;
+      while (manager->running && manager->stat.size >= manager->max_events_queue_size)
+      {
+        if (sc_cond_wait_until(&manager->queue_condition, &manager->queue_mutex, end_time) == SC_FALSE)
+        {
+          policy = SC_EVENTS_QUEUE_OVERFLOW_SPILL;
+          break;
+        }
+      }
+      break;
+    }
+
+    default:
+      break;
+    }
+
+    // spilled sc-events are bounded too, otherwise handler threads emitting sc-events may grow queue without limit
+    if (policy == SC_EVENTS_QUEUE_OVERFLOW_SPILL
+        && manager->stat.size >= (sc_uint64)manager->max_events_queue_size * SC_EVENTS_QUEUE_MAX_SPILL_FACTOR)
+      policy = SC_EVENTS_QUEUE_OVERFLOW_DROP;
+
+    if (policy == SC_EVENTS_QUEUE_OVERFLOW_SPILL)
+      ++manager->stat.spilled_count;
+    else if (policy == SC_EVENTS_QUEUE_OVERFLOW_DROP)
+    {
+      // sc-events are dropped by other policies too, when queue is full of spilled sc-events
+      sc_uint64 const dropped_count = ++manager->stat.dropped_count;
+      sc_bool const is_dropped_by_policy = manager->overflow_policy == SC_EVENTS_QUEUE_OVERFLOW_DROP;
+      sc_uint64 const queue_size = manager->stat.size;
+      sc_mutex_unlock(&manager->queue_mutex);
+      _sc_event_emission_pool_worker_data_destroy(data);
+
+      if (is_dropped_by_policy)
+        sc_warning("Sc-event is dropped, events queue is full (%llu events), dropped: %llu", queue_size, dropped_count);
+      else
+        sc_warning(
+            "Sc-event is dropped, events queue is full of spilled events (%llu events), dropped: %llu",
+            queue_size,
+            dropped_count);
+      return;
+    }
+  }
+
+  data->sequence = ++manager->queue_sequence;
+  data->enqueue_time = g_get_monotonic_time();
+  ++manager->stat.size;
+  manager->stat.max_size = sc_max(manager->stat.max_size, manager->stat.size);
+  sc_mutex_unlock(&manager->queue_mutex);
+
+  sc_monitor_acquire_write(&manager->pool_monitor);
+  g_thread_pool_push(manager->thread_pool, data, null_ptr);
+  sc_monitor_release_write(&manager->pool_monitor);
+}
+
+/*! Function that adds latency to histogram.
+ * @param histogram Pointer to the sc_latency_histogram to be updated.
+ * @param latency Latency in microseconds.
+ */
+void _sc_latency_histogram_add(sc_latency_histogram * histogram, sc_uint64 latency)
+{
+  sc_uint32 bucket = 0;
+  while (bucket < SC_LATENCY_HISTOGRAM_BUCKETS_COUNT - 1 && (latency >> bucket) != 0)
+    ++bucket;
+
+  ++histogram->count;
+  histogram->total_time += latency;
+  histogram->max_time = sc_max(histogram->max_time, latency);
+  ++histogram->buckets[bucket];
+}
+
+/*! Function that gets histograms of latencies of events of the specified type and priority class.
+ * @note Queue mutex must be locked.
+ */
+sc_latency_histogram * _sc_event_emission_manager_get_latencies(
+    sc_event_emission_manager * manager,
+    sc_event_emission_pool_worker_data const * data)
+{
+  if (data->type < 0 || data->type >= SC_EVENT_TYPES_COUNT)
+    return null_ptr;
+
+  return manager->latencies[data->type][data->priority];
+}
+
+/*! Function that marks an event as taken from queue by a worker of the event emission pool.
+ * @param manager Pointer to the sc_event_emission_manager managing the event emission.
+ * @param data Pointer to the sc_event_emission_pool_worker_data taken from queue.
+ * @returns Returns monotonic time in microseconds when the worker started processing of the event.
+ */
+sc_int64 _sc_event_emission_manager_pop(sc_event_emission_manager * manager, sc_event_emission_pool_worker_data * data)
+{
+  sc_int64 const start_time = g_get_monotonic_time();
+  sc_uint64 const wait_time = start_time - data->enqueue_time;
+
+  sc_mutex_lock(&manager->queue_mutex);
+  --manager->stat.size;
+  ++manager->stat.processed_count;
+  manager->stat.total_wait_time += wait_time;
+  manager->stat.max_wait_time = sc_max(manager->stat.max_wait_time, wait_time);
+
+  ++manager->busy_workers_count;
+  manager->max_busy_workers_count = sc_max(manager->max_busy_workers_count, manager->busy_workers_count);
+
+  sc_latency_histogram * latencies = _sc_event_emission_manager_get_latencies(manager, data);
+  if (latencies != null_ptr)
+  {
+    _sc_latency_histogram_add(&latencies[SC_EVENT_LATENCY_PENDING], data->enqueue_time - data->emit_time);
+    _sc_latency_histogram_add(&latencies[SC_EVENT_LATENCY_QUEUED], wait_time);
+  }
+
+  sc_cond_signal(&manager->queue_condition);
+  sc_mutex_unlock(&manager->queue_mutex);
+
+  return start_time;
+}
+
+/*! Function that marks an event as completed by a worker of the event emission pool.
+ * @param manager Pointer to the sc_event_emission_manager managing the event emission.
+ * @param data Pointer to the sc_event_emission_pool_worker_data taken from queue.
+ * @param start_time Monotonic time in microseconds when the worker started processing of the event.
+ * @param is_processed Whether callback of the event was called, latencies of callbacks are measured only.
+ */
+void _sc_event_emission_manager_complete(
+    sc_event_emission_manager * manager,
+    sc_event_emission_pool_worker_data * data,
+    sc_int64 start_time,
+    sc_bool is_processed)
+{
+  sc_int64 const end_time = g_get_monotonic_time();
+
+  sc_mutex_lock(&manager->queue_mutex);
+  --manager->busy_workers_count;
+  manager->busy_time += end_time - start_time;
+
+  sc_latency_histogram * latencies = _sc_event_emission_manager_get_latencies(manager, data);
+  if (is_processed && latencies != null_ptr)
+  {
+    _sc_latency_histogram_add(&latencies[SC_EVENT_LATENCY_PROCESSING], end_time - start_time);
+    _sc_latency_histogram_add(&latencies[SC_EVENT_LATENCY_TOTAL], end_time - data->emit_time);
+  }
+  sc_mutex_unlock(&manager->queue_mutex);
+}
+
+/*! Function that schedules delivery of batch of emitted events for the specified sc-event.
+ * @param manager Pointer to the sc_event_emission_manager managing the event emission.
+ * @param event Pointer to the sc-event with batch.
+ * @note Batch mutex must be locked. Latencies of batch delivery are measured from emission of the first event in batch.
+ */
+void _sc_event_emission_manager_schedule_batch(sc_event_emission_manager * manager, sc_event * event)
+{
+  sc_event_batch * batch = event->batch;
+  batch->is_scheduled = SC_TRUE;
+
+  sc_event_emission_pool_worker_data * data = _sc_event_emission_pool_worker_data_new(
+      event, SC_ADDR_EMPTY, SC_ADDR_EMPTY, 0, SC_ADDR_EMPTY, batch->flush_time - batch->max_delay);
+  _sc_event_emission_manager_push(manager, data, SC_FALSE);
+}
+
+/*! Function that wakes up the thread flushing batches, so it recalculates time of the next flush.
+ * @param manager Pointer to the sc_event_emission_manager managing the event emission.
+ */
+void _sc_event_emission_manager_notify_batches_flusher(sc_event_emission_manager * manager)
+{
+  sc_mutex_lock(&manager->batches_mutex);
+  sc_cond_signal(&manager->batches_condition);
+  sc_mutex_unlock(&manager->batches_mutex);
+}
+
+/*! Function that delivers emitted events waiting in batch of the specified sc-event, but no more than maximum size of
+ * batch. The rest events stay in batch and are delivered by the next scheduled delivery.
+ * @param manager Pointer to the sc_event_emission_manager managing the event emission.
+ * @param event Pointer to the sc-event with batch.
+ * @param callback Batch callback of the sc-event.
+ */
+void _sc_event_emission_pool_worker_deliver_batch(
+    sc_event_emission_manager * manager,
+    sc_event * event,
+    sc_event_batch_callback callback)
+{
+  sc_event_batch * batch = event->batch;
+
+  sc_mutex_lock(&batch->mutex);
+  sc_event_batch_item * items;
+  sc_uint32 const items_count = sc_min(batch->items_count, batch->max_size);
+  if (items_count == batch->items_count)
+  {
+    items = batch->items;
+    batch->items = null_ptr;
+    batch->items_count = 0;
+    batch->items_capacity = 0;
+  }
+  else
+  {
+    // events are accumulated while worker is busy, so they are delivered by several batches
+    items = sc_mem_new(sc_event_batch_item, items_count);
+    sc_mem_cpy(items, batch->items, items_count * sizeof(sc_event_batch_item));
+    batch->items_count -= items_count;
+    memmove(batch->items, batch->items + items_count, batch->items_count * sizeof(sc_event_batch_item));
+  }
+  sc_mutex_unlock(&batch->mutex);
+
+  if (items_count != 0)
+    callback(event, items, items_count);
+  sc_mem_free(items);
+
+  // events emitted during delivery are delivered by the next batch, so order of events is preserved
+  sc_bool is_waiting = SC_FALSE;
+  sc_mutex_lock(&batch->mutex);
+  batch->is_scheduled = SC_FALSE;
+  if (batch->items_count >= batch->max_size
+      || (batch->items_count != 0 && g_get_monotonic_time() >= batch->flush_time))
+    _sc_event_emission_manager_schedule_batch(manager, event);
+  else
+    is_waiting = batch->items_count != 0;
+  sc_mutex_unlock(&batch->mutex);
+
+  if (is_waiting)
+    _sc_event_emission_manager_notify_batches_flusher(manager);
+}
+
 /*! Function that represents the work performed by a worker in the event emission pool.
  * @param data Pointer to the sc_event_emission_pool_worker_data containing information about the work.
  * @param user_data Pointer to the sc_event_emission_manager managing the event emission.
@@ -67,6 +349,10 @@ void _sc_event_emission_pool_worker(sc_pointer data, sc_pointer user_data)
   sc_event_emission_pool_worker_data * work_data = (sc_event_emission_pool_worker_data *)data;
   sc_event_emission_manager * queue = user_data;
 
+  g_private_set(&sc_event_emission_pool_thread, GINT_TO_POINTER(SC_TRUE));
+  sc_int64 const start_time = _sc_event_emission_manager_pop(queue, work_data);
+  sc_bool is_processed = SC_FALSE;
+
   sc_event * event = work_data->event;
   if (event == null_ptr)
     goto destroy;
@@ -86,10 +372,13 @@ void _sc_event_emission_pool_worker(sc_pointer data, sc_pointer user_data)
   sc_event_callback callback = event->callback;
   sc_event_callback_ext callback_ext = event->callback_ext;
   sc_event_callback_with_user callback_ext2 = event->callback_with_user;
+  sc_event_batch_callback batch_callback = event->batch_callback;
 
   sc_storage_start_new_process();
 
-  if (callback != null_ptr)
+  if (batch_callback != null_ptr)
+    _sc_event_emission_pool_worker_deliver_batch(queue, event, batch_callback);
+  else if (callback != null_ptr)
     callback(event, work_data->connector_addr);
   else if (callback_ext != null_ptr)
     callback_ext(event, work_data->connector_addr, work_data->other_addr);
@@ -98,15 +387,70 @@ void _sc_event_emission_pool_worker(sc_pointer data, sc_pointer user_data)
         event, work_data->user_addr, work_data->connector_addr, work_data->connector_type, work_data->other_addr);
 
   sc_storage_end_new_process();
+  is_processed = SC_TRUE;
 
   sc_monitor_release_read(&event->monitor);
 
 end:
   sc_monitor_release_read(&queue->destroy_monitor);
 destroy:
+  _sc_event_emission_manager_complete(queue, work_data, start_time, is_processed);
   _sc_event_emission_pool_worker_data_destroy(work_data);
 }
 
+/*! Function that schedules delivery of batches which time is over.
+ * @param data Pointer to the sc_event_emission_manager managing the event emission.
+ * @returns Returns null_ptr.
+ */
+sc_pointer _sc_event_emission_manager_flush_batches(sc_pointer data)
+{
+  sc_event_emission_manager * manager = data;
+
+  sc_mutex_lock(&manager->batches_mutex);
+  while (manager->batches_flushing)
+  {
+    sc_int64 const now = g_get_monotonic_time();
+    sc_int64 wake_time = now + SC_EVENT_BATCHES_FLUSHER_IDLE_TIME;
+
+    for (sc_hash_table_list * it = manager->batched_events; it != null_ptr; it = it->next)
+    {
+      sc_event * event = it->data;
+      sc_event_batch * batch = event->batch;
+
+      sc_mutex_lock(&batch->mutex);
+      if (batch->items_count != 0 && batch->is_scheduled == SC_FALSE)
+      {
+        if (batch->flush_time <= now)
+          _sc_event_emission_manager_schedule_batch(manager, event);
+        else if (batch->flush_time < wake_time)
+          wake_time = batch->flush_time;
+      }
+      sc_mutex_unlock(&batch->mutex);
+    }
+
+    sc_cond_wait_until(&manager->batches_condition, &manager->batches_mutex, wake_time);
+  }
+  sc_mutex_unlock(&manager->batches_mutex);
+
+  return null_ptr;
+}
+
+sc_result sc_events_queue_overflow_policy_parse(sc_char const * string, sc_events_queue_overflow_policy * policy)
+{
+  *policy = SC_EVENTS_QUEUE_OVERFLOW_BLOCK;
+  if (string == null_ptr || sc_str_cmp(string, "Block"))
+    return SC_RESULT_OK;
+
+  if (sc_str_cmp(string, "Spill"))
+    *policy = SC_EVENTS_QUEUE_OVERFLOW_SPILL;
+  else if (sc_str_cmp(string, "Drop"))
+    *policy = SC_EVENTS_QUEUE_OVERFLOW_DROP;
+  else
+    return SC_RESULT_ERROR_INVALID_PARAMS;
+
+  return SC_RESULT_OK;
+}
+
 void sc_event_emission_manager_initialize(sc_event_emission_manager ** manager, sc_memory_params const * params)
 {
   *manager = sc_mem_new(sc_event_emission_manager, 1);
@@ -125,16 +469,46 @@ void sc_event_emission_manager_initialize(sc_event_emission_manager ** manager,
     sc_message("\tMax events and agents threads: %d", (*manager)->max_events_and_agents_threads);
   }
 
+  (*manager)->max_events_queue_size = params->max_events_queue_size;
+  // params are checked by sc-storage before sc-memory is initialized
+  sc_events_queue_overflow_policy_parse(params->events_queue_overflow_policy, &(*manager)->overflow_policy);
+  {
+    sc_message("\tMax events queue size: %u", (*manager)->max_events_queue_size);
+    sc_message(
+        "\tEvents queue overflow policy: %s",
+        (*manager)->overflow_policy == SC_EVENTS_QUEUE_OVERFLOW_SPILL
+            ? "Spill"
+            : ((*manager)->overflow_policy == SC_EVENTS_QUEUE_OVERFLOW_DROP ? "Drop" : "Block"));
+  }
+  sc_mutex_init(&(*manager)->queue_mutex);
+  sc_cond_init(&(*manager)->queue_condition);
+  (*manager)->queue_sequence = 0;
+  sc_mem_set(&(*manager)->stat, 0, sizeof(sc_events_queue_stat));
+  (*manager)->busy_workers_count = 0;
+  (*manager)->max_busy_workers_count = 0;
+  (*manager)->busy_time = 0;
+  sc_mem_set((*manager)->latencies, 0, sizeof((*manager)->latencies));
+
   (*manager)->running = SC_TRUE;
   sc_monitor_init(&(*manager)->destroy_monitor);
 
   sc_monitor_init(&(*manager)->pool_monitor);
+  (*manager)->start_time = g_get_monotonic_time();
   (*manager)->thread_pool = g_thread_pool_new(
       _sc_event_emission_pool_worker,
       *manager,
       (sc_int32)(*manager)->max_events_and_agents_threads,
       SC_FALSE,
       null_ptr);
+  g_thread_pool_set_sort_function(
+      (*manager)->thread_pool, (GCompareDataFunc)_sc_event_emission_pool_worker_data_compare, null_ptr);
+
+  (*manager)->batched_events = null_ptr;
+  sc_mutex_init(&(*manager)->batches_mutex);
+  sc_cond_init(&(*manager)->batches_condition);
+  (*manager)->batches_flushing = SC_TRUE;
+  (*manager)->batches_flusher =
+      sc_thread_new("sc-events-batches", _sc_event_emission_manager_flush_batches, *manager);
 }
 
 void sc_event_emission_manager_stop(sc_event_emission_manager * manager)
@@ -153,6 +527,11 @@ void sc_event_emission_manager_stop(sc_event_emission_manager * manager)
     sc_monitor_acquire_write(&manager->destroy_monitor);
     manager->running = SC_FALSE;
     sc_monitor_release_write(&manager->destroy_monitor);
+
+    // emitters waiting for free space in queue are released
+    sc_mutex_lock(&manager->queue_mutex);
+    sc_cond_broadcast(&manager->queue_condition);
+    sc_mutex_unlock(&manager->queue_mutex);
   }
 }
 
@@ -161,6 +540,13 @@ void sc_event_emission_manager_shutdown(sc_event_emission_manager * manager)
   if (manager == null_ptr)
     return;
 
+  // the thread flushing batches pushes tasks to the thread pool, so it is stopped before the thread pool
+  sc_mutex_lock(&manager->batches_mutex);
+  manager->batches_flushing = SC_FALSE;
+  sc_cond_signal(&manager->batches_condition);
+  sc_mutex_unlock(&manager->batches_mutex);
+  sc_thread_join(manager->batches_flusher);
+
   sc_monitor_acquire_write(&manager->pool_monitor);
   if (manager->thread_pool)
   {
@@ -171,33 +557,167 @@ void sc_event_emission_manager_shutdown(sc_event_emission_manager * manager)
   while (!sc_queue_empty(&manager->deletable_events))
   {
     sc_event * event = sc_queue_pop(&manager->deletable_events);
+    sc_event_batch_destroy(event);
     sc_monitor_destroy(&event->monitor);
     sc_mem_free(event);
+    sc_mem_account_free(SC_ALLOCATIONS_EVENTS, 1, sizeof(sc_event));
   }
   sc_queue_destroy(&manager->deletable_events);
 
   sc_monitor_release_write(&manager->pool_monitor);
 
+  sc_hash_table_list_destroy(manager->batched_events);
+  sc_cond_destroy(&manager->batches_condition);
+  sc_mutex_destroy(&manager->batches_mutex);
+
+  sc_cond_destroy(&manager->queue_condition);
+  sc_mutex_destroy(&manager->queue_mutex);
+
   sc_monitor_destroy(&manager->pool_monitor);
   sc_monitor_destroy(&manager->destroy_monitor);
   sc_mem_free(manager);
 }
 
-void _sc_event_emission_manager_add(
+/*! Function that adds emitted event to batch of the specified sc-event.
+ * @note Batch delivery is scheduled, when batch is full. Otherwise, the thread flushing batches schedules it, when
+ * time of the first event in batch is over.
+ */
+void _sc_event_emission_manager_add_to_batch(
     sc_event_emission_manager * manager,
     sc_event * event,
     sc_addr user_addr,
     sc_addr connector_addr,
     sc_type connector_type,
     sc_addr other_addr)
+{
+  sc_event_batch * batch = event->batch;
+
+  sc_mutex_lock(&batch->mutex);
+  if (batch->items_count == batch->items_capacity)
+  {
+    batch->items_capacity =
+        batch->items_capacity == 0 ? SC_EVENT_BATCH_INITIAL_CAPACITY : batch->items_capacity * 2;
+    batch->items = sc_mem_realloc(batch->items, batch->items_capacity, sizeof(sc_event_batch_item));
+  }
+
+  sc_bool const is_new_batch = batch->items_count == 0;
+  if (is_new_batch)
+    batch->flush_time = g_get_monotonic_time() + batch->max_delay;
+
+  sc_event_batch_item * item = &batch->items[batch->items_count++];
+  item->user_addr = user_addr;
+  item->connector_addr = connector_addr;
+  item->connector_type = connector_type;
+  item->other_addr = other_addr;
+
+  if (batch->is_scheduled == SC_FALSE && batch->items_count >= batch->max_size)
+    _sc_event_emission_manager_schedule_batch(manager, event);
+  sc_mutex_unlock(&batch->mutex);
+
+  if (is_new_batch)
+    _sc_event_emission_manager_notify_batches_flusher(manager);
+}
+
+void _sc_event_emission_manager_add(
+    sc_event_emission_manager * manager,
+    sc_event * event,
+    sc_addr user_addr,
+    sc_addr connector_addr,
+    sc_type connector_type,
+    sc_addr other_addr,
+    sc_int64 emit_time)
 {
   if (manager == null_ptr)
     return;
 
-  sc_event_emission_pool_worker_data * data =
-      _sc_event_emission_pool_worker_data_new(event, user_addr, connector_addr, connector_type, other_addr);
+  if (event->batch != null_ptr)
+  {
+    _sc_event_emission_manager_add_to_batch(manager, event, user_addr, connector_addr, connector_type, other_addr);
+    return;
+  }
 
-  sc_monitor_acquire_write(&manager->pool_monitor);
-  g_thread_pool_push(manager->thread_pool, data, null_ptr);
-  sc_monitor_release_write(&manager->pool_monitor);
+  sc_event_emission_pool_worker_data * data = _sc_event_emission_pool_worker_data_new(
+      event, user_addr, connector_addr, connector_type, other_addr, emit_time);
+  _sc_event_emission_manager_push(manager, data, SC_TRUE);
+}
+
+void sc_event_emission_manager_get_stat(sc_event_emission_manager * manager, sc_events_queue_stat * stat)
+{
+  if (manager == null_ptr)
+  {
+    sc_mem_set(stat, 0, sizeof(sc_events_queue_stat));
+    return;
+  }
+
+  sc_mutex_lock(&manager->queue_mutex);
+  *stat = manager->stat;
+  sc_mutex_unlock(&manager->queue_mutex);
+}
+
+void sc_event_emission_manager_get_latency_stat(
+    sc_event_emission_manager * manager,
+    sc_events_latency_stat ** stats,
+    sc_uint32 * count)
+{
+  *stats = null_ptr;
+  *count = 0;
+
+  if (manager == null_ptr)
+    return;
+
+  *stats = sc_mem_new(sc_events_latency_stat, SC_EVENT_TYPES_COUNT * SC_EVENT_PRIORITIES_COUNT);
+
+  sc_mutex_lock(&manager->queue_mutex);
+  for (sc_int32 type = 0; type < SC_EVENT_TYPES_COUNT; ++type)
+  {
+    for (sc_uint8 priority = 0; priority < SC_EVENT_PRIORITIES_COUNT; ++priority)
+    {
+      sc_latency_histogram const * latencies = manager->latencies[type][priority];
+      if (latencies[SC_EVENT_LATENCY_QUEUED].count == 0)
+        continue;
+
+      sc_events_latency_stat * stat = &(*stats)[(*count)++];
+      stat->event_type = (sc_event_type)type;
+      stat->priority = priority;
+      sc_mem_cpy(stat->phases, latencies, sizeof(stat->phases));
+    }
+  }
+  sc_mutex_unlock(&manager->queue_mutex);
+}
+
+void sc_event_emission_manager_get_workers_stat(sc_event_emission_manager * manager, sc_events_workers_stat * stat)
+{
+  if (manager == null_ptr)
+  {
+    sc_mem_set(stat, 0, sizeof(sc_events_workers_stat));
+    return;
+  }
+
+  sc_mutex_lock(&manager->queue_mutex);
+  stat->max_workers_count = manager->max_events_and_agents_threads;
+  stat->busy_workers_count = manager->busy_workers_count;
+  stat->max_busy_workers_count = manager->max_busy_workers_count;
+  stat->busy_time = manager->busy_time;
+  stat->uptime = g_get_monotonic_time() - manager->start_time;
+  sc_mutex_unlock(&manager->queue_mutex);
+}
+
+void _sc_event_emission_manager_add_batched_event(sc_event_emission_manager * manager, sc_event * event)
+{
+  if (manager == null_ptr)
+    return;
+
+  sc_mutex_lock(&manager->batches_mutex);
+  manager->batched_events = sc_hash_table_list_append(manager->batched_events, event);
+  sc_mutex_unlock(&manager->batches_mutex);
+}
+
+void _sc_event_emission_manager_remove_batched_event(sc_event_emission_manager * manager, sc_event * event)
+{
+  if (manager == null_ptr)
+    return;
+
+  sc_mutex_lock(&manager->batches_mutex);
+  manager->batched_events = sc_hash_table_list_remove(manager->batched_events, event);
+  sc_mutex_unlock(&manager->batches_mutex);
 }
@@ -10,9 +10,26 @@
 #include "../../sc_memory_params.h"
 
 #include "../sc_types.h"
+#include "../sc_event.h"
 #include "../sc-base/sc_mutex.h"
 #include "../sc-container/sc-hash-table/sc_hash_table.h"
 #include "../sc-base/sc_monitor.h"
+#include "../sc-base/sc_condition.h"
+#include "../sc-base/sc_thread.h"
+
+/*! Policies for sc-events emitted into full sc-events queue.
+ */
+typedef enum
+{
+  SC_EVENTS_QUEUE_OVERFLOW_BLOCK,  ///< Emitter waits for free space in queue
+  SC_EVENTS_QUEUE_OVERFLOW_SPILL,  ///< Emitted sc-event is queued over queue capacity, but at most twice of it
+  SC_EVENTS_QUEUE_OVERFLOW_DROP,   ///< Emitted sc-event is dropped
+} sc_events_queue_overflow_policy;
+
+//! Amount of sc-event types which latencies are measured
+#define SC_EVENT_TYPES_COUNT (SC_EVENT_CONTENT_CHANGED + 1)
+//! Amount of priority classes of sc-event subscriptions
+#define SC_EVENT_PRIORITIES_COUNT (SC_EVENT_PRIORITY_BACKGROUND + 1)
 
 /*! Structure representing an sc-event emission manager.
  * @note This structure manages the asynchronous processing of sc-events using a thread pool.
@@ -27,8 +44,32 @@ typedef struct
   sc_monitor destroy_monitor;               ///< Monitor for synchronizing access to the destruction process.
   GThreadPool * thread_pool;                ///< Thread pool used for worker threads processing events.
   sc_monitor pool_monitor;                  ///< Monitor for synchronizing access to the thread pool.
+  sc_uint32 max_events_queue_size;  ///< Maximum number of emitted events waiting for processing, 0 is unbounded.
+  sc_events_queue_overflow_policy overflow_policy;  ///< Policy for events emitted into full queue.
+  sc_mutex queue_mutex;                     ///< Mutex for synchronizing access to queue size and statistics.
+  sc_condition queue_condition;             ///< Condition to wake up emitters waiting for free space in queue.
+  sc_uint64 queue_sequence;                 ///< Number of the last queued event, it orders events of one priority.
+  sc_events_queue_stat stat;                ///< Statistics of events queue.
+  sc_int64 start_time;                      ///< Monotonic time in microseconds when the thread pool was started.
+  sc_uint32 busy_workers_count;             ///< Number of workers processing events now.
+  sc_uint32 max_busy_workers_count;         ///< Maximum number of workers processing events at the same time.
+  sc_uint64 busy_time;                      ///< Total time in microseconds that workers processed events.
+  ///< Latencies of events by their types and priority classes of their subscriptions.
+  sc_latency_histogram latencies[SC_EVENT_TYPES_COUNT][SC_EVENT_PRIORITIES_COUNT][SC_EVENT_LATENCY_PHASES_COUNT];
+  sc_hash_table_list * batched_events;      ///< List of sc-events which emitted events are delivered in batches.
+  sc_mutex batches_mutex;                   ///< Mutex for synchronizing access to the list of batched sc-events.
+  sc_condition batches_condition;           ///< Condition to wake up the thread flushing batches by time.
+  sc_bool batches_flushing;                 ///< Flag indicating whether the thread flushing batches is running.
+  sc_thread * batches_flusher;              ///< Thread that schedules delivery of batches which time is over.
 } sc_event_emission_manager;
 
+/*! Function that parses a policy for sc-events emitted into full sc-events queue.
+ * @param string Name of policy: "Block", "Spill" or "Drop". If it is null_ptr, then policy is "Block".
+ * @param[out] policy Pointer to parsed policy. It is "Block" if name is invalid.
+ * @returns SC_RESULT_OK if name is valid or null_ptr, otherwise SC_RESULT_ERROR_INVALID_PARAMS.
+ */
+sc_result sc_events_queue_overflow_policy_parse(sc_char const * string, sc_events_queue_overflow_policy * policy);
+
 /*! Function that initializes an sc-event emission manager.
  * @param manager Pointer to the sc_event_emission_manager to be initialized.
  * @param params Pointer to the sc-memory params.
@@ -53,6 +94,7 @@ void sc_event_emission_manager_shutdown(sc_event_emission_manager * manager);
  * @param event Pointer to the sc-event to be added for processing.
  * @param connector_addr sc-address representing the sc-connector associated with the event.
  * @param other_addr sc-address representing the other sc-element associated with the event.
+ * @param emit_time Monotonic time in microseconds when the event was emitted.
  * @note This function adds an sc-event to the event emission manager for asynchronous processing.
  */
 void _sc_event_emission_manager_add(
@@ -61,6 +103,42 @@ void _sc_event_emission_manager_add(
     sc_addr user_addr,
     sc_addr connector_addr,
     sc_type connector_type,
-    sc_addr other_addr);
+    sc_addr other_addr,
+    sc_int64 emit_time);
+
+/*! Function that gets statistics of sc-events queue.
+ * @param manager Pointer to the sc_event_emission_manager managing event emission.
+ * @param stat Pointer to structure to store statistics.
+ */
+void sc_event_emission_manager_get_stat(sc_event_emission_manager * manager, sc_events_queue_stat * stat);
+
+/*! Function that gets latencies of processed sc-events.
+ * @param manager Pointer to the sc_event_emission_manager managing event emission.
+ * @param[out] stats Pointer to array of latencies of sc-events by their types and priority classes of their
+ * subscriptions, only pairs with processed sc-events are got. It should be freed by `sc_mem_free`.
+ * @param[out] count Pointer to amount of got latencies.
+ */
+void sc_event_emission_manager_get_latency_stat(
+    sc_event_emission_manager * manager,
+    sc_events_latency_stat ** stats,
+    sc_uint32 * count);
+
+/*! Function that gets utilization of workers processing sc-events.
+ * @param manager Pointer to the sc_event_emission_manager managing event emission.
+ * @param stat Pointer to structure to store statistics.
+ */
+void sc_event_emission_manager_get_workers_stat(sc_event_emission_manager * manager, sc_events_workers_stat * stat);
+
+/*! Function that registers a batched sc-event, so its emitted events are delivered when their time is over.
+ * @param manager Pointer to the sc_event_emission_manager managing event emission.
+ * @param event Pointer to the sc-event with batch.
+ */
+void _sc_event_emission_manager_add_batched_event(sc_event_emission_manager * manager, sc_event * event);
+
+/*! Function that unregisters a batched sc-event, its emitted events waiting for delivery are dropped.
+ * @param manager Pointer to the sc_event_emission_manager managing event emission.
+ * @param event Pointer to the sc-event with batch.
+ */
+void _sc_event_emission_manager_remove_batched_event(sc_event_emission_manager * manager, sc_event * event);
 
 #endif
@@ -6,23 +6,59 @@
 
 #ifdef SC_DICTIONARY_FS_MEMORY
 
+#  include <stdlib.h>
+#  include <string.h>
+
 #  include "sc_dictionary_fs_memory.h"
 #  include "sc_dictionary_fs_memory_private.h"
 
 #  include "../sc-base/sc_allocator.h"
 #  include "../sc-container/sc-string/sc_string.h"
+#  include "../sc-container/sc-hash-table/sc_hash_table.h"
 
 #  include "sc_file_system.h"
 #  include "sc_io.h"
+#  include "../sc-base/sc_thread.h"
 
 #  define DEFAULT_STRING_INT_SIZE 20
 #  define DEFAULT_MAX_SEARCHABLE_STRING_SIZE 1000
 
 typedef struct
 {
-  sc_list * link_hashes;
-  sc_uint64 string_offset;
-} sc_link_hash_content;
+  sc_char const * data;
+  sc_uint64 size;
+  sc_uint64 position;
+} sc_dictionary_fs_memory_file_reader;
+
+//! Change of strings made when dictionaries weren't loaded
+typedef struct
+{
+  sc_addr_hash link_hash;
+  sc_uint64 string_offset;  // INVALID_STRING_OFFSET if string is unlinked from link
+  sc_uint64 content_hash;
+  sc_bool is_searchable_string;
+  sc_bool is_string_new;
+  sc_list * string_terms;  // terms of new string if they are added into `term - offsets` dictionary
+  sc_uint8 dictionaries;   // mask of groups of dictionaries which entry isn't added into
+} sc_dictionary_fs_memory_journal_entry;
+
+void _sc_dictionary_fs_memory_acquire_dictionaries(sc_dictionary_fs_memory * memory, sc_uint8 dictionaries);
+
+void _sc_dictionary_fs_memory_release_dictionaries(sc_dictionary_fs_memory * memory);
+
+sc_uint8 _sc_dictionary_fs_memory_lock_dictionaries(sc_dictionary_fs_memory * memory);
+
+sc_uint8 _sc_dictionary_fs_memory_hold_dictionaries(sc_dictionary_fs_memory * memory);
+
+sc_uint8 _sc_dictionary_fs_memory_lock_held_dictionaries(sc_dictionary_fs_memory * memory);
+
+void _sc_dictionary_fs_memory_unlock_dictionaries(sc_dictionary_fs_memory * memory, sc_uint8 changed_dictionaries);
+
+void _sc_dictionary_fs_memory_append_journal_entry(
+    sc_dictionary_fs_memory * memory,
+    sc_dictionary_fs_memory_journal_entry * entry);
+
+sc_pointer _sc_dictionary_fs_memory_unload_dictionaries_thread(sc_pointer data);
 
 sc_io_channel * _sc_dictionary_fs_memory_get_strings_channel_by_offset(
     sc_dictionary_fs_memory * memory,
@@ -135,11 +171,17 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_initialize_ext(
       (*memory)->max_searchable_string_size = sc_boundary(params->max_searchable_string_size, 10, 100000);
       (*memory)->term_separators = params->term_separators;
       (*memory)->search_by_substring = params->search_by_substring;
+      (*memory)->sorted_terms_dictionary = params->sorted_terms_dictionary;
+      (*memory)->lazy_dictionaries_loading = params->lazy_dictionaries_loading;
+      (*memory)->dictionaries_unload_period = params->dictionaries_unload_period;
     }
     {
       _sc_uchar_dictionary_initialize(&(*memory)->terms_string_offsets_dictionary);
       static sc_char const * term_string_offsets = "term_string_offsets" SC_FS_EXT;
       sc_fs_concat_path((*memory)->path, term_string_offsets, &(*memory)->terms_string_offsets_path);
+      static sc_char const * sorted_term_string_offsets = "sorted_term_string_offsets" SC_FS_EXT;
+      sc_fs_concat_path((*memory)->path, sorted_term_string_offsets, &(*memory)->sorted_terms_string_offsets_path);
+      (*memory)->terms_string_offsets_file = null_ptr;
 
       (*memory)->strings_channels = (void **)sc_mem_new(sc_io_channel *, (*memory)->max_strings_channels);
       _sc_monitor_table_init(&(*memory)->strings_channels_monitors_table);
@@ -151,6 +193,28 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_initialize_ext(
     _sc_number_dictionary_initialize(&(*memory)->string_offsets_link_hashes_dictionary);
     static sc_char const * string_offsets_link_hashes = "string_offsets_link_hashes" SC_FS_EXT;
     sc_fs_concat_path((*memory)->path, string_offsets_link_hashes, &(*memory)->string_offsets_link_hashes_path);
+
+    _sc_number_dictionary_initialize(&(*memory)->content_hashes_string_offsets_dictionary);
+    static sc_char const * content_hashes_string_offsets = "content_hashes_string_offsets" SC_FS_EXT;
+    sc_fs_concat_path(
+        (*memory)->path, content_hashes_string_offsets, &(*memory)->content_hashes_string_offsets_path);
+
+    {
+      // dictionaries are empty until they are loaded, so they are considered to be loaded
+      sc_mutex_init(&(*memory)->dictionaries_mutex);
+      sc_cond_init(&(*memory)->dictionaries_condition);
+      (*memory)->loaded_dictionaries = SC_DICTIONARY_FS_MEMORY_ALL;
+      (*memory)->loading_dictionaries = 0;
+      (*memory)->unloading_dictionaries = 0;
+      (*memory)->changed_dictionaries = 0;
+      (*memory)->dictionaries_users = 0;
+      (*memory)->dictionaries_last_use_time = g_get_monotonic_time();
+      sc_list_init(&(*memory)->journal);
+      (*memory)->journal_dictionaries = 0;
+      (*memory)->dictionaries_unloader = null_ptr;
+      sc_cond_init(&(*memory)->dictionaries_unloader_condition);
+      (*memory)->is_dictionaries_unloader_running = SC_FALSE;
+    }
   }
   sc_fs_memory_info("Configuration:");
   sc_message("\tSc-dictionary node size: %zd", sizeof(sc_dictionary_node));
@@ -164,6 +228,9 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_initialize_ext(
   sc_message("\tMax strings channel size: %d", (*memory)->max_strings_channel_size);
   sc_message("\tMax searchable string size: %d", (*memory)->max_searchable_string_size);
   sc_message("\tTerm separators: \"%s\"", (*memory)->term_separators);
+  sc_message("\tSorted terms dictionary: %s", (*memory)->sorted_terms_dictionary ? "On" : "Off");
+  sc_message("\tLazy dictionaries loading: %s", (*memory)->lazy_dictionaries_loading ? "On" : "Off");
+  sc_message("\tDictionaries unload period: %u", (*memory)->dictionaries_unload_period);
 
   sc_fs_memory_info("Successfully initialized");
 
@@ -198,11 +265,22 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_shutdown(sc_dictionary_fs
 
   sc_fs_memory_info("Shutdown");
   {
+    if (memory->dictionaries_unloader != null_ptr)
+    {
+      sc_mutex_lock(&memory->dictionaries_mutex);
+      memory->is_dictionaries_unloader_running = SC_FALSE;
+      sc_cond_signal(&memory->dictionaries_unloader_condition);
+      sc_mutex_unlock(&memory->dictionaries_mutex);
+      sc_thread_join(memory->dictionaries_unloader);
+    }
+
     sc_mem_free(memory->path);
 
     {
       sc_dictionary_destroy(memory->terms_string_offsets_dictionary, _sc_dictionary_fs_memory_node_clear);
       sc_mem_free(memory->terms_string_offsets_path);
+      sc_sorted_dictionary_file_close(memory->terms_string_offsets_file);
+      sc_mem_free(memory->sorted_terms_string_offsets_path);
 
       for (sc_uint64 i = 0; i < memory->max_strings_channels && memory->strings_channels[i] != null_ptr; ++i)
       {
@@ -216,6 +294,26 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_shutdown(sc_dictionary_fs
     sc_dictionary_destroy(memory->link_hashes_string_offsets_dictionary, _sc_dictionary_fs_memory_string_node_clear);
     sc_dictionary_destroy(memory->string_offsets_link_hashes_dictionary, _sc_dictionary_fs_memory_link_node_clear);
     sc_mem_free(memory->string_offsets_link_hashes_path);
+
+    sc_dictionary_destroy(memory->content_hashes_string_offsets_dictionary, _sc_dictionary_fs_memory_node_clear);
+    sc_mem_free(memory->content_hashes_string_offsets_path);
+
+    {
+      sc_iterator * entry_it = sc_list_iterator(memory->journal);
+      while (sc_iterator_next(entry_it))
+      {
+        sc_dictionary_fs_memory_journal_entry * entry = sc_iterator_get(entry_it);
+        sc_list_clear(entry->string_terms);
+        sc_list_destroy(entry->string_terms);
+      }
+      sc_iterator_destroy(entry_it);
+      sc_list_clear(memory->journal);
+      sc_list_destroy(memory->journal);
+
+      sc_cond_destroy(&memory->dictionaries_unloader_condition);
+      sc_cond_destroy(&memory->dictionaries_condition);
+      sc_mutex_destroy(&memory->dictionaries_mutex);
+    }
   }
   sc_mem_free(memory);
 
@@ -223,7 +321,7 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_shutdown(sc_dictionary_fs
   return SC_FS_MEMORY_OK;
 }
 
-void _sc_dictionary_fs_memory_append(
+sc_list * _sc_dictionary_fs_memory_append(
     sc_dictionary * dictionary,
     sc_char const * key,
     sc_uint64 const key_size,
@@ -234,13 +332,15 @@ void _sc_dictionary_fs_memory_append(
   {
     sc_char * copied_key;
     sc_str_cpy(copied_key, key, key_size);
+    sc_mem_account_new(SC_ALLOCATIONS_DICTIONARIES, 0, key_size + 1);
 
-    sc_list_init(&list);
+    list = _sc_dictionary_fs_memory_list_new();
     sc_dictionary_append(dictionary, copied_key, key_size, list);
-    sc_list_push_back(list, copied_key);
+    _sc_dictionary_fs_memory_list_push_back(list, copied_key);
   }
 
-  sc_list_push_back(list, data);
+  _sc_dictionary_fs_memory_list_push_back(list, data);
+  return list;
 }
 
 sc_bool _sc_addr_hash_compare(void * addr_hash, void * other_addr_hash)
@@ -264,7 +364,7 @@ void _sc_dictionary_fs_memory_append_link_string_unique(
     is_content_new = (content == null_ptr);
     if (is_content_new)
     {
-      content = sc_mem_new(sc_link_hash_content, 1);
+      content = _sc_dictionary_fs_memory_link_hash_content_new();
       sc_dictionary_append(memory->link_hashes_string_offsets_dictionary, link_hash_str, link_hash_str_size, content);
     }
   }
@@ -278,7 +378,7 @@ void _sc_dictionary_fs_memory_append_link_string_unique(
         memory->string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size);
     if (link_hashes == null_ptr)
     {
-      sc_list_init(&link_hashes);
+      link_hashes = _sc_dictionary_fs_memory_list_new();
       sc_dictionary_append(
           memory->string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size, link_hashes);
     }
@@ -286,13 +386,13 @@ void _sc_dictionary_fs_memory_append_link_string_unique(
 
   {
     if (!is_content_new && content->link_hashes != link_hashes)
-      sc_list_remove_if(content->link_hashes, (void *)link_hash, _sc_addr_hash_compare);
+      _sc_dictionary_fs_memory_list_remove_if(content->link_hashes, (void *)link_hash, _sc_addr_hash_compare);
 
     if (content->link_hashes != link_hashes)
     {
       content->string_offset = string_offset + 1;
       content->link_hashes = link_hashes;
-      sc_list_push_back(content->link_hashes, (void *)link_hash);
+      _sc_dictionary_fs_memory_list_push_back(content->link_hashes, (void *)link_hash);
     }
   }
 }
@@ -340,14 +440,19 @@ sc_dictionary_fs_memory_status _sc_dictionary_node_fs_memory_get_string_offset_b
       if (other_string_size != string_size)
         continue;
 
-      sc_char other_string[other_string_size + 1];
+      // strings with the same content hash may be long, so they are compared in heap memory
+      sc_char * other_string = sc_mem_new(sc_char, other_string_size + 1);
       if (sc_io_channel_read_chars(strings_channel, other_string, other_string_size, &read_bytes, null_ptr)
               != SC_FS_IO_STATUS_NORMAL
           || other_string_size != read_bytes)
+      {
+        sc_mem_free(other_string);
         goto error;
-      other_string[other_string_size] = '\0';
+      }
 
-      if (sc_str_cmp(string, other_string) == SC_FALSE)
+      sc_bool const is_equal = memcmp(string, other_string, string_size) == 0;
+      sc_mem_free(other_string);
+      if (is_equal == SC_FALSE)
         continue;
     }
 
@@ -363,15 +468,41 @@ error:
   return SC_FS_MEMORY_READ_ERROR;
 }
 
+sc_list * _sc_dictionary_fs_memory_get_string_offsets_by_content_hash(
+    sc_dictionary_fs_memory const * memory,
+    sc_uint64 const content_hash)
+{
+  sc_char content_hash_str[DEFAULT_STRING_INT_SIZE];
+  sc_uint64 content_hash_str_size;
+  sc_int_to_str_int(content_hash, content_hash_str, content_hash_str_size);
+  return sc_dictionary_get_by_key(
+      memory->content_hashes_string_offsets_dictionary, content_hash_str, content_hash_str_size);
+}
+
+void _sc_dictionary_fs_memory_append_content_hash_string_offset(
+    sc_dictionary_fs_memory * memory,
+    sc_uint64 const content_hash,
+    sc_uint64 const string_offset)
+{
+  sc_char content_hash_str[DEFAULT_STRING_INT_SIZE];
+  sc_uint64 content_hash_str_size;
+  sc_int_to_str_int(content_hash, content_hash_str, content_hash_str_size);
+  _sc_dictionary_fs_memory_append(
+      memory->content_hashes_string_offsets_dictionary,
+      content_hash_str,
+      content_hash_str_size,
+      (void *)string_offset);
+}
+
 sc_uint64 _sc_dictionary_fs_memory_get_string_offset_by_string(
     sc_dictionary_fs_memory * memory,
     sc_io_channel * strings_channel,
     sc_monitor * channel_monitor,
     sc_char const * string,
     sc_uint64 const string_size,
-    sc_char const * term)
+    sc_uint64 const content_hash)
 {
-  sc_list * string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term(memory, term);
+  sc_list * string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_content_hash(memory, content_hash);
 
   sc_uint64 string_offset = INVALID_STRING_OFFSET;
   _sc_dictionary_node_fs_memory_get_string_offset_by_string(
@@ -384,7 +515,6 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_string(
     sc_addr_hash const link_hash,
     sc_char const * string,
     sc_uint64 const string_size,
-    sc_list const * string_terms,
     sc_bool is_searchable_string,
     sc_uint64 * string_offset,
     sc_bool * is_not_exist)
@@ -398,11 +528,12 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_string(
 
   sc_monitor_acquire_write(&memory->monitor);
   sc_monitor_acquire_write(channel_monitor);
-  // find string if it exists in fs-memory
+  // find string if it exists in fs-memory, strings with the same content hash are compared to resolve collisions
+  sc_uint64 const content_hash = _sc_dictionary_fs_memory_get_content_hash(string, string_size);
   if (is_searchable_string)
   {
     *string_offset = _sc_dictionary_fs_memory_get_string_offset_by_string(
-        memory, strings_channel, channel_monitor, string, string_size, string_terms->begin->data);
+        memory, strings_channel, channel_monitor, string, string_size, content_hash);
   }
 
   *is_not_exist = (*string_offset == INVALID_STRING_OFFSET);
@@ -434,6 +565,9 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_write_string(
     }
 
     memory->last_string_offset += written_bytes;
+
+    if (is_searchable_string)
+      _sc_dictionary_fs_memory_append_content_hash_string_offset(memory, content_hash, *string_offset);
   }
 
   sc_monitor_release_write(channel_monitor);
@@ -492,42 +626,78 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_link_string_ext(
     return SC_FS_MEMORY_NO;
   }
 
-  is_searchable_string &= string_size < memory->max_searchable_string_size;
+  // strings of any size can be found by content hash, but big strings aren't divided into terms
+  sc_bool const is_searchable_by_terms = is_searchable_string && string_size < memory->max_searchable_string_size;
   sc_list * string_terms = null_ptr;
-  // don't divide into terms big strings if you don't need to search them
-  if (is_searchable_string)
+  if (is_searchable_by_terms)
     string_terms = _sc_dictionary_fs_memory_get_string_terms(string, memory->term_separators);
 
+  // dictionaries loaded now aren't unloaded while string is written, but they are locked only to add string into them
+  sc_uint8 const held_dictionaries = _sc_dictionary_fs_memory_hold_dictionaries(memory);
+  sc_bool const is_links_held = (held_dictionaries & SC_DICTIONARY_FS_MEMORY_LINKS) != 0;
+
+  // existing string can be found only by loaded `content hash - offsets` dictionary, otherwise string is written again
   sc_bool is_not_exist = SC_TRUE;
   sc_uint64 string_offset;
   sc_dictionary_fs_memory_status status = _sc_dictionary_fs_memory_write_string(
-      memory, link_hash, string, string_size, string_terms, is_searchable_string, &string_offset, &is_not_exist);
+      memory, link_hash, string, string_size, is_searchable_string && is_links_held, &string_offset, &is_not_exist);
+
+  sc_uint8 const loaded_dictionaries = _sc_dictionary_fs_memory_lock_held_dictionaries(memory);
+  sc_bool const is_links_loaded = (loaded_dictionaries & SC_DICTIONARY_FS_MEMORY_LINKS) != 0;
   if (status != SC_FS_MEMORY_OK)
+  {
+    _sc_dictionary_fs_memory_unlock_dictionaries(memory, 0);
+    sc_list_clear(string_terms);
+    sc_list_destroy(string_terms);
     return status;
+  }
 
-  // cache string offset and link hash data
+  // dictionaries loaded while string was written don't have its content hash
+  if (is_links_loaded && !is_links_held && is_searchable_string && is_not_exist)
   {
-    _sc_dictionary_fs_memory_append_link_string_unique(memory, link_hash, string_offset);
+    sc_monitor_acquire_write(&memory->monitor);
+    _sc_dictionary_fs_memory_append_content_hash_string_offset(
+        memory, _sc_dictionary_fs_memory_get_content_hash(string, string_size), string_offset);
+    sc_monitor_release_write(&memory->monitor);
   }
 
-  if (is_searchable_string && is_not_exist)
+  // last string offset is saved with `term - offsets` dictionary
+  sc_uint8 const changed_dictionaries = is_not_exist ? SC_DICTIONARY_FS_MEMORY_ALL : SC_DICTIONARY_FS_MEMORY_LINKS;
+
+  // cache string offset and link hash data
+  if (is_links_loaded)
+    _sc_dictionary_fs_memory_append_link_string_unique(memory, link_hash, string_offset);
+
+  if (is_searchable_by_terms && is_not_exist && (loaded_dictionaries & SC_DICTIONARY_FS_MEMORY_TERMS))
     status = _sc_dictionary_fs_memory_write_string_terms_string_offset(memory, string_offset, string_terms);
+
+  sc_uint8 const journal_dictionaries = changed_dictionaries & ~loaded_dictionaries;
+  if (journal_dictionaries != 0)
+  {
+    sc_dictionary_fs_memory_journal_entry * entry = sc_mem_new(sc_dictionary_fs_memory_journal_entry, 1);
+    entry->link_hash = link_hash;
+    entry->string_offset = string_offset;
+    entry->content_hash = _sc_dictionary_fs_memory_get_content_hash(string, string_size);
+    entry->is_searchable_string = is_searchable_string;
+    entry->is_string_new = is_not_exist;
+    entry->dictionaries = journal_dictionaries;
+    if (is_searchable_by_terms && (journal_dictionaries & SC_DICTIONARY_FS_MEMORY_TERMS))
+    {
+      entry->string_terms = string_terms;
+      string_terms = null_ptr;
+    }
+    _sc_dictionary_fs_memory_append_journal_entry(memory, entry);
+  }
+
+  _sc_dictionary_fs_memory_unlock_dictionaries(memory, changed_dictionaries);
   sc_list_clear(string_terms);
   sc_list_destroy(string_terms);
 
   return status;
 }
 
-sc_dictionary_fs_memory_status sc_dictionary_fs_memory_unlink_string(
-    sc_dictionary_fs_memory * memory,
-    sc_addr_hash const link_hash)
+void _sc_dictionary_fs_memory_unlink_string(sc_dictionary_fs_memory * memory, sc_addr_hash const link_hash)
 {
-  if (memory == null_ptr)
-  {
-    sc_fs_memory_info("Memory is empty to unlink string");
-    return SC_FS_MEMORY_NO;
-  }
-
   sc_monitor_acquire_write(&memory->monitor);
 
   sc_char link_hash_str[DEFAULT_STRING_INT_SIZE];
@@ -541,8 +711,8 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_unlink_string(
     if (link_hash_content == null_ptr)
       goto result;
 
-    sc_list_remove_if(link_hash_content->link_hashes, (void *)link_hash, _sc_addr_hash_compare);
-    sc_mem_free(link_hash_content);
+    _sc_dictionary_fs_memory_list_remove_if(link_hash_content->link_hashes, (void *)link_hash, _sc_addr_hash_compare);
+    _sc_dictionary_fs_memory_link_hash_content_destroy(link_hash_content);
   }
 
   // set empty link
@@ -550,14 +720,43 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_unlink_string(
 
 result:
   sc_monitor_release_write(&memory->monitor);
+}
+
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_unlink_string(
+    sc_dictionary_fs_memory * memory,
+    sc_addr_hash const link_hash)
+{
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to unlink string");
+    return SC_FS_MEMORY_NO;
+  }
+
+  sc_uint8 const loaded_dictionaries = _sc_dictionary_fs_memory_lock_dictionaries(memory);
+  if (loaded_dictionaries & SC_DICTIONARY_FS_MEMORY_LINKS)
+    _sc_dictionary_fs_memory_unlink_string(memory, link_hash);
+  else
+  {
+    sc_dictionary_fs_memory_journal_entry * entry = sc_mem_new(sc_dictionary_fs_memory_journal_entry, 1);
+    entry->link_hash = link_hash;
+    entry->string_offset = INVALID_STRING_OFFSET;
+    entry->dictionaries = SC_DICTIONARY_FS_MEMORY_LINKS;
+    _sc_dictionary_fs_memory_append_journal_entry(memory, entry);
+  }
+  _sc_dictionary_fs_memory_unlock_dictionaries(memory, SC_DICTIONARY_FS_MEMORY_LINKS);
 
   return SC_FS_MEMORY_OK;
 }
 
+/*! Reads string saved in strings channels by its offset.
+ * @param[out] string_size Pointer to size of read string, strings may contain zero bytes. It isn't set if it is
+ * null_ptr.
+ */
 sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_read_string_by_offset(
     sc_dictionary_fs_memory * memory,
     sc_uint64 const string_offset,
-    sc_char ** string)
+    sc_char ** string,
+    sc_uint64 * string_size)
 {
   sc_monitor * channel_monitor;
   sc_io_channel * strings_channel =
@@ -574,8 +773,9 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_read_string_by_offset(
   sc_monitor_acquire_write(channel_monitor);
   sc_io_channel_seek(strings_channel, normalized_string_offset, SC_FS_IO_SEEK_SET, null_ptr);
   {
-    sc_uint64 string_size;
-    if (sc_io_channel_read_chars(strings_channel, (sc_char *)&string_size, sizeof(sc_uint64), &read_bytes, null_ptr)
+    sc_uint64 read_string_size;
+    if (sc_io_channel_read_chars(
+            strings_channel, (sc_char *)&read_string_size, sizeof(sc_uint64), &read_bytes, null_ptr)
             != SC_FS_IO_STATUS_NORMAL
         || sizeof(sc_uint64) != read_bytes)
     {
@@ -583,14 +783,18 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_read_string_by_offset(
       goto error;
     }
 
-    *string = sc_mem_new(sc_char, string_size + 1);
-    if (sc_io_channel_read_chars(strings_channel, *string, string_size, &read_bytes, null_ptr) != SC_FS_IO_STATUS_NORMAL
-        || string_size != read_bytes)
+    *string = sc_mem_new(sc_char, read_string_size + 1);
+    if (sc_io_channel_read_chars(strings_channel, *string, read_string_size, &read_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || read_string_size != read_bytes)
     {
       sc_mem_free(*string);
       *string = null_ptr;
       goto error;
     }
+
+    if (string_size != null_ptr)
+      *string_size = read_string_size;
   }
 
   sc_monitor_release_write(channel_monitor);
@@ -601,6 +805,80 @@ error:
   return SC_FS_MEMORY_READ_ERROR;
 }
 
+sc_link_hash_content * _sc_dictionary_fs_memory_get_link_hash_content(
+    sc_dictionary_fs_memory const * memory,
+    sc_addr_hash const link_hash)
+{
+  sc_char link_hash_str[DEFAULT_STRING_INT_SIZE];
+  sc_uint64 link_hash_str_size;
+  sc_int_to_str_int(link_hash, link_hash_str, link_hash_str_size);
+  return sc_dictionary_get_by_key(memory->link_hashes_string_offsets_dictionary, link_hash_str, link_hash_str_size);
+}
+
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_compact(
+    sc_dictionary_fs_memory * memory,
+    sc_dictionary_fs_memory * compacted_memory,
+    sc_addr_hash const * link_hashes,
+    sc_addr_hash const * compacted_link_hashes,
+    sc_uint64 link_hashes_count)
+{
+  if (memory == null_ptr || compacted_memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to compact");
+    return SC_FS_MEMORY_NO;
+  }
+
+  sc_fs_memory_info("Compact strings of %llu sc-links", link_hashes_count);
+  _sc_dictionary_fs_memory_acquire_dictionaries(memory, SC_DICTIONARY_FS_MEMORY_LINKS);
+
+  // string offsets are stored incremented by one, so zero means that string isn't copied yet
+  sc_hash_table * compacted_string_offsets = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+  sc_dictionary_fs_memory_status status = SC_FS_MEMORY_OK;
+
+  for (sc_uint64 i = 0; i < link_hashes_count; ++i)
+  {
+    sc_link_hash_content const * content = _sc_dictionary_fs_memory_get_link_hash_content(memory, link_hashes[i]);
+    if (content == null_ptr)
+      continue;
+
+    sc_uint64 compacted_string_offset =
+        (sc_uint64)sc_hash_table_get(compacted_string_offsets, (sc_pointer)content->string_offset);
+    if (compacted_string_offset != 0)
+    {
+      _sc_dictionary_fs_memory_append_link_string_unique(
+          compacted_memory, compacted_link_hashes[i], compacted_string_offset - 1);
+      continue;
+    }
+
+    // contents may be binary, so they are copied with sizes read from strings channels
+    sc_char * string = null_ptr;
+    sc_uint64 string_size = 0;
+    status =
+        _sc_dictionary_fs_memory_read_string_by_offset(memory, content->string_offset - 1, &string, &string_size);
+    if (status != SC_FS_MEMORY_OK)
+      break;
+
+    status = sc_dictionary_fs_memory_link_string(compacted_memory, compacted_link_hashes[i], string, string_size);
+    sc_mem_free(string);
+    if (status != SC_FS_MEMORY_OK)
+      break;
+
+    sc_link_hash_content const * compacted_content =
+        _sc_dictionary_fs_memory_get_link_hash_content(compacted_memory, compacted_link_hashes[i]);
+    sc_hash_table_insert(
+        compacted_string_offsets, (sc_pointer)content->string_offset, (sc_pointer)compacted_content->string_offset);
+  }
+
+  sc_hash_table_destroy(compacted_string_offsets);
+  _sc_dictionary_fs_memory_release_dictionaries(memory);
+
+  sc_fs_memory_info(
+      "Strings compacted: %llu bytes instead of %llu bytes",
+      compacted_memory->last_string_offset,
+      memory->last_string_offset);
+  return status;
+}
+
 void _sc_dictionary_fs_memory_read_file(sc_char * file_path, sc_char ** content, sc_uint32 * size)
 {
   if (sc_fs_is_binary_file(file_path))
@@ -626,6 +904,7 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash(
     return SC_FS_MEMORY_NO;
   }
 
+  _sc_dictionary_fs_memory_acquire_dictionaries(memory, SC_DICTIONARY_FS_MEMORY_LINKS);
   sc_char link_hash_str[DEFAULT_STRING_INT_SIZE];
   sc_uint64 link_hash_str_size;
   sc_int_to_str_int(link_hash, link_hash_str, link_hash_str_size);
@@ -634,14 +913,16 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash(
 
   if (content == null_ptr)
   {
+    _sc_dictionary_fs_memory_release_dictionaries(memory);
     *string = null_ptr;
     *string_size = 0;
     return SC_FS_MEMORY_NO_STRING;
   }
 
   sc_uint64 const string_offset = (sc_uint64)content->string_offset - 1;
+  _sc_dictionary_fs_memory_release_dictionaries(memory);
   sc_dictionary_fs_memory_status const status =
-      _sc_dictionary_fs_memory_read_string_by_offset(memory, string_offset, string);
+      _sc_dictionary_fs_memory_read_string_by_offset(memory, string_offset, string, string_size);
   if (status != SC_FS_MEMORY_OK)
   {
     *string = null_ptr;
@@ -654,10 +935,9 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_string_by_link_hash(
     sc_char * file_path = *string;
     _sc_dictionary_fs_memory_read_file(file_path, string, (sc_uint32 *)string_size);
     sc_mem_free(file_path);
+    *string_size = sc_str_len(*string);
   }
 
-  *string_size = sc_str_len(*string);
-
   return SC_FS_MEMORY_OK;
 }
 
@@ -710,22 +990,23 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_strin
         goto cont;
       }
 
-      sc_char other_string[other_string_size + 1];
+      // strings found by content hash may be big, so they are read in heap memory
+      sc_char * other_string = sc_mem_new(sc_char, other_string_size + 1);
       if (sc_io_channel_read_chars(strings_channel, other_string, other_string_size, &read_bytes, null_ptr)
               != SC_FS_IO_STATUS_NORMAL
           || other_string_size != read_bytes)
+      {
+        sc_mem_free(other_string);
         goto error;
-
-      other_string[other_string_size] = '\0';
+      }
 
       if ((is_substring
            && ((to_search_as_prefix && sc_str_has_prefix(other_string, string) == SC_FALSE)
                || (!to_search_as_prefix && sc_str_find(other_string, string) == SC_FALSE)))
-          || (!is_substring && sc_str_cmp(string, other_string) == SC_FALSE))
-      {
+          || (!is_substring && memcmp(string, other_string, string_size) != 0))
         go_to_next = SC_TRUE;
-        goto cont;
-      }
+
+      sc_mem_free(other_string);
     }
 
   cont:
@@ -760,6 +1041,22 @@ error:
   return SC_FS_MEMORY_READ_ERROR;
 }
 
+void _sc_dictionary_fs_memory_append_linked_string_offset(
+    sc_dictionary_fs_memory const * memory,
+    sc_list * string_offsets,
+    sc_uint64 const string_offset)
+{
+  sc_char string_offset_str[DEFAULT_STRING_INT_SIZE];
+  sc_uint64 string_offset_str_size;
+  sc_int_to_str_int(string_offset, string_offset_str, string_offset_str_size);
+
+  // skip strings without links
+  sc_list * link_hashes = sc_dictionary_get_by_key(
+      memory->string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size);
+  if (link_hashes != null_ptr && link_hashes->size != 0)
+    sc_list_push_back(string_offsets, (void *)string_offset);
+}
+
 sc_bool _sc_dictionary_fs_memory_visit_string_offsets_by_term_prefix(sc_dictionary_node * node, void ** arguments)
 {
   if (node->data == null_ptr)
@@ -775,23 +1072,25 @@ sc_bool _sc_dictionary_fs_memory_visit_string_offsets_by_term_prefix(sc_dictiona
   }
 
   while (sc_iterator_next(it))
-  {
-    sc_uint64 const string_offset = (sc_uint64)sc_iterator_get(it);
-    sc_char string_offset_str[DEFAULT_STRING_INT_SIZE];
-    sc_uint64 string_offset_str_size;
-    sc_int_to_str_int(string_offset, string_offset_str, string_offset_str_size);
-
-    // skip strings without links
-    sc_list * link_hashes = sc_dictionary_get_by_key(
-        memory->string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size);
-    if (link_hashes != null_ptr && link_hashes->size != 0)
-      sc_list_push_back(string_offsets, (void *)string_offset);
-  }
+    _sc_dictionary_fs_memory_append_linked_string_offset(memory, string_offsets, (sc_uint64)sc_iterator_get(it));
   sc_iterator_destroy(it);
 
   return SC_TRUE;
 }
 
+sc_bool _sc_dictionary_fs_memory_visit_sorted_string_offsets_by_term_prefix(
+    sc_sorted_dictionary_record const * record,
+    void ** arguments)
+{
+  sc_dictionary_fs_memory * memory = arguments[0];
+  sc_list * string_offsets = arguments[1];
+  for (sc_uint64 i = 0; i < record->values_count; ++i)
+    _sc_dictionary_fs_memory_append_linked_string_offset(
+        memory, string_offsets, sc_sorted_dictionary_record_get_value(record, i));
+
+  return SC_TRUE;
+}
+
 sc_list * _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(
     sc_dictionary_fs_memory const * memory,
     sc_char const * term)
@@ -805,6 +1104,13 @@ sc_list * _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(
   arguments[0] = (void *)memory;
   arguments[1] = string_offsets;
 
+  // terms string offsets saved in sorted dictionary file and added after it was loaded don't intersect
+  sc_sorted_dictionary_file_visit_by_key_prefix(
+      memory->terms_string_offsets_file,
+      term,
+      term_size,
+      _sc_dictionary_fs_memory_visit_sorted_string_offsets_by_term_prefix,
+      arguments);
   sc_dictionary_get_by_key_prefix(
       memory->terms_string_offsets_dictionary,
       term,
@@ -830,23 +1136,87 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_link_hashes_by_string
     return SC_FS_MEMORY_NO;
   }
 
-  sc_char * term = _sc_dictionary_fs_memory_get_first_term(string, memory->term_separators);
+  // sc-links of strings found by terms are got from `string offsets - link hashes` dictionary
+  _sc_dictionary_fs_memory_acquire_dictionaries(
+      memory, is_substring ? SC_DICTIONARY_FS_MEMORY_ALL : SC_DICTIONARY_FS_MEMORY_LINKS);
+
   sc_list * string_offsets = null_ptr;
   if (is_substring)
+  {
+    sc_char * term = _sc_dictionary_fs_memory_get_first_term(string, memory->term_separators);
     string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(memory, term);
+    sc_mem_free(term);
+  }
   else
-    string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term(memory, term);
-  sc_mem_free(term);
+  {
+    // exact strings are found by content hash, it doesn't depend on string size and term frequency
+    string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_content_hash(
+        memory, _sc_dictionary_fs_memory_get_content_hash(string, string_size));
+  }
 
   sc_dictionary_fs_memory_status const status = _sc_dictionary_fs_memory_get_link_hashes_by_string_term(
       memory, string, string_size, is_substring, to_search_as_prefix, string_offsets, data, callback);
 
   if (is_substring)
     sc_list_destroy(string_offsets);
+  _sc_dictionary_fs_memory_release_dictionaries(memory);
 
   return status;
 }
 
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_estimate_link_hashes_by_string(
+    sc_dictionary_fs_memory * memory,
+    sc_char const * string,
+    sc_uint64 const string_size,
+    sc_bool const is_substring,
+    sc_uint64 * count)
+{
+  *count = 0;
+  if (memory == null_ptr)
+  {
+    sc_fs_memory_info("Memory is empty to estimate link hashes by string");
+    return SC_FS_MEMORY_NO;
+  }
+
+  _sc_dictionary_fs_memory_acquire_dictionaries(
+      memory, is_substring ? SC_DICTIONARY_FS_MEMORY_ALL : SC_DICTIONARY_FS_MEMORY_LINKS);
+
+  sc_list * string_offsets = null_ptr;
+  if (is_substring)
+  {
+    sc_char * term = _sc_dictionary_fs_memory_get_first_term(string, memory->term_separators);
+    string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(memory, term);
+    sc_mem_free(term);
+  }
+  else
+    string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_content_hash(
+        memory, _sc_dictionary_fs_memory_get_content_hash(string, string_size));
+
+  // strings aren't read and compared, so all sc-links of candidate strings are counted
+  sc_iterator * string_offset_it = sc_list_iterator(string_offsets);
+  if (sc_iterator_next(string_offset_it))
+  {
+    while (sc_iterator_next(string_offset_it))
+    {
+      sc_char string_offset_str[DEFAULT_STRING_INT_SIZE];
+      sc_uint64 string_offset_str_size;
+      sc_int_to_str_int((sc_uint64)sc_iterator_get(string_offset_it), string_offset_str, string_offset_str_size);
+
+      sc_list * link_hashes = sc_dictionary_get_by_key(
+          memory->string_offsets_link_hashes_dictionary, string_offset_str, string_offset_str_size);
+      if (link_hashes != null_ptr)
+        *count += link_hashes->size;
+    }
+  }
+  sc_iterator_destroy(string_offset_it);
+
+  if (is_substring)
+    sc_list_destroy(string_offsets);
+  _sc_dictionary_fs_memory_release_dictionaries(memory);
+
+  return SC_FS_MEMORY_OK;
+}
+
 sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_link_hashes_by_string(
     sc_dictionary_fs_memory * memory,
     sc_char const * string,
@@ -978,6 +1348,8 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_strings_by_substring
     return SC_FS_MEMORY_NO;
   }
 
+  // strings without sc-links are skipped by `string offsets - link hashes` dictionary
+  _sc_dictionary_fs_memory_acquire_dictionaries(memory, SC_DICTIONARY_FS_MEMORY_ALL);
   sc_char * term = _sc_dictionary_fs_memory_get_first_term(string, memory->term_separators);
   sc_list * string_offsets = _sc_dictionary_fs_memory_get_string_offsets_by_term_prefix(memory, term);
   sc_mem_free(term);
@@ -985,6 +1357,7 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_strings_by_substring
   sc_dictionary_fs_memory_status const status = _sc_dictionary_fs_memory_get_strings_by_substring_term(
       memory, string, string_size, to_search_as_prefix, string_offsets, data, callback);
   sc_list_destroy(string_offsets);
+  _sc_dictionary_fs_memory_release_dictionaries(memory);
 
   return status;
 }
@@ -1040,6 +1413,19 @@ sc_bool _sc_dictionary_fs_memory_get_link_hashes_by_string_offsets(sc_dictionary
   return SC_TRUE;
 }
 
+void _sc_dictionary_fs_memory_append_string_offset_term(
+    sc_dictionary * string_offsets_terms_dictionary,
+    sc_uint64 const string_offset,
+    sc_char const * term)
+{
+  sc_char string_offset_str[DEFAULT_STRING_INT_SIZE];
+  sc_uint64 string_offset_str_size;
+  sc_int_to_str_int(string_offset, string_offset_str, string_offset_str_size);
+
+  _sc_dictionary_fs_memory_append(
+      string_offsets_terms_dictionary, string_offset_str, string_offset_str_size, (void *)term);
+}
+
 void _sc_dictionary_fs_memory_get_string_offsets_by_terms(
     sc_dictionary_fs_memory const * memory,
     sc_list const * terms,
@@ -1054,22 +1440,25 @@ void _sc_dictionary_fs_memory_get_string_offsets_by_terms(
     sc_uint64 const term_size = sc_str_len(term);
 
     sc_list * string_offsets = sc_dictionary_get_by_key(memory->terms_string_offsets_dictionary, term, term_size);
-    sc_iterator * string_offsets_it = sc_list_iterator(string_offsets);
-    if (!sc_iterator_next(string_offsets_it))
+    sc_sorted_dictionary_record record;
+    sc_bool const is_term_saved =
+        sc_sorted_dictionary_file_get_by_key(memory->terms_string_offsets_file, term, term_size, &record);
+    if (string_offsets == null_ptr && !is_term_saved)
     {
-      sc_iterator_destroy(string_offsets_it);
+      sc_iterator_destroy(term_it);
       return;
     }
 
-    while (sc_iterator_next(string_offsets_it))
-    {
-      sc_uint64 const string_offset = (sc_uint64)sc_iterator_get(string_offsets_it);
-      sc_char string_offset_str[DEFAULT_STRING_INT_SIZE];
-      sc_uint64 string_offset_str_size;
-      sc_int_to_str_int(string_offset, string_offset_str, string_offset_str_size);
+    for (sc_uint64 i = 0; is_term_saved && i < record.values_count; ++i)
+      _sc_dictionary_fs_memory_append_string_offset_term(
+          *string_offsets_terms_dictionary, sc_sorted_dictionary_record_get_value(&record, i), term);
 
-      _sc_dictionary_fs_memory_append(
-          *string_offsets_terms_dictionary, string_offset_str, string_offset_str_size, (void *)term);
+    sc_iterator * string_offsets_it = sc_list_iterator(string_offsets);
+    if (sc_iterator_next(string_offsets_it))
+    {
+      while (sc_iterator_next(string_offsets_it))
+        _sc_dictionary_fs_memory_append_string_offset_term(
+            *string_offsets_terms_dictionary, (sc_uint64)sc_iterator_get(string_offsets_it), term);
     }
     sc_iterator_destroy(string_offsets_it);
   }
@@ -1092,6 +1481,7 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_terms
   if (terms->size == 0)
     return SC_FS_MEMORY_OK;
 
+  _sc_dictionary_fs_memory_acquire_dictionaries((sc_dictionary_fs_memory *)memory, SC_DICTIONARY_FS_MEMORY_ALL);
   sc_dictionary * string_offsets_terms_dictionary;
   _sc_dictionary_fs_memory_get_string_offsets_by_terms(memory, terms, &string_offsets_terms_dictionary);
 
@@ -1102,6 +1492,7 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_link_hashes_by_terms
   sc_dictionary_fs_memory_status const status = sc_dictionary_visit_down_nodes(
       string_offsets_terms_dictionary, _sc_dictionary_fs_memory_get_link_hashes_by_string_offsets, arguments);
   sc_dictionary_destroy(string_offsets_terms_dictionary, _sc_dictionary_fs_memory_node_clear);
+  _sc_dictionary_fs_memory_release_dictionaries((sc_dictionary_fs_memory *)memory);
   return status;
 }
 
@@ -1140,7 +1531,7 @@ sc_bool _sc_dictionary_fs_memory_get_string_by_string_offsets(sc_dictionary_node
 
     sc_char * string;
     sc_dictionary_fs_memory_status const status =
-        _sc_dictionary_fs_memory_read_string_by_offset(memory, string_offset, &string);
+        _sc_dictionary_fs_memory_read_string_by_offset(memory, string_offset, &string, null_ptr);
     if (status != SC_FS_MEMORY_OK)
       return SC_FALSE;
 
@@ -1166,6 +1557,7 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_strings_by_terms(
   if (terms->size == 0)
     return SC_FS_MEMORY_OK;
 
+  _sc_dictionary_fs_memory_acquire_dictionaries((sc_dictionary_fs_memory *)memory, SC_DICTIONARY_FS_MEMORY_TERMS);
   sc_dictionary * term_string_offsets_dictionary;
   _sc_dictionary_fs_memory_get_string_offsets_by_terms(memory, terms, &term_string_offsets_dictionary);
 
@@ -1176,6 +1568,7 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_get_strings_by_terms(
   sc_dictionary_visit_down_nodes(
       term_string_offsets_dictionary, _sc_dictionary_fs_memory_get_string_by_string_offsets, arguments);
   sc_dictionary_destroy(term_string_offsets_dictionary, _sc_dictionary_fs_memory_node_clear);
+  _sc_dictionary_fs_memory_release_dictionaries((sc_dictionary_fs_memory *)memory);
 
   return SC_FS_MEMORY_OK;
 }
@@ -1196,96 +1589,213 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_unite_strings_by_terms(
   return _sc_dictionary_fs_memory_get_strings_by_terms(memory, terms, SC_FALSE, strings);
 }
 
-void _sc_dictionary_fs_memory_read_terms_string_offsets(sc_dictionary_fs_memory * memory, sc_io_channel * channel)
+sc_bool _sc_dictionary_fs_memory_read_value(sc_dictionary_fs_memory_file_reader * reader, void * value, sc_uint64 size)
+{
+  if (reader->size - reader->position < size)
+    return SC_FALSE;
+
+  memcpy(value, reader->data + reader->position, size);
+  reader->position += size;
+  return SC_TRUE;
+}
+
+sc_io_mapped_file * _sc_dictionary_fs_memory_open_file_reader(
+    sc_char const * path,
+    sc_dictionary_fs_memory_file_reader * reader)
+{
+  if (sc_fs_is_file(path) == SC_FALSE)
+    return null_ptr;
+
+  // dictionary file is mapped into memory, so it is parsed without reading it by values
+  sc_io_mapped_file * file = sc_io_new_mapped_file(path, null_ptr);
+  if (file == null_ptr)
+    return null_ptr;
+
+  reader->data = sc_io_mapped_file_get_contents(file);
+  reader->size = sc_io_mapped_file_get_length(file);
+  reader->position = 0;
+  return file;
+}
+
+void _sc_dictionary_fs_memory_append_to_list(
+    sc_dictionary * dictionary,
+    sc_list ** list,
+    sc_char const * key,
+    sc_uint64 const key_size,
+    void * data)
+{
+  // values of the same key are appended into its list without searching it in dictionary again
+  if (*list == null_ptr)
+    *list = _sc_dictionary_fs_memory_append(dictionary, key, key_size, data);
+  else
+    _sc_dictionary_fs_memory_list_push_back(*list, data);
+}
+
+void _sc_dictionary_fs_memory_read_terms_string_offsets(
+    sc_dictionary_fs_memory * memory,
+    sc_dictionary_fs_memory_file_reader * reader)
 {
-  sc_uint64 read_bytes = 0;
   while (SC_TRUE)
   {
     sc_uint64 term_size;
-    if (sc_io_channel_read_chars(channel, (sc_char *)&term_size, sizeof(sc_uint64), &read_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || sizeof(sc_uint64) != read_bytes)
+    if (!_sc_dictionary_fs_memory_read_value(reader, &term_size, sizeof(sc_uint64))
+        || reader->size - reader->position < term_size)
       break;
 
-    // allocate term in stack memory
-    sc_char term[term_size + 1];
-    if (sc_io_channel_read_chars(channel, (sc_char *)term, term_size, &read_bytes, null_ptr) != SC_FS_IO_STATUS_NORMAL
-        || term_size != read_bytes)
-      break;
-    term[term_size] = '\0';
+    sc_char const * term = reader->data + reader->position;
+    reader->position += term_size;
 
     sc_uint64 term_offset_count;
-    if (sc_io_channel_read_chars(channel, (sc_char *)&term_offset_count, sizeof(sc_uint64), &read_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || sizeof(sc_uint64) != read_bytes)
+    if (!_sc_dictionary_fs_memory_read_value(reader, &term_offset_count, sizeof(sc_uint64)))
       break;
 
+    sc_list * string_offsets = null_ptr;
     for (sc_uint64 i = 0; i < term_offset_count; ++i)
     {
       sc_uint64 string_offset;
-      if (sc_io_channel_read_chars(channel, (sc_char *)&string_offset, sizeof(sc_uint64), &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || sizeof(sc_uint64) != read_bytes)
+      if (!_sc_dictionary_fs_memory_read_value(reader, &string_offset, sizeof(sc_uint64)))
         break;
 
-      _sc_dictionary_fs_memory_append(memory->terms_string_offsets_dictionary, term, term_size, (void *)string_offset);
+      _sc_dictionary_fs_memory_append_to_list(
+          memory->terms_string_offsets_dictionary, &string_offsets, term, term_size, (void *)string_offset);
     }
   }
 }
 
-sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_terms_offsets(sc_dictionary_fs_memory * memory)
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_sorted_terms_offsets(
+    sc_dictionary_fs_memory * memory,
+    sc_uint64 * last_string_offset)
 {
-  sc_fs_memory_info("Load `term - offsets` dictionary from %s", memory->terms_string_offsets_path);
-  sc_io_channel * terms_offsets_channel = sc_io_new_read_channel(memory->terms_string_offsets_path, null_ptr);
-  if (terms_offsets_channel == null_ptr)
+  sc_fs_memory_info("Load sorted `term - offsets` dictionary from %s", memory->sorted_terms_string_offsets_path);
+  sc_sorted_dictionary_file * file = sc_sorted_dictionary_file_open(memory->sorted_terms_string_offsets_path);
+  if (file == null_ptr)
+    return SC_FS_MEMORY_READ_ERROR;
+
+  if (last_string_offset != null_ptr)
+    *last_string_offset = sc_sorted_dictionary_file_get_meta(file);
+  sc_message("\tTerms count: %llu", sc_sorted_dictionary_file_get_records_count(file));
+
+  if (memory->sorted_terms_dictionary)
   {
-    sc_fs_memory_info("Path `%s` doesn't exist. Nothing to load", memory->terms_string_offsets_path);
-    return SC_FS_MEMORY_NO;
+    // terms are searched in mapped file, new terms string offsets are added into `term - offsets` dictionary
+    memory->terms_string_offsets_file = file;
+    sc_fs_memory_info("Dictionary `term - offsets` mapped");
+    return SC_FS_MEMORY_OK;
   }
-  sc_io_channel_set_encoding(terms_offsets_channel, null_ptr, null_ptr);
 
-  sc_uint64 read_bytes = 0;
-  if (sc_io_channel_read_chars(
-          terms_offsets_channel, (sc_char *)&memory->last_string_offset, sizeof(sc_uint64), &read_bytes, null_ptr)
-          != SC_FS_IO_STATUS_NORMAL
-      || sizeof(sc_uint64) != read_bytes)
+  sc_sorted_dictionary_record record;
+  for (sc_bool has_record = sc_sorted_dictionary_file_get_first_record(file, &record); has_record;
+       has_record = sc_sorted_dictionary_file_get_next_record(file, &record, &record))
   {
-    sc_io_channel_shutdown(terms_offsets_channel, SC_TRUE, null_ptr);
-    memory->last_string_offset = 0;
+    sc_list * string_offsets = null_ptr;
+    for (sc_uint64 i = 0; i < record.values_count; ++i)
+      _sc_dictionary_fs_memory_append_to_list(
+          memory->terms_string_offsets_dictionary,
+          &string_offsets,
+          record.key,
+          record.key_size,
+          (void *)sc_sorted_dictionary_record_get_value(&record, i));
+  }
+  sc_sorted_dictionary_file_close(file);
+
+  sc_fs_memory_info("Dictionary `term - offsets` loaded");
+  return SC_FS_MEMORY_OK;
+}
+
+sc_bool _sc_dictionary_fs_memory_is_sorted_terms_offsets_preferred(sc_dictionary_fs_memory const * memory)
+{
+  // dictionary in format specified by params is preferred if both dictionaries exist
+  return sc_fs_is_file(memory->sorted_terms_string_offsets_path)
+         && (memory->sorted_terms_dictionary || !sc_fs_is_file(memory->terms_string_offsets_path));
+}
+
+/*! Loads `term - offsets` dictionary
+ * @param last_string_offset Pointer to last string offset saved with dictionary, it isn't read if it is null_ptr
+ */
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_terms_offsets(
+    sc_dictionary_fs_memory * memory,
+    sc_uint64 * last_string_offset)
+{
+  if (_sc_dictionary_fs_memory_is_sorted_terms_offsets_preferred(memory)
+      && _sc_dictionary_fs_memory_load_sorted_terms_offsets(memory, last_string_offset) == SC_FS_MEMORY_OK)
     return SC_FS_MEMORY_OK;
+
+  sc_fs_memory_info("Load `term - offsets` dictionary from %s", memory->terms_string_offsets_path);
+  sc_dictionary_fs_memory_file_reader reader;
+  sc_io_mapped_file * file = _sc_dictionary_fs_memory_open_file_reader(memory->terms_string_offsets_path, &reader);
+  if (file == null_ptr)
+  {
+    sc_fs_memory_info("Path `%s` doesn't exist. Nothing to load", memory->terms_string_offsets_path);
+    return SC_FS_MEMORY_NO;
   }
 
-  _sc_dictionary_fs_memory_read_terms_string_offsets(memory, terms_offsets_channel);
+  sc_uint64 saved_last_string_offset = 0;
+  sc_bool const is_read = _sc_dictionary_fs_memory_read_value(&reader, &saved_last_string_offset, sizeof(sc_uint64));
+  if (last_string_offset != null_ptr)
+    *last_string_offset = saved_last_string_offset;
+  if (!is_read)
+  {
+    sc_io_mapped_file_free(file);
+    return SC_FS_MEMORY_OK;
+  }
+
+  _sc_dictionary_fs_memory_read_terms_string_offsets(memory, &reader);
 
-  sc_io_channel_shutdown(terms_offsets_channel, SC_TRUE, null_ptr);
+  sc_io_mapped_file_free(file);
 
   sc_fs_memory_info("Dictionary `term - offsets` loaded");
   return SC_FS_MEMORY_OK;
 }
 
-void _sc_dictionary_fs_memory_read_string_offsets_link_hashes(sc_dictionary_fs_memory * memory, sc_io_channel * channel)
+sc_pointer _sc_dictionary_fs_memory_load_terms_offsets_thread(sc_pointer data)
+{
+  sc_dictionary_fs_memory * memory = data;
+  // strings can be written before dictionaries are loaded lazily, so last string offset is read on startup only
+  _sc_dictionary_fs_memory_load_terms_offsets(
+      memory, memory->lazy_dictionaries_loading ? null_ptr : &memory->last_string_offset);
+  return null_ptr;
+}
+
+void _sc_dictionary_fs_memory_load_last_string_offset(sc_dictionary_fs_memory * memory)
+{
+  if (_sc_dictionary_fs_memory_is_sorted_terms_offsets_preferred(memory))
+  {
+    sc_sorted_dictionary_file * file = sc_sorted_dictionary_file_open(memory->sorted_terms_string_offsets_path);
+    if (file != null_ptr)
+    {
+      memory->last_string_offset = sc_sorted_dictionary_file_get_meta(file);
+      sc_sorted_dictionary_file_close(file);
+      return;
+    }
+  }
+
+  sc_dictionary_fs_memory_file_reader reader;
+  sc_io_mapped_file * file = _sc_dictionary_fs_memory_open_file_reader(memory->terms_string_offsets_path, &reader);
+  if (file == null_ptr)
+    return;
+
+  _sc_dictionary_fs_memory_read_value(&reader, &memory->last_string_offset, sizeof(sc_uint64));
+  sc_io_mapped_file_free(file);
+}
+
+void _sc_dictionary_fs_memory_read_string_offsets_link_hashes(
+    sc_dictionary_fs_memory * memory,
+    sc_dictionary_fs_memory_file_reader * reader)
 {
-  sc_uint64 read_bytes = 0;
   while (SC_TRUE)
   {
     sc_uint64 string_offset;
-    if (sc_io_channel_read_chars(channel, (sc_char *)&string_offset, sizeof(sc_uint64), &read_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || sizeof(sc_uint64) != read_bytes)
+    if (!_sc_dictionary_fs_memory_read_value(reader, &string_offset, sizeof(sc_uint64)))
       break;
 
     sc_uint64 link_hashes_count;
-    if (sc_io_channel_read_chars(channel, (sc_char *)&link_hashes_count, sizeof(sc_uint64), &read_bytes, null_ptr)
-            != SC_FS_IO_STATUS_NORMAL
-        || sizeof(sc_uint64) != read_bytes)
+    if (!_sc_dictionary_fs_memory_read_value(reader, &link_hashes_count, sizeof(sc_uint64)))
       break;
 
     for (sc_uint64 i = 0; i < link_hashes_count; ++i)
     {
       sc_addr_hash link_hash;
-      if (sc_io_channel_read_chars(channel, (sc_char *)&link_hash, sizeof(sc_addr_hash), &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || sizeof(sc_addr_hash) != read_bytes)
+      if (!_sc_dictionary_fs_memory_read_value(reader, &link_hash, sizeof(sc_addr_hash)))
         break;
 
       _sc_dictionary_fs_memory_append_link_string_unique(memory, link_hash, string_offset);
@@ -1296,23 +1806,152 @@ void _sc_dictionary_fs_memory_read_string_offsets_link_hashes(sc_dictionary_fs_m
 sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_string_offsets_link_hashes(
     sc_dictionary_fs_memory * memory)
 {
-  sc_fs_memory_info("Load `term - offsets` dictionary from %s", memory->string_offsets_link_hashes_path);
-  sc_io_channel * channel = sc_io_new_read_channel(memory->string_offsets_link_hashes_path, null_ptr);
-  if (channel == null_ptr)
+  sc_fs_memory_info(
+      "Load `string offsets - link hashes` dictionary from %s", memory->string_offsets_link_hashes_path);
+  sc_dictionary_fs_memory_file_reader reader;
+  sc_io_mapped_file * file =
+      _sc_dictionary_fs_memory_open_file_reader(memory->string_offsets_link_hashes_path, &reader);
+  if (file == null_ptr)
   {
     sc_fs_memory_info("Path `%s` doesn't exist. Nothing to load", memory->string_offsets_link_hashes_path);
     return SC_FS_MEMORY_NO;
   }
-  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
 
-  _sc_dictionary_fs_memory_read_string_offsets_link_hashes(memory, channel);
+  _sc_dictionary_fs_memory_read_string_offsets_link_hashes(memory, &reader);
 
-  sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+  sc_io_mapped_file_free(file);
   sc_fs_memory_info("Dictionary `string offsets - link hashes` loaded");
 
   return SC_FS_MEMORY_OK;
 }
 
+void _sc_dictionary_fs_memory_read_content_hashes_string_offsets(
+    sc_dictionary_fs_memory * memory,
+    sc_dictionary_fs_memory_file_reader * reader)
+{
+  while (SC_TRUE)
+  {
+    sc_uint64 content_hash;
+    if (!_sc_dictionary_fs_memory_read_value(reader, &content_hash, sizeof(sc_uint64)))
+      break;
+
+    sc_uint64 string_offsets_count;
+    if (!_sc_dictionary_fs_memory_read_value(reader, &string_offsets_count, sizeof(sc_uint64)))
+      break;
+
+    sc_char content_hash_str[DEFAULT_STRING_INT_SIZE];
+    sc_uint64 content_hash_str_size;
+    sc_int_to_str_int(content_hash, content_hash_str, content_hash_str_size);
+
+    sc_list * string_offsets = null_ptr;
+    for (sc_uint64 i = 0; i < string_offsets_count; ++i)
+    {
+      sc_uint64 string_offset;
+      if (!_sc_dictionary_fs_memory_read_value(reader, &string_offset, sizeof(sc_uint64)))
+        break;
+
+      _sc_dictionary_fs_memory_append_to_list(
+          memory->content_hashes_string_offsets_dictionary,
+          &string_offsets,
+          content_hash_str,
+          content_hash_str_size,
+          (void *)string_offset);
+    }
+  }
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_load_content_hashes_string_offsets(
+    sc_dictionary_fs_memory * memory)
+{
+  sc_fs_memory_info("Load `content hash - offsets` dictionary from %s", memory->content_hashes_string_offsets_path);
+  sc_dictionary_fs_memory_file_reader reader;
+  sc_io_mapped_file * file =
+      _sc_dictionary_fs_memory_open_file_reader(memory->content_hashes_string_offsets_path, &reader);
+  if (file == null_ptr)
+  {
+    sc_fs_memory_info("Path `%s` doesn't exist. Nothing to load", memory->content_hashes_string_offsets_path);
+    return SC_FS_MEMORY_NO;
+  }
+
+  _sc_dictionary_fs_memory_read_content_hashes_string_offsets(memory, &reader);
+
+  sc_io_mapped_file_free(file);
+  sc_fs_memory_info("Dictionary `content hash - offsets` loaded");
+
+  return SC_FS_MEMORY_OK;
+}
+
+void _sc_dictionary_fs_memory_append_content_hash_by_string_offset(
+    sc_dictionary_fs_memory * memory,
+    sc_hash_table * hashed_string_offsets,
+    sc_uint64 const string_offset)
+{
+  // the same string may be found by several terms, string offsets are stored incremented by one
+  if (sc_hash_table_get(hashed_string_offsets, (sc_pointer)(string_offset + 1)) != null_ptr)
+    return;
+  sc_hash_table_insert(hashed_string_offsets, (sc_pointer)(string_offset + 1), (sc_pointer)(string_offset + 1));
+
+  // binary strings can contain null characters, so content hash is calculated by size of string in file
+  sc_char * string = null_ptr;
+  sc_uint64 string_size = 0;
+  if (_sc_dictionary_fs_memory_read_string_by_offset(memory, string_offset, &string, &string_size) != SC_FS_MEMORY_OK)
+    return;
+
+  _sc_dictionary_fs_memory_append_content_hash_string_offset(
+      memory, _sc_dictionary_fs_memory_get_content_hash(string, string_size), string_offset);
+  sc_mem_free(string);
+}
+
+sc_bool _sc_dictionary_fs_memory_visit_term_string_offsets_to_hash(sc_dictionary_node * node, void ** arguments)
+{
+  if (node->data == null_ptr)
+    return SC_TRUE;
+
+  sc_dictionary_fs_memory * memory = arguments[0];
+  sc_hash_table * hashed_string_offsets = arguments[1];
+
+  sc_iterator * it = sc_list_iterator(node->data);
+  if (!sc_iterator_next(it))
+  {
+    sc_iterator_destroy(it);
+    return SC_TRUE;
+  }
+
+  while (sc_iterator_next(it))
+    _sc_dictionary_fs_memory_append_content_hash_by_string_offset(
+        memory, hashed_string_offsets, (sc_uint64)sc_iterator_get(it));
+  sc_iterator_destroy(it);
+
+  return SC_TRUE;
+}
+
+void _sc_dictionary_fs_memory_rebuild_content_hashes_string_offsets(sc_dictionary_fs_memory * memory)
+{
+  sc_fs_memory_warning("Build `content hash - offsets` dictionary from `term - offsets` dictionary");
+
+  sc_hash_table * hashed_string_offsets = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+
+  sc_sorted_dictionary_record record;
+  for (sc_bool has_record = sc_sorted_dictionary_file_get_first_record(memory->terms_string_offsets_file, &record);
+       has_record;
+       has_record = sc_sorted_dictionary_file_get_next_record(memory->terms_string_offsets_file, &record, &record))
+  {
+    for (sc_uint64 i = 0; i < record.values_count; ++i)
+      _sc_dictionary_fs_memory_append_content_hash_by_string_offset(
+          memory, hashed_string_offsets, sc_sorted_dictionary_record_get_value(&record, i));
+  }
+
+  void * arguments[2];
+  arguments[0] = memory;
+  arguments[1] = hashed_string_offsets;
+  sc_dictionary_visit_down_nodes(
+      memory->terms_string_offsets_dictionary, _sc_dictionary_fs_memory_visit_term_string_offsets_to_hash, arguments);
+
+  sc_hash_table_destroy(hashed_string_offsets);
+
+  sc_fs_memory_info("Dictionary `content hash - offsets` built");
+}
+
 sc_fs_memory_status _sc_dictionary_fs_memory_load_deprecated_dictionaries(sc_dictionary_fs_memory * memory)
 {
   sc_char * strings_path;
@@ -1391,14 +2030,51 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_load(sc_dictionary_fs_mem
   }
 
   sc_fs_memory_info("Load sc-fs-memory dictionaries");
+  if (memory->lazy_dictionaries_loading)
+    _sc_dictionary_fs_memory_load_last_string_offset(memory);
+
+  if (_sc_dictionary_fs_memory_load_deprecated_dictionaries(memory) == SC_FS_MEMORY_OK)
+    _sc_dictionary_fs_memory_load_string_offsets_link_hashes(memory);
+  else if (
+      memory->lazy_dictionaries_loading
+      && (sc_fs_is_file(memory->content_hashes_string_offsets_path)
+          || (!sc_fs_is_file(memory->terms_string_offsets_path)
+              && !sc_fs_is_file(memory->sorted_terms_string_offsets_path))))
+  {
+    // repos without `content hash - offsets` dictionary are loaded on startup to build it
+    sc_mutex_lock(&memory->dictionaries_mutex);
+    memory->loaded_dictionaries = 0;
+    sc_mutex_unlock(&memory->dictionaries_mutex);
+    sc_fs_memory_info("Dictionaries will be loaded on first use");
+  }
+  else
+  {
+    // `term - offsets` and `string offsets - link hashes` dictionaries don't share data, so they are loaded
+    // concurrently
+    sc_thread * terms_offsets_thread =
+        sc_thread_new("sc-fs-memory-terms", _sc_dictionary_fs_memory_load_terms_offsets_thread, memory);
+    _sc_dictionary_fs_memory_load_string_offsets_link_hashes(memory);
+    sc_dictionary_fs_memory_status const content_hashes_status =
+        _sc_dictionary_fs_memory_load_content_hashes_string_offsets(memory);
+    sc_thread_join(terms_offsets_thread);
+
+    // repos saved before `content hash - offsets` dictionary was introduced have only `term - offsets` dictionary
+    if (content_hashes_status == SC_FS_MEMORY_NO)
+    {
+      _sc_dictionary_fs_memory_rebuild_content_hashes_string_offsets(memory);
+      memory->changed_dictionaries |= SC_DICTIONARY_FS_MEMORY_LINKS;
+    }
+  }
 
-  if (_sc_dictionary_fs_memory_load_deprecated_dictionaries(memory) != SC_FS_MEMORY_OK)
-    _sc_dictionary_fs_memory_load_terms_offsets(memory);
+  if (memory->lazy_dictionaries_loading && memory->dictionaries_unload_period != 0)
+  {
+    memory->is_dictionaries_unloader_running = SC_TRUE;
+    memory->dictionaries_unloader =
+        sc_thread_new("sc-fs-memory-unloader", _sc_dictionary_fs_memory_unload_dictionaries_thread, memory);
+  }
 
   sc_message("\tLast string offset: %lld", memory->last_string_offset);
 
-  _sc_dictionary_fs_memory_load_string_offsets_link_hashes(memory);
-
   sc_fs_memory_info("All sc-fs-memory dictionaries loaded");
 
   return SC_FS_MEMORY_OK;
@@ -1498,10 +2174,135 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_term_string_offsets
   }
 
   sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+
+  // sorted dictionary file may be saved before, it is removed to not load it instead of the saved dictionary
+  if (sc_fs_is_file(memory->sorted_terms_string_offsets_path))
+    sc_fs_remove_file(memory->sorted_terms_string_offsets_path);
+
   sc_fs_memory_info("Dictionary `term - offsets` written");
   return SC_FS_MEMORY_OK;
 }
 
+sc_bool _sc_dictionary_fs_memory_collect_term_string_offsets(sc_dictionary_node * node, void ** arguments)
+{
+  if (node->data == null_ptr)
+    return SC_TRUE;
+
+  sc_list *** terms_string_offsets = arguments[0];
+  sc_uint64 * size = arguments[1];
+  sc_uint64 * capacity = arguments[2];
+  if (*size == *capacity)
+  {
+    *capacity = *capacity == 0 ? 1024 : *capacity * 2;
+    *terms_string_offsets = sc_mem_realloc(*terms_string_offsets, *capacity, sizeof(sc_list *));
+  }
+
+  (*terms_string_offsets)[(*size)++] = node->data;
+  return SC_TRUE;
+}
+
+int _sc_dictionary_fs_memory_compare_term_string_offsets(void const * list, void const * other_list)
+{
+  sc_char const * term = (*(sc_list * const *)list)->begin->data;
+  sc_char const * other_term = (*(sc_list * const *)other_list)->begin->data;
+  return sc_sorted_dictionary_compare_keys(term, sc_str_len(term), other_term, sc_str_len(other_term));
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_sorted_term_string_offsets(
+    sc_dictionary_fs_memory const * memory)
+{
+  // terms string offsets added after sorted dictionary file was loaded are sorted and merged with it
+  sc_list ** terms_string_offsets = null_ptr;
+  sc_uint64 size = 0;
+  sc_uint64 capacity = 0;
+  {
+    void * arguments[3];
+    arguments[0] = &terms_string_offsets;
+    arguments[1] = &size;
+    arguments[2] = &capacity;
+    sc_dictionary_visit_down_nodes(
+        memory->terms_string_offsets_dictionary, _sc_dictionary_fs_memory_collect_term_string_offsets, arguments);
+    qsort(terms_string_offsets, size, sizeof(sc_list *), _sc_dictionary_fs_memory_compare_term_string_offsets);
+  }
+
+  sc_sorted_dictionary_file_writer * writer =
+      sc_sorted_dictionary_file_writer_new(memory->sorted_terms_string_offsets_path, memory->last_string_offset);
+  if (writer == null_ptr)
+  {
+    sc_mem_free(terms_string_offsets);
+    return SC_FS_MEMORY_WRITE_ERROR;
+  }
+
+  sc_bool is_written = SC_TRUE;
+  sc_sorted_dictionary_record record;
+  sc_bool has_record = sc_sorted_dictionary_file_get_first_record(memory->terms_string_offsets_file, &record);
+  sc_uint64 i = 0;
+  while (is_written && (has_record || i < size))
+  {
+    sc_list * string_offsets = i < size ? terms_string_offsets[i] : null_ptr;
+    sc_char const * term = string_offsets != null_ptr ? string_offsets->begin->data : null_ptr;
+    sc_uint64 const term_size = term != null_ptr ? sc_str_len(term) : 0;
+
+    // saved record is written if order isn't positive, added term is written if order isn't negative
+    sc_int32 order;
+    if (!has_record)
+      order = 1;
+    else if (term == null_ptr)
+      order = -1;
+    else
+      order = sc_sorted_dictionary_compare_keys(record.key, record.key_size, term, term_size);
+
+    sc_char const * key = order <= 0 ? record.key : term;
+    sc_uint64 const key_size = order <= 0 ? record.key_size : term_size;
+    sc_uint64 const values_count =
+        (order <= 0 ? record.values_count : 0) + (order >= 0 ? string_offsets->size - 1 : 0);
+    is_written = sc_sorted_dictionary_file_writer_append_record(writer, key, key_size, values_count);
+
+    for (sc_uint64 j = 0; is_written && order <= 0 && j < record.values_count; ++j)
+      is_written = sc_sorted_dictionary_file_writer_append_value(
+          writer, sc_sorted_dictionary_record_get_value(&record, j));
+
+    if (order >= 0)
+    {
+      sc_iterator * string_offset_it = sc_list_iterator(string_offsets);
+      sc_iterator_next(string_offset_it);
+      while (is_written && sc_iterator_next(string_offset_it))
+        is_written = sc_sorted_dictionary_file_writer_append_value(
+            writer, (sc_uint64)sc_iterator_get(string_offset_it));
+      sc_iterator_destroy(string_offset_it);
+      ++i;
+    }
+
+    if (order <= 0)
+      has_record = sc_sorted_dictionary_file_get_next_record(memory->terms_string_offsets_file, &record, &record);
+  }
+  sc_mem_free(terms_string_offsets);
+
+  if (!sc_sorted_dictionary_file_writer_finish(writer, is_written))
+    return SC_FS_MEMORY_WRITE_ERROR;
+
+  // merged terms string offsets are searched in the new file, so dictionary keeps only ones added after save and
+  // isn't merged again by the next save
+  sc_sorted_dictionary_file * file = sc_sorted_dictionary_file_open(memory->sorted_terms_string_offsets_path);
+  if (file != null_ptr)
+  {
+    sc_dictionary_fs_memory * mutable_memory = (sc_dictionary_fs_memory *)memory;
+    sc_sorted_dictionary_file_close(mutable_memory->terms_string_offsets_file);
+    mutable_memory->terms_string_offsets_file = file;
+    sc_dictionary_destroy(mutable_memory->terms_string_offsets_dictionary, _sc_dictionary_fs_memory_node_clear);
+    _sc_uchar_dictionary_initialize(&mutable_memory->terms_string_offsets_dictionary);
+  }
+  else
+    sc_fs_memory_warning("Saved terms string offsets are kept in memory, because sorted dictionary file isn't mapped");
+
+  // dictionary in the previous format is converted into sorted dictionary file
+  if (sc_fs_is_file(memory->terms_string_offsets_path))
+    sc_fs_remove_file(memory->terms_string_offsets_path);
+
+  sc_fs_memory_info("Sorted dictionary `term - offsets` written");
+  return SC_FS_MEMORY_OK;
+}
+
 sc_bool _sc_dictionary_fs_memory_write_string_offsets_link_hashes(sc_dictionary_node * node, void ** arguments)
 {
   if (node->data == null_ptr)
@@ -1573,6 +2374,365 @@ sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_string_offsets_link
   return SC_FS_MEMORY_OK;
 }
 
+sc_bool _sc_dictionary_fs_memory_write_content_hash_string_offsets(sc_dictionary_node * node, void ** arguments)
+{
+  if (node->data == null_ptr)
+    return SC_TRUE;
+
+  sc_io_channel * channel = arguments[0];
+
+  sc_list * list = node->data;
+  sc_iterator * data_it = sc_list_iterator(list);
+
+  // save content hash and string offsets in fs-memory
+  sc_uint64 written_bytes = 0;
+  if (sc_iterator_next(data_it))
+  {
+    sc_char const * content_hash_str = sc_iterator_get(data_it);
+    sc_uint64 const content_hash = strtoull(content_hash_str, null_ptr, 10);
+    if (sc_io_channel_write_chars(channel, (sc_char *)&content_hash, sizeof(sc_uint64), &written_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || sizeof(sc_uint64) != written_bytes)
+    {
+      sc_fs_memory_error("Error while attribute `content_hash` writing");
+      goto error;
+    }
+
+    sc_uint64 const string_offsets_count = list->size - 1;
+    if (sc_io_channel_write_chars(
+            channel, (sc_char *)&string_offsets_count, sizeof(sc_uint64), &written_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || sizeof(sc_uint64) != written_bytes)
+    {
+      sc_fs_memory_error("Error while attribute `string_offsets_count` writing");
+      goto error;
+    }
+
+    while (sc_iterator_next(data_it))
+    {
+      sc_uint64 const string_offset = (sc_uint64)sc_iterator_get(data_it);
+      if (sc_io_channel_write_chars(channel, (sc_char *)&string_offset, sizeof(string_offset), &written_bytes, null_ptr)
+              != SC_FS_IO_STATUS_NORMAL
+          || sizeof(sc_uint64) != written_bytes)
+      {
+        sc_fs_memory_error("Error while attribute `string_offset` writing");
+        goto error;
+      }
+    }
+  }
+
+  sc_iterator_destroy(data_it);
+  return SC_TRUE;
+
+error:
+{
+  sc_iterator_destroy(data_it);
+  return SC_FALSE;
+}
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_content_hashes_string_offsets(
+    sc_dictionary_fs_memory const * memory)
+{
+  sc_io_channel * channel = sc_io_new_write_channel(memory->content_hashes_string_offsets_path, null_ptr);
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  // content hashes of new strings are added while strings are written, without lock of dictionaries
+  sc_monitor * monitor = (sc_monitor *)&memory->monitor;
+  sc_monitor_acquire_read(monitor);
+  sc_bool const is_written = sc_dictionary_visit_down_nodes(
+      memory->content_hashes_string_offsets_dictionary,
+      _sc_dictionary_fs_memory_write_content_hash_string_offsets,
+      (void **)&channel);
+  sc_monitor_release_read(monitor);
+  if (!is_written)
+  {
+    sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+    return SC_FS_MEMORY_WRITE_ERROR;
+  }
+
+  sc_io_channel_shutdown(channel, SC_TRUE, null_ptr);
+  sc_fs_memory_info("Dictionary `content hash - offsets` written");
+  return SC_FS_MEMORY_OK;
+}
+
+sc_dictionary_fs_memory_status _sc_dictionary_fs_memory_save_dictionaries(
+    sc_dictionary_fs_memory const * memory,
+    sc_uint8 dictionaries)
+{
+  sc_dictionary_fs_memory_status status = SC_FS_MEMORY_OK;
+  if (dictionaries & SC_DICTIONARY_FS_MEMORY_TERMS)
+  {
+    if (memory->sorted_terms_dictionary)
+      status = _sc_dictionary_fs_memory_save_sorted_term_string_offsets(memory);
+    else
+      status = _sc_dictionary_fs_memory_save_term_string_offsets(memory);
+    if (status != SC_FS_MEMORY_OK)
+      return status;
+  }
+
+  if (dictionaries & SC_DICTIONARY_FS_MEMORY_LINKS)
+  {
+    status = _sc_dictionary_fs_memory_save_string_offsets_link_hashes(memory);
+    if (status != SC_FS_MEMORY_OK)
+      return status;
+
+    status = _sc_dictionary_fs_memory_save_content_hashes_string_offsets(memory);
+  }
+
+  return status;
+}
+
+sc_uint8 _sc_dictionary_fs_memory_lock_dictionaries(sc_dictionary_fs_memory * memory)
+{
+  if (!memory->lazy_dictionaries_loading)
+    return SC_DICTIONARY_FS_MEMORY_ALL;
+
+  sc_mutex_lock(&memory->dictionaries_mutex);
+  return memory->loaded_dictionaries;
+}
+
+/*! Holds loaded dictionaries, so they aren't unloaded until they are locked by
+ * `_sc_dictionary_fs_memory_lock_held_dictionaries`. Dictionaries aren't locked, so they can be loaded meanwhile.
+ * @returns Mask of loaded groups of dictionaries.
+ */
+sc_uint8 _sc_dictionary_fs_memory_hold_dictionaries(sc_dictionary_fs_memory * memory)
+{
+  if (!memory->lazy_dictionaries_loading)
+    return SC_DICTIONARY_FS_MEMORY_ALL;
+
+  sc_mutex_lock(&memory->dictionaries_mutex);
+  ++memory->dictionaries_users;
+  sc_uint8 const loaded_dictionaries = memory->loaded_dictionaries;
+  sc_mutex_unlock(&memory->dictionaries_mutex);
+  return loaded_dictionaries;
+}
+
+//! Locks dictionaries held by `_sc_dictionary_fs_memory_hold_dictionaries`
+sc_uint8 _sc_dictionary_fs_memory_lock_held_dictionaries(sc_dictionary_fs_memory * memory)
+{
+  if (!memory->lazy_dictionaries_loading)
+    return SC_DICTIONARY_FS_MEMORY_ALL;
+
+  sc_mutex_lock(&memory->dictionaries_mutex);
+  --memory->dictionaries_users;
+  return memory->loaded_dictionaries;
+}
+
+void _sc_dictionary_fs_memory_unlock_dictionaries(sc_dictionary_fs_memory * memory, sc_uint8 changed_dictionaries)
+{
+  if (!memory->lazy_dictionaries_loading)
+    return;
+
+  memory->changed_dictionaries |= changed_dictionaries & memory->loaded_dictionaries;
+  sc_mutex_unlock(&memory->dictionaries_mutex);
+}
+
+void _sc_dictionary_fs_memory_append_journal_entry(
+    sc_dictionary_fs_memory * memory,
+    sc_dictionary_fs_memory_journal_entry * entry)
+{
+  sc_list_push_back(memory->journal, entry);
+  memory->journal_dictionaries |= entry->dictionaries;
+}
+
+void _sc_dictionary_fs_memory_apply_journal(sc_dictionary_fs_memory * memory, sc_uint8 dictionaries)
+{
+  if ((memory->journal_dictionaries & dictionaries) == 0)
+    return;
+
+  // entries are added in order of changes, so string relinked several times is linked with the last string
+  sc_uint64 applied_entries_count = 0;
+  sc_iterator * entry_it = sc_list_iterator(memory->journal);
+  while (sc_iterator_next(entry_it))
+  {
+    sc_dictionary_fs_memory_journal_entry * entry = sc_iterator_get(entry_it);
+    sc_uint8 const entry_dictionaries = entry->dictionaries & dictionaries;
+    if (entry_dictionaries == 0)
+      continue;
+
+    if (entry_dictionaries & SC_DICTIONARY_FS_MEMORY_LINKS)
+    {
+      if (entry->string_offset == INVALID_STRING_OFFSET)
+        _sc_dictionary_fs_memory_unlink_string(memory, entry->link_hash);
+      else
+      {
+        _sc_dictionary_fs_memory_append_link_string_unique(memory, entry->link_hash, entry->string_offset);
+        if (entry->is_searchable_string && entry->is_string_new)
+          _sc_dictionary_fs_memory_append_content_hash_string_offset(
+              memory, entry->content_hash, entry->string_offset);
+      }
+    }
+
+    if ((entry_dictionaries & SC_DICTIONARY_FS_MEMORY_TERMS) && entry->string_terms != null_ptr)
+    {
+      _sc_dictionary_fs_memory_write_string_terms_string_offset(memory, entry->string_offset, entry->string_terms);
+      sc_list_clear(entry->string_terms);
+      sc_list_destroy(entry->string_terms);
+      entry->string_terms = null_ptr;
+    }
+
+    entry->dictionaries &= ~entry_dictionaries;
+    ++applied_entries_count;
+  }
+  sc_iterator_destroy(entry_it);
+
+  memory->changed_dictionaries |= memory->journal_dictionaries & dictionaries;
+  memory->journal_dictionaries &= ~dictionaries;
+  if (memory->journal_dictionaries == 0)
+  {
+    sc_list_clear(memory->journal);
+    sc_list_destroy(memory->journal);
+    sc_list_init(&memory->journal);
+  }
+
+  sc_fs_memory_info("Journaled changes of strings applied: %llu", applied_entries_count);
+}
+
+void _sc_dictionary_fs_memory_load_dictionaries(sc_dictionary_fs_memory * memory, sc_uint8 dictionaries)
+{
+  sc_fs_memory_info("Load sc-fs-memory dictionaries on first use");
+
+  sc_thread * terms_offsets_thread = null_ptr;
+  if (dictionaries == SC_DICTIONARY_FS_MEMORY_ALL)
+    terms_offsets_thread =
+        sc_thread_new("sc-fs-memory-terms", _sc_dictionary_fs_memory_load_terms_offsets_thread, memory);
+  else if (dictionaries & SC_DICTIONARY_FS_MEMORY_TERMS)
+    _sc_dictionary_fs_memory_load_terms_offsets(memory, null_ptr);
+
+  if (dictionaries & SC_DICTIONARY_FS_MEMORY_LINKS)
+  {
+    _sc_dictionary_fs_memory_load_string_offsets_link_hashes(memory);
+    _sc_dictionary_fs_memory_load_content_hashes_string_offsets(memory);
+  }
+
+  if (terms_offsets_thread != null_ptr)
+    sc_thread_join(terms_offsets_thread);
+}
+
+void _sc_dictionary_fs_memory_acquire_dictionaries(sc_dictionary_fs_memory * memory, sc_uint8 dictionaries)
+{
+  if (!memory->lazy_dictionaries_loading)
+    return;
+
+  sc_mutex_lock(&memory->dictionaries_mutex);
+  ++memory->dictionaries_users;
+  memory->dictionaries_last_use_time = g_get_monotonic_time();
+
+  while ((memory->loaded_dictionaries & dictionaries) != dictionaries)
+  {
+    // dictionaries being unloaded are loaded after they are saved
+    sc_uint8 const dictionaries_to_load =
+        dictionaries
+        & ~(memory->loaded_dictionaries | memory->loading_dictionaries | memory->unloading_dictionaries);
+    if (dictionaries_to_load == 0)
+    {
+      // dictionaries being loaded or unloaded by other operations are waited for
+      sc_cond_wait(&memory->dictionaries_condition, &memory->dictionaries_mutex);
+      continue;
+    }
+
+    // dictionaries are loaded without lock, so strings can be written and other dictionaries can be used meanwhile
+    memory->loading_dictionaries |= dictionaries_to_load;
+    sc_mutex_unlock(&memory->dictionaries_mutex);
+
+    _sc_dictionary_fs_memory_load_dictionaries(memory, dictionaries_to_load);
+
+    sc_mutex_lock(&memory->dictionaries_mutex);
+    _sc_dictionary_fs_memory_apply_journal(memory, dictionaries_to_load);
+    memory->loading_dictionaries &= ~dictionaries_to_load;
+    memory->loaded_dictionaries |= dictionaries_to_load;
+    sc_cond_broadcast(&memory->dictionaries_condition);
+  }
+  sc_mutex_unlock(&memory->dictionaries_mutex);
+}
+
+void _sc_dictionary_fs_memory_release_dictionaries(sc_dictionary_fs_memory * memory)
+{
+  if (!memory->lazy_dictionaries_loading)
+    return;
+
+  sc_mutex_lock(&memory->dictionaries_mutex);
+  --memory->dictionaries_users;
+  memory->dictionaries_last_use_time = g_get_monotonic_time();
+  sc_mutex_unlock(&memory->dictionaries_mutex);
+}
+
+/*! Saves and unloads dictionaries. They are marked as unloaded under lock, so strings linked meanwhile are journaled,
+ * and they are saved and destroyed without lock.
+ * @note Lock of dictionaries must be held, it is released while dictionaries are saved.
+ */
+void _sc_dictionary_fs_memory_unload_dictionaries(sc_dictionary_fs_memory * memory)
+{
+  sc_fs_memory_info("Unload sc-fs-memory dictionaries unused for %u seconds", memory->dictionaries_unload_period);
+
+  sc_uint8 const dictionaries = memory->loaded_dictionaries;
+  sc_uint8 const changed_dictionaries = memory->changed_dictionaries;
+  memory->loaded_dictionaries = 0;
+  memory->changed_dictionaries = 0;
+  memory->unloading_dictionaries = dictionaries;
+  sc_mutex_unlock(&memory->dictionaries_mutex);
+
+  // changed dictionaries are saved not to lose their changes, other dictionaries are saved already
+  sc_bool const is_saved =
+      _sc_dictionary_fs_memory_save_dictionaries(memory, dictionaries & changed_dictionaries) == SC_FS_MEMORY_OK;
+  if (is_saved && (dictionaries & SC_DICTIONARY_FS_MEMORY_TERMS))
+  {
+    sc_dictionary_destroy(memory->terms_string_offsets_dictionary, _sc_dictionary_fs_memory_node_clear);
+    _sc_uchar_dictionary_initialize(&memory->terms_string_offsets_dictionary);
+    sc_sorted_dictionary_file_close(memory->terms_string_offsets_file);
+    memory->terms_string_offsets_file = null_ptr;
+  }
+
+  if (is_saved && (dictionaries & SC_DICTIONARY_FS_MEMORY_LINKS))
+  {
+    sc_dictionary_destroy(memory->link_hashes_string_offsets_dictionary, _sc_dictionary_fs_memory_string_node_clear);
+    _sc_number_dictionary_initialize(&memory->link_hashes_string_offsets_dictionary);
+    sc_dictionary_destroy(memory->string_offsets_link_hashes_dictionary, _sc_dictionary_fs_memory_link_node_clear);
+    _sc_number_dictionary_initialize(&memory->string_offsets_link_hashes_dictionary);
+    sc_dictionary_destroy(memory->content_hashes_string_offsets_dictionary, _sc_dictionary_fs_memory_node_clear);
+    _sc_number_dictionary_initialize(&memory->content_hashes_string_offsets_dictionary);
+  }
+
+  sc_mutex_lock(&memory->dictionaries_mutex);
+  if (is_saved)
+    sc_fs_memory_info("Dictionaries unloaded");
+  else
+  {
+    // strings linked while dictionaries were saved are journaled, so they are added into kept dictionaries
+    sc_fs_memory_warning("Dictionaries aren't unloaded, they can't be saved");
+    _sc_dictionary_fs_memory_apply_journal(memory, dictionaries);
+    memory->loaded_dictionaries |= dictionaries;
+    memory->changed_dictionaries |= changed_dictionaries;
+  }
+  memory->unloading_dictionaries &= ~dictionaries;
+  sc_cond_broadcast(&memory->dictionaries_condition);
+}
+
+sc_pointer _sc_dictionary_fs_memory_unload_dictionaries_thread(sc_pointer data)
+{
+  sc_dictionary_fs_memory * memory = data;
+  sc_int64 const unload_period = (sc_int64)memory->dictionaries_unload_period * G_TIME_SPAN_SECOND;
+
+  sc_mutex_lock(&memory->dictionaries_mutex);
+  while (memory->is_dictionaries_unloader_running)
+  {
+    sc_int64 const now = g_get_monotonic_time();
+    sc_int64 wake_time = memory->dictionaries_last_use_time + unload_period;
+    if (wake_time <= now)
+    {
+      if (memory->dictionaries_users == 0 && memory->loaded_dictionaries != 0)
+        _sc_dictionary_fs_memory_unload_dictionaries(memory);
+      wake_time = now + unload_period;
+    }
+
+    sc_cond_wait_until(&memory->dictionaries_unloader_condition, &memory->dictionaries_mutex, wake_time);
+  }
+  sc_mutex_unlock(&memory->dictionaries_mutex);
+
+  return null_ptr;
+}
+
 sc_dictionary_fs_memory_status sc_dictionary_fs_memory_save(sc_dictionary_fs_memory const * memory)
 {
   if (memory == null_ptr)
@@ -1582,11 +2742,47 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_save(sc_dictionary_fs_mem
   }
 
   sc_fs_memory_info("Save sc-fs-memory dictionaries");
-  sc_dictionary_fs_memory_status status = _sc_dictionary_fs_memory_save_term_string_offsets(memory);
-  if (status != SC_FS_MEMORY_OK)
-    return status;
+  sc_dictionary_fs_memory * mutable_memory = (sc_dictionary_fs_memory *)memory;
+  sc_uint8 dictionaries = SC_DICTIONARY_FS_MEMORY_ALL;
+  sc_uint8 journal_dictionaries = 0;
+  if (memory->lazy_dictionaries_loading)
+  {
+    // dictionaries with journaled changes are loaded to save them, files of other unloaded dictionaries are actual
+    sc_mutex_lock(&mutable_memory->dictionaries_mutex);
+    journal_dictionaries = memory->journal_dictionaries;
+    sc_mutex_unlock(&mutable_memory->dictionaries_mutex);
+    if (journal_dictionaries != 0)
+      _sc_dictionary_fs_memory_acquire_dictionaries(mutable_memory, journal_dictionaries);
+
+    // saved dictionaries are marked as being unloaded, so strings linked while they are saved without lock are
+    // journaled, and they aren't unloaded by unloader, because they are used by save
+    sc_mutex_lock(&mutable_memory->dictionaries_mutex);
+    dictionaries = memory->loaded_dictionaries & memory->changed_dictionaries;
+    ++mutable_memory->dictionaries_users;
+    mutable_memory->loaded_dictionaries &= ~dictionaries;
+    mutable_memory->changed_dictionaries &= ~dictionaries;
+    mutable_memory->unloading_dictionaries |= dictionaries;
+    sc_mutex_unlock(&mutable_memory->dictionaries_mutex);
+  }
+
+  sc_dictionary_fs_memory_status const status = _sc_dictionary_fs_memory_save_dictionaries(memory, dictionaries);
+
+  if (memory->lazy_dictionaries_loading)
+  {
+    // journaled changes mark dictionaries as changed again, so they are saved next time
+    sc_mutex_lock(&mutable_memory->dictionaries_mutex);
+    _sc_dictionary_fs_memory_apply_journal(mutable_memory, dictionaries);
+    if (status != SC_FS_MEMORY_OK)
+      mutable_memory->changed_dictionaries |= dictionaries;
+    mutable_memory->loaded_dictionaries |= dictionaries;
+    mutable_memory->unloading_dictionaries &= ~dictionaries;
+    --mutable_memory->dictionaries_users;
+    sc_cond_broadcast(&mutable_memory->dictionaries_condition);
+    sc_mutex_unlock(&mutable_memory->dictionaries_mutex);
+    if (journal_dictionaries != 0)
+      _sc_dictionary_fs_memory_release_dictionaries(mutable_memory);
+  }
 
-  status = _sc_dictionary_fs_memory_save_string_offsets_link_hashes(memory);
   if (status != SC_FS_MEMORY_OK)
     return status;
 
@@ -113,6 +113,23 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_get_link_hashes_by_string
     void * data,
     void (*callback)(void * data, sc_addr const link_addr));
 
+/*! Function that estimates amount of sc-link hashes which can be found by a string without reading strings.
+ * @param memory Pointer to the file memory.
+ * @param string Pointer to the string.
+ * @param string_size Size of the string.
+ * @param is_substring Flag indicating whether sc-links are searched by substring or by full string.
+ * @param[out] count Pointer to upper bound of amount of sc-link hashes found by the string.
+ * @returns Returns the memory status indicating the success or failure of the operation.
+ * @note Sc-links of strings with the same content hash or with terms starting with the first term of the string are
+ * counted, so it is cheaper than search, but may be greater than amount of found sc-links.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_estimate_link_hashes_by_string(
+    sc_dictionary_fs_memory * memory,
+    sc_char const * string,
+    sc_uint64 string_size,
+    sc_bool is_substring,
+    sc_uint64 * count);
+
 /*! Function that retrieves sc-link hashes by a substring term extension from the file memory.
  * @param memory Pointer to the memory memory.
  * @param string Pointer to the substring term.
@@ -213,6 +230,24 @@ sc_dictionary_fs_memory_status sc_dictionary_fs_memory_unite_strings_by_terms(
     sc_list const * terms,
     sc_list ** strings);
 
+/*! Copies sc-link content strings of specified sc-links from one file memory to another one, giving them new sc-link
+ * hashes. Strings shared by several sc-links stay shared, strings that aren't linked with specified sc-links aren't
+ * copied.
+ * @param memory A pointer to file memory to copy strings from
+ * @param compacted_memory A pointer to empty file memory to copy strings to
+ * @param link_hashes Sc-link hashes in memory
+ * @param compacted_link_hashes Sc-link hashes in compacted memory, i-th of them corresponds to i-th sc-link hash in
+ * memory
+ * @param link_hashes_count A count of sc-link hashes
+ * @returns SC_FS_MEMORY_OK, if are no reading and writing errors.
+ */
+sc_dictionary_fs_memory_status sc_dictionary_fs_memory_compact(
+    sc_dictionary_fs_memory * memory,
+    sc_dictionary_fs_memory * compacted_memory,
+    sc_addr_hash const * link_hashes,
+    sc_addr_hash const * compacted_link_hashes,
+    sc_uint64 link_hashes_count);
+
 /*! Load file system memory from file system
  * @param memory A pointer to file memory
  * @returns SC_FS_MEMORY_OK, if are no reading and writing errors.
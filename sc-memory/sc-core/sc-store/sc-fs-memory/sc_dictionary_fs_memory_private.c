@@ -48,13 +48,66 @@ sc_bool _sc_number_dictionary_initialize(sc_dictionary ** dictionary)
       dictionary, _sc_number_dictionary_children_size(), _sc_number_dictionary_sc_char_to_sc_int);
 }
 
+//! Returns bytes of sc-list and its nodes, not empty sc-list has one more node after the last one
+static sc_uint64 _sc_dictionary_fs_memory_list_bytes(sc_list const * list)
+{
+  return sizeof(sc_list) + (list->size == 0 ? 0 : (list->size + 1) * sizeof(sc_struct_node));
+}
+
+sc_list * _sc_dictionary_fs_memory_list_new()
+{
+  sc_list * list;
+  sc_list_init(&list);
+  sc_mem_account_new(SC_ALLOCATIONS_DICTIONARIES, 1, _sc_dictionary_fs_memory_list_bytes(list));
+  return list;
+}
+
+void _sc_dictionary_fs_memory_list_push_back(sc_list * list, void * data)
+{
+  sc_uint64 const bytes = _sc_dictionary_fs_memory_list_bytes(list);
+  sc_list_push_back(list, data);
+  sc_mem_account_new(SC_ALLOCATIONS_DICTIONARIES, 0, _sc_dictionary_fs_memory_list_bytes(list) - bytes);
+}
+
+sc_bool _sc_dictionary_fs_memory_list_remove_if(
+    sc_list * list,
+    void * data,
+    sc_bool (*predicate)(void * data, void * other))
+{
+  sc_uint64 const bytes = _sc_dictionary_fs_memory_list_bytes(list);
+  sc_bool const is_removed = sc_list_remove_if(list, data, predicate);
+  sc_mem_account_free(SC_ALLOCATIONS_DICTIONARIES, 0, bytes - _sc_dictionary_fs_memory_list_bytes(list));
+  return is_removed;
+}
+
+void _sc_dictionary_fs_memory_list_destroy(sc_list * list)
+{
+  sc_mem_account_free(SC_ALLOCATIONS_DICTIONARIES, 1, _sc_dictionary_fs_memory_list_bytes(list));
+  sc_list_destroy(list);
+}
+
+sc_link_hash_content * _sc_dictionary_fs_memory_link_hash_content_new()
+{
+  sc_mem_account_new(SC_ALLOCATIONS_DICTIONARIES, 1, sizeof(sc_link_hash_content));
+  return sc_mem_new(sc_link_hash_content, 1);
+}
+
+void _sc_dictionary_fs_memory_link_hash_content_destroy(sc_link_hash_content * content)
+{
+  sc_mem_free(content);
+  sc_mem_account_free(SC_ALLOCATIONS_DICTIONARIES, 1, sizeof(sc_link_hash_content));
+}
+
 void _sc_dictionary_fs_memory_node_clear(sc_dictionary_node * node)
 {
   if (node->data == null_ptr)
     return;
 
-  sc_mem_free(((sc_list *)node->data)->begin->data);
-  sc_list_destroy(node->data);
+  // the first item of list is copy of key
+  sc_char * key = ((sc_list *)node->data)->begin->data;
+  sc_mem_account_free(SC_ALLOCATIONS_DICTIONARIES, 0, sc_str_len(key) + 1);
+  sc_mem_free(key);
+  _sc_dictionary_fs_memory_list_destroy(node->data);
 }
 
 void _sc_dictionary_fs_memory_link_node_clear(sc_dictionary_node * node)
@@ -63,16 +116,16 @@ void _sc_dictionary_fs_memory_link_node_clear(sc_dictionary_node * node)
   if (link_hashes == null_ptr)
     return;
 
-  sc_list_destroy(link_hashes);
+  _sc_dictionary_fs_memory_list_destroy(link_hashes);
 }
 
 void _sc_dictionary_fs_memory_string_node_clear(sc_dictionary_node * node)
 {
-  void * content = node->data;
+  sc_link_hash_content * content = node->data;
   if (content == null_ptr)
     return;
 
-  sc_mem_free(content);
+  _sc_dictionary_fs_memory_link_hash_content_destroy(content);
 }
 
 sc_memory_params * _sc_dictionary_fs_memory_get_default_params(sc_char const * path, sc_bool clear)
@@ -85,6 +138,9 @@ sc_memory_params * _sc_dictionary_fs_memory_get_default_params(sc_char const * p
   params->max_searchable_string_size = DEFAULT_MAX_SEARCHABLE_STRING_SIZE;
   params->term_separators = DEFAULT_TERM_SEPARATORS;
   params->search_by_substring = DEFAULT_SEARCH_BY_SUBSTRING;
+  params->sorted_terms_dictionary = DEFAULT_SORTED_TERMS_DICTIONARY;
+  params->lazy_dictionaries_loading = DEFAULT_LAZY_DICTIONARIES_LOADING;
+  params->dictionaries_unload_period = DEFAULT_DICTIONARIES_UNLOAD_PERIOD;
 
   return params;
 }
@@ -154,3 +210,42 @@ sc_list * _sc_dictionary_fs_memory_get_string_terms(sc_char const * string, sc_c
 
   return terms;
 }
+
+sc_uint64 _sc_dictionary_fs_memory_get_content_hash(sc_char const * string, sc_uint64 string_size)
+{
+  // MurmurHash64A
+  sc_uint64 const m = 0xc6a4a7935bd1e995ULL;
+  sc_int32 const r = 47;
+  sc_uint64 hash = 0x9747b28c ^ (string_size * m);
+
+  sc_uchar const * data = (sc_uchar const *)string;
+  sc_uchar const * end = data + (string_size / 8) * 8;
+  for (; data != end; data += 8)
+  {
+    sc_uint64 k;
+    sc_mem_cpy(&k, data, sizeof(k));
+
+    k *= m;
+    k ^= k >> r;
+    k *= m;
+
+    hash ^= k;
+    hash *= m;
+  }
+
+  sc_uint64 tail = 0;
+  for (sc_uint64 i = string_size & 7; i > 0; --i)
+    tail = (tail << 8) | data[i - 1];
+  if ((string_size & 7) != 0)
+  {
+    hash ^= tail;
+    hash *= m;
+  }
+
+  hash ^= hash >> r;
+  hash *= m;
+  hash ^= hash >> r;
+
+  // hashes are used as keys of number dictionary, so they must fit into `sc_int_to_str_int` string
+  return hash >> 1;
+}
@@ -14,9 +14,14 @@
 #include "../sc-container/sc-dictionary/sc_dictionary.h"
 
 #include "../sc-base/sc_monitor_table.h"
+#include "../sc-base/sc_mutex.h"
+#include "../sc-base/sc_condition.h"
+#include "../sc-base/sc_thread.h"
 
 #include "../../sc_memory_params.h"
 
+#include "sc_sorted_dictionary_file.h"
+
 #define SC_FS_EXT ".scdb"
 #define INVALID_STRING_OFFSET LONG_MAX
 
@@ -25,6 +30,15 @@
 #define sc_fs_memory_warning(...) sc_warning(SC_FS_MEMORY_PREFIX __VA_ARGS__)
 #define sc_fs_memory_error(...) sc_critical(SC_FS_MEMORY_PREFIX __VA_ARGS__)
 
+//! Groups of dictionaries loaded and unloaded together if dictionaries are loaded lazily
+typedef enum
+{
+  // `string offsets - link hashes`, `link hashes - string offsets` and `content hash - offsets` dictionaries
+  SC_DICTIONARY_FS_MEMORY_LINKS = 0x1,
+  SC_DICTIONARY_FS_MEMORY_TERMS = 0x2,  // `term - offsets` dictionary
+  SC_DICTIONARY_FS_MEMORY_ALL = SC_DICTIONARY_FS_MEMORY_LINKS | SC_DICTIONARY_FS_MEMORY_TERMS,
+} sc_dictionary_fs_memory_dictionaries;
+
 struct _sc_dictionary_fs_memory
 {
   sc_char * path;  // path to all dictionary files
@@ -35,6 +49,7 @@ struct _sc_dictionary_fs_memory
   sc_uint32 max_searchable_string_size;  // maximal size of strings that can be found by string/substring
   sc_char const * term_separators;
   sc_bool search_by_substring;
+  sc_bool sorted_terms_dictionary;  // save `term - offsets` dictionary as sorted file and search in it without loading
 
   void ** strings_channels;
   sc_monitor_table strings_channels_monitors_table;
@@ -43,18 +58,67 @@ struct _sc_dictionary_fs_memory
 
   sc_char * terms_string_offsets_path;              // path to dictionary file with terms and its strings offsets
   sc_dictionary * terms_string_offsets_dictionary;  // dictionary instance with terms and its strings offsets
+  sc_char * sorted_terms_string_offsets_path;       // path to sorted dictionary file with terms and its strings offsets
+  // sorted dictionary file loaded on startup or saved, `terms_string_offsets_dictionary` keeps only terms string
+  // offsets added after it was loaded or saved
+  sc_sorted_dictionary_file * terms_string_offsets_file;
 
   sc_char * string_offsets_link_hashes_path;  // path to dictionary file with strings offsets and its link hashes
   sc_dictionary *
       string_offsets_link_hashes_dictionary;  // dictionary instance with strings offsets and its link hashes
   sc_dictionary *
       link_hashes_string_offsets_dictionary;  // dictionary instance with link hashes and its strings offsets
+
+  sc_char * content_hashes_string_offsets_path;  // path to dictionary file with content hashes and strings offsets
+  sc_dictionary *
+      content_hashes_string_offsets_dictionary;  // dictionary instance with content hashes and its strings offsets
+
+  sc_bool lazy_dictionaries_loading;     // load dictionaries on first use instead of loading them on startup
+  sc_uint32 dictionaries_unload_period;  // period (in seconds) without use after which dictionaries are unloaded
+  sc_mutex dictionaries_mutex;           // guards the following state of lazily loaded dictionaries
+  sc_condition dictionaries_condition;   // signalled when dictionaries are loaded or unloaded
+  sc_uint8 loaded_dictionaries;          // mask of loaded groups of dictionaries
+  sc_uint8 loading_dictionaries;         // mask of groups of dictionaries being loaded
+  sc_uint8 unloading_dictionaries;       // mask of groups of dictionaries being saved or unloaded
+  sc_uint8 changed_dictionaries;         // mask of groups of dictionaries changed since they were loaded or saved
+  sc_uint32 dictionaries_users;          // number of operations using dictionaries now
+  sc_int64 dictionaries_last_use_time;   // monotonic time in microseconds when dictionaries were used last time
+  // changes of strings made when dictionaries weren't loaded, they are added into dictionaries when they are loaded
+  sc_list * journal;
+  sc_uint8 journal_dictionaries;  // mask of groups of dictionaries which journal entries aren't added into
+  sc_thread * dictionaries_unloader;
+  sc_condition dictionaries_unloader_condition;
+  sc_bool is_dictionaries_unloader_running;
 };
 
+typedef struct
+{
+  sc_list * link_hashes;
+  sc_uint64 string_offset;
+} sc_link_hash_content;
+
 sc_bool _sc_uchar_dictionary_initialize(sc_dictionary ** dictionary);
 
 sc_bool _sc_number_dictionary_initialize(sc_dictionary ** dictionary);
 
+/*! Creates sc-list to be stored in sc-dictionary node and accounts it in sc-dictionaries allocations. Lists
+ * created by this function must be changed and destroyed by functions below.
+ */
+sc_list * _sc_dictionary_fs_memory_list_new();
+
+void _sc_dictionary_fs_memory_list_push_back(sc_list * list, void * data);
+
+sc_bool _sc_dictionary_fs_memory_list_remove_if(
+    sc_list * list,
+    void * data,
+    sc_bool (*predicate)(void * data, void * other));
+
+void _sc_dictionary_fs_memory_list_destroy(sc_list * list);
+
+sc_link_hash_content * _sc_dictionary_fs_memory_link_hash_content_new();
+
+void _sc_dictionary_fs_memory_link_hash_content_destroy(sc_link_hash_content * content);
+
 void _sc_dictionary_fs_memory_node_clear(sc_dictionary_node * node);
 
 void _sc_dictionary_fs_memory_link_node_clear(sc_dictionary_node * node);
@@ -67,4 +131,11 @@ sc_char * _sc_dictionary_fs_memory_get_first_term(sc_char const * string, sc_cha
 
 sc_list * _sc_dictionary_fs_memory_get_string_terms(sc_char const * string, sc_char const * term_separators);
 
+sc_uint64 _sc_dictionary_fs_memory_get_content_hash(sc_char const * string, sc_uint64 string_size);
+
+/*! Saves and unloads loaded dictionaries.
+ * @note Lock of dictionaries must be held, it is released while dictionaries are saved and held again on return.
+ */
+void _sc_dictionary_fs_memory_unload_dictionaries(sc_dictionary_fs_memory * memory);
+
 #endif
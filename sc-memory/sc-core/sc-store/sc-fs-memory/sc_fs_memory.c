@@ -9,12 +9,15 @@
 
 #include "sc_file_system.h"
 #include "sc_dictionary_fs_memory_private.h"
+#include "../sc-container/sc-string/sc_string.h"
 
 #include "../sc_segment.h"
 #include "../sc_storage_private.h"
 
 #include "sc_io.h"
 
+#include "../sc-base/sc_thread.h"
+
 sc_fs_memory_manager * manager;
 
 sc_fs_memory_status sc_fs_memory_initialize_ext(sc_memory_params const * params)
@@ -110,6 +113,15 @@ sc_fs_memory_status sc_fs_memory_get_link_hashes_by_substring(
       manager->fs_memory, substring, substring_size, max_length_to_search_as_prefix, data, callback);
 }
 
+sc_fs_memory_status sc_fs_memory_estimate_link_hashes_by_string(
+    sc_char const * string,
+    sc_uint32 const string_size,
+    sc_bool const is_substring,
+    sc_uint64 * count)
+{
+  return manager->estimate_link_hashes_by_string(manager->fs_memory, string, string_size, is_substring, count);
+}
+
 sc_fs_memory_status sc_fs_memory_get_strings_by_substring(
     sc_char const * substring,
     sc_uint32 const substring_size,
@@ -126,7 +138,80 @@ sc_fs_memory_status sc_fs_memory_unlink_string(sc_addr_hash link_hash)
   return manager->unlink_string(manager->fs_memory, link_hash);
 }
 
+sc_fs_memory_status sc_fs_memory_compact(
+    sc_memory_params const * params,
+    sc_addr_hash const * link_hashes,
+    sc_addr_hash const * compacted_link_hashes,
+    sc_uint64 link_hashes_count)
+{
+  if (params->repo_path == null_ptr || sc_str_cmp(params->repo_path, manager->path))
+  {
+    sc_fs_memory_error("Compacted memory must be saved to another repo path");
+    return SC_FS_MEMORY_WRONG_PATH;
+  }
+
+  sc_fs_memory * compacted_memory = null_ptr;
+  if (manager->initialize(&compacted_memory, params) != SC_FS_MEMORY_OK)
+    return SC_FS_MEMORY_NO;
+
+  sc_fs_memory_status const status = manager->compact(
+      manager->fs_memory, compacted_memory, link_hashes, compacted_link_hashes, link_hashes_count);
+  if (status != SC_FS_MEMORY_OK)
+  {
+    manager->shutdown(compacted_memory);
+    return status;
+  }
+
+  manager->shutdown(manager->fs_memory);
+  manager->fs_memory = compacted_memory;
+
+  manager->path = params->repo_path;
+  sc_mem_free(manager->segments_path);
+  static sc_char const * segments_postfix = "segments" SC_FS_EXT;
+  sc_fs_concat_path(manager->path, segments_postfix, &manager->segments_path);
+  sc_fs_remove_file(manager->segments_path);
+
+  return SC_FS_MEMORY_OK;
+}
+
 // read, write and save methods
+#define SC_FS_MEMORY_SEGMENTS_READ_BUFFER_SIZE (1 << 20)
+#define SC_FS_MEMORY_DEPRECATED_ELEMENT_SIZE 36
+
+typedef struct
+{
+  sc_segment * segment;
+  sc_char * deprecated_elements;  // sc-elements in deprecated format, they are decoded into segment
+} _sc_fs_memory_segment_chunk;
+
+void _sc_fs_memory_decode_segment_chunk(sc_pointer data, sc_pointer user_data)
+{
+  (void)user_data;
+
+  _sc_fs_memory_segment_chunk * chunk = data;
+  sc_segment * segment = chunk->segment;
+
+  if (chunk->deprecated_elements != null_ptr)
+  {
+    for (sc_addr_offset i = 0; i < SC_SEGMENT_ELEMENTS_COUNT; ++i)
+    {
+      sc_mem_cpy(
+          &segment->elements[i],
+          chunk->deprecated_elements + i * SC_FS_MEMORY_DEPRECATED_ELEMENT_SIZE,
+          SC_FS_MEMORY_DEPRECATED_ELEMENT_SIZE);
+
+      // needed for sc-template search
+      segment->elements[i].input_arcs_count = 1;
+      segment->elements[i].output_arcs_count = 1;
+    }
+
+    sc_mem_free(chunk->deprecated_elements);
+  }
+
+  sc_segment_rebuild_registry(segment);
+  sc_mem_free(chunk);
+}
+
 sc_fs_memory_status _sc_fs_memory_load_sc_memory_segments(sc_storage * storage)
 {
   if (sc_fs_is_file(manager->segments_path) == SC_FALSE)
@@ -139,6 +224,10 @@ sc_fs_memory_status _sc_fs_memory_load_sc_memory_segments(sc_storage * storage)
   // open segments
   sc_io_channel * segments_channel = sc_io_new_read_channel(manager->segments_path, null_ptr);
   sc_io_channel_set_encoding(segments_channel, null_ptr, null_ptr);
+  sc_io_channel_set_buffer_size(segments_channel, SC_FS_MEMORY_SEGMENTS_READ_BUFFER_SIZE);
+
+  // segments are read sequentially by this thread and decoded by pool threads
+  GThreadPool * decode_pool = null_ptr;
 
   if (sc_fs_memory_header_read(segments_channel, &manager->header) != SC_FS_MEMORY_OK)
     goto error;
@@ -152,8 +241,9 @@ sc_fs_memory_status _sc_fs_memory_load_sc_memory_segments(sc_storage * storage)
   else
     sc_fs_memory_warning("Load deprecated sc-memory segments from %s", manager->segments_path);
 
-  static sc_uint32 const OLD_SC_ELEMENT_SIZE = 36;
-  sc_uint32 element_size = is_no_deprecated_segments ? sizeof(sc_element) : OLD_SC_ELEMENT_SIZE;
+  sc_uint64 const elements_size = is_no_deprecated_segments
+                                      ? SC_SEG_ELEMENTS_SIZE_BYTE
+                                      : SC_FS_MEMORY_DEPRECATED_ELEMENT_SIZE * SC_SEGMENT_ELEMENTS_COUNT;
   if (is_no_deprecated_segments)
   {
     if (sc_io_channel_read_chars(
@@ -205,29 +295,29 @@ sc_fs_memory_status _sc_fs_memory_load_sc_memory_segments(sc_storage * storage)
     goto error;
   }
 
+  decode_pool = g_thread_pool_new(
+      _sc_fs_memory_decode_segment_chunk, null_ptr, (sc_int32)g_get_num_processors(), SC_FALSE, null_ptr);
+
   for (sc_addr_seg i = 0; i < storage->segments_count; ++i)
   {
-    sc_addr_seg const num = i;
     sc_segment * seg = sc_segment_new(i + 1);
     storage->segments[i] = seg;
 
-    for (sc_addr_seg j = 0; j < SC_SEGMENT_ELEMENTS_COUNT; ++j)
-    {
-      if (sc_io_channel_read_chars(segments_channel, (sc_char *)&seg->elements[j], element_size, &read_bytes, null_ptr)
-              != SC_FS_IO_STATUS_NORMAL
-          || read_bytes != element_size)
-      {
-        storage->segments_count = num;
-        sc_fs_memory_error("Error while sc-element %d in sc-segment %d reading", j, i);
-        goto error;
-      }
+    _sc_fs_memory_segment_chunk * chunk = sc_mem_new(_sc_fs_memory_segment_chunk, 1);
+    chunk->segment = seg;
+    chunk->deprecated_elements = is_no_deprecated_segments ? null_ptr : sc_mem_new(sc_char, elements_size);
 
-      // needed for sc-template search
-      if (!is_no_deprecated_segments)
-      {
-        seg->elements[j].input_arcs_count = 1;
-        seg->elements[j].output_arcs_count = 1;
-      }
+    // all sc-elements of segment are read by one call
+    sc_char * elements = is_no_deprecated_segments ? (sc_char *)seg->elements : chunk->deprecated_elements;
+    if (sc_io_channel_read_chars(segments_channel, elements, elements_size, &read_bytes, null_ptr)
+            != SC_FS_IO_STATUS_NORMAL
+        || read_bytes != elements_size)
+    {
+      storage->segments_count = i;
+      sc_mem_free(chunk->deprecated_elements);
+      sc_mem_free(chunk);
+      sc_fs_memory_error("Error while sc-elements of sc-segment %d reading", i);
+      goto error;
     }
 
     if (is_no_deprecated_segments)
@@ -237,6 +327,7 @@ sc_fs_memory_status _sc_fs_memory_load_sc_memory_segments(sc_storage * storage)
               != SC_FS_IO_STATUS_NORMAL
           || read_bytes != sizeof(sc_addr_offset))
       {
+        sc_mem_free(chunk);
         sc_fs_memory_error("Error while sc-segment %d reading", i);
         goto error;
       }
@@ -246,14 +337,17 @@ sc_fs_memory_status _sc_fs_memory_load_sc_memory_segments(sc_storage * storage)
               != SC_FS_IO_STATUS_NORMAL
           || read_bytes != sizeof(sc_addr_offset))
       {
+        sc_mem_free(chunk);
         sc_fs_memory_error("Error while sc-segment %d reading", i);
         goto error;
       }
     }
 
-    i = num;
+    g_thread_pool_push(decode_pool, chunk, null_ptr);
   }
 
+  // wait until all read segments are decoded
+  g_thread_pool_free(decode_pool, SC_FALSE, SC_TRUE);
   sc_io_channel_shutdown(segments_channel, SC_FALSE, null_ptr);
 
   sc_message("\tLoaded segments count: %d", storage->segments_count);
@@ -270,16 +364,27 @@ sc_fs_memory_status _sc_fs_memory_load_sc_memory_segments(sc_storage * storage)
 
 error:
 {
+  if (decode_pool != null_ptr)
+    g_thread_pool_free(decode_pool, SC_FALSE, SC_TRUE);
   sc_io_channel_shutdown(segments_channel, SC_FALSE, null_ptr);
   return SC_FS_MEMORY_READ_ERROR;
 }
 }
 
+sc_pointer _sc_fs_memory_load_dictionaries(sc_pointer data)
+{
+  (void)data;
+  return GINT_TO_POINTER(manager->load(manager->fs_memory));
+}
+
 sc_fs_memory_status sc_fs_memory_load(sc_storage * storage)
 {
-  if (_sc_fs_memory_load_sc_memory_segments(storage) != SC_FS_MEMORY_OK)
-    return SC_FS_MEMORY_READ_ERROR;
-  if (manager->load(manager->fs_memory) != SC_FS_MEMORY_OK)
+  // dictionaries don't depend on sc-memory segments, so they are loaded concurrently with segments
+  sc_thread * dictionaries_thread = sc_thread_new("sc-fs-memory-load", _sc_fs_memory_load_dictionaries, null_ptr);
+  sc_fs_memory_status const segments_status = _sc_fs_memory_load_sc_memory_segments(storage);
+  sc_fs_memory_status const dictionaries_status = GPOINTER_TO_INT(sc_thread_join(dictionaries_thread));
+
+  if (segments_status != SC_FS_MEMORY_OK || dictionaries_status != SC_FS_MEMORY_OK)
     return SC_FS_MEMORY_READ_ERROR;
 
   return SC_FS_MEMORY_OK;
@@ -58,6 +58,12 @@ typedef struct _sc_fs_memory_manager
       sc_uint32 const max_length_to_search_as_prefix,
       void * data,
       void (*callback)(void * data, sc_addr const link_addr));
+  sc_fs_memory_status (*estimate_link_hashes_by_string)(
+      sc_fs_memory * memory,
+      sc_char const * string,
+      sc_uint64 const string_size,
+      sc_bool const is_substring,
+      sc_uint64 * count);
   sc_fs_memory_status (*get_strings_by_substring)(
       sc_fs_memory * memory,
       sc_char const * substring,
@@ -66,6 +72,12 @@ typedef struct _sc_fs_memory_manager
       void * data,
       void (*callback)(void * data, sc_addr const link_addr, sc_char const * link_content));
   sc_fs_memory_status (*unlink_string)(sc_fs_memory * memory, sc_addr_hash const link_hash);
+  sc_fs_memory_status (*compact)(
+      sc_fs_memory * memory,
+      sc_fs_memory * compacted_memory,
+      sc_addr_hash const * link_hashes,
+      sc_addr_hash const * compacted_link_hashes,
+      sc_uint64 link_hashes_count);
 } sc_fs_memory_manager;
 
 /*! Initialize file system memory in specified path.
@@ -150,6 +162,19 @@ sc_fs_memory_status sc_fs_memory_get_link_hashes_by_substring(
     void * data,
     void (*callback)(void * data, sc_addr const link_addr));
 
+/*! Estimates amount of sc-link hashes in file system memory found by string or substring content.
+ * @param string A sc-links content string or substring
+ * @param string_size A sc-links content string or substring size
+ * @param is_substring Estimate search by substring
+ * @param[out] count Upper bound of amount of found sc-link hashes, strings aren't read to get it
+ * @returns SC_FS_MEMORY_OK, if amount is estimated.
+ */
+sc_fs_memory_status sc_fs_memory_estimate_link_hashes_by_string(
+    sc_char const * string,
+    sc_uint32 string_size,
+    sc_bool is_substring,
+    sc_uint64 * count);
+
 /*! Gets sc-strings from file system memory by its substring content.
  * @param substring A sc-strings content substring
  * @param string_size A sc-strings content substring size
@@ -164,6 +189,20 @@ sc_fs_memory_status sc_fs_memory_get_strings_by_substring(
     void * data,
     void (*callback)(void * data, sc_addr const link_addr, sc_char const * link_content));
 
+/*! Relocates file system memory to another repo path keeping only strings of specified sc-links. Sc-links get new
+ * sc-link hashes in relocated memory. Segments are saved to new repo path on the next save.
+ * @param params Sc-memory params with new repo path, it must be different from the current one
+ * @param link_hashes Sc-link hashes in current memory
+ * @param compacted_link_hashes Sc-link hashes in relocated memory
+ * @param link_hashes_count A count of sc-link hashes
+ * @returns SC_FS_MEMORY_OK, if file system memory relocated.
+ */
+sc_fs_memory_status sc_fs_memory_compact(
+    sc_memory_params const * params,
+    sc_addr_hash const * link_hashes,
+    sc_addr_hash const * compacted_link_hashes,
+    sc_uint64 link_hashes_count);
+
 /*! Load file system memory from file system
  * @returns SC_TRUE, if file system loaded.
  */
@@ -12,6 +12,7 @@
 #include "../sc_types.h"
 
 typedef GIOChannel sc_io_channel;
+typedef GMappedFile sc_io_mapped_file;
 
 /// io statuses
 #define SC_FS_IO_STATUS_NORMAL G_IO_STATUS_NORMAL
@@ -29,6 +30,8 @@ typedef GIOChannel sc_io_channel;
 
 #define sc_io_channel_set_encoding(channel, encoding, errors) g_io_channel_set_encoding(channel, encoding, errors)
 
+#define sc_io_channel_set_buffer_size(channel, size) g_io_channel_set_buffer_size(channel, size)
+
 #define sc_io_channel_flush(channel, errors) g_io_channel_flush(channel, errors)
 
 #define sc_io_channel_shutdown(channel, flush, errors) \
@@ -43,4 +46,12 @@ typedef GIOChannel sc_io_channel;
 
 #define sc_io_channel_seek(channel, offset, type, errors) g_io_channel_seek_position(channel, offset, type, errors)
 
+#define sc_io_new_mapped_file(file_path, errors) g_mapped_file_new(file_path, FALSE, errors)
+
+#define sc_io_mapped_file_get_contents(file) g_mapped_file_get_contents(file)
+
+#define sc_io_mapped_file_get_length(file) g_mapped_file_get_length(file)
+
+#define sc_io_mapped_file_free(file) g_mapped_file_unref(file)
+
 #endif
@@ -0,0 +1,411 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_sorted_dictionary_file.h"
+
+#include <string.h>
+
+#include "sc_dictionary_fs_memory_private.h"
+#include "sc_file_system.h"
+#include "sc_io.h"
+
+#include "../sc-base/sc_allocator.h"
+#include "../sc-container/sc-string/sc_string.h"
+
+#define SC_SORTED_DICTIONARY_FILE_MAGIC 0x3146445344435300  // "\0SCDSDF1"
+#define SC_SORTED_DICTIONARY_FILE_BLOCK_SIZE 32
+#define SC_SORTED_DICTIONARY_FILE_TMP_EXT ".tmp"
+
+typedef struct
+{
+  sc_uint64 magic;
+  sc_uint64 meta;
+  sc_uint64 records_count;
+  sc_uint64 block_size;
+  sc_uint64 index_position;
+} sc_sorted_dictionary_file_header;
+
+struct _sc_sorted_dictionary_file
+{
+  sc_io_mapped_file * mapped_file;
+  sc_char const * data;
+  sc_uint64 size;
+  sc_sorted_dictionary_file_header header;
+  sc_uint64 blocks_count;
+};
+
+struct _sc_sorted_dictionary_file_writer
+{
+  sc_char * path;
+  sc_char * tmp_path;
+  sc_io_channel * channel;
+  sc_sorted_dictionary_file_header header;
+  sc_uint64 position;
+  sc_uint64 * index;
+  sc_uint64 blocks_count;
+  sc_uint64 index_capacity;
+  sc_char * last_key;
+  sc_uint64 last_key_size;
+  sc_uint64 remaining_values_count;
+  sc_bool is_valid;
+};
+
+sc_uint64 _sc_sorted_dictionary_file_read_uint64(sc_char const * data)
+{
+  // file data isn't aligned
+  sc_uint64 value;
+  memcpy(&value, data, sizeof(sc_uint64));
+  return value;
+}
+
+sc_int32 sc_sorted_dictionary_compare_keys(
+    sc_char const * key,
+    sc_uint64 key_size,
+    sc_char const * other_key,
+    sc_uint64 other_key_size)
+{
+  sc_int32 const result = memcmp(key, other_key, sc_min(key_size, other_key_size));
+  if (result != 0)
+    return result;
+
+  return key_size < other_key_size ? -1 : (key_size > other_key_size ? 1 : 0);
+}
+
+sc_bool _sc_sorted_dictionary_file_read_record(
+    sc_sorted_dictionary_file const * file,
+    sc_uint64 position,
+    sc_sorted_dictionary_record * record)
+{
+  sc_uint64 const end = file->header.index_position;
+  if (position < sizeof(sc_sorted_dictionary_file_header) || position >= end || end - position < sizeof(sc_uint64))
+    return SC_FALSE;
+
+  record->key_size = _sc_sorted_dictionary_file_read_uint64(file->data + position);
+  position += sizeof(sc_uint64);
+  if (end - position < record->key_size || end - position - record->key_size < sizeof(sc_uint64))
+    return SC_FALSE;
+
+  record->key = file->data + position;
+  position += record->key_size;
+
+  record->values_count = _sc_sorted_dictionary_file_read_uint64(file->data + position);
+  position += sizeof(sc_uint64);
+  if ((end - position) / sizeof(sc_uint64) < record->values_count)
+    return SC_FALSE;
+
+  record->values = file->data + position;
+  record->next_position = position + record->values_count * sizeof(sc_uint64);
+  return SC_TRUE;
+}
+
+sc_bool _sc_sorted_dictionary_file_read_block_record(
+    sc_sorted_dictionary_file const * file,
+    sc_uint64 block,
+    sc_sorted_dictionary_record * record)
+{
+  sc_uint64 const position =
+      _sc_sorted_dictionary_file_read_uint64(file->data + file->header.index_position + block * sizeof(sc_uint64));
+  return _sc_sorted_dictionary_file_read_record(file, position, record);
+}
+
+sc_sorted_dictionary_file * sc_sorted_dictionary_file_open(sc_char const * path)
+{
+  if (sc_fs_is_file(path) == SC_FALSE)
+    return null_ptr;
+
+  sc_io_mapped_file * mapped_file = sc_io_new_mapped_file(path, null_ptr);
+  if (mapped_file == null_ptr)
+  {
+    sc_fs_memory_error("Can't map file `%s`", path);
+    return null_ptr;
+  }
+
+  sc_sorted_dictionary_file * file = sc_mem_new(sc_sorted_dictionary_file, 1);
+  file->mapped_file = mapped_file;
+  file->data = sc_io_mapped_file_get_contents(mapped_file);
+  file->size = sc_io_mapped_file_get_length(mapped_file);
+  if (file->data == null_ptr || file->size < sizeof(sc_sorted_dictionary_file_header))
+    goto error;
+
+  memcpy(&file->header, file->data, sizeof(sc_sorted_dictionary_file_header));
+  if (file->header.magic != SC_SORTED_DICTIONARY_FILE_MAGIC || file->header.block_size == 0
+      || file->header.index_position < sizeof(sc_sorted_dictionary_file_header)
+      || file->header.index_position > file->size)
+    goto error;
+
+  file->blocks_count = (file->header.records_count + file->header.block_size - 1) / file->header.block_size;
+  if ((file->size - file->header.index_position) / sizeof(sc_uint64) != file->blocks_count)
+    goto error;
+
+  return file;
+
+error:
+  sc_fs_memory_error("File `%s` is not a sorted dictionary file or it is damaged", path);
+  sc_sorted_dictionary_file_close(file);
+  return null_ptr;
+}
+
+void sc_sorted_dictionary_file_close(sc_sorted_dictionary_file * file)
+{
+  if (file == null_ptr)
+    return;
+
+  sc_io_mapped_file_free(file->mapped_file);
+  sc_mem_free(file);
+}
+
+sc_uint64 sc_sorted_dictionary_file_get_meta(sc_sorted_dictionary_file const * file)
+{
+  return file->header.meta;
+}
+
+sc_uint64 sc_sorted_dictionary_file_get_records_count(sc_sorted_dictionary_file const * file)
+{
+  return file->header.records_count;
+}
+
+//! Finds the first record which key isn't less than the specified key
+sc_bool _sc_sorted_dictionary_file_lower_bound(
+    sc_sorted_dictionary_file const * file,
+    sc_char const * key,
+    sc_uint64 key_size,
+    sc_sorted_dictionary_record * record)
+{
+  if (file->blocks_count == 0)
+    return SC_FALSE;
+
+  // find the last block which first key isn't greater than the specified key
+  sc_uint64 left = 0;
+  sc_uint64 right = file->blocks_count;
+  while (right - left > 1)
+  {
+    sc_uint64 const middle = left + (right - left) / 2;
+    if (_sc_sorted_dictionary_file_read_block_record(file, middle, record) == SC_FALSE)
+      return SC_FALSE;
+
+    if (sc_sorted_dictionary_compare_keys(record->key, record->key_size, key, key_size) <= 0)
+      left = middle;
+    else
+      right = middle;
+  }
+
+  if (_sc_sorted_dictionary_file_read_block_record(file, left, record) == SC_FALSE)
+    return SC_FALSE;
+
+  // the found record may be the first record of the next block
+  while (sc_sorted_dictionary_compare_keys(record->key, record->key_size, key, key_size) < 0)
+  {
+    if (sc_sorted_dictionary_file_get_next_record(file, record, record) == SC_FALSE)
+      return SC_FALSE;
+  }
+
+  return SC_TRUE;
+}
+
+sc_bool sc_sorted_dictionary_file_get_by_key(
+    sc_sorted_dictionary_file const * file,
+    sc_char const * key,
+    sc_uint64 key_size,
+    sc_sorted_dictionary_record * record)
+{
+  if (file == null_ptr)
+    return SC_FALSE;
+
+  return _sc_sorted_dictionary_file_lower_bound(file, key, key_size, record)
+         && sc_sorted_dictionary_compare_keys(record->key, record->key_size, key, key_size) == 0;
+}
+
+sc_bool sc_sorted_dictionary_file_visit_by_key_prefix(
+    sc_sorted_dictionary_file const * file,
+    sc_char const * prefix,
+    sc_uint64 prefix_size,
+    sc_sorted_dictionary_record_visitor visitor,
+    void ** arguments)
+{
+  if (file == null_ptr)
+    return SC_TRUE;
+
+  sc_sorted_dictionary_record record;
+  if (_sc_sorted_dictionary_file_lower_bound(file, prefix, prefix_size, &record) == SC_FALSE)
+    return SC_TRUE;
+
+  // records with the same prefix follow each other
+  do
+  {
+    if (record.key_size < prefix_size || memcmp(record.key, prefix, prefix_size) != 0)
+      break;
+
+    if (visitor(&record, arguments) == SC_FALSE)
+      return SC_FALSE;
+  } while (sc_sorted_dictionary_file_get_next_record(file, &record, &record));
+
+  return SC_TRUE;
+}
+
+sc_bool sc_sorted_dictionary_file_get_first_record(
+    sc_sorted_dictionary_file const * file,
+    sc_sorted_dictionary_record * record)
+{
+  if (file == null_ptr || file->header.records_count == 0)
+    return SC_FALSE;
+
+  return _sc_sorted_dictionary_file_read_record(file, sizeof(sc_sorted_dictionary_file_header), record);
+}
+
+sc_bool sc_sorted_dictionary_file_get_next_record(
+    sc_sorted_dictionary_file const * file,
+    sc_sorted_dictionary_record const * record,
+    sc_sorted_dictionary_record * next_record)
+{
+  return _sc_sorted_dictionary_file_read_record(file, record->next_position, next_record);
+}
+
+sc_uint64 sc_sorted_dictionary_record_get_value(sc_sorted_dictionary_record const * record, sc_uint64 index)
+{
+  return _sc_sorted_dictionary_file_read_uint64(record->values + index * sizeof(sc_uint64));
+}
+
+void _sc_sorted_dictionary_file_writer_write(
+    sc_sorted_dictionary_file_writer * writer,
+    void const * data,
+    sc_uint64 size)
+{
+  if (writer->is_valid == SC_FALSE)
+    return;
+
+  sc_uint64 written_bytes = 0;
+  if (sc_io_channel_write_chars(writer->channel, data, size, &written_bytes, null_ptr) != SC_FS_IO_STATUS_NORMAL
+      || size != written_bytes)
+  {
+    sc_fs_memory_error("Error while sorted dictionary file `%s` writing", writer->tmp_path);
+    writer->is_valid = SC_FALSE;
+    return;
+  }
+
+  writer->position += written_bytes;
+}
+
+sc_sorted_dictionary_file_writer * sc_sorted_dictionary_file_writer_new(sc_char const * path, sc_uint64 meta)
+{
+  sc_char * tmp_path;
+  sc_str_concat(path, SC_SORTED_DICTIONARY_FILE_TMP_EXT, tmp_path);
+
+  sc_io_channel * channel = sc_io_new_write_channel(tmp_path, null_ptr);
+  if (channel == null_ptr)
+  {
+    sc_fs_memory_error("Can't create file `%s`", tmp_path);
+    sc_mem_free(tmp_path);
+    return null_ptr;
+  }
+  sc_io_channel_set_encoding(channel, null_ptr, null_ptr);
+
+  sc_sorted_dictionary_file_writer * writer = sc_mem_new(sc_sorted_dictionary_file_writer, 1);
+  sc_str_cpy(writer->path, path, sc_str_len(path));
+  writer->tmp_path = tmp_path;
+  writer->channel = channel;
+  writer->header.magic = SC_SORTED_DICTIONARY_FILE_MAGIC;
+  writer->header.meta = meta;
+  writer->header.block_size = SC_SORTED_DICTIONARY_FILE_BLOCK_SIZE;
+  writer->is_valid = SC_TRUE;
+
+  // header is rewritten when records are written
+  _sc_sorted_dictionary_file_writer_write(writer, &writer->header, sizeof(sc_sorted_dictionary_file_header));
+  return writer;
+}
+
+sc_bool sc_sorted_dictionary_file_writer_append_record(
+    sc_sorted_dictionary_file_writer * writer,
+    sc_char const * key,
+    sc_uint64 key_size,
+    sc_uint64 values_count)
+{
+  if (writer->remaining_values_count != 0
+      || (writer->last_key != null_ptr
+          && sc_sorted_dictionary_compare_keys(writer->last_key, writer->last_key_size, key, key_size) >= 0))
+  {
+    sc_fs_memory_error("Records of sorted dictionary file `%s` are written in wrong order", writer->tmp_path);
+    writer->is_valid = SC_FALSE;
+  }
+
+  if (writer->is_valid == SC_FALSE)
+    return SC_FALSE;
+
+  if (writer->header.records_count % writer->header.block_size == 0)
+  {
+    if (writer->blocks_count == writer->index_capacity)
+    {
+      writer->index_capacity = writer->index_capacity == 0 ? 16 : writer->index_capacity * 2;
+      writer->index = sc_mem_realloc(writer->index, writer->index_capacity, sizeof(sc_uint64));
+    }
+    writer->index[writer->blocks_count++] = writer->position;
+  }
+
+  _sc_sorted_dictionary_file_writer_write(writer, &key_size, sizeof(sc_uint64));
+  _sc_sorted_dictionary_file_writer_write(writer, key, key_size);
+  _sc_sorted_dictionary_file_writer_write(writer, &values_count, sizeof(sc_uint64));
+
+  sc_mem_free(writer->last_key);
+  sc_str_cpy(writer->last_key, key, key_size);
+  writer->last_key_size = key_size;
+  writer->remaining_values_count = values_count;
+  ++writer->header.records_count;
+
+  return writer->is_valid;
+}
+
+sc_bool sc_sorted_dictionary_file_writer_append_value(sc_sorted_dictionary_file_writer * writer, sc_uint64 value)
+{
+  if (writer->remaining_values_count == 0)
+  {
+    sc_fs_memory_error("Too many values are written into record of sorted dictionary file `%s`", writer->tmp_path);
+    writer->is_valid = SC_FALSE;
+    return SC_FALSE;
+  }
+
+  --writer->remaining_values_count;
+  _sc_sorted_dictionary_file_writer_write(writer, &value, sizeof(sc_uint64));
+  return writer->is_valid;
+}
+
+sc_bool sc_sorted_dictionary_file_writer_finish(sc_sorted_dictionary_file_writer * writer, sc_bool commit)
+{
+  if (writer->remaining_values_count != 0)
+  {
+    sc_fs_memory_error("Not all values are written into record of sorted dictionary file `%s`", writer->tmp_path);
+    writer->is_valid = SC_FALSE;
+  }
+
+  writer->header.index_position = writer->position;
+  _sc_sorted_dictionary_file_writer_write(writer, writer->index, writer->blocks_count * sizeof(sc_uint64));
+
+  if (writer->is_valid
+      && sc_io_channel_seek(writer->channel, 0, SC_FS_IO_SEEK_SET, null_ptr) != SC_FS_IO_STATUS_NORMAL)
+  {
+    sc_fs_memory_error("Error while sorted dictionary file `%s` writing", writer->tmp_path);
+    writer->is_valid = SC_FALSE;
+  }
+  _sc_sorted_dictionary_file_writer_write(writer, &writer->header, sizeof(sc_sorted_dictionary_file_header));
+  sc_io_channel_shutdown(writer->channel, SC_TRUE, null_ptr);
+
+  sc_bool result = commit && writer->is_valid;
+  if (result)
+  {
+    // mapped file by the same path stays valid after it is replaced
+    result = sc_fs_rename_file(writer->tmp_path, writer->path);
+    if (result == SC_FALSE)
+      sc_fs_memory_error("Can't replace file `%s` by `%s`", writer->path, writer->tmp_path);
+  }
+
+  if (result == SC_FALSE)
+    sc_fs_remove_file(writer->tmp_path);
+
+  sc_mem_free(writer->last_key);
+  sc_mem_free(writer->index);
+  sc_mem_free(writer->tmp_path);
+  sc_mem_free(writer->path);
+  sc_mem_free(writer);
+  return result;
+}
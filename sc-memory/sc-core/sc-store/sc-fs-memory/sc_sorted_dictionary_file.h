@@ -0,0 +1,115 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_sorted_dictionary_file_h_
+#define _sc_sorted_dictionary_file_h_
+
+#include "../sc_types.h"
+
+/*! Immutable dictionary file with records sorted by keys. Records are grouped into blocks of the fixed size, and
+ * positions of the first records of blocks are stored in index at the end of file. The file is memory mapped on open,
+ * so it isn't parsed and records are searched by binary search over index.
+ *
+ * File layout (all numbers are 64-bit unsigned integers):
+ *   header: magic, meta, records count, block size, index position;
+ *   records: key size, key, values count, values;
+ *   index: positions of the first records of blocks.
+ */
+typedef struct _sc_sorted_dictionary_file sc_sorted_dictionary_file;
+
+typedef struct _sc_sorted_dictionary_file_writer sc_sorted_dictionary_file_writer;
+
+//! Record of sorted dictionary file, it refers to memory of the file and is valid until the file is closed
+typedef struct
+{
+  sc_char const * key;
+  sc_uint64 key_size;
+  sc_uint64 values_count;
+  sc_char const * values;  // values aren't aligned, they should be got by `sc_sorted_dictionary_record_get_value`
+  sc_uint64 next_position;
+} sc_sorted_dictionary_record;
+
+typedef sc_bool (*sc_sorted_dictionary_record_visitor)(sc_sorted_dictionary_record const * record, void ** arguments);
+
+/*! Opens sorted dictionary file and maps it into memory
+ * @param path Path to the file
+ * @returns Returns opened file, null_ptr if the file doesn't exist or it is damaged
+ */
+sc_sorted_dictionary_file * sc_sorted_dictionary_file_open(sc_char const * path);
+
+void sc_sorted_dictionary_file_close(sc_sorted_dictionary_file * file);
+
+//! Returns the number saved with the file by its writer
+sc_uint64 sc_sorted_dictionary_file_get_meta(sc_sorted_dictionary_file const * file);
+
+sc_uint64 sc_sorted_dictionary_file_get_records_count(sc_sorted_dictionary_file const * file);
+
+/*! Finds record by key
+ * @returns Returns SC_TRUE if record is found
+ */
+sc_bool sc_sorted_dictionary_file_get_by_key(
+    sc_sorted_dictionary_file const * file,
+    sc_char const * key,
+    sc_uint64 key_size,
+    sc_sorted_dictionary_record * record);
+
+/*! Visits records which keys start with prefix in ascending order of keys
+ * @param visitor Function called for each record, visiting is stopped if it returns SC_FALSE
+ * @returns Returns SC_FALSE if visitor stopped visiting or the file is damaged
+ */
+sc_bool sc_sorted_dictionary_file_visit_by_key_prefix(
+    sc_sorted_dictionary_file const * file,
+    sc_char const * prefix,
+    sc_uint64 prefix_size,
+    sc_sorted_dictionary_record_visitor visitor,
+    void ** arguments);
+
+sc_bool sc_sorted_dictionary_file_get_first_record(
+    sc_sorted_dictionary_file const * file,
+    sc_sorted_dictionary_record * record);
+
+//! Gets record following the specified one, record may be passed as next record to iterate over file
+sc_bool sc_sorted_dictionary_file_get_next_record(
+    sc_sorted_dictionary_file const * file,
+    sc_sorted_dictionary_record const * record,
+    sc_sorted_dictionary_record * next_record);
+
+sc_uint64 sc_sorted_dictionary_record_get_value(sc_sorted_dictionary_record const * record, sc_uint64 index);
+
+//! Compares keys bytewise, shorter key is less than longer key with the same prefix
+sc_int32 sc_sorted_dictionary_compare_keys(
+    sc_char const * key,
+    sc_uint64 key_size,
+    sc_char const * other_key,
+    sc_uint64 other_key_size);
+
+/*! Creates writer of sorted dictionary file. Records are written into temporary file, it replaces file by the
+ * specified path when writing is finished.
+ * @param path Path to the file
+ * @param meta Number saved with the file, it can be got by `sc_sorted_dictionary_file_get_meta`
+ * @returns Returns writer, null_ptr if temporary file can't be created
+ */
+sc_sorted_dictionary_file_writer * sc_sorted_dictionary_file_writer_new(sc_char const * path, sc_uint64 meta);
+
+/*! Starts record writing, `values_count` values of record should be written by
+ * `sc_sorted_dictionary_file_writer_append_value` after it
+ * @note Records should be written in ascending order of keys.
+ */
+sc_bool sc_sorted_dictionary_file_writer_append_record(
+    sc_sorted_dictionary_file_writer * writer,
+    sc_char const * key,
+    sc_uint64 key_size,
+    sc_uint64 values_count);
+
+sc_bool sc_sorted_dictionary_file_writer_append_value(sc_sorted_dictionary_file_writer * writer, sc_uint64 value);
+
+/*! Finishes writing and destroys writer
+ * @param commit If SC_TRUE then written file replaces file by path of writer, otherwise written file is removed
+ * @returns Returns SC_TRUE if file is written and replaced
+ */
+sc_bool sc_sorted_dictionary_file_writer_finish(sc_sorted_dictionary_file_writer * writer, sc_bool commit);
+
+#endif
@@ -28,18 +28,6 @@ struct _sc_event_registration_manager
 
 #define TABLE_KEY(__Addr) GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(__Addr))
 
-// Pointer to hash table that contains events
-
-guint events_table_hash_func(gconstpointer pointer)
-{
-  return GPOINTER_TO_UINT(pointer);
-}
-
-gboolean events_table_equal_func(gconstpointer a, gconstpointer b)
-{
-  return (a == b);
-}
-
 /*! Adds the specified sc-event to the registration manager's events table.
  * @param manager Pointer to the sc-event registration manager.
  * @param event Pointer to the sc-event to be added.
@@ -111,7 +99,8 @@ error:
 void sc_event_registration_manager_initialize(sc_event_registration_manager ** manager)
 {
   (*manager) = sc_mem_new(sc_event_registration_manager, 1);
-  (*manager)->events_table = sc_hash_table_init(events_table_hash_func, events_table_equal_func, null_ptr, null_ptr);
+  (*manager)->events_table = sc_hash_table_init(
+      sc_hash_table_default_hash_func, sc_hash_table_default_equal_func, null_ptr, null_ptr);
   sc_monitor_init(&(*manager)->events_table_monitor);
 }
 
@@ -143,10 +132,14 @@ sc_event * sc_event_new(
   event->callback = callback;
   event->callback_ext = null_ptr;
   event->callback_with_user = null_ptr;
+  event->batch_callback = null_ptr;
+  event->batch = null_ptr;
+  event->priority = SC_EVENT_PRIORITY_NORMAL;
   event->delete_callback = delete_callback;
   event->data = data;
   event->ref_count = 1;
   sc_monitor_init(&event->monitor);
+  sc_mem_account_new(SC_ALLOCATIONS_EVENTS, 1, sizeof(sc_event));
 
   // register created event
   sc_event_registration_manager * manager = sc_storage_get_event_registration_manager();
@@ -176,10 +169,14 @@ sc_event * sc_event_new_ex(
   event->callback = null_ptr;
   event->callback_ext = callback;
   event->callback_with_user = null_ptr;
+  event->batch_callback = null_ptr;
+  event->batch = null_ptr;
+  event->priority = SC_EVENT_PRIORITY_NORMAL;
   event->delete_callback = delete_callback;
   event->data = data;
   event->ref_count = 1;
   sc_monitor_init(&event->monitor);
+  sc_mem_account_new(SC_ALLOCATIONS_EVENTS, 1, sizeof(sc_event));
 
   // register created event
   sc_event_registration_manager * manager = sc_storage_get_event_registration_manager();
@@ -209,10 +206,14 @@ sc_event * sc_event_with_user_new(
   event->callback = null_ptr;
   event->callback_ext = null_ptr;
   event->callback_with_user = callback;
+  event->batch_callback = null_ptr;
+  event->batch = null_ptr;
+  event->priority = SC_EVENT_PRIORITY_NORMAL;
   event->delete_callback = delete_callback;
   event->data = data;
   event->ref_count = 1;
   sc_monitor_init(&event->monitor);
+  sc_mem_account_new(SC_ALLOCATIONS_EVENTS, 1, sizeof(sc_event));
 
   // register created event
   sc_event_registration_manager * manager = sc_storage_get_event_registration_manager();
@@ -221,6 +222,75 @@ sc_event * sc_event_with_user_new(
   return event;
 }
 
+sc_event * sc_event_batch_new(
+    sc_memory_context const * ctx,
+    sc_addr subscription_addr,
+    sc_event_type type,
+    sc_pointer data,
+    sc_event_batch_callback callback,
+    sc_event_delete_function delete_callback,
+    sc_uint32 max_batch_size,
+    sc_uint32 max_batch_delay_ms)
+{
+  sc_unused(ctx);
+
+  if (SC_ADDR_IS_EMPTY(subscription_addr))
+    return null_ptr;
+
+  sc_event * event = null_ptr;
+
+  event = sc_mem_new(sc_event, 1);
+  event->subscription_addr = subscription_addr;
+  event->type = type;
+  event->callback = null_ptr;
+  event->callback_ext = null_ptr;
+  event->callback_with_user = null_ptr;
+  event->batch_callback = callback;
+  event->priority = SC_EVENT_PRIORITY_NORMAL;
+  event->delete_callback = delete_callback;
+  event->data = data;
+  event->ref_count = 1;
+  sc_monitor_init(&event->monitor);
+  sc_mem_account_new(SC_ALLOCATIONS_EVENTS, 1, sizeof(sc_event));
+
+  event->batch = sc_mem_new(sc_event_batch, 1);
+  sc_mutex_init(&event->batch->mutex);
+  event->batch->max_size = sc_max(1, max_batch_size);
+  event->batch->max_delay = (sc_int64)max_batch_delay_ms * 1000;
+
+  // register created event, its batches are delivered by size or by time
+  sc_event_emission_manager * emission_manager = sc_storage_get_event_emission_manager();
+  _sc_event_emission_manager_add_batched_event(emission_manager, event);
+
+  sc_event_registration_manager * manager = sc_storage_get_event_registration_manager();
+  _sc_event_registration_manager_add(manager, event);
+
+  return event;
+}
+
+void sc_event_batch_destroy(sc_event * event)
+{
+  if (event->batch == null_ptr)
+    return;
+
+  sc_mutex_destroy(&event->batch->mutex);
+  sc_mem_free(event->batch->items);
+  sc_mem_free(event->batch);
+  event->batch = null_ptr;
+}
+
+sc_result sc_event_set_priority(sc_event * event, sc_event_priority priority)
+{
+  if (event == null_ptr)
+    return SC_RESULT_NO;
+
+  sc_monitor_acquire_write(&event->monitor);
+  event->priority = priority;
+  sc_monitor_release_write(&event->monitor);
+
+  return SC_RESULT_OK;
+}
+
 sc_result sc_event_destroy(sc_event * event)
 {
   if (event == null_ptr)
@@ -239,12 +309,17 @@ sc_result sc_event_destroy(sc_event * event)
   if (event->delete_callback != null_ptr)
     event->delete_callback(event);
 
+  // emitted events waiting in batch are dropped, batch is freed with sc-event
+  if (event->batch != null_ptr)
+    _sc_event_emission_manager_remove_batched_event(emission_manager, event);
+
   event->ref_count = SC_EVENT_REQUEST_DESTROY;
   event->subscription_addr = SC_ADDR_EMPTY;
   event->type = 0;
   event->callback = null_ptr;
   event->callback_ext = null_ptr;
   event->callback_with_user = null_ptr;
+  event->batch_callback = null_ptr;
   event->delete_callback = null_ptr;
   event->data = null_ptr;
 
@@ -294,6 +369,9 @@ sc_result sc_event_notify_element_deleted(sc_addr element)
       // mark event for deletion
       sc_monitor_acquire_write(&event->monitor);
 
+      if (event->batch != null_ptr)
+        _sc_event_emission_manager_remove_batched_event(emission_manager, event);
+
       sc_monitor_acquire_write(&emission_manager->pool_monitor);
       sc_queue_push(&emission_manager->deletable_events, event);
       sc_monitor_release_write(&emission_manager->pool_monitor);
@@ -323,13 +401,15 @@ sc_result sc_event_emit(
   if (_sc_memory_context_are_events_blocking(ctx))
     return SC_RESULT_OK;
 
+  sc_int64 const emit_time = g_get_monotonic_time();
+
   if (_sc_memory_context_are_events_pending(ctx))
   {
-    _sc_memory_context_pend_event(ctx, type, subscription_addr, connector_addr, connector_type, other_addr);
+    _sc_memory_context_pend_event(ctx, type, subscription_addr, connector_addr, connector_type, other_addr, emit_time);
     return SC_RESULT_OK;
   }
 
-  return sc_event_emit_impl(ctx, subscription_addr, type, connector_addr, connector_type, other_addr);
+  return sc_event_emit_impl(ctx, subscription_addr, type, connector_addr, connector_type, other_addr, emit_time);
 }
 
 sc_result sc_event_emit_impl(
@@ -338,7 +418,8 @@ sc_result sc_event_emit_impl(
     sc_event_type type,
     sc_addr connector_addr,
     sc_type connector_type,
-    sc_addr other_addr)
+    sc_addr other_addr,
+    sc_int64 emit_time)
 {
   sc_hash_table_list * element_events_list = null_ptr;
   sc_event * event = null_ptr;
@@ -366,7 +447,7 @@ sc_result sc_event_emit_impl(
 
     if (event->type == type)
       _sc_event_emission_manager_add(
-          emission_manager, event, ctx->user_addr, connector_addr, connector_type, other_addr);
+          emission_manager, event, ctx->user_addr, connector_addr, connector_type, other_addr, emit_time);
 
     element_events_list = element_events_list->next;
   }
@@ -11,6 +11,17 @@
 
 typedef struct _sc_event_registration_manager sc_event_registration_manager;
 
+/*! Priority classes of sc-event subscriptions. Emitted sc-events of subscriptions with higher priority are processed
+ * before waiting sc-events of subscriptions with lower priority, sc-events of the same priority are processed in order
+ * of their emission.
+ */
+typedef enum
+{
+  SC_EVENT_PRIORITY_INTERACTIVE = 0,  ///< For agents which answer to users and other latency-sensitive agents
+  SC_EVENT_PRIORITY_NORMAL = 1,       ///< Default priority of sc-event subscriptions
+  SC_EVENT_PRIORITY_BACKGROUND = 2,   ///< For bulk processing that can wait
+} sc_event_priority;
+
 /*! Event callback function type.
  * It takes 3 parameters:
  * - pointer to emitted event description
@@ -25,6 +36,27 @@ typedef sc_result (*sc_event_callback_with_user)(
     sc_type connector_type,
     sc_addr other_addr);
 
+/*! Arguments of emitted sc-event delivered in batch.
+ */
+typedef struct _sc_event_batch_item
+{
+  sc_addr user_addr;       ///< sc-address of user that initiated sc-event
+  sc_addr connector_addr;  ///< sc-address of added/removed sc-connector
+  sc_type connector_type;  ///< sc-type of added/removed sc-connector
+  sc_addr other_addr;      ///< sc-address of another end of added/removed sc-connector
+} sc_event_batch_item;
+
+/*! Batch event callback function type.
+ * It takes 3 parameters:
+ * - pointer to subscription event description
+ * - array of emitted events arguments in order of their emission
+ * - size of this array
+ */
+typedef sc_result (*sc_event_batch_callback)(
+    sc_event const * event,
+    sc_event_batch_item const * items,
+    sc_uint32 items_count);
+
 /// Backward compatibility
 typedef sc_result (*sc_event_callback_ext)(sc_event const * event, sc_addr connector_addr, sc_addr other_addr);
 
@@ -86,6 +118,36 @@ _SC_EXTERN sc_event * sc_event_with_user_new(
     sc_event_callback_with_user callback,
     sc_event_delete_function delete_callback);
 
+/*! Subscribe for events from specified sc-element and receive them in batches
+ * @param subscription_addr sc-address of subscribed sc-element events
+ * @param type Type of listening sc-events
+ * @param data Pointer to user data
+ * @param callback Pointer to callback function. It would be calls with batch of emitted events
+ * @param delete_callback Pointer to callback function, that calls on subscribed sc-element deletion
+ * @param max_batch_size Maximum amount of emitted events in one batch, batch is delivered when it is full
+ * @param max_batch_delay_ms Maximum time in milliseconds that emitted event waits for its batch to be delivered
+ * @return Returns pointer to created sc-event
+ * @remarks Callback functions can be called from any thread, so they need to be a thread safe. Batches of one
+ * sc-event are delivered one after another, so emitted events are received in order of their emission.
+ */
+_SC_EXTERN sc_event * sc_event_batch_new(
+    sc_memory_context const * ctx,
+    sc_addr subscription_addr,
+    sc_event_type type,
+    sc_pointer data,
+    sc_event_batch_callback callback,
+    sc_event_delete_function delete_callback,
+    sc_uint32 max_batch_size,
+    sc_uint32 max_batch_delay_ms);
+
+/*! Sets priority class of the specified sc-event subscription.
+ * @param event Pointer to the sc-event.
+ * @param priority Priority class of sc-event subscription.
+ * @return Returns SC_RESULT_OK if the operation is successful, SC_RESULT_NO otherwise.
+ * @note Priority is applied to sc-events emitted after this call.
+ */
+_SC_EXTERN sc_result sc_event_set_priority(sc_event * event, sc_event_priority priority);
+
 /*! Destroys the specified sc-event.
  * @param event Pointer to the sc-event to be destroyed.
  * @return Returns SC_RESULT_OK if the operation is successful, SC_RESULT_NO otherwise.
@@ -206,18 +206,69 @@ sc_iterator3 * sc_iterator3_new(
   it->type = type;
   it->ctx = ctx;
   it->finished = SC_FALSE;
+  it->batch = null_ptr;
+  it->batch_size = 0;
+  it->batch_count = 0;
+  it->batch_position = 0;
 
   return it;
 }
 
+sc_bool sc_iterator3_set_batch_size(sc_iterator3 * it, sc_uint16 batch_size)
+{
+  if (it == null_ptr || it->batch != null_ptr || (it->type != sc_iterator3_f_a_a && it->type != sc_iterator3_a_a_f))
+    return SC_FALSE;
+
+  if (batch_size < 2)
+    return SC_FALSE;
+
+  it->batch_size = batch_size > SC_ITERATOR3_MAX_BATCH_SIZE ? SC_ITERATOR3_MAX_BATCH_SIZE : batch_size;
+  it->batch = sc_mem_new(sc_iterator_result, it->batch_size * 3);
+  return SC_TRUE;
+}
+
 void sc_iterator3_free(sc_iterator3 * it)
 {
   if (it == null_ptr)
     return;
 
+  sc_mem_free(it->batch);
   sc_mem_free(it);
 }
 
+/*! Stores found result in batch of iterator.
+ * @param other_index Index of result that is found together with sc-arc
+ * @return Return SC_TRUE, if found results should be returned
+ */
+sc_bool _sc_iterator3_store_batch_result(sc_iterator3 * it, sc_uint8 other_index)
+{
+  if (it->batch == null_ptr)
+    return SC_TRUE;
+
+  sc_iterator_result * batch_results = &it->batch[it->batch_count * 3];
+  batch_results[0] = it->results[0];
+  batch_results[1] = it->results[1];
+  batch_results[2] = it->results[2];
+  ++it->batch_count;
+
+  it->results[1].is_accessed = SC_FALSE;
+  it->results[other_index].is_accessed = SC_FALSE;
+  return it->batch_count == it->batch_size;
+}
+
+sc_bool _sc_iterator3_pop_batch_result(sc_iterator3 * it)
+{
+  sc_iterator_result const * batch_results = &it->batch[it->batch_position * 3];
+  it->results[0] = batch_results[0];
+  it->results[1] = batch_results[1];
+  it->results[2] = batch_results[2];
+
+  if (++it->batch_position == it->batch_count)
+    it->batch_position = it->batch_count = 0;
+
+  return SC_TRUE;
+}
+
 sc_addr _sc_iterator3_get_other_edge_incident_element(sc_element * el, sc_addr incident_element)
 {
   return SC_ADDR_IS_EQUAL(incident_element, el->arc.end) ? el->arc.begin : el->arc.end;
@@ -299,6 +350,10 @@ sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
             ? SC_ADDR_IS_EQUAL(arc_begin, el->arc.end) ? el->arc.next_end_out_arc : el->arc.next_begin_out_arc
             : el->arc.next_begin_out_arc;
 
+    // load next sc-arc and end of this sc-arc into cache while permissions are checked
+    sc_storage_prefetch_element(next_out_arc);
+    sc_storage_prefetch_element(el->arc.end);
+
     if (_sc_memory_context_check_local_and_global_permissions(
             sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_addr)
         == SC_FALSE)
@@ -344,7 +399,8 @@ sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
         it->results[2].is_accessed = SC_TRUE;
       }
 
-      goto success;
+      if (_sc_iterator3_store_batch_result(it, 2) == SC_TRUE)
+        goto success;
     }
 
     // go to next arc
@@ -354,11 +410,17 @@ sc_bool _sc_iterator3_f_a_a_next(sc_iterator3 * it)
 
 error:
   sc_monitor_release_read(monitor);
+  if (it->batch_count != 0)
+    return _sc_iterator3_pop_batch_result(it);
+
   it->finished = SC_TRUE;
   return SC_FALSE;
 
 success:
   sc_monitor_release_read(monitor);
+  if (it->batch_count != 0)
+    return _sc_iterator3_pop_batch_result(it);
+
   return SC_TRUE;
 }
 
@@ -447,6 +509,9 @@ sc_bool _sc_iterator3_f_a_f_next(sc_iterator3 * it)
             ? SC_ADDR_IS_EQUAL(arc_end, el->arc.end) ? el->arc.next_end_in_arc : el->arc.next_begin_in_arc
             : el->arc.next_end_in_arc;
 
+    // load next sc-arc into cache while permissions are checked
+    sc_storage_prefetch_element(next_in_arc);
+
     if (_sc_memory_context_check_local_and_global_permissions(
             sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_addr)
         == SC_FALSE)
@@ -588,6 +653,10 @@ sc_bool _sc_iterator3_a_a_f_next(sc_iterator3 * it)
             : el->arc.next_end_in_arc;
 #endif
 
+    // load next sc-arc and begin of this sc-arc into cache while permissions are checked
+    sc_storage_prefetch_element(next_in_arc);
+    sc_storage_prefetch_element(el->arc.begin);
+
     if (_sc_memory_context_check_local_and_global_permissions(
             sc_memory_get_context_manager(), it->ctx, SC_CONTEXT_PERMISSIONS_READ, arc_addr)
         == SC_FALSE)
@@ -631,7 +700,8 @@ sc_bool _sc_iterator3_a_a_f_next(sc_iterator3 * it)
         it->results[0].is_accessed = SC_TRUE;
       }
 
-      goto success;
+      if (_sc_iterator3_store_batch_result(it, 0) == SC_TRUE)
+        goto success;
     }
 
     // go to next arc
@@ -641,11 +711,17 @@ sc_bool _sc_iterator3_a_a_f_next(sc_iterator3 * it)
 
 error:
   sc_monitor_release_read(monitor);
+  if (it->batch_count != 0)
+    return _sc_iterator3_pop_batch_result(it);
+
   it->finished = SC_TRUE;
   return SC_FALSE;
 
 success:
   sc_monitor_release_read(monitor);
+  if (it->batch_count != 0)
+    return _sc_iterator3_pop_batch_result(it);
+
   return SC_TRUE;
 }
 
@@ -926,6 +1002,10 @@ sc_bool sc_iterator3_next_ext(sc_iterator3 * it, sc_result * result)
     return status;
   }
 
+  // results found in advance are returned without locks
+  if (it->batch_count != 0)
+    return _sc_iterator3_pop_batch_result(it);
+
   switch (it->type)
   {
   case sc_iterator3_f_a_a:
@@ -62,8 +62,15 @@ struct _sc_iterator3
   sc_iterator_result results[3];  // results array (same size as params)
   sc_memory_context const * ctx;  // pointer to used memory context
   sc_bool finished;
+  sc_iterator_result * batch;  // results found in advance, each 3 items are one iterator result
+  sc_uint16 batch_size;        // maximum amount of results found in advance, 0 if batch mode is off
+  sc_uint16 batch_count;
+  sc_uint16 batch_position;
 };
 
+//! Maximum amount of results that sc-iterator3 can find in advance
+#define SC_ITERATOR3_MAX_BATCH_SIZE 64
+
 /*! Create iterator to find output arcs for specified element
  * @param el sc-addr of element to iterate output arcs
  * @param arc_type Type of output arc to iterate (0 - all types)
@@ -140,6 +147,16 @@ _SC_EXTERN sc_iterator3 * sc_iterator3_new(
     sc_iterator_param p2,
     sc_iterator_param p3);
 
+/*! Turns on batch mode of iterator. In batch mode iterator finds up to `batch_size` results under one lock of
+ * iterated sc-element and returns them one by one without locks. It is supported by sc_iterator3_f_a_a and
+ * sc_iterator3_a_a_f only and must be turned on before the first `sc_iterator3_next` call.
+ * @param it Pointer to iterator
+ * @param batch_size Amount of results found in advance, it is limited by SC_ITERATOR3_MAX_BATCH_SIZE
+ * @return Return SC_TRUE, if batch mode is turned on; otherwise return SC_FALSE.
+ * @note Results found in advance may be erased before they are returned, as any result after it is returned.
+ */
+_SC_EXTERN sc_bool sc_iterator3_set_batch_size(sc_iterator3 * it, sc_uint16 batch_size);
+
 /*! Destroy iterator and free allocated memory
  * @param it Pointer to sc-iterator that need to be destroyed
  */
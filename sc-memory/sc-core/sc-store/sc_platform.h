@@ -57,4 +57,11 @@
 #define SC_IS_PLATFORM_IOS (SC_PLATFORM == SC_PLATFORM_IOS)
 #define SC_IS_PLATFORM_ANDROID (SC_PLATFORM == SC_PLATFORM_ANDROID)
 
+// Hint processor to load memory into cache before it is read
+#if SC_COMPILER == SC_COMPILER_GNU || SC_COMPILER == SC_COMPILER_CLANG
+#  define SC_PREFETCH(address) __builtin_prefetch(address)
+#else
+#  define SC_PREFETCH(address)
+#endif
+
 #endif  // _sc_platform_h_
\ No newline at end of file
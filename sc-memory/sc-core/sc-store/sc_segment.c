@@ -11,6 +11,9 @@
 #include "sc-base/sc_allocator.h"
 #include "sc-base/sc_atomic.h"
 
+//! Amount of spins that reader of sc-element waits for writer before it yields processor
+#define SC_SEGMENT_READ_MAX_SPINS 64
+
 sc_segment * sc_segment_new(sc_addr_seg num)
 {
   sc_segment * segment = sc_mem_new(sc_segment, 1);
@@ -18,6 +21,7 @@ sc_segment * sc_segment_new(sc_addr_seg num)
   segment->last_engaged_offset = 0;
   segment->last_released_offset = 0;
   sc_monitor_init(&segment->monitor);
+  sc_mem_account_new(SC_ALLOCATIONS_SEGMENTS, 1, sizeof(sc_segment));
 
   return segment;
 }
@@ -26,22 +30,108 @@ void sc_segment_free(sc_segment * segment)
 {
   sc_monitor_destroy(&segment->monitor);
   sc_mem_free(segment);
+  sc_mem_account_free(SC_ALLOCATIONS_SEGMENTS, 1, sizeof(sc_segment));
 }
 
 void sc_segment_collect_elements_stat(sc_segment * seg, sc_stat * stat)
 {
-  for (sc_addr_offset i = 0; i < seg->last_engaged_offset; ++i)
+  stat->node_count += sc_atomic_int_get(&seg->registry_counts[SC_SEGMENT_ELEMENT_CLASS_NODE]);
+  stat->link_count += sc_atomic_int_get(&seg->registry_counts[SC_SEGMENT_ELEMENT_CLASS_LINK]);
+  stat->arc_count += sc_atomic_int_get(&seg->registry_counts[SC_SEGMENT_ELEMENT_CLASS_CONNECTOR]);
+}
+
+sc_uint8 sc_segment_get_element_class(sc_type type)
+{
+  if (sc_type_has_subtype(type, sc_type_node))
+    return SC_SEGMENT_ELEMENT_CLASS_NODE;
+  if (sc_type_has_subtype(type, sc_type_link))
+    return SC_SEGMENT_ELEMENT_CLASS_LINK;
+  if (sc_type_has_subtype_in_mask(type, sc_type_arc_mask))
+    return SC_SEGMENT_ELEMENT_CLASS_CONNECTOR;
+
+  return SC_SEGMENT_ELEMENT_CLASSES_COUNT;
+}
+
+void sc_segment_register_element(sc_segment * seg, sc_addr_offset offset, sc_type type)
+{
+  sc_uint8 const element_class = sc_segment_get_element_class(type);
+  if (element_class == SC_SEGMENT_ELEMENT_CLASSES_COUNT)
+    return;
+
+  sc_uint32 const bit = 1u << (offset % SC_SEGMENT_REGISTRY_WORD_BITS);
+  sc_uint32 * word = &seg->registry[element_class][offset / SC_SEGMENT_REGISTRY_WORD_BITS];
+  if ((sc_atomic_int_or(word, bit) & bit) == 0)
+    sc_atomic_int_inc(&seg->registry_counts[element_class]);
+}
+
+void sc_segment_unregister_element(sc_segment * seg, sc_addr_offset offset, sc_type type)
+{
+  sc_uint8 const element_class = sc_segment_get_element_class(type);
+  if (element_class == SC_SEGMENT_ELEMENT_CLASSES_COUNT)
+    return;
+
+  sc_uint32 const bit = 1u << (offset % SC_SEGMENT_REGISTRY_WORD_BITS);
+  sc_uint32 * word = &seg->registry[element_class][offset / SC_SEGMENT_REGISTRY_WORD_BITS];
+  if ((sc_atomic_int_and(word, ~bit) & bit) != 0)
+    sc_atomic_int_add(&seg->registry_counts[element_class], -1);
+}
+
+void sc_segment_begin_element_change(sc_segment * seg, sc_addr_offset offset)
+{
+  sc_atomic_int_inc(&seg->versions[offset]);
+}
+
+void sc_segment_end_element_change(sc_segment * seg, sc_addr_offset offset)
+{
+  sc_atomic_int_inc(&seg->versions[offset]);
+}
+
+sc_bool sc_segment_read_element(sc_segment * seg, sc_addr_offset offset, sc_type * type, sc_addr * begin, sc_addr * end)
+{
+  sc_element const * element = &seg->elements[offset];
+  sc_uint32 version;
+  sc_states states;
+
+  do
+  {
+    // writers hold sc-element only for a few stores, so wait for them spinning, but yield if writer is preempted
+    sc_uint32 spins = 0;
+    while (((version = sc_atomic_int_get(&seg->versions[offset])) & 1) == 1)
+    {
+      if (++spins < SC_SEGMENT_READ_MAX_SPINS)
+        sc_atomic_spin_pause();
+      else
+      {
+        g_thread_yield();
+        spins = 0;
+      }
+    }
+
+    states = sc_atomic_load_relaxed(&element->flags.states);
+    *type = sc_atomic_load_relaxed(&element->flags.type);
+    begin->seg = sc_atomic_load_relaxed(&element->arc.begin.seg);
+    begin->offset = sc_atomic_load_relaxed(&element->arc.begin.offset);
+    end->seg = sc_atomic_load_relaxed(&element->arc.end.seg);
+    end->offset = sc_atomic_load_relaxed(&element->arc.end.offset);
+
+    // fields must be read before version is read again
+    sc_atomic_thread_fence_acquire();
+  } while (sc_atomic_int_get(&seg->versions[offset]) != version);
+
+  return (states & SC_STATE_ELEMENT_EXIST) == SC_STATE_ELEMENT_EXIST;
+}
+
+void sc_segment_rebuild_registry(sc_segment * seg)
+{
+  sc_mem_set(seg->registry, 0, sizeof(seg->registry));
+  sc_mem_set(seg->registry_counts, 0, sizeof(seg->registry_counts));
+
+  for (sc_addr_offset i = 1; i <= seg->last_engaged_offset; ++i)
   {
-    sc_element element = seg->elements[i];
-    if ((element.flags.states & SC_STATE_ELEMENT_EXIST) == 0)
+    sc_element * element = &seg->elements[i];
+    if ((element->flags.states & SC_STATE_ELEMENT_EXIST) == 0)
       continue;
 
-    sc_type type = element.flags.type;
-    if (sc_type_has_subtype(type, sc_type_node))
-      stat->node_count++;
-    else if (sc_type_has_subtype(type, sc_type_link))
-      stat->link_count++;
-    else if (sc_type_has_subtype_in_mask(type, sc_type_arc_mask))
-      stat->arc_count++;
+    sc_segment_register_element(seg, i, element->flags.type);
   }
 }
@@ -15,6 +15,16 @@
 
 #define SC_SEG_ELEMENTS_SIZE_BYTE (sizeof(sc_element) * SC_SEGMENT_ELEMENTS_COUNT)
 
+//! Element classes that segment registry tracks separately
+#define SC_SEGMENT_ELEMENT_CLASS_NODE 0
+#define SC_SEGMENT_ELEMENT_CLASS_LINK 1
+#define SC_SEGMENT_ELEMENT_CLASS_CONNECTOR 2
+#define SC_SEGMENT_ELEMENT_CLASSES_COUNT 3
+
+#define SC_SEGMENT_REGISTRY_WORD_BITS 32
+#define SC_SEGMENT_REGISTRY_WORDS_COUNT \
+  ((SC_SEGMENT_ELEMENTS_COUNT + SC_SEGMENT_REGISTRY_WORD_BITS) / SC_SEGMENT_REGISTRY_WORD_BITS)
+
 /*! Structure for segment storing
  */
 struct _sc_segment
@@ -24,6 +34,11 @@ struct _sc_segment
   sc_addr_offset last_engaged_offset;  // number of sc-element in the segment
   sc_addr_offset last_released_offset;
   sc_monitor monitor;
+  // bitmaps of live sc-elements for each element class, bit number is sc-element offset
+  sc_uint32 registry[SC_SEGMENT_ELEMENT_CLASSES_COUNT][SC_SEGMENT_REGISTRY_WORDS_COUNT];
+  sc_uint32 registry_counts[SC_SEGMENT_ELEMENT_CLASSES_COUNT];
+  // sequence counters of sc-elements, counter is odd while sc-element fields are being changed
+  sc_uint32 versions[SC_SEGMENT_ELEMENTS_COUNT];
 };
 
 /*! Create new segment with specified size.
@@ -33,7 +48,37 @@ sc_segment * sc_segment_new(sc_addr_seg num);
 
 void sc_segment_free(sc_segment * segment);
 
-//! Collects segment elements statistics
+//! Collects segment elements statistics from segment registry counters
 void sc_segment_collect_elements_stat(sc_segment * seg, sc_stat * stat);
 
+/*! Gets element class of specified sc-element type.
+ * @returns One of SC_SEGMENT_ELEMENT_CLASS_* values, or SC_SEGMENT_ELEMENT_CLASSES_COUNT if type has no
+ * element class.
+ */
+sc_uint8 sc_segment_get_element_class(sc_type type);
+
+/*! Marks sc-element with specified offset as live in registry of its element class.
+ * @note This function is lock-free, registry bitmaps are changed atomically.
+ */
+void sc_segment_register_element(sc_segment * seg, sc_addr_offset offset, sc_type type);
+
+//! Removes sc-element with specified offset from registry of its element class
+void sc_segment_unregister_element(sc_segment * seg, sc_addr_offset offset, sc_type type);
+
+/*! Starts change of sc-element fields read without sc-monitors: existence state, type, begin and end. Caller must
+ * hold write lock of sc-element monitor and finish change by `sc_segment_end_element_change`.
+ */
+void sc_segment_begin_element_change(sc_segment * seg, sc_addr_offset offset);
+
+void sc_segment_end_element_change(sc_segment * seg, sc_addr_offset offset);
+
+/*! Copies existence state, type, begin and end of sc-element without sc-monitors. Copy is repeated while sc-element
+ * is being changed, erased or reused concurrently.
+ * @returns Returns SC_FALSE if sc-element doesn't exist
+ */
+sc_bool sc_segment_read_element(sc_segment * seg, sc_addr_offset offset, sc_type * type, sc_addr * begin, sc_addr * end);
+
+//! Rebuilds segment registry from its elements, it is used after segment loading
+void sc_segment_rebuild_registry(sc_segment * seg);
+
 #endif
@@ -16,13 +16,26 @@
 #include "../sc_memory_private.h"
 
 #include "sc_stream_memory.h"
+#include "../sc_memory_context_private.h"
+#include "../sc_memory_context_permissions.h"
 #include "sc-base/sc_allocator.h"
+#include "sc-base/sc_atomic.h"
+#include "sc-base/sc_monitor_profiler.h"
 #include "sc-container/sc-string/sc_string.h"
 
 sc_storage * storage = null_ptr;
 
 sc_result sc_storage_initialize(sc_memory_params const * params)
 {
+  sc_events_queue_overflow_policy overflow_policy;
+  if (sc_events_queue_overflow_policy_parse(params->events_queue_overflow_policy, &overflow_policy) != SC_RESULT_OK)
+  {
+    sc_memory_error(
+        "Invalid events queue overflow policy `%s`, it should be `Block`, `Spill` or `Drop`",
+        params->events_queue_overflow_policy);
+    return SC_RESULT_ERROR_INVALID_PARAMS;
+  }
+
   if (sc_fs_memory_initialize_ext(params) != SC_FS_MEMORY_OK)
     return SC_RESULT_ERROR;
 
@@ -34,6 +47,7 @@ sc_result sc_storage_initialize(sc_memory_params const * params)
   storage->segments = sc_mem_new(sc_segment *, params->max_loaded_segments);
   sc_monitor_init(&storage->segments_monitor);
   _sc_monitor_table_init(&storage->addr_monitors_table);
+  _sc_monitor_profiler_initialize(params->monitors_contention_sampling_period);
 
   sc_memory_info("Sc-memory configuration:");
   sc_message("\tClean on initialize: %s", params->clear ? "On" : "Off");
@@ -42,6 +56,7 @@ sc_result sc_storage_initialize(sc_memory_params const * params)
   sc_message("\tSc-segment elements count: %d", SC_SEGMENT_ELEMENTS_COUNT);
   sc_message("\tSc-storage size: %zd", sizeof(sc_storage));
   sc_message("\tMax segments count: %d", storage->max_segments_count);
+  sc_message("\tMonitors contention sampling period: %d", params->monitors_contention_sampling_period);
 
   storage->processes_segments_table = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
   sc_monitor_init(&storage->processes_monitor);
@@ -50,6 +65,7 @@ sc_result sc_storage_initialize(sc_memory_params const * params)
   if (params->clear == SC_FALSE)
   {
     sc_monitor_acquire_write(&storage->segments_monitor);
+    // segment registries are rebuilt by sc-fs-memory while segments are loaded
     result = sc_fs_memory_load(storage) == SC_FS_MEMORY_OK;
     sc_monitor_release_write(&storage->segments_monitor);
   }
@@ -114,6 +130,7 @@ error:
   sc_mem_free(storage->segments);
   sc_monitor_destroy(&storage->segments_monitor);
   _sc_monitor_table_destroy(&storage->addr_monitors_table);
+  _sc_monitor_profiler_shutdown();
   sc_mem_free(storage);
   storage = null_ptr;
 
@@ -170,6 +187,32 @@ error:
   return result;
 }
 
+/*! Copies type, begin and end of sc-element without sc-monitors. It is used by getters of fields that are changed
+ * only with sc-element sequence counter.
+ */
+sc_result _sc_storage_read_element(sc_addr addr, sc_type * type, sc_addr * begin, sc_addr * end)
+{
+  if (storage == null_ptr || addr.seg == 0 || addr.offset == 0 || addr.seg > storage->max_segments_count
+      || addr.offset > SC_SEGMENT_ELEMENTS_COUNT)
+    return SC_RESULT_ERROR_ADDR_IS_NOT_VALID;
+
+  sc_segment * segment = storage->segments[addr.seg - 1];
+  if (segment == null_ptr || sc_segment_read_element(segment, addr.offset, type, begin, end) == SC_FALSE)
+    return SC_RESULT_ERROR_ADDR_IS_NOT_VALID;
+
+  return SC_RESULT_OK;
+}
+
+void sc_storage_prefetch_element(sc_addr addr)
+{
+  if (addr.seg == 0 || addr.seg > storage->max_segments_count || addr.offset > SC_SEGMENT_ELEMENTS_COUNT)
+    return;
+
+  sc_segment * segment = storage->segments[addr.seg - 1];
+  if (segment != null_ptr)
+    SC_PREFETCH(&segment->elements[addr.offset]);
+}
+
 sc_result sc_storage_free_element(sc_addr addr)
 {
   sc_result result = SC_RESULT_ERROR_ADDR_IS_NOT_VALID;
@@ -185,8 +228,11 @@ sc_result sc_storage_free_element(sc_addr addr)
     goto error;
 
   sc_monitor_acquire_write(&segment->monitor);
+  sc_segment_unregister_element(segment, addr.offset, element->flags.type);
   sc_addr_offset const last_released_offset = segment->last_released_offset;
+  sc_segment_begin_element_change(segment, addr.offset);
   segment->elements[addr.offset] = (sc_element){(sc_element_flags){.type = last_released_offset}};
+  sc_segment_end_element_change(segment, addr.offset);
   segment->last_released_offset = addr.offset;
   sc_monitor_release_write(&segment->monitor);
 
@@ -407,9 +453,6 @@ sc_element * sc_storage_allocate_new_element(sc_memory_context const * ctx, sc_a
           storage->max_segments_count);
   }
 
-  if (element != null_ptr)
-    element->flags.states |= SC_STATE_ELEMENT_EXIST;
-
   return element;
 }
 
@@ -755,6 +798,24 @@ error:
   return result;
 }
 
+void _sc_storage_register_element(sc_addr addr, sc_type type)
+{
+  sc_segment * segment = storage->segments[addr.seg - 1];
+  sc_segment_register_element(segment, addr.offset, type);
+}
+
+/*! Sets type of allocated sc-element and makes it existing within one change of sc-element, so readers of sc-segment
+ * never see existing sc-element without type.
+ */
+void _sc_storage_initialize_element(sc_addr addr, sc_element * element, sc_type type)
+{
+  sc_segment * segment = storage->segments[addr.seg - 1];
+  sc_segment_begin_element_change(segment, addr.offset);
+  element->flags.type = type;
+  element->flags.states |= SC_STATE_ELEMENT_EXIST;
+  sc_segment_end_element_change(segment, addr.offset);
+}
+
 sc_addr sc_storage_node_new(sc_memory_context const * ctx, sc_type type)
 {
   sc_result result;
@@ -778,7 +839,8 @@ sc_addr sc_storage_node_new_ext(sc_memory_context const * ctx, sc_type type, sc_
     return addr;
   }
 
-  element->flags.type = sc_type_node | type;
+  _sc_storage_initialize_element(addr, element, sc_type_node | type);
+  _sc_storage_register_element(addr, element->flags.type);
   *result = SC_RESULT_OK;
   return addr;
 }
@@ -806,11 +868,32 @@ sc_addr sc_storage_link_new_ext(sc_memory_context const * ctx, sc_type type, sc_
     return addr;
   }
 
-  element->flags.type = sc_type_link | type;
+  _sc_storage_initialize_element(addr, element, sc_type_link | type);
+  _sc_storage_register_element(addr, element->flags.type);
   *result = SC_RESULT_OK;
   return addr;
 }
 
+sc_int32 _sc_storage_compare_addr_hashes(void const * a, void const * b)
+{
+  sc_addr_hash const hash_a = *(sc_addr_hash const *)a;
+  sc_addr_hash const hash_b = *(sc_addr_hash const *)b;
+  return hash_a < hash_b ? -1 : (hash_a > hash_b ? 1 : 0);
+}
+
+sc_monitor * _sc_storage_get_not_locked_monitor_for_addr(
+    sc_addr addr,
+    sc_addr_hash const * locked_addrs,
+    sc_uint32 locked_addrs_count)
+{
+  sc_addr_hash const addr_hash = SC_ADDR_LOCAL_TO_INT(addr);
+  if (bsearch(&addr_hash, locked_addrs, locked_addrs_count, sizeof(sc_addr_hash), _sc_storage_compare_addr_hashes)
+      != null_ptr)
+    return null_ptr;
+
+  return sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
+}
+
 void _sc_storage_make_elements_incident_to_arc(
     sc_addr arc_addr,
     sc_element * arc_el,
@@ -818,6 +901,8 @@ void _sc_storage_make_elements_incident_to_arc(
     sc_element * beg_el,
     sc_addr end_addr,
     sc_element * end_el,
+    sc_addr_hash const * locked_addrs,
+    sc_uint32 locked_addrs_count,
     sc_bool is_reverse)
 {
   sc_element *first_out_arc = null_ptr, *first_in_arc = null_ptr;
@@ -828,10 +913,10 @@ void _sc_storage_make_elements_incident_to_arc(
   sc_monitor * first_out_arc_monitor = null_ptr;
   sc_monitor * first_in_arc_monitor = null_ptr;
 
-  if (SC_ADDR_IS_NOT_EQUAL(first_out_arc_addr, beg_addr) && SC_ADDR_IS_NOT_EQUAL(first_out_arc_addr, end_addr))
-    first_out_arc_monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, first_out_arc_addr);
-  if (SC_ADDR_IS_NOT_EQUAL(first_in_arc_addr, beg_addr) && SC_ADDR_IS_NOT_EQUAL(first_in_arc_addr, end_addr))
-    first_in_arc_monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, first_in_arc_addr);
+  // begin and end elements monitors are already locked by caller
+  first_out_arc_monitor =
+      _sc_storage_get_not_locked_monitor_for_addr(first_out_arc_addr, locked_addrs, locked_addrs_count);
+  first_in_arc_monitor = _sc_storage_get_not_locked_monitor_for_addr(first_in_arc_addr, locked_addrs, locked_addrs_count);
 
   sc_monitor_acquire_write_n(2, first_out_arc_monitor, first_in_arc_monitor);
 
@@ -875,16 +960,14 @@ void _sc_storage_update_structure_arcs(
     sc_element * arc_el,
     sc_addr beg_addr,
     sc_addr end_addr,
-    sc_element * end_el)
+    sc_element * end_el,
+    sc_addr_hash const * locked_addrs,
+    sc_uint32 locked_addrs_count)
 {
   sc_element * first_in_accessed_arc = null_ptr;
   sc_addr first_in_accessed_arc_addr = end_el->first_in_arc_from_structure;
-  sc_monitor * first_in_accessed_arc_monitor = null_ptr;
-
-  if (SC_ADDR_IS_NOT_EQUAL(first_in_accessed_arc_addr, beg_addr)
-      && SC_ADDR_IS_NOT_EQUAL(first_in_accessed_arc_addr, end_addr))
-    first_in_accessed_arc_monitor =
-        sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, first_in_accessed_arc_addr);
+  sc_monitor * first_in_accessed_arc_monitor =
+      _sc_storage_get_not_locked_monitor_for_addr(first_in_accessed_arc_addr, locked_addrs, locked_addrs_count);
 
   sc_monitor_acquire_write(first_in_accessed_arc_monitor);
 
@@ -938,9 +1021,14 @@ sc_addr sc_storage_arc_new_ext(
     return arc_addr;
   }
 
+  sc_segment * arc_segment = storage->segments[arc_addr.seg - 1];
+  sc_segment_begin_element_change(arc_segment, arc_addr.offset);
   arc_el->flags.type = type;
+  arc_el->flags.states |= SC_STATE_ELEMENT_EXIST;
   arc_el->arc.begin = beg_addr;
   arc_el->arc.end = end_addr;
+  sc_segment_end_element_change(arc_segment, arc_addr.offset);
+  _sc_storage_register_element(arc_addr, type);
 
   sc_bool is_edge = sc_type_has_subtype(type, sc_type_edge_common);
   sc_bool is_not_loop = SC_ADDR_IS_NOT_EQUAL(beg_addr, end_addr);
@@ -959,13 +1047,19 @@ sc_addr sc_storage_arc_new_ext(
     goto error;
 
   // lock arcs to change output/input list
-  _sc_storage_make_elements_incident_to_arc(arc_addr, arc_el, beg_addr, beg_el, end_addr, end_el, SC_FALSE);
+  sc_addr_hash const beg_addr_hash = SC_ADDR_LOCAL_TO_INT(beg_addr);
+  sc_addr_hash const end_addr_hash = SC_ADDR_LOCAL_TO_INT(end_addr);
+  sc_addr_hash const locked_addrs[] = {sc_min(beg_addr_hash, end_addr_hash), sc_max(beg_addr_hash, end_addr_hash)};
+
+  _sc_storage_make_elements_incident_to_arc(
+      arc_addr, arc_el, beg_addr, beg_el, end_addr, end_el, locked_addrs, 2, SC_FALSE);
   if (is_edge && is_not_loop)
-    _sc_storage_make_elements_incident_to_arc(arc_addr, arc_el, end_addr, end_el, beg_addr, beg_el, SC_TRUE);
+    _sc_storage_make_elements_incident_to_arc(
+        arc_addr, arc_el, end_addr, end_el, beg_addr, beg_el, locked_addrs, 2, SC_TRUE);
 
 #ifdef SC_OPTIMIZE_SEARCHING_INPUT_CONNECTORS_FROM_STRUCTURES
   if (sc_type_is_structure_and_arc(beg_el->flags.type, type))
-    _sc_storage_update_structure_arcs(arc_addr, arc_el, beg_addr, end_addr, end_el);
+    _sc_storage_update_structure_arcs(arc_addr, arc_el, beg_addr, end_addr, end_el, locked_addrs, 2);
 #endif
 
   // emit events
@@ -987,6 +1081,254 @@ error:
   return SC_ADDR_EMPTY;
 }
 
+sc_uint32 _sc_storage_get_elements(sc_uint32 count, sc_addr * addrs, sc_element ** elements)
+{
+  sc_segment * segment = _sc_storage_get_segment();
+  if (segment == null_ptr)
+    return 0;
+
+  sc_uint32 allocated_count = 0;
+  sc_addr_offset element_offset;
+
+  sc_monitor_acquire_write(&segment->monitor);
+
+  while (allocated_count < count && segment->last_engaged_offset + 1 != SC_SEGMENT_ELEMENTS_COUNT)
+  {
+    element_offset = ++segment->last_engaged_offset;
+    elements[allocated_count] = &segment->elements[element_offset];
+    addrs[allocated_count] = (sc_addr){segment->num, element_offset};
+    ++allocated_count;
+  }
+
+  while (allocated_count < count && segment->last_released_offset != 0)
+  {
+    element_offset = segment->last_released_offset;
+    sc_element * element = &segment->elements[element_offset];
+    segment->last_released_offset = element->flags.type;
+    element->flags.type = 0;
+
+    elements[allocated_count] = element;
+    addrs[allocated_count] = (sc_addr){segment->num, element_offset};
+    ++allocated_count;
+  }
+
+  sc_monitor_release_write(&segment->monitor);
+
+  return allocated_count;
+}
+
+sc_result _sc_storage_allocate_new_elements(
+    sc_memory_context const * ctx,
+    sc_uint32 count,
+    sc_addr * addrs,
+    sc_element ** elements)
+{
+  sc_uint32 allocated_count = 0;
+  while (allocated_count < count)
+  {
+    sc_uint32 const segment_allocated_count =
+        _sc_storage_get_elements(count - allocated_count, addrs + allocated_count, elements + allocated_count);
+    if (segment_allocated_count != 0)
+    {
+      allocated_count += segment_allocated_count;
+      continue;
+    }
+
+    // there are no free segments for this process, so try to reuse released elements of other segments
+    elements[allocated_count] = sc_storage_allocate_new_element(ctx, &addrs[allocated_count]);
+    if (elements[allocated_count] == null_ptr)
+    {
+      // allocated sc-elements are made existing without type to be released by common way
+      for (sc_uint32 i = 0; i < allocated_count; ++i)
+      {
+        _sc_storage_initialize_element(addrs[i], elements[i], 0);
+        sc_storage_free_element(addrs[i]);
+      }
+      return SC_RESULT_ERROR_FULL_MEMORY;
+    }
+    ++allocated_count;
+  }
+
+  return SC_RESULT_OK;
+}
+
+sc_result _sc_storage_check_batch_item(sc_element_batch_item const * item, sc_uint32 index)
+{
+  if (sc_type_has_not_subtype_in_mask(item->type, sc_type_arc_mask))
+    return SC_RESULT_OK;
+
+  if (item->begin_index >= (sc_int32)index || item->end_index >= (sc_int32)index)
+    return SC_RESULT_ERROR_ADDR_IS_NOT_VALID;
+
+  if ((item->begin_index < 0 && SC_ADDR_IS_EMPTY(item->begin_addr))
+      || (item->end_index < 0 && SC_ADDR_IS_EMPTY(item->end_addr)))
+    return SC_RESULT_ERROR_ADDR_IS_NOT_VALID;
+
+  return SC_RESULT_OK;
+}
+
+sc_result sc_storage_elements_new_batch(
+    sc_memory_context const * ctx,
+    sc_element_batch_item const * items,
+    sc_uint32 count,
+    sc_addr * result_addrs)
+{
+  sc_result result = SC_RESULT_OK;
+  if (count == 0)
+    return result;
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    result = _sc_storage_check_batch_item(&items[i], i);
+    if (result != SC_RESULT_OK)
+      return result;
+  }
+
+  sc_element ** elements = sc_mem_new(sc_element *, count);
+  sc_addr * begin_addrs = sc_mem_new(sc_addr, count);
+  sc_addr * end_addrs = sc_mem_new(sc_addr, count);
+  sc_monitor ** monitors = sc_mem_new(sc_monitor *, 2 * count);
+  sc_addr_hash * locked_addrs = sc_mem_new(sc_addr_hash, 2 * count);
+  sc_uint32 locked_addrs_count = 0;
+  sc_uint32 monitors_count = 0;
+
+  // reserve all sc-elements at once
+  result = _sc_storage_allocate_new_elements(ctx, count, result_addrs, elements);
+  if (result != SC_RESULT_OK)
+    goto end;
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    sc_element_batch_item const * item = &items[i];
+    sc_element * element = elements[i];
+
+    if (sc_type_has_subtype_in_mask(item->type, sc_type_arc_mask))
+    {
+      begin_addrs[i] = item->begin_index < 0 ? item->begin_addr : result_addrs[item->begin_index];
+      end_addrs[i] = item->end_index < 0 ? item->end_addr : result_addrs[item->end_index];
+
+      sc_segment * segment = storage->segments[result_addrs[i].seg - 1];
+      sc_segment_begin_element_change(segment, result_addrs[i].offset);
+      element->flags.type = item->type;
+      element->flags.states |= SC_STATE_ELEMENT_EXIST;
+      element->arc.begin = begin_addrs[i];
+      element->arc.end = end_addrs[i];
+      sc_segment_end_element_change(segment, result_addrs[i].offset);
+
+      locked_addrs[locked_addrs_count++] = SC_ADDR_LOCAL_TO_INT(begin_addrs[i]);
+      locked_addrs[locked_addrs_count++] = SC_ADDR_LOCAL_TO_INT(end_addrs[i]);
+    }
+    else if (sc_type_has_subtype(item->type, sc_type_link))
+      _sc_storage_initialize_element(result_addrs[i], element, sc_type_link | item->type);
+    else
+      _sc_storage_initialize_element(result_addrs[i], element, sc_type_node | item->type);
+
+    _sc_storage_register_element(result_addrs[i], element->flags.type);
+  }
+
+  // lock all begin and end sc-elements of sc-connectors under one acquisition
+  qsort(locked_addrs, locked_addrs_count, sizeof(sc_addr_hash), _sc_storage_compare_addr_hashes);
+  sc_uint32 unique_locked_addrs_count = 0;
+  for (sc_uint32 i = 0; i < locked_addrs_count; ++i)
+  {
+    if (unique_locked_addrs_count == 0 || locked_addrs[unique_locked_addrs_count - 1] != locked_addrs[i])
+      locked_addrs[unique_locked_addrs_count++] = locked_addrs[i];
+  }
+  locked_addrs_count = unique_locked_addrs_count;
+
+  for (sc_uint32 i = 0; i < locked_addrs_count; ++i)
+  {
+    sc_addr addr;
+    SC_ADDR_LOCAL_FROM_INT(locked_addrs[i], addr);
+    monitors[i] = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
+  }
+  monitors_count = sc_monitor_acquire_write_array(monitors, locked_addrs_count);
+
+  // check that all sc-elements exist before any of them are changed
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    if (sc_type_has_not_subtype_in_mask(items[i].type, sc_type_arc_mask))
+      continue;
+
+    sc_element *beg_el = null_ptr, *end_el = null_ptr;
+    result = sc_storage_get_element_by_addr(begin_addrs[i], &beg_el);
+    if (result == SC_RESULT_OK)
+      result = sc_storage_get_element_by_addr(end_addrs[i], &end_el);
+    if (result != SC_RESULT_OK)
+    {
+      sc_monitor_release_write_array(monitors, monitors_count);
+      for (sc_uint32 j = 0; j < count; ++j)
+        sc_storage_free_element(result_addrs[j]);
+      goto end;
+    }
+  }
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    sc_type const type = items[i].type;
+    if (sc_type_has_not_subtype_in_mask(type, sc_type_arc_mask))
+      continue;
+
+    sc_addr const arc_addr = result_addrs[i];
+    sc_addr const beg_addr = begin_addrs[i];
+    sc_addr const end_addr = end_addrs[i];
+    sc_element *arc_el = elements[i], *beg_el = null_ptr, *end_el = null_ptr;
+    sc_storage_get_element_by_addr(beg_addr, &beg_el);
+    sc_storage_get_element_by_addr(end_addr, &end_el);
+
+    sc_bool is_edge = sc_type_has_subtype(type, sc_type_edge_common);
+    sc_bool is_not_loop = SC_ADDR_IS_NOT_EQUAL(beg_addr, end_addr);
+
+    _sc_storage_make_elements_incident_to_arc(
+        arc_addr, arc_el, beg_addr, beg_el, end_addr, end_el, locked_addrs, locked_addrs_count, SC_FALSE);
+    if (is_edge && is_not_loop)
+      _sc_storage_make_elements_incident_to_arc(
+          arc_addr, arc_el, end_addr, end_el, beg_addr, beg_el, locked_addrs, locked_addrs_count, SC_TRUE);
+
+#ifdef SC_OPTIMIZE_SEARCHING_INPUT_CONNECTORS_FROM_STRUCTURES
+    if (sc_type_is_structure_and_arc(beg_el->flags.type, type))
+      _sc_storage_update_structure_arcs(
+          arc_addr, arc_el, beg_addr, end_addr, end_el, locked_addrs, locked_addrs_count);
+#endif
+  }
+
+  // emit events of all created sc-connectors after the whole batch is linked
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    sc_type const type = items[i].type;
+    if (sc_type_has_not_subtype_in_mask(type, sc_type_arc_mask))
+      continue;
+
+    sc_addr const arc_addr = result_addrs[i];
+    sc_addr const beg_addr = begin_addrs[i];
+    sc_addr const end_addr = end_addrs[i];
+
+    sc_event_emit(ctx, beg_addr, SC_EVENT_ADD_OUTPUT_ARC, arc_addr, type, end_addr);
+    sc_event_emit(ctx, end_addr, SC_EVENT_ADD_INPUT_ARC, arc_addr, type, beg_addr);
+    if (sc_type_has_subtype(type, sc_type_edge_common) && SC_ADDR_IS_NOT_EQUAL(beg_addr, end_addr))
+    {
+      sc_event_emit(ctx, end_addr, SC_EVENT_ADD_OUTPUT_ARC, arc_addr, type, beg_addr);
+      sc_event_emit(ctx, beg_addr, SC_EVENT_ADD_INPUT_ARC, arc_addr, type, end_addr);
+    }
+  }
+
+  sc_monitor_release_write_array(monitors, monitors_count);
+
+end:
+  sc_mem_free(locked_addrs);
+  sc_mem_free(monitors);
+  sc_mem_free(end_addrs);
+  sc_mem_free(begin_addrs);
+  sc_mem_free(elements);
+
+  if (result != SC_RESULT_OK)
+  {
+    for (sc_uint32 i = 0; i < count; ++i)
+      result_addrs[i] = SC_ADDR_EMPTY;
+  }
+  return result;
+}
+
 sc_uint32 sc_storage_get_element_output_arcs_count(sc_memory_context const * ctx, sc_addr addr, sc_result * result)
 {
   sc_uint32 count = 0;
@@ -1027,17 +1369,13 @@ error:
 
 sc_result sc_storage_get_element_type(sc_memory_context const * ctx, sc_addr addr, sc_type * type)
 {
-  sc_result result;
+  sc_addr begin, end;
+  sc_type element_type;
 
-  sc_element * el = null_ptr;
+  sc_result const result = _sc_storage_read_element(addr, &element_type, &begin, &end);
+  if (result == SC_RESULT_OK)
+    *type = element_type;
 
-  result = sc_storage_get_element_by_addr(addr, &el);
-  if (result != SC_RESULT_OK)
-    goto error;
-
-  *type = el->flags.type;
-
-error:
   return result;
 }
 
@@ -1060,7 +1398,11 @@ sc_result sc_storage_change_element_subtype(sc_memory_context const * ctx, sc_ad
     goto error;
   }
 
+  // element class isn't changed, so segment registry remains valid
+  sc_segment * segment = storage->segments[addr.seg - 1];
+  sc_segment_begin_element_change(segment, addr.offset);
   el->flags.type = type;
+  sc_segment_end_element_change(segment, addr.offset);
 
 error:
   sc_monitor_release_write(monitor);
@@ -1069,89 +1411,115 @@ error:
 
 sc_result sc_storage_get_arc_begin(sc_memory_context const * ctx, sc_addr addr, sc_addr * result_begin_addr)
 {
-  *result_begin_addr = SC_ADDR_EMPTY;
-  sc_result result;
+  sc_addr end_addr;
+  return sc_storage_get_arc_info(ctx, addr, result_begin_addr, &end_addr);
+}
 
-  sc_element * el = null_ptr;
+sc_result sc_storage_get_arc_end(sc_memory_context const * ctx, sc_addr addr, sc_addr * result_end_addr)
+{
+  sc_addr begin_addr;
+  return sc_storage_get_arc_info(ctx, addr, &begin_addr, result_end_addr);
+}
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
-  sc_monitor_acquire_read(monitor);
+sc_result sc_storage_get_arc_info(
+    sc_memory_context const * ctx,
+    sc_addr addr,
+    sc_addr * result_begin_addr,
+    sc_addr * result_end_addr)
+{
+  *result_begin_addr = SC_ADDR_EMPTY;
+  *result_end_addr = SC_ADDR_EMPTY;
 
-  result = sc_storage_get_element_by_addr(addr, &el);
+  // sc-arc begin and end are set once, when sc-arc is created, so they are read without sc-monitor
+  sc_type type;
+  sc_addr begin_addr, end_addr;
+  sc_result const result = _sc_storage_read_element(addr, &type, &begin_addr, &end_addr);
   if (result != SC_RESULT_OK)
-    goto error;
-
-  if (sc_type_has_not_subtype_in_mask(el->flags.type, sc_type_arc_mask))
-  {
-    result = SC_RESULT_ERROR_ELEMENT_IS_NOT_CONNECTOR;
-    goto error;
-  }
+    return result;
 
-  *result_begin_addr = el->arc.begin;
+  if (sc_type_has_not_subtype_in_mask(type, sc_type_arc_mask))
+    return SC_RESULT_ERROR_ELEMENT_IS_NOT_CONNECTOR;
 
-error:
-  sc_monitor_release_read(monitor);
-  return result;
+  *result_begin_addr = begin_addr;
+  *result_end_addr = end_addr;
+  return SC_RESULT_OK;
 }
 
-sc_result sc_storage_get_arc_end(sc_memory_context const * ctx, sc_addr addr, sc_addr * result_end_addr)
+sc_int32 _sc_storage_compare_element_info_keys(void const * a, void const * b)
 {
-  *result_end_addr = SC_ADDR_EMPTY;
-  sc_result result;
-
-  sc_element * el = null_ptr;
+  sc_uint64 const key_a = *(sc_uint64 const *)a;
+  sc_uint64 const key_b = *(sc_uint64 const *)b;
+  return key_a < key_b ? -1 : (key_a > key_b ? 1 : 0);
+}
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
-  sc_monitor_acquire_read(monitor);
+void _sc_storage_read_element_info(sc_segment * segment, sc_addr addr, sc_element_info * info)
+{
+  *info = (sc_element_info){.result = SC_RESULT_ERROR_ADDR_IS_NOT_VALID};
+  if (segment == null_ptr || addr.offset == 0 || addr.offset > segment->last_engaged_offset)
+    return;
 
-  result = sc_storage_get_element_by_addr(addr, &el);
-  if (result != SC_RESULT_OK)
-    goto error;
+  sc_element const * el = &segment->elements[addr.offset];
+  if ((el->flags.states & SC_STATE_ELEMENT_EXIST) != SC_STATE_ELEMENT_EXIST)
+    return;
 
-  if (sc_type_has_not_subtype_in_mask(el->flags.type, sc_type_arc_mask))
+  info->result = SC_RESULT_OK;
+  info->type = el->flags.type;
+  info->output_arcs_count = el->output_arcs_count;
+  info->input_arcs_count = el->input_arcs_count;
+  if (sc_type_has_subtype_in_mask(el->flags.type, sc_type_arc_mask))
   {
-    result = SC_RESULT_ERROR_ELEMENT_IS_NOT_CONNECTOR;
-    goto error;
+    info->begin_addr = el->arc.begin;
+    info->end_addr = el->arc.end;
   }
-
-  *result_end_addr = el->arc.end;
-
-error:
-  sc_monitor_release_read(monitor);
-  return result;
 }
 
-sc_result sc_storage_get_arc_info(
+sc_result sc_storage_get_elements_info(
     sc_memory_context const * ctx,
-    sc_addr addr,
-    sc_addr * result_begin_addr,
-    sc_addr * result_end_addr)
+    sc_addr const * addrs,
+    sc_uint32 count,
+    sc_element_info * infos)
 {
-  *result_begin_addr = SC_ADDR_EMPTY;
-  *result_end_addr = SC_ADDR_EMPTY;
-  sc_result result;
+  if (count == 0)
+    return SC_RESULT_OK;
 
-  sc_element * el = null_ptr;
+  // sort sc-addresses to read sc-elements of each segment under one acquisition of its monitor
+  sc_uint64 * keys = sc_mem_new(sc_uint64, count);
+  for (sc_uint32 i = 0; i < count; ++i)
+    keys[i] = ((sc_uint64)SC_ADDR_LOCAL_TO_INT(addrs[i]) << 32) | i;
+  qsort(keys, count, sizeof(sc_uint64), _sc_storage_compare_element_info_keys);
 
-  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&storage->addr_monitors_table, addr);
-  sc_monitor_acquire_read(monitor);
+  sc_uint32 group_begin = 0;
+  while (group_begin < count)
+  {
+    sc_addr_seg const seg = addrs[(sc_uint32)keys[group_begin]].seg;
+    sc_uint32 group_end = group_begin + 1;
+    while (group_end < count && addrs[(sc_uint32)keys[group_end]].seg == seg)
+      ++group_end;
 
-  result = sc_storage_get_element_by_addr(addr, &el);
-  if (result != SC_RESULT_OK)
-    goto error;
+    sc_segment * segment = null_ptr;
+    if (storage != null_ptr && seg != 0 && seg <= storage->max_segments_count)
+    {
+      sc_monitor_acquire_read(&storage->segments_monitor);
+      segment = storage->segments[seg - 1];
+      sc_monitor_release_read(&storage->segments_monitor);
+    }
 
-  if (sc_type_has_not_subtype_in_mask(el->flags.type, sc_type_arc_mask))
-  {
-    result = SC_RESULT_ERROR_ELEMENT_IS_NOT_CONNECTOR;
-    goto error;
-  }
+    // sc-elements can't be freed while their segment monitor is acquired
+    if (segment != null_ptr)
+      sc_monitor_acquire_read(&segment->monitor);
+    for (sc_uint32 i = group_begin; i < group_end; ++i)
+    {
+      sc_uint32 const index = (sc_uint32)keys[i];
+      _sc_storage_read_element_info(segment, addrs[index], &infos[index]);
+    }
+    if (segment != null_ptr)
+      sc_monitor_release_read(&segment->monitor);
 
-  *result_begin_addr = el->arc.begin;
-  *result_end_addr = el->arc.end;
+    group_begin = group_end;
+  }
 
-error:
-  sc_monitor_release_read(monitor);
-  return result;
+  sc_mem_free(keys);
+  return SC_RESULT_OK;
 }
 
 sc_result sc_storage_set_link_content(
@@ -1318,6 +1686,38 @@ error:
   return result;
 }
 
+sc_result sc_storage_estimate_links_by_content(
+    sc_memory_context const * ctx,
+    sc_stream const * stream,
+    sc_bool is_substring,
+    sc_uint64 * count)
+{
+  sc_result result = SC_RESULT_OK;
+  *count = 0;
+
+  sc_char * string = null_ptr;
+  sc_uint32 string_size = 0;
+  if (sc_stream_get_data(stream, &string, &string_size) != SC_TRUE)
+  {
+    result = SC_RESULT_ERROR_STREAM_IO;
+    goto error;
+  }
+
+  if (string == null_ptr)
+  {
+    string_size = 0;
+    sc_string_empty(string);
+  }
+
+  if (sc_fs_memory_estimate_link_hashes_by_string(string, string_size, is_substring, count) != SC_FS_MEMORY_OK)
+    result = SC_RESULT_ERROR_FILE_MEMORY_IO;
+
+  sc_mem_free(string);
+
+error:
+  return result;
+}
+
 sc_result sc_storage_find_links_contents_by_content_substring(
     sc_memory_context const * ctx,
     sc_stream const * stream,
@@ -1368,6 +1768,140 @@ sc_result sc_storage_get_elements_stat(sc_stat * stat)
   return SC_RESULT_OK;
 }
 
+sc_bool _sc_storage_get_registry_classes(sc_type type, sc_bool * classes)
+{
+  sc_mem_set(classes, SC_FALSE, sizeof(sc_bool) * SC_SEGMENT_ELEMENT_CLASSES_COUNT);
+
+  sc_type const element_type = type & sc_type_element_mask;
+  if (element_type == 0 || element_type == sc_type_arc_mask)
+  {
+    classes[SC_SEGMENT_ELEMENT_CLASS_CONNECTOR] = SC_TRUE;
+    if (element_type == 0)
+      classes[SC_SEGMENT_ELEMENT_CLASS_NODE] = classes[SC_SEGMENT_ELEMENT_CLASS_LINK] = SC_TRUE;
+    return SC_TRUE;
+  }
+
+  sc_uint8 const element_class = sc_segment_get_element_class(element_type);
+  if (element_class == SC_SEGMENT_ELEMENT_CLASSES_COUNT)
+    return SC_FALSE;
+
+  classes[element_class] = SC_TRUE;
+  return SC_TRUE;
+}
+
+sc_bool _sc_storage_is_element_type_suitable(sc_type element_type, sc_type type)
+{
+  sc_type const element_class_type = type & sc_type_element_mask;
+  if (element_class_type == sc_type_arc_mask)
+    type &= ~sc_type_arc_mask;
+
+  return sc_type_has_subtype(element_type, type);
+}
+
+sc_result sc_storage_find_elements_by_type(
+    sc_memory_context const * ctx,
+    sc_type type,
+    sc_bool check_permissions,
+    void * data,
+    void (*callback)(void * data, sc_addr const addr))
+{
+  sc_bool classes[SC_SEGMENT_ELEMENT_CLASSES_COUNT];
+  if (_sc_storage_get_registry_classes(type, classes) == SC_FALSE)
+    return SC_RESULT_ERROR_INVALID_TYPE;
+
+  sc_monitor_acquire_read(&storage->segments_monitor);
+  sc_addr_seg const count = storage->segments_count;
+  sc_monitor_release_read(&storage->segments_monitor);
+
+  for (sc_addr_seg i = 0; i < count; ++i)
+  {
+    sc_segment * segment = storage->segments[i];
+    if (segment == null_ptr)
+      continue;
+
+    for (sc_uint8 element_class = 0; element_class < SC_SEGMENT_ELEMENT_CLASSES_COUNT; ++element_class)
+    {
+      if (classes[element_class] == SC_FALSE || sc_atomic_int_get(&segment->registry_counts[element_class]) == 0)
+        continue;
+
+      for (sc_uint32 word_idx = 0; word_idx < SC_SEGMENT_REGISTRY_WORDS_COUNT; ++word_idx)
+      {
+        sc_uint32 word = sc_atomic_int_get(&segment->registry[element_class][word_idx]);
+        while (word != 0)
+        {
+          sc_uint32 const bit_idx = g_bit_nth_lsf(word, -1);
+          word &= word - 1;
+
+          sc_addr const addr = {segment->num, (sc_addr_offset)(word_idx * SC_SEGMENT_REGISTRY_WORD_BITS + bit_idx)};
+          sc_element * element;
+          if (sc_storage_get_element_by_addr(addr, &element) != SC_RESULT_OK)
+            continue;
+
+          sc_element_flags const flags = element->flags;
+          if ((flags.states & SC_STATE_REQUEST_DELETION) == SC_STATE_REQUEST_DELETION
+              || _sc_storage_is_element_type_suitable(flags.type, type) == SC_FALSE)
+            continue;
+
+          if (check_permissions == SC_TRUE
+              && _sc_memory_context_check_local_and_global_permissions(
+                     sc_memory_get_context_manager(), ctx, SC_CONTEXT_PERMISSIONS_READ, addr)
+                     == SC_FALSE)
+            continue;
+
+          callback(data, addr);
+        }
+      }
+    }
+  }
+
+  return SC_RESULT_OK;
+}
+
+void _sc_storage_count_element(void * data, sc_addr const addr)
+{
+  (void)addr;
+  ++*(sc_uint64 *)data;
+}
+
+sc_result sc_storage_get_elements_count_by_type(
+    sc_memory_context const * ctx,
+    sc_type type,
+    sc_bool check_permissions,
+    sc_uint64 * count)
+{
+  *count = 0;
+
+  sc_bool classes[SC_SEGMENT_ELEMENT_CLASSES_COUNT];
+  if (_sc_storage_get_registry_classes(type, classes) == SC_FALSE)
+    return SC_RESULT_ERROR_INVALID_TYPE;
+
+  // only element class is specified, so registry counters can be used without bitmaps traversal
+  if (check_permissions == SC_FALSE
+      && (type == 0 || type == sc_type_node || type == sc_type_link || type == sc_type_arc_mask))
+  {
+    sc_monitor_acquire_read(&storage->segments_monitor);
+    sc_addr_seg const segments_count = storage->segments_count;
+    sc_monitor_release_read(&storage->segments_monitor);
+
+    for (sc_addr_seg i = 0; i < segments_count; ++i)
+    {
+      sc_segment * segment = storage->segments[i];
+      if (segment == null_ptr)
+        continue;
+
+      for (sc_uint8 element_class = 0; element_class < SC_SEGMENT_ELEMENT_CLASSES_COUNT; ++element_class)
+      {
+        if (classes[element_class] == SC_TRUE)
+          *count += sc_atomic_int_get(&segment->registry_counts[element_class]);
+      }
+    }
+
+    return SC_RESULT_OK;
+  }
+
+  return sc_storage_find_elements_by_type(ctx, type, check_permissions, count, _sc_storage_count_element);
+}
+
 sc_result sc_storage_save(sc_memory_context const * ctx)
 {
   return sc_fs_memory_save(storage) == SC_FS_MEMORY_OK ? SC_RESULT_OK : SC_RESULT_ERROR;
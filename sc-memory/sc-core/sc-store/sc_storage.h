@@ -47,7 +47,7 @@ typedef struct _sc_storage sc_storage;
  *
  * @see sc_storage_shutdown
  */
-sc_result sc_storage_initialize(sc_memory_params const * params);
+_SC_EXTERN sc_result sc_storage_initialize(sc_memory_params const * params);
 
 /*!
  * @brief Shuts down the sc-storage.
@@ -68,7 +68,7 @@ sc_result sc_storage_initialize(sc_memory_params const * params);
  *
  * @see sc_storage_initialize
  */
-sc_result sc_storage_shutdown(sc_bool save_state);
+_SC_EXTERN sc_result sc_storage_shutdown(sc_bool save_state);
 
 //! Check if storage initialized
 sc_bool sc_storage_is_initialized();
@@ -254,6 +254,30 @@ sc_addr sc_storage_arc_new_ext(
     sc_addr end_addr,
     sc_result * result);
 
+/*!
+ * @brief Creates a batch of sc-elements with the specified types.
+ *
+ * This function reserves all sc-elements of the batch in one allocation step, links all sc-connectors of the batch
+ * under one acquisition of locks of their begin and end sc-elements and emits events of created sc-connectors after
+ * the whole batch is linked. sc-connectors can refer to sc-elements created earlier in the same batch by their indices.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param items Array of descriptions of sc-elements to be created.
+ * @param count Count of sc-elements in the batch.
+ * @param result_addrs Array of size `count` that will store sc-addrs of created sc-elements.
+ *
+ * @note If the batch can't be created, no sc-element of the batch is created.
+ *
+ * @retval SC_RESULT_OK All sc-elements of the batch were successfully created.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID Begin or end sc-element of some sc-connector is not valid.
+ * @retval SC_RESULT_ERROR_FULL_MEMORY Memory allocation for the batch failed.
+ */
+sc_result sc_storage_elements_new_batch(
+    sc_memory_context const * ctx,
+    sc_element_batch_item const * items,
+    sc_uint32 count,
+    sc_addr * result_addrs);
+
 /*!
  * @brief Retrieves the count of output connectors for the specified sc-element.
  *
@@ -440,6 +464,29 @@ sc_result sc_storage_get_arc_info(
     sc_addr * result_begin_addr,
     sc_addr * result_end_addr);
 
+/*!
+ * @brief Reads metadata of a batch of sc-elements.
+ *
+ * This function reads types, begin and end sc-elements of sc-connectors and counts of incident sc-connectors of
+ * all specified sc-elements. Sc-addresses are grouped by segment, so metadata of sc-elements of the same segment
+ * is read under one acquisition of the segment monitor.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addrs Array of sc-addrs of sc-elements.
+ * @param count Count of sc-addrs in the batch.
+ * @param infos Array of size `count` that will store metadata of sc-elements in the order of `addrs`. Result of
+ * each item is SC_RESULT_ERROR_ADDR_IS_NOT_VALID if its sc-element doesn't exist.
+ *
+ * @return Returns SC_RESULT_OK.
+ *
+ * @note This function is thread-safe.
+ */
+sc_result sc_storage_get_elements_info(
+    sc_memory_context const * ctx,
+    sc_addr const * addrs,
+    sc_uint32 count,
+    sc_element_info * infos);
+
 /*!
  * @brief Sets the content of the specified sc-link.
  *
@@ -558,6 +605,31 @@ sc_result sc_storage_find_links_by_content_substring(
     void * data,
     void (*callback)(void * data, sc_addr const link_addr));
 
+/*!
+ * @brief Estimates amount of sc-links found by content string or substring.
+ *
+ * This function counts sc-links of candidate strings from file memory indexes without reading and
+ * comparing these strings, so the amount is an upper bound of amount of sc-links found by search.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param stream The stream containing the search string or substring.
+ * @param is_substring Flag indicating whether sc-links are searched by substring.
+ * @param count A pointer to the estimated amount of sc-links.
+ *
+ * @return Returns an sc_result indicating the success or failure of the operation.
+ * Possible result values:
+ * @retval SC_RESULT_OK: The operation was successful.
+ * @retval SC_RESULT_ERROR_STREAM_IO: An error occurred during stream I/O.
+ * @retval SC_RESULT_ERROR_FILE_MEMORY_IO: An error occurred during file memory access.
+ *
+ * @note This function is thread-safe.
+ */
+sc_result sc_storage_estimate_links_by_content(
+    sc_memory_context const * ctx,
+    sc_stream const * stream,
+    sc_bool is_substring,
+    sc_uint64 * count);
+
 /*!
  * @brief Finds sc-link contents containing the specified substring.
  *
@@ -606,6 +678,60 @@ sc_result sc_storage_find_links_contents_by_content_substring(
  */
 sc_result sc_storage_get_elements_stat(sc_stat * stat);
 
+/*!
+ * @brief Finds all sc-elements of the specified type.
+ *
+ * This function enumerates live sc-elements using per-segment registries of element classes (sc-nodes,
+ * sc-links, sc-connectors), so only segments containing elements of required class are traversed.
+ * An sc-element is suitable if its type contains all subtypes of the specified type. If the specified
+ * type has no element class, all sc-elements are checked. Use `sc_type_arc_mask` to find all sc-connectors.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param type The type of sc-elements to find.
+ * @param check_permissions SC_TRUE to skip sc-elements which the context can't read by its local and global
+ * permissions. It is SC_FALSE if read permissions have already been checked for all sc-elements.
+ * @param data Pointer to user-specific data.
+ * @param callback Callback function to be invoked for each found sc-element.
+ *
+ * @return Returns an sc_result indicating the success or failure of the operation.
+ * Possible result values:
+ * @retval SC_RESULT_OK: The operation was successful.
+ * @retval SC_RESULT_ERROR_INVALID_TYPE: The specified type has invalid element class.
+ *
+ * @note This function is thread-safe.
+ */
+sc_result sc_storage_find_elements_by_type(
+    sc_memory_context const * ctx,
+    sc_type type,
+    sc_bool check_permissions,
+    void * data,
+    void (*callback)(void * data, sc_addr const addr));
+
+/*!
+ * @brief Gets count of sc-elements of the specified type.
+ *
+ * If the specified type is `0`, `sc_type_node`, `sc_type_link` or `sc_type_arc_mask` and permissions aren't
+ * checked, count is calculated from registry counters without elements traversal. Otherwise, it is calculated by
+ * `sc_storage_find_elements_by_type`.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param type The type of sc-elements to count.
+ * @param check_permissions SC_TRUE to skip sc-elements which the context can't read.
+ * @param count Pointer to count of found sc-elements.
+ *
+ * @return Returns an sc_result indicating the success or failure of the operation.
+ * Possible result values:
+ * @retval SC_RESULT_OK: The operation was successful.
+ * @retval SC_RESULT_ERROR_INVALID_TYPE: The specified type has invalid element class.
+ *
+ * @note This function is thread-safe.
+ */
+sc_result sc_storage_get_elements_count_by_type(
+    sc_memory_context const * ctx,
+    sc_type type,
+    sc_bool check_permissions,
+    sc_uint64 * count);
+
 /*!
  * @brief Saves the current state of the sc-storage to persistent storage.
  *
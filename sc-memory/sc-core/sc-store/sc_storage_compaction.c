@@ -0,0 +1,266 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_storage_compaction.h"
+
+#include "sc_storage.h"
+#include "sc_storage_private.h"
+#include "sc_segment.h"
+#include "sc_element.h"
+
+#include "sc-fs-memory/sc_fs_memory.h"
+
+#include "sc-base/sc_allocator.h"
+#include "sc-base/sc_message.h"
+
+#define SC_STORAGE_COMPACTION_SEGMENT_CAPACITY (SC_SEGMENT_ELEMENTS_COUNT - 1)
+
+typedef struct _sc_storage_compaction
+{
+  sc_storage * storage;
+  sc_addr * new_addrs;  // new sc-addresses of sc-elements indexed by their old sc-addresses
+  sc_addr * order;      // old sc-addresses of live sc-elements in new order
+  sc_uint64 count;      // amount of ordered sc-elements
+} sc_storage_compaction;
+
+sc_uint64 _sc_storage_compaction_get_index(sc_addr addr)
+{
+  return (sc_uint64)(addr.seg - 1) * SC_SEGMENT_ELEMENTS_COUNT + addr.offset;
+}
+
+sc_element * _sc_storage_compaction_get_element(sc_storage_compaction const * compaction, sc_addr addr)
+{
+  if (addr.seg == 0 || addr.seg > compaction->storage->segments_count || addr.offset == 0)
+    return null_ptr;
+
+  sc_segment * segment = compaction->storage->segments[addr.seg - 1];
+  if (segment == null_ptr || addr.offset > segment->last_engaged_offset)
+    return null_ptr;
+
+  sc_element * element = &segment->elements[addr.offset];
+  return (element->flags.states & SC_STATE_ELEMENT_EXIST) == SC_STATE_ELEMENT_EXIST ? element : null_ptr;
+}
+
+sc_bool _sc_storage_compaction_order(sc_storage_compaction * compaction, sc_addr addr)
+{
+  sc_addr * new_addr = &compaction->new_addrs[_sc_storage_compaction_get_index(addr)];
+  if (new_addr->seg != 0)
+    return SC_FALSE;
+
+  new_addr->seg = compaction->count / SC_STORAGE_COMPACTION_SEGMENT_CAPACITY + 1;
+  new_addr->offset = compaction->count % SC_STORAGE_COMPACTION_SEGMENT_CAPACITY + 1;
+  compaction->order[compaction->count++] = addr;
+  return SC_TRUE;
+}
+
+void _sc_storage_compaction_order_from(sc_storage_compaction * compaction, sc_addr addr)
+{
+  // ordered sc-elements are used as queue, each sc-element is followed by its outgoing sc-connectors
+  sc_uint64 next = compaction->count;
+  if (_sc_storage_compaction_order(compaction, addr) == SC_FALSE)
+    return;
+
+  while (next < compaction->count)
+  {
+    sc_element const * element = _sc_storage_compaction_get_element(compaction, compaction->order[next++]);
+
+    sc_addr arc_addr = element->first_out_arc;
+    while (SC_ADDR_IS_NOT_EMPTY(arc_addr))
+    {
+      sc_element const * arc = _sc_storage_compaction_get_element(compaction, arc_addr);
+      if (arc == null_ptr)
+        break;
+
+      _sc_storage_compaction_order(compaction, arc_addr);
+      arc_addr = arc->arc.next_begin_out_arc;
+    }
+  }
+}
+
+sc_addr _sc_storage_compaction_map(sc_storage_compaction const * compaction, sc_addr addr)
+{
+  if (_sc_storage_compaction_get_element(compaction, addr) == null_ptr)
+    return SC_ADDR_EMPTY;
+
+  return compaction->new_addrs[_sc_storage_compaction_get_index(addr)];
+}
+
+void _sc_storage_compaction_map_element(sc_storage_compaction const * compaction, sc_element * element)
+{
+  element->first_out_arc = _sc_storage_compaction_map(compaction, element->first_out_arc);
+  element->first_in_arc = _sc_storage_compaction_map(compaction, element->first_in_arc);
+#ifdef SC_OPTIMIZE_SEARCHING_INPUT_CONNECTORS_FROM_STRUCTURES
+  element->first_in_arc_from_structure = _sc_storage_compaction_map(compaction, element->first_in_arc_from_structure);
+#endif
+
+  if (sc_type_has_not_subtype_in_mask(element->flags.type, sc_type_arc_mask))
+    return;
+
+  sc_arc_info * arc = &element->arc;
+  arc->begin = _sc_storage_compaction_map(compaction, arc->begin);
+  arc->end = _sc_storage_compaction_map(compaction, arc->end);
+  arc->next_begin_out_arc = _sc_storage_compaction_map(compaction, arc->next_begin_out_arc);
+  arc->prev_begin_out_arc = _sc_storage_compaction_map(compaction, arc->prev_begin_out_arc);
+  arc->next_begin_in_arc = _sc_storage_compaction_map(compaction, arc->next_begin_in_arc);
+  arc->next_end_out_arc = _sc_storage_compaction_map(compaction, arc->next_end_out_arc);
+  arc->next_end_in_arc = _sc_storage_compaction_map(compaction, arc->next_end_in_arc);
+  arc->prev_end_in_arc = _sc_storage_compaction_map(compaction, arc->prev_end_in_arc);
+#ifdef SC_OPTIMIZE_SEARCHING_INPUT_CONNECTORS_FROM_STRUCTURES
+  arc->prev_in_arc_from_structure = _sc_storage_compaction_map(compaction, arc->prev_in_arc_from_structure);
+  arc->next_in_arc_from_structure = _sc_storage_compaction_map(compaction, arc->next_in_arc_from_structure);
+#endif
+}
+
+sc_result sc_storage_compact(
+    sc_memory_params const * params,
+    void * data,
+    sc_storage_compaction_callback callback,
+    sc_storage_compaction_stat * stat)
+{
+  sc_storage * storage = sc_storage_get();
+  if (storage == null_ptr)
+    return SC_RESULT_ERROR_INVALID_STATE;
+
+  sc_result result = SC_RESULT_OK;
+  sc_addr_seg compacted_segments_count = 0;
+  sc_segment ** compacted_segments = null_ptr;
+  sc_uint64 links_count = 0;
+  sc_addr_hash * link_hashes = null_ptr;
+  sc_addr_hash * compacted_link_hashes = null_ptr;
+
+  sc_uint64 const slots_count = (sc_uint64)storage->segments_count * SC_SEGMENT_ELEMENTS_COUNT;
+  sc_storage_compaction compaction = {
+      .storage = storage,
+      .new_addrs = sc_mem_new(sc_addr, slots_count),
+      .order = sc_mem_new(sc_addr, slots_count),
+      .count = 0};
+
+  sc_message("Compact sc-storage with %u segments", storage->segments_count);
+
+  // sc-nodes and sc-links are placed in their current order, each of them is followed by its outgoing sc-connectors
+  sc_uint64 engaged_count = 0;
+  for (sc_uint32 pass = 0; pass < 2; ++pass)
+  {
+    for (sc_addr_seg seg = 1; seg <= storage->segments_count; ++seg)
+    {
+      sc_segment const * segment = storage->segments[seg - 1];
+      if (segment == null_ptr)
+        continue;
+
+      if (pass == 0)
+        engaged_count += segment->last_engaged_offset;
+
+      for (sc_addr_offset offset = 1; offset <= segment->last_engaged_offset; ++offset)
+      {
+        sc_addr const addr = {seg, offset};
+        sc_element const * element = _sc_storage_compaction_get_element(&compaction, addr);
+        if (element == null_ptr)
+          continue;
+
+        // sc-connectors not reachable from sc-nodes and sc-links are placed in the second pass
+        if (pass == 0 && sc_type_has_subtype_in_mask(element->flags.type, sc_type_arc_mask))
+          continue;
+
+        _sc_storage_compaction_order_from(&compaction, addr);
+      }
+    }
+  }
+
+  compacted_segments_count =
+      (compaction.count + SC_STORAGE_COMPACTION_SEGMENT_CAPACITY - 1) / SC_STORAGE_COMPACTION_SEGMENT_CAPACITY;
+  compacted_segments = sc_mem_new(sc_segment *, compacted_segments_count);
+  link_hashes = sc_mem_new(sc_addr_hash, compaction.count);
+  compacted_link_hashes = sc_mem_new(sc_addr_hash, compaction.count);
+
+  for (sc_uint64 i = 0; i < compaction.count; ++i)
+  {
+    sc_addr const old_addr = compaction.order[i];
+    sc_addr const new_addr = compaction.new_addrs[_sc_storage_compaction_get_index(old_addr)];
+
+    sc_segment * segment = compacted_segments[new_addr.seg - 1];
+    if (segment == null_ptr)
+      segment = compacted_segments[new_addr.seg - 1] = sc_segment_new(new_addr.seg);
+
+    sc_element * element = &segment->elements[new_addr.offset];
+    *element = *_sc_storage_compaction_get_element(&compaction, old_addr);
+    _sc_storage_compaction_map_element(&compaction, element);
+    segment->last_engaged_offset = new_addr.offset;
+
+    if (sc_type_has_subtype(element->flags.type, sc_type_link))
+    {
+      link_hashes[links_count] = SC_ADDR_LOCAL_TO_INT(old_addr);
+      compacted_link_hashes[links_count] = SC_ADDR_LOCAL_TO_INT(new_addr);
+      ++links_count;
+    }
+
+    if (callback != null_ptr)
+      callback(data, old_addr, new_addr);
+  }
+
+  if (sc_fs_memory_compact(params, link_hashes, compacted_link_hashes, links_count) != SC_FS_MEMORY_OK)
+  {
+    result = SC_RESULT_ERROR_FILE_MEMORY_IO;
+    goto error;
+  }
+
+  if (stat != null_ptr)
+  {
+    stat->live_elements_count = compaction.count;
+    stat->freed_elements_count = engaged_count - compaction.count;
+    stat->links_count = links_count;
+    stat->segments_count = storage->segments_count;
+    stat->compacted_segments_count = compacted_segments_count;
+  }
+
+  // replace segments, all free lists become empty and only the last segment may have not engaged sc-elements
+  sc_monitor_acquire_write(&storage->segments_monitor);
+  for (sc_addr_seg i = 0; i < storage->segments_count; ++i)
+  {
+    if (storage->segments[i] != null_ptr)
+      sc_segment_free(storage->segments[i]);
+    storage->segments[i] = i < compacted_segments_count ? compacted_segments[i] : null_ptr;
+  }
+  for (sc_addr_seg i = 0; i < compacted_segments_count; ++i)
+    sc_segment_rebuild_registry(storage->segments[i]);
+
+  storage->segments_count = compacted_segments_count;
+  storage->last_released_segment_num = 0;
+  storage->last_not_engaged_segment_num = 0;
+  if (compacted_segments_count != 0
+      && storage->segments[compacted_segments_count - 1]->last_engaged_offset + 1 != SC_SEGMENT_ELEMENTS_COUNT)
+    storage->last_not_engaged_segment_num = compacted_segments_count;
+  sc_monitor_release_write(&storage->segments_monitor);
+
+  sc_monitor_acquire_write(&storage->processes_monitor);
+  if (storage->processes_segments_table != null_ptr)
+    sc_hash_table_remove_all(storage->processes_segments_table);
+  sc_monitor_release_write(&storage->processes_monitor);
+
+  sc_mem_free(compacted_segments);
+  compacted_segments = null_ptr;
+
+  sc_message(
+      "Sc-storage compacted: %llu live sc-elements in %u segments",
+      compaction.count,
+      compacted_segments_count);
+
+error:
+  if (compacted_segments != null_ptr)
+  {
+    for (sc_addr_seg i = 0; i < compacted_segments_count; ++i)
+    {
+      if (compacted_segments[i] != null_ptr)
+        sc_segment_free(compacted_segments[i]);
+    }
+    sc_mem_free(compacted_segments);
+  }
+  sc_mem_free(link_hashes);
+  sc_mem_free(compacted_link_hashes);
+  sc_mem_free(compaction.new_addrs);
+  sc_mem_free(compaction.order);
+
+  return result;
+}
@@ -0,0 +1,61 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_storage_compaction_h_
+#define _sc_storage_compaction_h_
+
+#include "../sc_memory_params.h"
+
+#include "sc_types.h"
+#include "sc_defines.h"
+
+/*! Callback that is called for each live sc-element moved by compaction.
+ * @param data A pointer to user data passed to compaction
+ * @param old_addr A sc-address of sc-element before compaction
+ * @param new_addr A sc-address of sc-element after compaction
+ */
+typedef void (*sc_storage_compaction_callback)(void * data, sc_addr old_addr, sc_addr new_addr);
+
+/*! Structure to store compaction results
+ */
+typedef struct _sc_storage_compaction_stat
+{
+  sc_uint64 live_elements_count;   // amount of live sc-elements renumbered by compaction
+  sc_uint64 freed_elements_count;  // amount of freed sc-element slots removed by compaction
+  sc_uint64 links_count;           // amount of sc-links which contents are moved to compacted repo
+  sc_addr_seg segments_count;      // amount of segments before compaction
+  sc_addr_seg compacted_segments_count;  // amount of segments after compaction
+} sc_storage_compaction_stat;
+
+/*!
+ * @brief Compacts loaded sc-storage and relocates it to another repo path.
+ *
+ * This function renumbers live sc-elements densely, so that freed sc-element slots and free lists disappear. Each
+ * sc-element not being sc-connector is followed by its outgoing sc-connectors, so sc-elements traversed together by
+ * iterators are placed nearby. All sc-addresses stored in sc-elements are rewritten, and sc-link contents are moved
+ * to file memory in the new repo path with new sc-link hashes, without dead strings. Compacted sc-storage is saved
+ * to the new repo path by `sc_storage_shutdown` with saving state.
+ *
+ * @param params Sc-memory params with repo path for compacted sc-storage, it must differ from the loaded one.
+ * @param data A pointer to user data passed to callback.
+ * @param callback A callback called for each live sc-element with its old and new sc-addresses, may be null_ptr.
+ * @param[out] stat A pointer to structure to store compaction results, may be null_ptr.
+ *
+ * @return Returns SC_RESULT_OK if sc-storage is compacted.
+ *
+ * @note This function is intended for offline tools: nothing else may use sc-storage during and after compaction,
+ * because all sc-addresses got before it become invalid.
+ *
+ * @retval SC_RESULT_ERROR_INVALID_STATE Sc-storage isn't initialized.
+ * @retval SC_RESULT_ERROR_FILE_MEMORY_IO Sc-link contents can't be moved to the new repo path.
+ */
+_SC_EXTERN sc_result sc_storage_compact(
+    sc_memory_params const * params,
+    void * data,
+    sc_storage_compaction_callback callback,
+    sc_storage_compaction_stat * stat);
+
+#endif
@@ -9,6 +9,7 @@
 #include <unistd.h>
 
 #include "sc_storage.h"
+#include "sc_storage_private.h"
 #include "../sc_memory_private.h"
 
 #include "sc-base/sc_allocator.h"
@@ -77,6 +78,30 @@ void _sc_storage_dump_statistics_timer()
   sc_message("Links: %llu (%f)", statistics.link_count, (sc_float)statistics.link_count / (sc_float)allElements * 100);
   sc_message("Edges: %llu (%f)", statistics.arc_count, (sc_float)statistics.arc_count / (sc_float)allElements * 100);
   sc_message("Total: %llu", allElements);
+
+  sc_allocations_stat allocations;
+  sc_mem_get_allocations_stat(&allocations);
+  for (sc_uint32 i = 0; i < SC_ALLOCATIONS_SUBSYSTEMS_COUNT; ++i)
+    sc_message(
+        "Allocations of %s: %llu bytes, %llu objects",
+        sc_mem_get_allocations_subsystem_name(i),
+        allocations.live_bytes[i],
+        allocations.live_objects[i]);
+
+  sc_events_queue_stat events_queue;
+  sc_event_emission_manager_get_stat(sc_storage_get_event_emission_manager(), &events_queue);
+  sc_message(
+      "Events queue: %llu waiting (max %llu), %llu processed, %llu blocked, %llu spilled, %llu dropped",
+      events_queue.size,
+      events_queue.max_size,
+      events_queue.processed_count,
+      events_queue.blocked_count,
+      events_queue.spilled_count,
+      events_queue.dropped_count);
+  sc_message(
+      "Events queue wait time: %llu us average, %llu us max",
+      events_queue.processed_count == 0 ? 0 : events_queue.total_wait_time / events_queue.processed_count,
+      events_queue.max_wait_time);
 }
 
 void sc_storage_dump_manager_initialize(sc_storage_dump_manager ** manager, sc_memory_params const * params)
@@ -0,0 +1,261 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_storage_neighbourhood.h"
+
+#include "sc_storage.h"
+#include "sc_storage_private.h"
+#include "sc_element.h"
+#include "sc_iterator3.h"
+
+#include "../sc_memory_context_manager.h"
+#include "../sc_memory_context_private.h"
+#include "../sc_memory_context_permissions.h"
+
+#include "sc-base/sc_allocator.h"
+#include "sc-base/sc_monitor_table.h"
+
+#define SC_NEIGHBOURHOOD_BITMAP_SIZE ((SC_SEGMENT_ELEMENTS_COUNT + 8) / 8)
+#define SC_NEIGHBOURHOOD_MIN_CAPACITY 64
+
+typedef struct _sc_neighbourhood
+{
+  sc_memory_context const * ctx;
+  sc_neighbourhood_params const * params;
+  sc_bool check_permissions;
+  sc_uint8 ** visited;       // bitmaps of found sc-elements, they are allocated for touched segments only
+  sc_addr_seg visited_size;  // amount of segments which bitmaps can be allocated
+  sc_addr * addrs;           // found sc-elements in order of their distance from root
+  sc_uint32 * depths;        // distances of found sc-elements from root
+  sc_uint32 count;           // amount of found sc-elements
+  sc_uint32 capacity;        // amount of sc-elements which arrays are allocated for
+  sc_bool is_full;           // SC_TRUE if sc-connector with its other incident sc-element exceeds max amount
+} sc_neighbourhood;
+
+//! Returns SC_TRUE if sc-element has been found before
+sc_bool _sc_neighbourhood_is_visited(sc_neighbourhood const * neighbourhood, sc_addr addr)
+{
+  if (addr.seg == 0 || addr.seg > neighbourhood->visited_size)
+    return SC_TRUE;
+
+  sc_uint8 const * bitmap = neighbourhood->visited[addr.seg - 1];
+  return bitmap != null_ptr && (bitmap[addr.offset / 8] & (1 << (addr.offset % 8))) != 0;
+}
+
+//! Marks sc-element as found and returns SC_TRUE if it hasn't been found before
+sc_bool _sc_neighbourhood_visit(sc_neighbourhood * neighbourhood, sc_addr addr)
+{
+  if (addr.seg == 0 || addr.seg > neighbourhood->visited_size)
+    return SC_FALSE;
+
+  sc_uint8 ** bitmap = &neighbourhood->visited[addr.seg - 1];
+  if (*bitmap == null_ptr)
+    *bitmap = sc_mem_new(sc_uint8, SC_NEIGHBOURHOOD_BITMAP_SIZE);
+
+  sc_uint8 const mask = 1 << (addr.offset % 8);
+  if (((*bitmap)[addr.offset / 8] & mask) != 0)
+    return SC_FALSE;
+
+  (*bitmap)[addr.offset / 8] |= mask;
+  return SC_TRUE;
+}
+
+sc_bool _sc_neighbourhood_is_full(sc_neighbourhood const * neighbourhood)
+{
+  return neighbourhood->is_full
+         || (neighbourhood->params->max_elements_count != 0
+             && neighbourhood->count >= neighbourhood->params->max_elements_count);
+}
+
+void _sc_neighbourhood_add(sc_neighbourhood * neighbourhood, sc_addr addr, sc_uint32 depth)
+{
+  if (_sc_neighbourhood_is_full(neighbourhood) || _sc_neighbourhood_visit(neighbourhood, addr) == SC_FALSE)
+    return;
+
+  if (neighbourhood->count == neighbourhood->capacity)
+  {
+    neighbourhood->capacity <<= 1;
+    neighbourhood->addrs = sc_mem_realloc(neighbourhood->addrs, neighbourhood->capacity, sizeof(sc_addr));
+    neighbourhood->depths = sc_mem_realloc(neighbourhood->depths, neighbourhood->capacity, sizeof(sc_uint32));
+  }
+
+  neighbourhood->addrs[neighbourhood->count] = addr;
+  neighbourhood->depths[neighbourhood->count] = depth;
+  ++neighbourhood->count;
+}
+
+sc_bool _sc_neighbourhood_is_readable(sc_neighbourhood const * neighbourhood, sc_addr addr)
+{
+  return neighbourhood->check_permissions == SC_FALSE
+         || _sc_memory_context_check_local_and_global_permissions(
+                sc_memory_get_context_manager(), neighbourhood->ctx, SC_CONTEXT_PERMISSIONS_READ, addr);
+}
+
+/*! Finds sc-connectors of one direction of sc-element and their other incident sc-elements. Monitor of sc-element
+ * must be acquired.
+ * @param is_output SC_TRUE to find outgoing sc-connectors, SC_FALSE to find incoming ones
+ */
+/*! Adds sc-connector with its other incident sc-element. Expanded incident sc-element is found already, so
+ * neighbourhood is truncated by whole triples: if they don't fit into max amount together, none of them is added.
+ */
+void _sc_neighbourhood_add_connector(
+    sc_neighbourhood * neighbourhood,
+    sc_addr connector_addr,
+    sc_addr other_addr,
+    sc_uint32 depth)
+{
+  sc_uint32 const max_count = neighbourhood->params->max_elements_count;
+  if (max_count != 0)
+  {
+    sc_uint32 const new_count = (_sc_neighbourhood_is_visited(neighbourhood, connector_addr) ? 0 : 1)
+                                + (_sc_neighbourhood_is_visited(neighbourhood, other_addr) ? 0 : 1);
+    if (neighbourhood->count + new_count > max_count)
+    {
+      neighbourhood->is_full = SC_TRUE;
+      return;
+    }
+  }
+
+  _sc_neighbourhood_add(neighbourhood, connector_addr, depth);
+  _sc_neighbourhood_add(neighbourhood, other_addr, depth);
+}
+
+void _sc_neighbourhood_expand_connectors(
+    sc_neighbourhood * neighbourhood,
+    sc_addr element_addr,
+    sc_element const * element,
+    sc_bool is_output,
+    sc_uint32 depth)
+{
+  sc_neighbourhood_params const * params = neighbourhood->params;
+
+  sc_addr connector_addr = is_output ? element->first_out_arc : element->first_in_arc;
+  while (SC_ADDR_IS_NOT_EMPTY(connector_addr) && !_sc_neighbourhood_is_full(neighbourhood))
+  {
+    sc_bool const is_not_same = SC_ADDR_IS_NOT_EQUAL(element_addr, connector_addr);
+    sc_monitor * connector_monitor = null_ptr;
+    if (is_not_same)
+    {
+      connector_monitor =
+          sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, connector_addr);
+      sc_monitor_acquire_read(connector_monitor);
+    }
+
+    sc_element * connector = null_ptr;
+    if (sc_storage_get_element_by_addr(connector_addr, &connector) != SC_RESULT_OK)
+    {
+      if (is_not_same)
+        sc_monitor_release_read(connector_monitor);
+      break;
+    }
+
+    sc_bool const is_edge = sc_type_has_subtype(connector->flags.type, sc_type_edge_common);
+    sc_bool const is_end = SC_ADDR_IS_EQUAL(element_addr, connector->arc.end);
+    sc_addr const next_connector_addr = is_output ? (is_edge && is_end ? connector->arc.next_end_out_arc
+                                                                       : connector->arc.next_begin_out_arc)
+                                                  : (is_edge && !is_end ? connector->arc.next_begin_in_arc
+                                                                        : connector->arc.next_end_in_arc);
+    sc_addr const other_addr = is_edge ? (is_end ? connector->arc.begin : connector->arc.end)
+                                       : (is_output ? connector->arc.end : connector->arc.begin);
+    sc_type const connector_type = connector->flags.type;
+
+    // load next sc-connector and other incident sc-element into cache while this one is checked
+    sc_storage_prefetch_element(next_connector_addr);
+    sc_storage_prefetch_element(other_addr);
+
+    sc_bool const is_accessed =
+        _sc_neighbourhood_is_readable(neighbourhood, connector_addr)
+        && _sc_memory_context_check_global_permissions_to_read_permissions(
+               sc_memory_get_context_manager(),
+               neighbourhood->ctx,
+               connector,
+               connector_addr,
+               SC_CONTEXT_PERMISSIONS_TO_READ_PERMISSIONS);
+
+    if (is_not_same)
+      sc_monitor_release_read(connector_monitor);
+
+    sc_type other_type;
+    if (is_accessed && sc_iterator_compare_type(connector_type, params->connector_type)
+        && sc_storage_get_element_type(neighbourhood->ctx, other_addr, &other_type) == SC_RESULT_OK
+        && sc_iterator_compare_type(other_type, params->element_type)
+        && _sc_neighbourhood_is_readable(neighbourhood, other_addr))
+    {
+      _sc_neighbourhood_add_connector(neighbourhood, connector_addr, other_addr, depth);
+    }
+
+    connector_addr = next_connector_addr;
+  }
+}
+
+void _sc_neighbourhood_expand(sc_neighbourhood * neighbourhood, sc_addr element_addr, sc_uint32 depth)
+{
+  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, element_addr);
+  sc_monitor_acquire_read(monitor);
+
+  sc_element * element = null_ptr;
+  if (sc_storage_get_element_by_addr(element_addr, &element) == SC_RESULT_OK)
+  {
+    if (neighbourhood->params->directions & SC_NEIGHBOURHOOD_OUTPUT)
+      _sc_neighbourhood_expand_connectors(neighbourhood, element_addr, element, SC_TRUE, depth);
+    if (neighbourhood->params->directions & SC_NEIGHBOURHOOD_INPUT)
+      _sc_neighbourhood_expand_connectors(neighbourhood, element_addr, element, SC_FALSE, depth);
+  }
+
+  sc_monitor_release_read(monitor);
+}
+
+sc_result sc_storage_get_neighbourhood(
+    sc_memory_context const * ctx,
+    sc_addr root_addr,
+    sc_neighbourhood_params const * params,
+    sc_bool check_permissions,
+    sc_addr ** result_addrs,
+    sc_uint32 * result_count)
+{
+  *result_addrs = null_ptr;
+  *result_count = 0;
+
+  if (sc_storage_is_element(ctx, root_addr) == SC_FALSE)
+    return SC_RESULT_ERROR_ADDR_IS_NOT_VALID;
+
+  sc_neighbourhood neighbourhood = {
+      .ctx = ctx,
+      .params = params,
+      .check_permissions = check_permissions,
+      .visited_size = sc_storage_get()->max_segments_count,
+      .count = 0,
+      .capacity = SC_NEIGHBOURHOOD_MIN_CAPACITY,
+      .is_full = SC_FALSE,
+  };
+
+  if (_sc_neighbourhood_is_readable(&neighbourhood, root_addr) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  neighbourhood.visited = sc_mem_new(sc_uint8 *, neighbourhood.visited_size);
+  neighbourhood.addrs = sc_mem_new(sc_addr, neighbourhood.capacity);
+  neighbourhood.depths = sc_mem_new(sc_uint32, neighbourhood.capacity);
+
+  _sc_neighbourhood_add(&neighbourhood, root_addr, 0);
+  // found sc-elements are appended in order of their distance, so they are expanded breadth-first
+  for (sc_uint32 i = 0; i < neighbourhood.count && !_sc_neighbourhood_is_full(&neighbourhood); ++i)
+  {
+    sc_uint32 const depth = neighbourhood.depths[i];
+    if (depth >= params->depth)
+      break;
+
+    _sc_neighbourhood_expand(&neighbourhood, neighbourhood.addrs[i], depth + 1);
+  }
+
+  for (sc_addr_seg i = 0; i < neighbourhood.visited_size; ++i)
+    sc_mem_free(neighbourhood.visited[i]);
+  sc_mem_free(neighbourhood.visited);
+  sc_mem_free(neighbourhood.depths);
+
+  *result_addrs = neighbourhood.addrs;
+  *result_count = neighbourhood.count;
+  return SC_RESULT_OK;
+}
@@ -0,0 +1,43 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_storage_neighbourhood_h_
+#define _sc_storage_neighbourhood_h_
+
+#include "sc_types.h"
+#include "sc_defines.h"
+
+/*!
+ * @brief Finds sc-elements within bounded amount of sc-connectors from root sc-element.
+ *
+ * This function expands neighbourhood of root sc-element breadth-first. Each found sc-element is expanded once under
+ * one acquisition of its monitor: its outgoing and/or incoming sc-connectors which type matches params are found
+ * together with their other incident sc-elements which type matches params. Found sc-connectors are expanded too,
+ * so sc-connectors incident to them, e.g. role sc-arcs, can be found. Found sc-elements are marked in bitmaps of
+ * their segments, so each of them is found once.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param root_addr A sc-addr of root sc-element.
+ * @param params A pointer to bounds and filters of expansion.
+ * @param check_permissions SC_TRUE if read permissions should be checked for each found sc-element.
+ * @param[out] result_addrs A pointer to array of found sc-elements in order of their distance from root. Root
+ * sc-element is the first. It should be freed by `sc_mem_free`.
+ * @param[out] result_count A pointer to amount of found sc-elements.
+ *
+ * @retval SC_RESULT_OK Neighbourhood is found.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID Root sc-element doesn't exist.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context has not read
+ * permissions for root sc-element.
+ */
+sc_result sc_storage_get_neighbourhood(
+    sc_memory_context const * ctx,
+    sc_addr root_addr,
+    sc_neighbourhood_params const * params,
+    sc_bool check_permissions,
+    sc_addr ** result_addrs,
+    sc_uint32 * result_count);
+
+#endif
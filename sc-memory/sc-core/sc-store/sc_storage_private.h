@@ -34,6 +34,9 @@ sc_event_emission_manager * sc_storage_get_event_emission_manager();
 
 sc_event_registration_manager * sc_storage_get_event_registration_manager();
 
+/*! Allocates sc-element that doesn't exist yet. Its type must be set and it must be marked as existing within one
+ * change of sc-element, so that readers of sc-segment see both at once.
+ */
 sc_element * sc_storage_allocate_new_element(sc_memory_context const * ctx, sc_addr * addr);
 
 void sc_storage_start_new_process();
@@ -42,6 +45,9 @@ void sc_storage_end_new_process();
 
 sc_result sc_storage_get_element_by_addr(sc_addr addr, sc_element ** el);
 
+//! Hints processor to load sc-element into cache, sc-elements lists walkers use it to load next sc-elements in advance
+void sc_storage_prefetch_element(sc_addr addr);
+
 sc_result sc_storage_free_element(sc_addr addr);
 
 #endif
@@ -232,6 +232,129 @@ struct _sc_stat
   sc_uint64 link_count;  // amount of all sc-links stored in memory
 };
 
+// subsystems which allocations are accounted
+enum _sc_allocations_subsystem
+{
+  SC_ALLOCATIONS_SEGMENTS = 0,         // sc-memory segments with sc-elements
+  SC_ALLOCATIONS_DICTIONARIES = 1,     // nodes, children and node strings of sc-dictionaries, lists of node data
+  SC_ALLOCATIONS_MONITORS = 2,         // monitors of sc-elements stored in monitor tables
+  SC_ALLOCATIONS_EVENTS = 3,           // sc-event subscriptions
+  SC_ALLOCATIONS_CONTEXTS = 4,         // sc-memory contexts and tables of users permissions
+  SC_ALLOCATIONS_SERVER_SESSIONS = 5,  // sc-server sessions with their connections and prepared sc-templates
+  SC_ALLOCATIONS_SUBSYSTEMS_COUNT = 6
+};
+
+// structure to store live allocations info per subsystem
+struct _sc_allocations_stat
+{
+  sc_uint64 live_bytes[SC_ALLOCATIONS_SUBSYSTEMS_COUNT];    // amount of bytes allocated and not freed yet
+  sc_uint64 live_objects[SC_ALLOCATIONS_SUBSYSTEMS_COUNT];  // amount of objects allocated and not freed yet
+};
+
+// structure to store state of sc-events queue
+struct _sc_events_queue_stat
+{
+  sc_uint64 size;             // amount of emitted sc-events waiting for processing
+  sc_uint64 max_size;         // maximum amount of emitted sc-events waiting for processing at the same time
+  sc_uint64 processed_count;  // amount of processed sc-events
+  sc_uint64 blocked_count;    // amount of sc-events which emitters waited for free space in queue
+  sc_uint64 spilled_count;    // amount of sc-events queued over queue capacity
+  sc_uint64 dropped_count;    // amount of sc-events dropped because queue is full
+  sc_uint64 total_wait_time;  // total time in microseconds that processed sc-events waited in queue
+  sc_uint64 max_wait_time;    // maximum time in microseconds that processed sc-event waited in queue
+};
+
+// structure to store sampled contention on monitor of sc-element
+struct _sc_monitor_contention_stat
+{
+  struct _sc_addr addr;         // sc-element which monitor was contended
+  sc_uint64 contended_count;    // amount of sampled acquisitions of monitor which waited for it
+  sc_uint64 total_wait_time;    // total time in microseconds that sampled acquisitions waited for monitor
+  sc_uint64 max_wait_time;      // maximum time in microseconds that sampled acquisition waited for monitor
+  sc_uint32 max_waiters_count;  // maximum amount of requests queued before sampled acquisition
+};
+
+#define SC_LATENCY_HISTOGRAM_BUCKETS_COUNT 24
+
+// structure to store distribution of latencies in microseconds
+struct _sc_latency_histogram
+{
+  sc_uint64 count;       // amount of measured latencies
+  sc_uint64 total_time;  // sum of measured latencies
+  sc_uint64 max_time;    // maximum measured latency
+  // i-th bucket counts latencies from 2^(i-1) to 2^i - 1 (0-th bucket counts zero latencies), the last bucket counts
+  // all latencies greater than bounds of previous buckets
+  sc_uint64 buckets[SC_LATENCY_HISTOGRAM_BUCKETS_COUNT];
+};
+
+// phases of delivery of emitted sc-events which latencies are measured
+enum _sc_event_latency_phase
+{
+  SC_EVENT_LATENCY_PENDING = 0,     // from emission to queueing, it includes pending and waiting for space in queue
+  SC_EVENT_LATENCY_QUEUED = 1,      // from queueing to start of processing by worker
+  SC_EVENT_LATENCY_PROCESSING = 2,  // from start to completion of sc-event callback
+  SC_EVENT_LATENCY_TOTAL = 3,       // from emission to completion of sc-event callback
+  SC_EVENT_LATENCY_PHASES_COUNT = 4
+};
+
+// structure to store latencies of sc-events of one type delivered to subscriptions of one priority class
+struct _sc_events_latency_stat
+{
+  enum _sc_event_type event_type;  // type of emitted sc-events
+  sc_uint8 priority;               // priority class of sc-event subscriptions, see `sc_event_priority`
+  struct _sc_latency_histogram phases[SC_EVENT_LATENCY_PHASES_COUNT];
+};
+
+// structure to store utilization of workers processing emitted sc-events
+struct _sc_events_workers_stat
+{
+  sc_uint32 max_workers_count;       // maximum amount of threads processing sc-events
+  sc_uint32 busy_workers_count;      // amount of threads processing sc-events now
+  sc_uint32 max_busy_workers_count;  // maximum amount of threads processing sc-events at the same time
+  sc_uint64 busy_time;               // total time in microseconds that threads processed sc-events
+  sc_uint64 uptime;                  // time in microseconds since threads processing sc-events were started
+};
+
+// structure to describe sc-element to be created within a batch
+struct _sc_element_batch_item
+{
+  sc_type type;          // type of sc-element to be created
+  struct _sc_addr begin_addr;  // begin sc-element of sc-connector, used if `begin_index` is negative
+  struct _sc_addr end_addr;    // end sc-element of sc-connector, used if `end_index` is negative
+  sc_int32 begin_index;        // index of begin sc-element in the same batch or negative value
+  sc_int32 end_index;          // index of end sc-element in the same batch or negative value
+};
+
+// structure to store metadata of sc-element read within a batch
+struct _sc_element_info
+{
+  enum _sc_result result;       // result of reading metadata of sc-element, other fields are valid if it is OK
+  sc_type type;                 // type of sc-element
+  struct _sc_addr begin_addr;   // begin sc-element of sc-connector, empty for other sc-elements
+  struct _sc_addr end_addr;     // end sc-element of sc-connector, empty for other sc-elements
+  sc_uint32 output_arcs_count;  // amount of outgoing sc-connectors of sc-element
+  sc_uint32 input_arcs_count;   // amount of incoming sc-connectors of sc-element
+};
+
+// directions of sc-connectors passed by neighbourhood expansion
+enum _sc_neighbourhood_direction
+{
+  SC_NEIGHBOURHOOD_OUTPUT = 0x1,  // pass outgoing sc-connectors of sc-elements
+  SC_NEIGHBOURHOOD_INPUT = 0x2,   // pass incoming sc-connectors of sc-elements
+  SC_NEIGHBOURHOOD_BOTH = SC_NEIGHBOURHOOD_OUTPUT | SC_NEIGHBOURHOOD_INPUT
+};
+
+// structure to describe bounds and filters of neighbourhood expansion
+struct _sc_neighbourhood_params
+{
+  sc_uint32 depth;               // maximum amount of sc-connectors between root and found sc-elements
+  sc_uint8 directions;           // combination of `_sc_neighbourhood_direction` values
+  sc_type connector_type;        // type of passed sc-connectors, 0 to pass sc-connectors of any type
+  sc_type element_type;          // type of reached sc-elements, 0 to reach sc-elements of any type
+  sc_uint32 max_elements_count;  // maximum amount of found sc-elements, 0 for no limit, it isn't exceeded by whole
+                                 // triples: sc-connectors are found with their incident sc-elements only
+};
+
 #endif
 
 typedef struct _sc_arc sc_arc;
@@ -250,3 +373,14 @@ typedef struct _sc_event sc_event;
 typedef enum _sc_result sc_result;
 typedef enum _sc_event_type sc_event_type;
 typedef struct _sc_stat sc_stat;
+typedef enum _sc_allocations_subsystem sc_allocations_subsystem;
+typedef struct _sc_allocations_stat sc_allocations_stat;
+typedef struct _sc_element_batch_item sc_element_batch_item;
+typedef struct _sc_element_info sc_element_info;
+typedef struct _sc_neighbourhood_params sc_neighbourhood_params;
+typedef struct _sc_events_queue_stat sc_events_queue_stat;
+typedef struct _sc_monitor_contention_stat sc_monitor_contention_stat;
+typedef struct _sc_latency_histogram sc_latency_histogram;
+typedef enum _sc_event_latency_phase sc_event_latency_phase;
+typedef struct _sc_events_latency_stat sc_events_latency_stat;
+typedef struct _sc_events_workers_stat sc_events_workers_stat;
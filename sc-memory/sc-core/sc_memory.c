@@ -8,6 +8,8 @@
 #include "sc_memory_params.h"
 
 #include "sc-store/sc_storage.h"
+#include "sc-store/sc_storage_neighbourhood.h"
+#include "sc-store/sc_iterator3.h"
 #include "sc-store/sc_storage_private.h"
 #include "sc_memory_private.h"
 #include "sc_helper.h"
@@ -19,7 +21,9 @@
 
 #include "sc-store/sc_types.h"
 #include "sc-store/sc-base/sc_allocator.h"
+#include "sc-store/sc-base/sc_monitor_profiler.h"
 #include "sc-store/sc-container/sc-string/sc_string.h"
+#include "sc-store/sc-container/sc-hash-table/sc_hash_table.h"
 
 struct _sc_memory
 {
@@ -376,6 +380,55 @@ sc_addr sc_memory_arc_new_ext(sc_memory_context const * ctx, sc_type type, sc_ad
   return sc_storage_arc_new_ext(ctx, type, beg, end, result);
 }
 
+sc_bool _sc_memory_check_batch_connector_incident_element_permissions(
+    sc_memory_context const * ctx,
+    sc_addr addr,
+    sc_int32 index)
+{
+  // sc-elements of the same batch are new, so they can't have local permissions
+  if (index >= 0)
+    return _sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_WRITE);
+
+  return _sc_memory_context_check_local_and_global_permissions(
+      memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_WRITE, addr);
+}
+
+sc_result sc_memory_elements_new_batch(
+    sc_memory_context const * ctx,
+    sc_element_batch_item const * items,
+    sc_uint32 count,
+    sc_addr * result_addrs)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    sc_element_batch_item const * item = &items[i];
+    if (sc_type_has_not_subtype_in_mask(item->type, sc_type_arc_mask))
+      continue;
+
+    if ((item->begin_index >= 0
+         || _sc_memory_context_check_if_has_permitted_structure(
+                memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_WRITE, item->begin_addr)
+                == SC_FALSE
+         || sc_type_has_not_subtype_in_mask(item->type, sc_type_arc_pos_const))
+        && (_sc_memory_check_batch_connector_incident_element_permissions(ctx, item->begin_addr, item->begin_index)
+                == SC_FALSE
+            || _sc_memory_check_batch_connector_incident_element_permissions(ctx, item->end_addr, item->end_index)
+                   == SC_FALSE))
+      return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS;
+
+    if (item->begin_index < 0
+        && _sc_memory_context_check_global_permissions_to_write_permissions(
+               memory->context_manager, ctx, item->begin_addr, item->type, SC_CONTEXT_PERMISSIONS_TO_WRITE_PERMISSIONS)
+               == SC_FALSE)
+      return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_PERMISSIONS_TO_WRITE_PERMISSIONS;
+  }
+
+  return sc_storage_elements_new_batch(ctx, items, count, result_addrs);
+}
+
 sc_result sc_memory_get_element_type(sc_memory_context const * ctx, sc_addr addr, sc_type * result)
 {
   if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
@@ -471,6 +524,122 @@ sc_result sc_memory_get_arc_info(sc_memory_context const * ctx, sc_addr addr, sc
   return result;
 }
 
+sc_result sc_memory_get_elements_info(
+    sc_memory_context const * ctx,
+    sc_addr const * addrs,
+    sc_uint32 count,
+    sc_element_info * infos)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  sc_storage_get_elements_info(ctx, addrs, count, infos);
+
+  // without local permissions, read permissions of all sc-elements are the same and they are checked once
+  if (_sc_memory_context_has_local_permissions(memory->context_manager, ctx) == SC_FALSE)
+  {
+    if (_sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+        == SC_TRUE)
+      return SC_RESULT_OK;
+
+    for (sc_uint32 i = 0; i < count; ++i)
+      infos[i] = (sc_element_info){.result = SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS};
+    return SC_RESULT_OK;
+  }
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    sc_element_info * info = &infos[i];
+    if (info->result != SC_RESULT_OK)
+      continue;
+
+    if (_sc_memory_context_check_local_and_global_permissions(
+            memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ, addrs[i])
+            == SC_FALSE
+        || (sc_type_has_subtype_in_mask(info->type, sc_type_arc_mask)
+            && (_sc_memory_context_check_local_and_global_permissions(
+                    memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ, info->begin_addr)
+                    == SC_FALSE
+                || _sc_memory_context_check_local_and_global_permissions(
+                       memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ, info->end_addr)
+                       == SC_FALSE)))
+      *info = (sc_element_info){.result = SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS};
+  }
+
+  return SC_RESULT_OK;
+}
+
+sc_result sc_memory_get_neighbourhood(
+    sc_memory_context const * ctx,
+    sc_addr root_addr,
+    sc_neighbourhood_params const * params,
+    sc_addr ** result_addrs,
+    sc_uint32 * result_count)
+{
+  *result_addrs = null_ptr;
+  *result_count = 0;
+
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  // without local permissions, read permissions of all sc-elements are the same and they are checked once
+  sc_bool const check_permissions = _sc_memory_context_has_local_permissions(memory->context_manager, ctx);
+  if (check_permissions == SC_FALSE
+      && _sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+             == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  return sc_storage_get_neighbourhood(ctx, root_addr, params, check_permissions, result_addrs, result_count);
+}
+
+sc_result sc_memory_add_neighbourhood_to_structure(
+    sc_memory_context const * ctx,
+    sc_addr root_addr,
+    sc_neighbourhood_params const * params,
+    sc_addr structure_addr,
+    sc_uint32 * added_count)
+{
+  if (added_count != null_ptr)
+    *added_count = 0;
+
+  sc_result result;
+  if (sc_memory_is_element_ext(ctx, structure_addr, &result) == SC_FALSE)
+    return result;
+
+  sc_addr * addrs;
+  sc_uint32 count;
+  result = sc_memory_get_neighbourhood(ctx, root_addr, params, &addrs, &count);
+  if (result != SC_RESULT_OK)
+    return result;
+
+  sc_hash_table * elements = sc_hash_table_init(
+      sc_hash_table_default_hash_func, sc_hash_table_default_equal_func, null_ptr, null_ptr);
+  sc_iterator3 * it = sc_iterator3_f_a_a_new(ctx, structure_addr, sc_type_arc_pos_const_perm, 0);
+  while (sc_iterator3_next(it))
+  {
+    sc_addr const element_addr = sc_iterator3_value(it, 2);
+    sc_hash_table_insert(elements, GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(element_addr)), GUINT_TO_POINTER(1));
+  }
+  sc_iterator3_free(it);
+
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    if (sc_hash_table_get(elements, GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(addrs[i]))) != null_ptr)
+      continue;
+
+    sc_memory_arc_new_ext(ctx, sc_type_arc_pos_const_perm, structure_addr, addrs[i], &result);
+    if (result != SC_RESULT_OK)
+      break;
+
+    if (added_count != null_ptr)
+      ++*added_count;
+  }
+
+  sc_hash_table_destroy(elements);
+  sc_mem_free(addrs);
+  return result;
+}
+
 sc_result sc_memory_set_link_content(sc_memory_context const * ctx, sc_addr addr, sc_stream const * stream)
 {
   return sc_memory_set_link_content_ext(ctx, addr, stream, SC_TRUE);
@@ -561,6 +730,18 @@ sc_result sc_memory_find_links_by_content_substring_ext(
   return sc_storage_find_links_by_content_substring(ctx, stream, max_length_to_search_as_prefix, data, callback);
 }
 
+sc_result sc_memory_estimate_links_by_content(
+    sc_memory_context const * ctx,
+    sc_stream const * stream,
+    sc_bool is_substring,
+    sc_uint64 * count)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  return sc_storage_estimate_links_by_content(ctx, stream, is_substring, count);
+}
+
 void _test_push_link_content(void * data, sc_addr const link_addr, sc_char const * link_content)
 {
   sc_unused(link_addr);
@@ -613,6 +794,138 @@ sc_result sc_memory_stat(sc_memory_context const * ctx, sc_stat * stat)
   return sc_storage_get_elements_stat(stat);
 }
 
+sc_result sc_memory_get_allocations_stat(sc_memory_context const * ctx, sc_allocations_stat * stat)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  if (_sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+      == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  sc_mem_get_allocations_stat(stat);
+  return SC_RESULT_OK;
+}
+
+sc_result sc_memory_get_events_queue_stat(sc_memory_context const * ctx, sc_events_queue_stat * stat)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  if (_sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+      == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  sc_event_emission_manager_get_stat(sc_storage_get_event_emission_manager(), stat);
+  return SC_RESULT_OK;
+}
+
+sc_result sc_memory_get_events_latency_stat(
+    sc_memory_context const * ctx,
+    sc_events_latency_stat ** stats,
+    sc_uint32 * count)
+{
+  *stats = null_ptr;
+  *count = 0;
+
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  if (_sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+      == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  sc_event_emission_manager_get_latency_stat(sc_storage_get_event_emission_manager(), stats, count);
+  return SC_RESULT_OK;
+}
+
+sc_result sc_memory_get_events_workers_stat(sc_memory_context const * ctx, sc_events_workers_stat * stat)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  if (_sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+      == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  sc_event_emission_manager_get_workers_stat(sc_storage_get_event_emission_manager(), stat);
+  return SC_RESULT_OK;
+}
+
+sc_result sc_memory_get_monitors_contention_stat(
+    sc_memory_context const * ctx,
+    sc_uint32 max_count,
+    sc_monitor_contention_stat ** stats,
+    sc_uint32 * count)
+{
+  *stats = null_ptr;
+  *count = 0;
+
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  if (_sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+      == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  sc_monitor_profiler_get_most_contended(max_count, stats, count);
+  return SC_RESULT_OK;
+}
+
+sc_result sc_memory_set_monitors_contention_sampling_period(sc_memory_context const * ctx, sc_uint32 sampling_period)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  if (_sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_WRITE)
+      == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS;
+
+  sc_monitor_profiler_set_sampling_period(sampling_period);
+  return SC_RESULT_OK;
+}
+
+sc_result sc_memory_find_elements_by_type(sc_memory_context const * ctx, sc_type type, sc_list ** result_hashes)
+{
+  sc_list_init(result_hashes);
+  return sc_memory_find_elements_by_type_ext(ctx, type, *result_hashes, _push_link_hash);
+}
+
+sc_result sc_memory_find_elements_by_type_ext(
+    sc_memory_context const * ctx,
+    sc_type type,
+    void * data,
+    void (*callback)(void * data, sc_addr const addr))
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  // without local permissions, read permissions of all sc-elements are the same and they are checked once
+  sc_bool const check_permissions = _sc_memory_context_has_local_permissions(memory->context_manager, ctx);
+  if (check_permissions == SC_FALSE
+      && _sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+             == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  return sc_storage_find_elements_by_type(ctx, type, check_permissions, data, callback);
+}
+
+sc_result sc_memory_get_elements_count_by_type(sc_memory_context const * ctx, sc_type type, sc_uint64 * count)
+{
+  *count = 0;
+
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  sc_bool const check_permissions = _sc_memory_context_has_local_permissions(memory->context_manager, ctx);
+  if (check_permissions == SC_FALSE
+      && _sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+             == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  return sc_storage_get_elements_count_by_type(ctx, type, check_permissions, count);
+}
+
 sc_result sc_memory_save(sc_memory_context const * ctx)
 {
   if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
@@ -427,6 +427,39 @@ _SC_EXTERN sc_addr sc_memory_arc_new_ext(
     sc_addr end_addr,
     sc_result * result);
 
+/*!
+ * @brief Creates a batch of sc-elements with the specified types.
+ *
+ * This function creates all sc-elements described by `items` at once: it reserves all of them in one allocation
+ * step, links all sc-connectors under one acquisition of locks of their begin and end sc-elements and emits events
+ * of created sc-connectors after the whole batch is linked. Each sc-connector can refer to its begin and end
+ * sc-elements either by their sc-addrs or by indices of sc-elements created earlier in the same batch.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param items Array of descriptions of sc-elements to be created.
+ * @param count Count of sc-elements in the batch.
+ * @param result_addrs Array of size `count` that will store sc-addrs of created sc-elements.
+ *
+ * @return Returns the result of the operation.
+ *
+ * @note If the batch can't be created, no sc-element of the batch is created.
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_OK All sc-elements of the batch were successfully created.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID Begin or end sc-element of some sc-connector is not valid.
+ * @retval SC_RESULT_ERROR_FULL_MEMORY Memory allocation for the batch failed.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED The specified sc-memory context is not authenticated.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS The specified sc-memory context has not write
+ * permissions.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_PERMISSIONS_TO_WRITE_PERMISSIONS The specified sc-memory context has
+ * not permissions to write permissions.
+ */
+_SC_EXTERN sc_result sc_memory_elements_new_batch(
+    sc_memory_context const * ctx,
+    sc_element_batch_item const * items,
+    sc_uint32 count,
+    sc_addr * result_addrs);
+
 /*!
  * @brief Retrieves the count of output connectors for the specified sc-element.
  *
@@ -626,6 +659,109 @@ _SC_EXTERN sc_result sc_memory_get_arc_end(sc_memory_context const * ctx, sc_add
 _SC_EXTERN sc_result
 sc_memory_get_arc_info(sc_memory_context const * ctx, sc_addr addr, sc_addr * begin_addr, sc_addr * end_addr);
 
+/*!
+ * @brief Retrieves metadata of a batch of sc-elements.
+ *
+ * This function retrieves types, begin and end sc-addrs of sc-connectors and counts of output and input
+ * sc-connectors of all specified sc-elements in one call. Sc-addrs are grouped by segment, so sc-elements of one
+ * segment are read under one lock. The context is authenticated once per batch, and read permissions are checked
+ * once per batch if the context has no local permissions, otherwise they are checked for each sc-element and for
+ * begin and end sc-elements of each sc-connector.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param addrs Array of sc-addrs of sc-elements.
+ * @param count Count of sc-addrs in the batch.
+ * @param infos Array of size `count` that will store metadata of sc-elements in the order of `addrs`.
+ *              It should be pre-allocated by the caller.
+ *
+ * @return Returns the result of the operation. If successful, it returns SC_RESULT_OK, and result of each
+ *         sc-element is stored in its `sc_element_info`.
+ *
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_OK The function executed successfully.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ *
+ * Possible values for the `result` field of `sc_element_info`:
+ * @retval SC_RESULT_OK Metadata of the sc-element is read.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID The specified sc-addr is not valid.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context has not read
+ * permissions for the sc-element or for begin or end sc-element of the sc-connector.
+ */
+_SC_EXTERN sc_result sc_memory_get_elements_info(
+    sc_memory_context const * ctx,
+    sc_addr const * addrs,
+    sc_uint32 count,
+    sc_element_info * infos);
+
+/*!
+ * @brief Finds sc-elements within bounded amount of sc-connectors from the specified sc-element.
+ *
+ * This function expands neighbourhood of root sc-element breadth-first inside sc-storage, instead of nested
+ * iterators. Each found sc-element is expanded under one acquisition of its monitor, found sc-elements are marked in
+ * bitmaps, so each of them is found and expanded once. Only sc-connectors of specified directions and type, whose
+ * other incident sc-elements have specified type, are passed. Found sc-connectors are expanded too, so role sc-arcs
+ * of found sc-arcs can be found. The context is authenticated once, and read permissions are checked once if the
+ * context has no local permissions, otherwise they are checked for each found sc-element. If maximum amount of
+ * sc-elements is specified, neighbourhood is truncated by whole triples: sc-connector is found together with its
+ * other incident sc-element only, and expansion stops at the first sc-connector they don't fit with.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param root_addr The sc-addr of root sc-element.
+ * @param params A pointer to depth, directions and type filters of expansion.
+ * @param result_addrs Pointer to array that will store sc-addrs of found sc-elements, including root sc-element and
+ *                     found sc-connectors, in order of their distance from root sc-element. It should be freed by
+ *                     `sc_mem_free`.
+ * @param result_count Pointer to variable that will store count of found sc-elements.
+ *
+ * @return Returns the result of the operation.
+ *
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_OK Neighbourhood is found.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID The specified root sc-addr is not valid.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED The specified sc-memory context is not authenticated.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context has not read
+ * permissions.
+ */
+_SC_EXTERN sc_result sc_memory_get_neighbourhood(
+    sc_memory_context const * ctx,
+    sc_addr root_addr,
+    sc_neighbourhood_params const * params,
+    sc_addr ** result_addrs,
+    sc_uint32 * result_count);
+
+/*!
+ * @brief Finds neighbourhood of the specified sc-element and adds it to the specified sc-structure.
+ *
+ * This function finds neighbourhood as `sc_memory_get_neighbourhood` does and generates positive constant permanent
+ * sc-arcs from sc-structure to found sc-elements that aren't its elements yet. Elements of sc-structure are got once
+ * before adding, instead of checking each found sc-element.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param root_addr The sc-addr of root sc-element.
+ * @param params A pointer to depth, directions and type filters of expansion.
+ * @param structure_addr The sc-addr of sc-structure to add neighbourhood to.
+ * @param added_count Pointer to variable that will store count of added sc-elements. It can be NULL if it is not
+ *                    needed.
+ *
+ * @return Returns the result of the operation.
+ *
+ * @retval SC_RESULT_OK Neighbourhood is added to sc-structure.
+ * @retval SC_RESULT_ERROR_ADDR_IS_NOT_VALID The specified root or sc-structure sc-addr is not valid.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED The specified sc-memory context is not authenticated.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context has not read
+ * permissions.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS The specified sc-memory context has not write
+ * permissions.
+ */
+_SC_EXTERN sc_result sc_memory_add_neighbourhood_to_structure(
+    sc_memory_context const * ctx,
+    sc_addr root_addr,
+    sc_neighbourhood_params const * params,
+    sc_addr structure_addr,
+    sc_uint32 * added_count);
+
 /*!
  * @brief Sets the content of the specified sc-link.
  *
@@ -838,6 +974,197 @@ _SC_EXTERN sc_result sc_memory_find_links_contents_by_content_substring(
  */
 _SC_EXTERN sc_result sc_memory_stat(sc_memory_context const * ctx, sc_stat * stat);
 
+/*!
+ * @brief Retrieves live allocations of sc-memory subsystems.
+ *
+ * This function retrieves counts of bytes and objects allocated by sc-memory subsystems (segments, dictionaries,
+ * monitor tables, sc-event subscriptions, sc-memory contexts and sc-server sessions) and not freed yet.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param stat Pointer to the `sc_allocations_stat` structure where the statistics will be stored.
+ *             It should be pre-allocated by the caller.
+ *
+ * @return Returns the result of the operation. If successful, it returns SC_RESULT_OK.
+ *
+ * @note Subsystems are indexed by `sc_allocations_subsystem` values, use `sc_mem_get_allocations_subsystem_name` to
+ *       get their names.
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context has not read
+ * permissions.
+ */
+_SC_EXTERN sc_result sc_memory_get_allocations_stat(sc_memory_context const * ctx, sc_allocations_stat * stat);
+
+/*!
+ * @brief Retrieves state of the queue of emitted sc-events.
+ *
+ * This function retrieves amount of sc-events waiting for processing, amounts of sc-events processed, blocked, spilled
+ * and dropped by the queue overflow policy, and time that sc-events waited in the queue.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param stat Pointer to the `sc_events_queue_stat` structure where the statistics will be stored.
+ *             It should be pre-allocated by the caller.
+ *
+ * @return Returns the result of the operation. If successful, it returns SC_RESULT_OK.
+ *
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context has not read
+ * permissions.
+ */
+_SC_EXTERN sc_result sc_memory_get_events_queue_stat(sc_memory_context const * ctx, sc_events_queue_stat * stat);
+
+/*!
+ * @brief Retrieves latencies of processed sc-events.
+ *
+ * Each emitted sc-event is timestamped at emission, queueing, start and completion of its processing. Latencies are
+ * collected into histograms by sc-event types and priority classes of sc-event subscriptions, for each phase: from
+ * emission to queueing (it includes pending of sc-events and waiting for free space in the queue), from queueing to
+ * start of processing, processing itself, and the whole delivery. Large queueing latencies with short processing
+ * ones mean that workers are saturated, otherwise sc-event callbacks are slow.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param[out] stats A pointer to array of latencies, only sc-event types and priority classes with processed sc-events
+ * are retrieved. It should be freed by `sc_mem_free`.
+ * @param[out] count A pointer to amount of retrieved latencies.
+ *
+ * @return Returns the result of the operation. If successful, it returns SC_RESULT_OK.
+ *
+ * @note Latencies are measured in microseconds. Batch deliveries are measured from emission of the first sc-event in
+ *       batch.
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context has not read
+ * permissions.
+ */
+_SC_EXTERN sc_result sc_memory_get_events_latency_stat(
+    sc_memory_context const * ctx,
+    sc_events_latency_stat ** stats,
+    sc_uint32 * count);
+
+/*!
+ * @brief Retrieves utilization of threads processing emitted sc-events.
+ *
+ * This function retrieves maximum amount of threads processing sc-events, amount of busy threads now and maximum of
+ * it, and time that threads were busy since they were started.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param stat Pointer to the `sc_events_workers_stat` structure where the statistics will be stored.
+ *             It should be pre-allocated by the caller.
+ *
+ * @return Returns the result of the operation. If successful, it returns SC_RESULT_OK.
+ *
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context has not read
+ * permissions.
+ */
+_SC_EXTERN sc_result sc_memory_get_events_workers_stat(sc_memory_context const * ctx, sc_events_workers_stat * stat);
+
+/*!
+ * @brief Retrieves the most contended monitors of sc-elements.
+ *
+ * Contended acquisitions of monitors of sc-elements, i.e. acquisitions which wait for other threads, are sampled with
+ * period specified by `monitors_contention_sampling_period` sc-memory param. For each sampled sc-element, amount of
+ * sampled acquisitions, their total and maximum wait times and maximum amount of waiting requests are recorded.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param max_count Maximum amount of sc-elements to retrieve.
+ * @param[out] stats A pointer to array of statistics of sc-elements ordered by total wait time descending. It should be
+ * freed by `sc_mem_free`.
+ * @param[out] count A pointer to amount of retrieved statistics.
+ *
+ * @return Returns the result of the operation. If successful, it returns SC_RESULT_OK.
+ *
+ * @note Wait times are measured in microseconds. Use `sc_helper_get_system_identifier_link` to get system identifiers
+ *       of sc-elements.
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context has not read
+ * permissions.
+ */
+_SC_EXTERN sc_result sc_memory_get_monitors_contention_stat(
+    sc_memory_context const * ctx,
+    sc_uint32 max_count,
+    sc_monitor_contention_stat ** stats,
+    sc_uint32 * count);
+
+/*!
+ * @brief Sets period of sampling contended acquisitions of monitors of sc-elements.
+ *
+ * Statistics collected before are cleared.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param sampling_period Every `sampling_period`-th contended acquisition is sampled, 0 disables sampling.
+ *
+ * @return Returns the result of the operation. If successful, it returns SC_RESULT_OK.
+ *
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS The specified sc-memory context has not write
+ * permissions.
+ */
+_SC_EXTERN sc_result
+sc_memory_set_monitors_contention_sampling_period(sc_memory_context const * ctx, sc_uint32 sampling_period);
+
+/*!
+ * @brief Finds all sc-elements of the specified type.
+ *
+ * This function enumerates live sc-elements through per-segment registries of sc-nodes, sc-links and
+ * sc-connectors instead of scanning all sc-memory segments. An sc-element is suitable if its type contains
+ * all subtypes of the specified type. Use `sc_type_arc_mask` to find all sc-connectors and `0` to find all
+ * sc-elements. Read permissions are checked once if the context has no local permissions, otherwise they are checked
+ * for each sc-element, and sc-elements which the context can't read aren't found.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param type The type of sc-elements to find.
+ * @param result_hashes The list containing the hash values of found sc-elements.
+ *
+ * @note The caller is responsible for handling any errors indicated by the result value.
+ * @note This function is thread-safe.
+ *
+ * @return Returns an sc_result indicating the success or failure of the operation.
+ * Possible result values:
+ * @retval SC_RESULT_OK: The operation was successful.
+ * @retval SC_RESULT_ERROR_INVALID_TYPE: The specified type has invalid element class.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context has not read
+ * permissions.
+ */
+_SC_EXTERN sc_result
+sc_memory_find_elements_by_type(sc_memory_context const * ctx, sc_type type, sc_list ** result_hashes);
+
+/*!
+ * @brief Gets count of sc-elements of the specified type.
+ *
+ * Counts of all sc-elements, sc-nodes (`sc_type_node`), sc-links (`sc_type_link`) and sc-connectors
+ * (`sc_type_arc_mask`) are got from registry counters in constant time per segment, counts of other types
+ * are calculated by registry traversal. If the context has local permissions, sc-elements which it can't read aren't
+ * counted, so their count is calculated by registry traversal for all types.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param type The type of sc-elements to count.
+ * @param count Pointer to count of found sc-elements.
+ *
+ * @note This function is thread-safe.
+ *
+ * @return Returns an sc_result indicating the success or failure of the operation.
+ * Possible result values:
+ * @retval SC_RESULT_OK: The operation was successful.
+ * @retval SC_RESULT_ERROR_INVALID_TYPE: The specified type has invalid element class.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context has not read
+ * permissions.
+ */
+_SC_EXTERN sc_result
+sc_memory_get_elements_count_by_type(sc_memory_context const * ctx, sc_type type, sc_uint64 * count);
+
 /*!
  * @brief Saves the current state of the sc-storage to persistent storage.
  *
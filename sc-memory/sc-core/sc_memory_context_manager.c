@@ -28,6 +28,7 @@ struct _sc_event_emit_params
   sc_addr connector_addr;     ///< sc-address representing the connector associated with the event.
   sc_type connector_type;     ///< sc-type of the connector associated with the event.
   sc_addr other_addr;         ///< sc-address representing the other element associated with the event.
+  sc_int64 emit_time;         ///< Monotonic time in microseconds when the event was emitted.
 };
 
 #define SC_CONTEXT_FLAG_PENDING_EVENTS 0x1
@@ -44,11 +45,11 @@ void _sc_memory_context_manager_initialize(sc_memory_context_manager ** manager,
   (*manager)->context_count = 0;
   sc_monitor_init(&(*manager)->context_monitor);
   (*manager)->user_mode = user_mode;
-  (*manager)->user_global_permissions = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+  (*manager)->user_global_permissions = _sc_memory_context_permissions_table_new(null_ptr);
   sc_monitor_init(&(*manager)->user_global_permissions_monitor);
-  (*manager)->basic_action_classes = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+  (*manager)->basic_action_classes = _sc_memory_context_permissions_table_new(null_ptr);
   (*manager)->user_local_permissions =
-      sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, (GDestroyNotify)g_hash_table_destroy);
+      _sc_memory_context_permissions_table_new((GDestroyNotify)_sc_memory_context_permissions_table_destroy);
   sc_monitor_init(&(*manager)->user_local_permissions_monitor);
 
   (*manager)->on_new_users_in_sets_events =
@@ -100,12 +101,12 @@ void _sc_memory_context_manager_shutdown(sc_memory_context_manager * manager)
   sc_monitor_destroy(&manager->context_monitor);
 
   sc_monitor_destroy(&manager->user_global_permissions_monitor);
-  sc_hash_table_destroy(manager->user_global_permissions);
+  _sc_memory_context_permissions_table_destroy(manager->user_global_permissions);
 
   sc_monitor_destroy(&manager->user_local_permissions_monitor);
-  sc_hash_table_destroy(manager->user_local_permissions);
+  _sc_memory_context_permissions_table_destroy(manager->user_local_permissions);
 
-  sc_hash_table_destroy(manager->basic_action_classes);
+  _sc_memory_context_permissions_table_destroy(manager->basic_action_classes);
 
   sc_hash_table_destroy(manager->on_new_users_in_sets_events);
   sc_monitor_destroy(&manager->on_new_users_in_sets_events_monitor);
@@ -138,6 +139,7 @@ sc_memory_context * _sc_memory_context_new_impl(sc_memory_context_manager * mana
   sc_hash_table_insert(
       manager->context_hash_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)), (sc_pointer)ctx);
   ++manager->context_count;
+  sc_mem_account_new(SC_ALLOCATIONS_CONTEXTS, 1, sizeof(sc_memory_context));
   goto result;
 
 error:
@@ -211,6 +213,7 @@ void _sc_memory_context_free_impl(sc_memory_context_manager * manager, sc_memory
   --manager->context_count;
 
   sc_mem_free(ctx);
+  sc_mem_account_free(SC_ALLOCATIONS_CONTEXTS, 1, sizeof(sc_memory_context));
 error:
   sc_monitor_release_write(&manager->context_monitor);
 }
@@ -237,7 +240,8 @@ void _sc_memory_context_pend_event(
     sc_addr subscription_addr,
     sc_addr connector_addr,
     sc_type connector_type,
-    sc_addr other_addr)
+    sc_addr other_addr,
+    sc_int64 emit_time)
 {
   sc_event_emit_params * params = sc_mem_new(sc_event_emit_params, 1);
   params->type = type;
@@ -245,6 +249,7 @@ void _sc_memory_context_pend_event(
   params->connector_addr = connector_addr;
   params->connector_type = connector_type;
   params->other_addr = other_addr;
+  params->emit_time = emit_time;
 
   sc_monitor_acquire_write((sc_monitor *)&ctx->monitor);
   ((sc_memory_context *)ctx)->pend_events = sc_hash_table_list_append(ctx->pend_events, params);
@@ -268,7 +273,8 @@ void _sc_memory_context_emit_events(sc_memory_context const * ctx)
         event_params->type,
         event_params->connector_addr,
         event_params->connector_type,
-        event_params->other_addr);
+        event_params->other_addr,
+        event_params->emit_time);
     sc_mem_free(event_params);
 
     ((sc_memory_context *)ctx)->pend_events = sc_hash_table_list_remove_sublist(ctx->pend_events, ctx->pend_events);
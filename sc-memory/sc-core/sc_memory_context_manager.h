@@ -110,6 +110,7 @@ void _sc_memory_context_pending_end(sc_memory_context * ctx);
  * @param connector_addr sc-address representing the sc-connector associated with the event.
  * @param connector_type sc-type representing the sc-connector associated with the event.
  * @param other_addr sc-address representing the other sc-element associated with the event.
+ * @param emit_time Monotonic time in microseconds when the event was emitted.
  * @note This function adds an event to the pending events list in the sc-memory context, to be emitted later.
  */
 void _sc_memory_context_pend_event(
@@ -118,7 +119,8 @@ void _sc_memory_context_pend_event(
     sc_addr subscription_addr,
     sc_addr connector_addr,
     sc_type connector_type,
-    sc_addr other_addr);
+    sc_addr other_addr,
+    sc_int64 emit_time);
 
 /*! Function that emits pending events in a sc-memory context.
  * @param ctx Pointer to the sc-memory context for which pending events are emitted.
@@ -10,9 +10,34 @@
 
 #include "sc-store/sc_storage_private.h"
 #include "sc-store/sc_iterator3.h"
+#include "sc-store/sc-base/sc_allocator.h"
 #include "sc_helper.h"
 #include "sc_keynodes.h"
 
+sc_hash_table * _sc_memory_context_permissions_table_new(GDestroyNotify value_destroy_func)
+{
+  sc_hash_table * table = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, value_destroy_func);
+  sc_mem_account_new(SC_ALLOCATIONS_CONTEXTS, 1, sc_hash_table_get_bytes(table));
+  return table;
+}
+
+void _sc_memory_context_permissions_table_destroy(sc_hash_table * table)
+{
+  sc_mem_account_free(SC_ALLOCATIONS_CONTEXTS, 1, sc_hash_table_get_bytes(table));
+  sc_hash_table_destroy(table);
+}
+
+void _sc_memory_context_permissions_table_insert(sc_hash_table * table, void * key, void * value)
+{
+  sc_uint64 const bytes = sc_hash_table_get_bytes(table);
+  sc_hash_table_insert(table, key, value);
+  sc_uint64 const new_bytes = sc_hash_table_get_bytes(table);
+  if (new_bytes > bytes)
+    sc_mem_account_new(SC_ALLOCATIONS_CONTEXTS, 0, new_bytes - bytes);
+  else if (new_bytes < bytes)
+    sc_mem_account_free(SC_ALLOCATIONS_CONTEXTS, 0, bytes - new_bytes);
+}
+
 typedef void (*sc_users_permissions_updater)(sc_memory_context_manager *, sc_addr, sc_addr, sc_addr);
 typedef void (*sc_users_updater)(sc_memory_context_manager *, sc_addr, sc_addr, sc_addr, sc_users_permissions_updater);
 typedef void (*sc_users_action_class_handler)(sc_memory_context_manager *, sc_addr, sc_addr, sc_users_updater);
@@ -73,7 +98,7 @@ typedef void (*sc_users_action_class_handler)(sc_memory_context_manager *, sc_ad
     sc_permissions _user_permissions = (sc_uint64)sc_hash_table_get( \
         manager->user_global_permissions, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_user_addr))); \
     _user_permissions |= (_adding_permissions); \
-    sc_hash_table_insert( \
+    _sc_memory_context_permissions_table_insert( \
         manager->user_global_permissions, \
         GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_user_addr)), \
         GINT_TO_POINTER(_user_permissions)); \
@@ -92,7 +117,7 @@ typedef void (*sc_users_action_class_handler)(sc_memory_context_manager *, sc_ad
     sc_permissions _user_permissions = (sc_uint64)sc_hash_table_get( \
         manager->user_global_permissions, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_user_addr))); \
     _user_permissions &= ~(_removing_permissions); \
-    sc_hash_table_insert( \
+    _sc_memory_context_permissions_table_insert( \
         manager->user_global_permissions, \
         GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_user_addr)), \
         GINT_TO_POINTER(_user_permissions)); \
@@ -131,8 +156,8 @@ typedef void (*sc_users_action_class_handler)(sc_memory_context_manager *, sc_ad
     sc_permissions _user_permissions = 0; \
     if (structures_permissions_table == null_ptr) \
     { \
-      structures_permissions_table = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr); \
-      sc_hash_table_insert( \
+      structures_permissions_table = _sc_memory_context_permissions_table_new(null_ptr); \
+      _sc_memory_context_permissions_table_insert( \
           manager->user_local_permissions, \
           GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_user_addr)), \
           structures_permissions_table); \
@@ -141,7 +166,7 @@ typedef void (*sc_users_action_class_handler)(sc_memory_context_manager *, sc_ad
       _user_permissions = (sc_uint64)sc_hash_table_get( \
           structures_permissions_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_structure_addr))); \
     _user_permissions |= (_adding_permissions); \
-    sc_hash_table_insert( \
+    _sc_memory_context_permissions_table_insert( \
         structures_permissions_table, \
         GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_structure_addr)), \
         GINT_TO_POINTER(_user_permissions)); \
@@ -165,7 +190,7 @@ typedef void (*sc_users_action_class_handler)(sc_memory_context_manager *, sc_ad
       _user_permissions = (sc_uint64)sc_hash_table_get( \
           structures_permissions_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_structure_addr))); \
       _user_permissions &= ~(_removing_permissions); \
-      sc_hash_table_insert( \
+      _sc_memory_context_permissions_table_insert( \
           structures_permissions_table, \
           GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_structure_addr)), \
           GINT_TO_POINTER(_user_permissions)); \
@@ -352,7 +377,7 @@ sc_result _sc_memory_context_manager_on_unauthentication_request_user(
  */
 #define sc_context_manager_add_basic_action_class_permissions(_action_class_addr, _permissions) \
   ({ \
-    sc_hash_table_insert( \
+    _sc_memory_context_permissions_table_insert( \
         manager->basic_action_classes, \
         GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_action_class_addr)), \
         GINT_TO_POINTER(_permissions)); \
@@ -1319,6 +1344,18 @@ result:
   return result;
 }
 
+sc_bool _sc_memory_context_has_local_permissions(sc_memory_context_manager * manager, sc_memory_context const * ctx)
+{
+  if (_sc_memory_context_check_system(manager, ctx))
+    return SC_FALSE;
+
+  sc_monitor_acquire_read((sc_monitor *)&ctx->monitor);
+  sc_bool const result = ctx->local_permissions != null_ptr;
+  sc_monitor_release_read((sc_monitor *)&ctx->monitor);
+
+  return result;
+}
+
 sc_bool _sc_memory_context_check_global_permissions(
     sc_memory_context_manager * manager,
     sc_memory_context const * ctx,
@@ -16,6 +16,27 @@
 
 #define SC_CONTEXT_FLAG_SYSTEM 0x10
 
+/**
+ * @brief Creates sc-hash-table of permissions and accounts it in allocations of sc-memory contexts.
+ * @param value_destroy_func Function to free values of table, may be null_ptr.
+ * @return Returns a pointer to created table.
+ */
+sc_hash_table * _sc_memory_context_permissions_table_new(GDestroyNotify value_destroy_func);
+
+/**
+ * @brief Destroys sc-hash-table of permissions created by `_sc_memory_context_permissions_table_new`.
+ * @param table Pointer to the table to be destroyed.
+ */
+void _sc_memory_context_permissions_table_destroy(sc_hash_table * table);
+
+/**
+ * @brief Inserts value into sc-hash-table of permissions and accounts growth of table.
+ * @param table Pointer to the table.
+ * @param key Key to insert value by.
+ * @param value Value to be inserted.
+ */
+void _sc_memory_context_permissions_table_insert(sc_hash_table * table, void * key, void * value);
+
 /**
  * @brief Sets permissions for a specific sc-memory element.
  * @param _element_addr Address of the sc-memory element.
@@ -137,6 +158,13 @@ sc_result _sc_memory_context_check_local_permissions(
     sc_permissions action_class_permissions,
     sc_addr element_addr);
 
+/*! Function that checks if a given memory context has local permissions for some sc-structures.
+ * @param manager Pointer to the sc-memory context manager.
+ * @param ctx Pointer to the sc-memory context.
+ * @returns Returns SC_FALSE if permissions of the context don't depend on sc-elements, otherwise SC_TRUE.
+ */
+sc_bool _sc_memory_context_has_local_permissions(sc_memory_context_manager * manager, sc_memory_context const * ctx);
+
 /*! Function that checks global permissions for a given memory context.
  * @param manager Pointer to the sc-memory context manager.
  * @param ctx Pointer to the sc-memory context for which global permissions are checked.
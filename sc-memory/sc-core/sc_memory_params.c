@@ -19,6 +19,9 @@ void sc_memory_params_clear(sc_memory_params * params)
   params->max_loaded_segments = DEFAULT_MAX_LOADED_SEGMENTS;
   params->limit_max_threads_by_max_physical_cores = DEFAULT_LIMIT_MAX_THREADS_BY_MAX_PHYSICAL_CORES;
   params->max_events_and_agents_threads = DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS;
+  params->max_events_queue_size = DEFAULT_MAX_EVENTS_QUEUE_SIZE;
+  params->events_queue_overflow_policy = DEFAULT_EVENTS_QUEUE_OVERFLOW_POLICY;
+  params->monitors_contention_sampling_period = DEFAULT_MONITORS_CONTENTION_SAMPLING_PERIOD;
 
   params->dump_memory = SC_TRUE;
   params->save_period = params->dump_memory_period = DEFAULT_DUMP_MEMORY_PERIOD;  // seconds
@@ -38,4 +41,13 @@ void sc_memory_params_clear(sc_memory_params * params)
   params->max_searchable_string_size = DEFAULT_MAX_SEARCHABLE_STRING_SIZE;
   params->term_separators = DEFAULT_TERM_SEPARATORS;
   params->search_by_substring = DEFAULT_SEARCH_BY_SUBSTRING;
+  params->sorted_terms_dictionary = DEFAULT_SORTED_TERMS_DICTIONARY;
+  params->lazy_dictionaries_loading = DEFAULT_LAZY_DICTIONARIES_LOADING;
+  params->dictionaries_unload_period = DEFAULT_DICTIONARIES_UNLOAD_PERIOD;  // seconds
+
+  params->slow_operations_log_file = DEFAULT_SLOW_OPERATIONS_LOG_FILE;
+  params->slow_operations_log_size = DEFAULT_SLOW_OPERATIONS_LOG_SIZE;
+  params->slow_template_search_threshold = DEFAULT_SLOW_TEMPLATE_SEARCH_THRESHOLD;
+  params->slow_agent_threshold = DEFAULT_SLOW_AGENT_THRESHOLD;
+  params->slow_server_request_threshold = DEFAULT_SLOW_SERVER_REQUEST_THRESHOLD;
 }
@@ -14,6 +14,9 @@
 #define DEFAULT_LIMIT_MAX_THREADS_BY_MAX_PHYSICAL_CORES SC_TRUE
 #define DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS 32
 #define DEFAULT_MIN_EVENTS_AND_AGENTS_THREADS 1
+#define DEFAULT_MAX_EVENTS_QUEUE_SIZE 0
+#define DEFAULT_EVENTS_QUEUE_OVERFLOW_POLICY "Block"
+#define DEFAULT_MONITORS_CONTENTION_SAMPLING_PERIOD 0
 #define DEFAULT_DUMP_MEMORY SC_TRUE
 #define DEFAULT_DUMP_MEMORY_PERIOD 32000
 #define DEFAULT_DUMP_MEMORY_STATISTICS SC_TRUE
@@ -26,6 +29,14 @@
 #define DEFAULT_MAX_SEARCHABLE_STRING_SIZE 1000
 #define DEFAULT_TERM_SEPARATORS " _"
 #define DEFAULT_SEARCH_BY_SUBSTRING SC_TRUE
+#define DEFAULT_SORTED_TERMS_DICTIONARY SC_FALSE
+#define DEFAULT_LAZY_DICTIONARIES_LOADING SC_FALSE
+#define DEFAULT_DICTIONARIES_UNLOAD_PERIOD 600
+#define DEFAULT_SLOW_OPERATIONS_LOG_FILE ""
+#define DEFAULT_SLOW_OPERATIONS_LOG_SIZE 1000
+#define DEFAULT_SLOW_TEMPLATE_SEARCH_THRESHOLD 0
+#define DEFAULT_SLOW_AGENT_THRESHOLD 0
+#define DEFAULT_SLOW_SERVER_REQUEST_THRESHOLD 0
 
 /*! Structure representing parameters for configuring the sc-memory.
  * @note This structure holds various configuration parameters that control the behavior of the sc-memory.
@@ -45,6 +56,12 @@ typedef struct
   ///< Boolean indicating whether sc-memory limit `max_events_and_agents_threads` by maximum physical core number.
   sc_bool limit_max_threads_by_max_physical_cores;
   sc_uint32 max_events_and_agents_threads;  ///< Maximum number of threads for events and agents processing.
+  sc_uint32 max_events_queue_size;  ///< Maximum number of emitted sc-events waiting for processing, 0 is unbounded.
+  ///< Policy for sc-events emitted into full queue ("Block", "Spill" or "Drop"). By default, it is "Block". Other
+  ///< values are rejected by sc-memory initialization.
+  sc_char const * events_queue_overflow_policy;
+  ///< Period of sampling contended acquisitions of monitors of sc-elements, 0 disables sampling. By default, it is 0.
+  sc_uint32 monitors_contention_sampling_period;
 
   sc_uint32 save_period;    ///< Period (in seconds) for automatic saving of sc-memory state (deprecated in 0.9.0).
   sc_uint32 update_period;  ///< Period (in seconds) for dumping statistics of sc-memory state (deprecated in 0.9.0).
@@ -71,6 +88,21 @@ typedef struct
   sc_uint32 max_searchable_string_size;  ///< Maximum size of a searchable string.
   sc_char const * term_separators;       ///< String containing term separators used in string operations.
   sc_bool search_by_substring;           ///< Boolean indicating whether to allow searching by substring.
+  ///< Boolean indicating whether to save terms dictionary as sorted file searched without loading. Versions without
+  ///< this option can't read this file. By default, it is SC_FALSE.
+  sc_bool sorted_terms_dictionary;
+  ///< Boolean indicating whether to load sc-fs-memory dictionaries on first search instead of loading them on
+  ///< initialize. By default, it is SC_FALSE.
+  sc_bool lazy_dictionaries_loading;
+  ///< Period (in seconds) without searches after which lazily loaded dictionaries are unloaded, 0 disables unloading.
+  sc_uint32 dictionaries_unload_period;
+
+  sc_char const * slow_operations_log_file;  ///< Path to the file of slow operations, they aren't written if empty.
+  sc_uint32 slow_operations_log_size;        ///< Maximum number of the last slow operations kept in memory.
+  ///< Durations (in milliseconds) after which operations are logged as slow, 0 disables logging of operations.
+  sc_uint32 slow_template_search_threshold;
+  sc_uint32 slow_agent_threshold;
+  sc_uint32 slow_server_request_threshold;
 } sc_memory_params;
 
 _SC_EXTERN void sc_memory_params_clear(sc_memory_params * params);
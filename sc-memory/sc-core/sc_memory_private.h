@@ -42,6 +42,19 @@ _SC_EXTERN sc_result sc_memory_find_links_by_content_substring_ext(
     void * data,
     void (*callback)(void * data, sc_addr const link_addr));
 
+/*! Estimates amount of sc-links in the sc-memory that are found by content string or substring.
+ * @param ctx Pointer to the sc-memory context.
+ * @param stream Pointer to the stream containing the string or substring to search for.
+ * @param is_substring Flag indicating whether sc-links are searched by substring.
+ * @param count Pointer to upper bound of amount of found sc-links.
+ * @return Returns SC_RESULT_OK if the operation was successful; otherwise, returns an error code.
+ */
+_SC_EXTERN sc_result sc_memory_estimate_links_by_content(
+    sc_memory_context const * ctx,
+    sc_stream const * stream,
+    sc_bool is_substring,
+    sc_uint64 * count);
+
 /*! Finds sc-links in the sc-memory that have content containing a substring from the provided stream.
  * @param ctx Pointer to the sc-memory context.
  * @param stream Pointer to the stream containing the substring to search for.
@@ -58,4 +71,18 @@ _SC_EXTERN sc_result sc_memory_find_links_contents_by_content_substring_ext(
     void * data,
     void (*callback)(void * data, sc_addr const link_addr, sc_char const * link_content));
 
+/*! Finds sc-elements of the specified type in the sc-memory.
+ * @param ctx Pointer to the sc-memory context.
+ * @param type Type of sc-elements to find.
+ * @param data Pointer to user-specific data.
+ * @param callback Callback function to be invoked for each found sc-element.
+ *                The callback function must have the signature: void callback(void * data, sc_addr const addr).
+ * @return Returns SC_RESULT_OK if the operation was successful; otherwise, returns an error code.
+ */
+_SC_EXTERN sc_result sc_memory_find_elements_by_type_ext(
+    sc_memory_context const * ctx,
+    sc_type type,
+    void * data,
+    void (*callback)(void * data, sc_addr const addr));
+
 #endif
@@ -6,8 +6,13 @@
 
 #include "sc_agent.hpp"
 
+#include "../sc_timer.hpp"
 #include "../sc_wait.hpp"
 
+#include "../utils/sc_slow_operations_log.hpp"
+
+#include <sstream>
+
 namespace
 {
 bool gInitializeResult = false;
@@ -58,7 +63,9 @@ sc_result ScAgentAction::Run(ScAddr const & listenAddr, ScAddr const & edgeAddr,
           m_memoryCtx.CreateEdge(ScType::EdgeAccessConstPosTemp, ScKeynodes::kCommandProgressedAddr, cmdAddr);
       ScAddr resultAddr = m_memoryCtx.CreateNode(ScType::NodeConstStruct);
 
+      ScTimer timer;
       sc_result const resCode = RunImpl(cmdAddr, resultAddr);
+      LogIfSlow(cmdAddr, resCode, timer.Seconds() * 1000);
 
       m_memoryCtx.EraseElement(progressAddr);
 
@@ -75,6 +82,19 @@ sc_result ScAgentAction::Run(ScAddr const & listenAddr, ScAddr const & edgeAddr,
   return SC_RESULT_ERROR;
 }
 
+void ScAgentAction::LogIfSlow(ScAddr const & cmdAddr, sc_result resCode, double duration)
+{
+  if (!utils::ScSlowOperationsLog::IsSlow(utils::ScSlowOperationsLog::Type::AgentAction, duration))
+    return;
+
+  std::string const & cmdClassIdtf = m_memoryCtx.HelperGetSystemIdtf(m_cmdClassAddr);
+  std::stringstream description;
+  description << "command class: " << (cmdClassIdtf.empty() ? std::to_string(m_cmdClassAddr.Hash()) : cmdClassIdtf)
+              << ", command: " << cmdAddr.Hash() << ", result code: " << int(resCode);
+
+  utils::ScSlowOperationsLog::Add(utils::ScSlowOperationsLog::Type::AgentAction, duration, description.str());
+}
+
 ScAddr ScAgentAction::GetParam(ScAddr const & cmdAddr, ScAddr const & relationAddr, ScType const & paramType) const
 {
   ScIterator5Ptr iter = m_memoryCtx.Iterator5(
@@ -88,7 +108,12 @@ ScAddr ScAgentAction::GetParam(ScAddr const & cmdAddr, ScAddr const & relationAd
 
 ScAddr ScAgentAction::GetParam(ScAddr const & cmdAddr, size_t index) const
 {
-  return GetParam(cmdAddr, ScKeynodes::GetRrelIndex(index), ScType());
+  if (index >= ScKeynodes::GetRrelIndexNum())
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "You should use index in range[0; " + std::to_string(ScKeynodes::GetRrelIndexNum()) + ")");
+
+  return m_memoryCtx.HelperGetOrderedSetElement(cmdAddr, index + 1);
 }
 
 ScAddr const & ScAgentAction::GetCommandInitiatedAddr()
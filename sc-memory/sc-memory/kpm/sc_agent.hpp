@@ -133,6 +133,9 @@ public:
 private:
   ScAddr m_cmdClassAddr;
 
+  //! Logs command processing if it lasts longer than threshold of agents of commands
+  void LogIfSlow(ScAddr const & cmdAddr, sc_result resCode, double duration);
+
 private:
 };
 
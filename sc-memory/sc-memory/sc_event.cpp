@@ -72,6 +72,26 @@ ScEvent::ScEvent(
       *ctx, *addr, ConvertEventType(eventType), (sc_pointer)this, &ScEvent::Handler, &ScEvent::HandlerDelete);
 }
 
+ScEvent::ScEvent(
+    ScMemoryContext const & ctx,
+    ScAddr const & addr,
+    Type eventType,
+    DelegateBatchFunc func,
+    sc_uint32 maxBatchSize,
+    sc_uint32 maxBatchDelayMs)
+{
+  m_delegateBatch = std::move(func);
+  m_event = sc_event_batch_new(
+      *ctx,
+      *addr,
+      ConvertEventType(eventType),
+      (sc_pointer)this,
+      &ScEvent::HandlerBatch,
+      &ScEvent::HandlerDelete,
+      maxBatchSize,
+      maxBatchDelayMs);
+}
+
 ScEvent::~ScEvent()
 {
   if (m_event)
@@ -83,6 +103,11 @@ void ScEvent::RemoveDelegate()
   m_delegate = DelegateFunc();
 }
 
+void ScEvent::SetPriority(Priority priority)
+{
+  sc_event_set_priority(m_event, static_cast<sc_event_priority>(priority));
+}
+
 sc_result ScEvent::Handler(sc_event const * event, sc_addr connector_addr, sc_addr other_addr)
 {
   sc_result result = SC_RESULT_ERROR;
@@ -149,6 +174,40 @@ result:
   return result;
 }
 
+sc_result ScEvent::HandlerBatch(sc_event const * event, sc_event_batch_item const * items, sc_uint32 itemsCount)
+{
+  sc_result result = SC_RESULT_ERROR;
+
+  auto * eventObj = (ScEvent *)sc_event_get_data(event);
+
+  if (eventObj == nullptr)
+    return result;
+
+  DelegateBatchFunc delegateFunc = eventObj->m_delegateBatch;
+  if (delegateFunc == nullptr)
+    return result;
+
+  Batch batch;
+  batch.reserve(itemsCount);
+  for (sc_uint32 i = 0; i < itemsCount; ++i)
+  {
+    sc_event_batch_item const & item = items[i];
+    batch.push_back(
+        {ScAddr(item.connector_addr), ScType(item.connector_type), ScAddr(item.other_addr), ScAddr(item.user_addr)});
+  }
+
+  try
+  {
+    result = delegateFunc(ScAddr(sc_event_get_element(event)), batch) ? SC_RESULT_OK : SC_RESULT_ERROR;
+  }
+  catch (utils::ScException & e)
+  {
+    SC_LOG_ERROR("Uncaught exception: " << e.Message());
+  }
+
+  return result;
+}
+
 sc_result ScEvent::HandlerDelete(sc_event const * evt)
 {
   auto * eventObj = (ScEvent *)sc_event_get_data(evt);
@@ -157,6 +216,7 @@ sc_result ScEvent::HandlerDelete(sc_event const * evt)
   if (eventObj->m_event)
   {
     eventObj->m_delegate = nullptr;
+    eventObj->m_delegateBatch = nullptr;
     eventObj->m_event = nullptr;
   }
 
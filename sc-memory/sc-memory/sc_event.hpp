@@ -7,6 +7,7 @@
 #pragma once
 
 #include <functional>
+#include <vector>
 
 #include "sc_addr.hpp"
 #include "sc_type.hpp"
@@ -14,6 +15,11 @@
 #include "sc_utils.hpp"
 #include "utils/sc_lock.hpp"
 
+extern "C"
+{
+#include "sc-core/sc-store/sc_event.h"
+}
+
 /* Base class for sc-events
  */
 class ScEvent
@@ -23,6 +29,18 @@ public:
   using DelegateFuncWithUserAddr =
       std::function<bool(ScAddr const &, ScAddr const &, ScAddr const &, ScType const &, ScAddr const &)>;
 
+  /* Arguments of emitted sc-event delivered in batch */
+  struct BatchItem
+  {
+    ScAddr m_connectorAddr;
+    ScType m_connectorType;
+    ScAddr m_otherAddr;
+    ScAddr m_userAddr;
+  };
+
+  using Batch = std::vector<BatchItem>;
+  using DelegateBatchFunc = std::function<bool(ScAddr const &, Batch const &)>;
+
   enum class Type : uint8_t
   {
     AddOutputEdge = 0,
@@ -33,6 +51,14 @@ public:
     ContentChanged
   };
 
+  /* Priority classes of sc-event subscriptions, they should be equal to C values */
+  enum class Priority : uint8_t
+  {
+    Interactive = 0,
+    Normal,
+    Background
+  };
+
   explicit _SC_EXTERN ScEvent(
       class ScMemoryContext const & ctx,
       ScAddr const & addr,
@@ -43,6 +69,15 @@ public:
       ScAddr const & addr,
       Type eventType,
       DelegateFuncWithUserAddr func = DelegateFuncWithUserAddr());
+  /* Subscribe to sc-events and receive them in batches in order of their emission. Batch is delivered when it
+   * contains `maxBatchSize` sc-events or when the first of them waits `maxBatchDelayMs` milliseconds. */
+  explicit _SC_EXTERN ScEvent(
+      class ScMemoryContext const & ctx,
+      ScAddr const & addr,
+      Type eventType,
+      DelegateBatchFunc func,
+      sc_uint32 maxBatchSize,
+      sc_uint32 maxBatchDelayMs);
   virtual _SC_EXTERN ~ScEvent();
 
   // Don't allow copying of events
@@ -57,6 +92,10 @@ public:
 
   void RemoveDelegate();
 
+  /* Set priority class of subscription. Emitted sc-events of subscriptions with higher priority are processed before
+   * waiting sc-events of subscriptions with lower priority. Subscriptions have Priority::Normal by default. */
+  _SC_EXTERN void SetPriority(Priority priority);
+
 protected:
   static sc_result Handler(sc_event const * event, sc_addr connector_addr, sc_addr other_addr);
   static sc_result Handler(
@@ -65,12 +104,14 @@ protected:
       sc_addr connector_addr,
       sc_type connector_type,
       sc_addr other_addr);
+  static sc_result HandlerBatch(sc_event const * event, sc_event_batch_item const * items, sc_uint32 itemsCount);
   static sc_result HandlerDelete(sc_event const * event);
 
 private:
   sc_event * m_event;
   DelegateFunc m_delegate;
   DelegateFuncWithUserAddr m_delegateExt;
+  DelegateBatchFunc m_delegateBatch;
   utils::ScLock m_lock;
 };
 
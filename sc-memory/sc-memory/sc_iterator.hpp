@@ -85,6 +85,12 @@ public:
     }
   }
 
+  //! Turns on batch mode of iterator, see `sc_iterator3_set_batch_size`. Returns false if iterator doesn't support it
+  bool SetBatchSize(sc_uint16 batchSize)
+  {
+    return sc_iterator3_set_batch_size(m_iterator, batchSize) == SC_TRUE;
+  }
+
   _SC_EXTERN bool Next() const override
   {
     sc_result result;
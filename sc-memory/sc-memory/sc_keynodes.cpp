@@ -22,6 +22,7 @@ ScAddr ScKeynodes::kNrelResult;
 ScAddr ScKeynodes::kNrelCommonTemplate;
 ScAddr ScKeynodes::kNrelIdtf;
 ScAddr ScKeynodes::kNrelFormat;
+ScAddr ScKeynodes::kNrelBasicSequence;
 
 ScAddr ScKeynodes::kScResult;
 ScAddr ScKeynodes::kScResultOk;
@@ -61,6 +61,9 @@ public:
   SC_PROPERTY(Keynode("nrel_format"), ForceCreate(ScType::NodeConstNoRole))
   _SC_EXTERN static ScAddr kNrelFormat;
 
+  SC_PROPERTY(Keynode("nrel_basic_sequence"), ForceCreate(ScType::NodeConstNoRole))
+  _SC_EXTERN static ScAddr kNrelBasicSequence;
+
   // result codes
   SC_PROPERTY(Keynode("sc_result"), ForceCreate(ScType::NodeConstClass))
   _SC_EXTERN static ScAddr kScResult;
@@ -8,11 +8,14 @@
 #include "sc_keynodes.hpp"
 #include "sc_utils.hpp"
 #include "sc_stream.hpp"
+#include "sc_ordered_set_index.hpp"
 
 #include "kpm/sc_agent.hpp"
 
 #include "utils/sc_log.hpp"
+#include "utils/sc_slow_operations_log.hpp"
 
+#include <cmath>
 #include <iostream>
 
 extern "C"
@@ -21,6 +24,7 @@ extern "C"
 #include "sc-core/sc_memory_private.h"
 #include "sc-core/sc_memory_context_private.h"
 #include "sc-core/sc_memory_context_permissions.h"
+#include "sc-core/sc-store/sc-base/sc_allocator.h"
 }
 
 SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_BEGIN
@@ -67,11 +71,77 @@ void _logPrintHandler(
 
 #define CHECK_CONTEXT SC_CHECK(IsValid(), "Used context is invalid. Make sure that it's initialized")
 
+sc_neighbourhood_params ToNeighbourhoodParams(ScMemoryContext::ScNeighbourhoodParams const & params)
+{
+  sc_neighbourhood_params neighbourhoodParams;
+  neighbourhoodParams.depth = (sc_uint32)params.m_depth;
+  neighbourhoodParams.directions = (params.m_passOutput ? SC_NEIGHBOURHOOD_OUTPUT : 0)
+                                   | (params.m_passInput ? SC_NEIGHBOURHOOD_INPUT : 0);
+  neighbourhoodParams.connector_type = *params.m_connectorType;
+  neighbourhoodParams.element_type = *params.m_elementType;
+  neighbourhoodParams.max_elements_count = (sc_uint32)params.m_maxElementsCount;
+  return neighbourhoodParams;
+}
+
+void CheckNeighbourhoodResult(sc_result result)
+{
+  switch (result)
+  {
+  case SC_RESULT_ERROR_ADDR_IS_NOT_VALID:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified sc-address is invalid to get neighbourhood");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to get neighbourhood due sc-memory context is not authorized");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to get neighbourhood due sc-memory context hasn't read permissions");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to add neighbourhood to sc-structure due sc-memory context hasn't write permissions");
+
+  default:
+    break;
+  }
+
+  if (result != SC_RESULT_OK)
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Not able to get neighbourhood");
+}
+
+sc_uint64 CalculateLatencyPercentile(sc_latency_histogram const & histogram, double percentile)
+{
+  sc_uint64 const bound = static_cast<sc_uint64>(std::ceil(histogram.count * percentile));
+  sc_uint64 count = 0;
+  for (size_t i = 0; i < SC_LATENCY_HISTOGRAM_BUCKETS_COUNT - 1; ++i)
+  {
+    count += histogram.buckets[i];
+    if (count >= bound)
+      return std::min(histogram.max_time, (sc_uint64(1) << i) - 1);
+  }
+
+  return histogram.max_time;
+}
+
+ScMemoryContext::ScLatencyHistogram ToLatencyHistogram(sc_latency_histogram const & histogram)
+{
+  return {
+      histogram.count,
+      histogram.count == 0 ? 0 : histogram.total_time / histogram.count,
+      histogram.max_time,
+      CalculateLatencyPercentile(histogram, 0.5),
+      CalculateLatencyPercentile(histogram, 0.99),
+      {std::begin(histogram.buckets), std::end(histogram.buckets)}};
+}
+
 }  // namespace
 
 // ------------------
 
 ScMemoryContext * ScMemory::ms_globalContext = nullptr;
+ScOrderedSetIndex * ScMemory::ms_orderedSetIndex = nullptr;
 std::string ScMemory::ms_configPath;
 
 bool ScMemory::Initialize(sc_memory_params const & params)
@@ -89,7 +159,10 @@ bool ScMemory::Initialize(sc_memory_params const & params)
       params.init_memory_generated_upload ? params.init_memory_generated_structure : (sc_char *)nullptr);
   ScAgentInit(true);
 
+  ms_orderedSetIndex = new ScOrderedSetIndex();
+
   utils::ScLog::SetUp(params.log_type, params.log_file, params.log_level);
+  utils::ScSlowOperationsLog::SetUp(params);
 
   return ms_globalContext != nullptr;
 }
@@ -102,6 +175,10 @@ bool ScMemory::IsInitialized()
 bool ScMemory::Shutdown(bool saveState /* = true */)
 {
   utils::ScLog::SetUp("Console", "", "Info");
+  utils::ScSlowOperationsLog::Shutdown();
+
+  delete ms_orderedSetIndex;
+  ms_orderedSetIndex = nullptr;
 
   ScKeynodes::Shutdown();
 
@@ -580,6 +657,72 @@ bool ScMemoryContext::GetEdgeInfo(ScAddr const & edgeAddr, ScAddr & outSourceAdd
   return true;
 }
 
+std::vector<ScMemoryContext::ScElementInfo> ScMemoryContext::GetElementsInfo(ScAddrVector const & addrs) const
+{
+  CHECK_CONTEXT;
+
+  std::vector<sc_addr> elementAddrs;
+  elementAddrs.reserve(addrs.size());
+  for (ScAddr const & addr : addrs)
+    elementAddrs.push_back(*addr);
+
+  std::vector<sc_element_info> elementInfos(addrs.size());
+  sc_result const result =
+      sc_memory_get_elements_info(m_context, elementAddrs.data(), (sc_uint32)addrs.size(), elementInfos.data());
+
+  if (result == SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to get sc-elements info due sc-memory context is not authorized");
+
+  std::vector<ScElementInfo> infos;
+  infos.reserve(elementInfos.size());
+  for (sc_element_info const & info : elementInfos)
+  {
+    infos.push_back(
+        {info.result == SC_RESULT_OK,
+         ScType{info.type},
+         ScAddr{info.begin_addr},
+         ScAddr{info.end_addr},
+         info.output_arcs_count,
+         info.input_arcs_count});
+  }
+
+  return infos;
+}
+
+ScAddrVector ScMemoryContext::GetNeighbourhood(ScAddr const & rootAddr, ScNeighbourhoodParams const & params) const
+{
+  CHECK_CONTEXT;
+
+  sc_neighbourhood_params const neighbourhoodParams = ToNeighbourhoodParams(params);
+  sc_addr * addrs;
+  sc_uint32 count;
+  CheckNeighbourhoodResult(sc_memory_get_neighbourhood(m_context, *rootAddr, &neighbourhoodParams, &addrs, &count));
+
+  ScAddrVector neighbourhood;
+  neighbourhood.reserve(count);
+  for (sc_uint32 i = 0; i < count; ++i)
+    neighbourhood.emplace_back(addrs[i]);
+  sc_mem_free(addrs);
+
+  return neighbourhood;
+}
+
+size_t ScMemoryContext::AddNeighbourhoodToStructure(
+    ScAddr const & rootAddr,
+    ScAddr const & structureAddr,
+    ScNeighbourhoodParams const & params)
+{
+  CHECK_CONTEXT;
+
+  sc_neighbourhood_params const neighbourhoodParams = ToNeighbourhoodParams(params);
+  sc_uint32 addedCount;
+  CheckNeighbourhoodResult(sc_memory_add_neighbourhood_to_structure(
+      m_context, *rootAddr, &neighbourhoodParams, *structureAddr, &addedCount));
+
+  return addedCount;
+}
+
 bool ScMemoryContext::SetLinkContent(ScAddr const & addr, ScStreamPtr const & stream, bool isSearchableString)
 {
   CHECK_CONTEXT;
@@ -746,6 +889,37 @@ ScAddrVector ScMemoryContext::FindLinksByContentSubstring(ScStreamPtr const & st
   return linkAddrList;
 }
 
+size_t ScMemoryContext::EstimateLinksByContent(ScStreamPtr const & stream, bool isSubstring)
+{
+  CHECK_CONTEXT;
+
+  if (!stream || !stream->IsValid())
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified stream is invalid to estimate sc-links by content");
+
+  sc_uint64 count = 0;
+  sc_result const result = sc_memory_estimate_links_by_content(m_context, stream->m_stream, isSubstring, &count);
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_STREAM_IO:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams, "Specified sc-stream data is invalid to estimate sc-links by content");
+
+  case SC_RESULT_ERROR_FILE_MEMORY_IO:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "File memory state is invalid to estimate sc-links by content");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to estimate sc-links by content due sc-memory context is not authorized");
+
+  default:
+    break;
+  }
+
+  return count;
+}
+
 void _PushLinkContent(void * data, sc_addr const link_addr, sc_char const * link_content)
 {
   SC_UNUSED(link_addr);
@@ -1015,6 +1189,70 @@ bool ScMemoryContext::HelperFindBySystemIdtf(std::string const & sysIdtf, ScSyst
   return result == SC_RESULT_OK;
 }
 
+bool ScMemoryContext::HelperIndexOrderedSet(ScAddr const & setAddr)
+{
+  CHECK_CONTEXT;
+
+  if (!IsElement(setAddr))
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified sc-set sc-address is invalid to index it");
+
+  if (ScMemory::ms_orderedSetIndex == nullptr)
+    return false;
+
+  return ScMemory::ms_orderedSetIndex->AddSet(*this, setAddr);
+}
+
+bool ScMemoryContext::HelperUnindexOrderedSet(ScAddr const & setAddr)
+{
+  CHECK_CONTEXT;
+
+  if (ScMemory::ms_orderedSetIndex == nullptr)
+    return false;
+
+  return ScMemory::ms_orderedSetIndex->RemoveSet(setAddr);
+}
+
+ScAddr ScMemoryContext::HelperGetOrderedSetElement(ScAddr const & setAddr, size_t position)
+{
+  CHECK_CONTEXT;
+
+  if (!setAddr.IsValid())
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified sc-set sc-address is invalid to find its element");
+
+  if (ScMemory::ms_orderedSetIndex == nullptr)
+  {
+    ScOrderedSetIndex::ScOrderedSetItem item;
+    ScOrderedSetIndex::FindItem(*this, setAddr, position, item);
+    return item.m_elementAddr;
+  }
+
+  return ScMemory::ms_orderedSetIndex->GetElement(*this, setAddr, position);
+}
+
+ScAddr ScMemoryContext::HelperGetNextOrderedSetElement(ScAddr const & setAddr, ScAddr const & elementAddr)
+{
+  CHECK_CONTEXT;
+
+  if (!setAddr.IsValid())
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified sc-set sc-address is invalid to find its element");
+
+  if (!elementAddr.IsValid())
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams, "Specified sc-element sc-address is invalid to find next element after it");
+
+  if (ScMemory::ms_orderedSetIndex == nullptr)
+  {
+    ScAddr accessArcAddr;
+    ScOrderedSetIndex::ScOrderedSetLink link;
+    if (!ScOrderedSetIndex::FindLink(*this, setAddr, elementAddr, accessArcAddr, link))
+      return ScAddr::Empty;
+
+    return ScOrderedSetIndex::GetLinkNextElement(*this, link);
+  }
+
+  return ScMemory::ms_orderedSetIndex->GetNextElement(*this, setAddr, elementAddr);
+}
+
 ScTemplate::Result ScMemoryContext::HelperGenTemplate(
     ScTemplate const & templ,
     ScTemplateResultItem & result,
@@ -1124,4 +1362,293 @@ ScMemoryContext::ScMemoryStatistics ScMemoryContext::CalculateStat() const
   return res;
 }
 
+std::vector<ScMemoryContext::ScMemoryAllocations> ScMemoryContext::CalculateAllocationsStat() const
+{
+  CHECK_CONTEXT;
+
+  sc_allocations_stat stat;
+  sc_result const result = sc_memory_get_allocations_stat(m_context, &stat);
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get sc-memory allocations statistics due sc-memory context is not authorized");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get sc-memory allocations statistics due sc-memory context hasn't read permissions");
+
+  default:
+    break;
+  }
+
+  std::vector<ScMemoryAllocations> allocations;
+  allocations.reserve(SC_ALLOCATIONS_SUBSYSTEMS_COUNT);
+  for (sc_uint32 i = 0; i < SC_ALLOCATIONS_SUBSYSTEMS_COUNT; ++i)
+  {
+    auto const subsystem = static_cast<sc_allocations_subsystem>(i);
+    allocations.push_back(
+        {sc_mem_get_allocations_subsystem_name(subsystem), stat.live_bytes[i], stat.live_objects[i]});
+  }
+
+  return allocations;
+}
+
+ScMemoryContext::ScEventsQueueStat ScMemoryContext::CalculateEventsQueueStat() const
+{
+  CHECK_CONTEXT;
+
+  sc_events_queue_stat stat;
+  sc_result const result = sc_memory_get_events_queue_stat(m_context, &stat);
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get sc-events queue statistics due sc-memory context is not authorized");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get sc-events queue statistics due sc-memory context hasn't read permissions");
+
+  default:
+    break;
+  }
+
+  return {
+      stat.size,
+      stat.max_size,
+      stat.processed_count,
+      stat.blocked_count,
+      stat.spilled_count,
+      stat.dropped_count,
+      stat.processed_count == 0 ? 0 : stat.total_wait_time / stat.processed_count,
+      stat.max_wait_time};
+}
+
+std::vector<ScMemoryContext::ScEventsLatencyStat> ScMemoryContext::CalculateEventsLatencyStat() const
+{
+  CHECK_CONTEXT;
+
+  sc_events_latency_stat * stats = nullptr;
+  sc_uint32 count = 0;
+  sc_result const result = sc_memory_get_events_latency_stat(m_context, &stats, &count);
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get sc-events latency statistics due sc-memory context is not authorized");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get sc-events latency statistics due sc-memory context hasn't read permissions");
+
+  default:
+    break;
+  }
+
+  std::vector<ScEventsLatencyStat> latencies;
+  latencies.reserve(count);
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    sc_events_latency_stat const & stat = stats[i];
+    // C++ sc-event types and priority classes are equal to C ones
+    latencies.push_back(
+        {static_cast<ScEvent::Type>(stat.event_type),
+         static_cast<ScEvent::Priority>(stat.priority),
+         ToLatencyHistogram(stat.phases[SC_EVENT_LATENCY_PENDING]),
+         ToLatencyHistogram(stat.phases[SC_EVENT_LATENCY_QUEUED]),
+         ToLatencyHistogram(stat.phases[SC_EVENT_LATENCY_PROCESSING]),
+         ToLatencyHistogram(stat.phases[SC_EVENT_LATENCY_TOTAL])});
+  }
+  sc_mem_free(stats);
+
+  return latencies;
+}
+
+ScMemoryContext::ScEventsWorkersStat ScMemoryContext::CalculateEventsWorkersStat() const
+{
+  CHECK_CONTEXT;
+
+  sc_events_workers_stat stat;
+  sc_result const result = sc_memory_get_events_workers_stat(m_context, &stat);
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get sc-events workers statistics due sc-memory context is not authorized");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get sc-events workers statistics due sc-memory context hasn't read permissions");
+
+  default:
+    break;
+  }
+
+  double const workersTime = double(stat.uptime) * stat.max_workers_count;
+  return {
+      stat.max_workers_count,
+      stat.busy_workers_count,
+      stat.max_busy_workers_count,
+      stat.busy_time,
+      workersTime == 0 ? 0 : std::min(1.0, stat.busy_time / workersTime)};
+}
+
+std::vector<ScMemoryContext::ScMonitorContention> ScMemoryContext::CalculateMonitorsContentionStat(size_t maxCount) const
+{
+  CHECK_CONTEXT;
+
+  sc_monitor_contention_stat * stats = nullptr;
+  sc_uint32 count = 0;
+  sc_result const result =
+      sc_memory_get_monitors_contention_stat(m_context, static_cast<sc_uint32>(maxCount), &stats, &count);
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get sc-element monitors contention statistics due sc-memory context is not authorized");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get sc-element monitors contention statistics due sc-memory context hasn't read permissions");
+
+  default:
+    break;
+  }
+
+  std::vector<ScMonitorContention> contentions;
+  contentions.reserve(count);
+  for (sc_uint32 i = 0; i < count; ++i)
+  {
+    sc_monitor_contention_stat const & stat = stats[i];
+    ScAddr const addr{stat.addr};
+    // sc-element could be erased after its monitor was sampled
+    std::string systemIdtf;
+    ScAddr idtfLinkAddr;
+    sc_stream * stream = nullptr;
+    if (sc_helper_get_system_identifier_link(m_context, stat.addr, &idtfLinkAddr.m_realAddr) == SC_RESULT_OK
+        && sc_memory_get_link_content(m_context, *idtfLinkAddr, &stream) == SC_RESULT_OK)
+      ScStreamConverter::StreamToString(std::make_shared<ScStream>(stream), systemIdtf);
+    contentions.push_back(
+        {addr, systemIdtf, stat.contended_count, stat.total_wait_time, stat.max_wait_time, stat.max_waiters_count});
+  }
+  sc_mem_free(stats);
+
+  return contentions;
+}
+
+void ScMemoryContext::SetMonitorsContentionSamplingPeriod(sc_uint32 samplingPeriod)
+{
+  CHECK_CONTEXT;
+
+  sc_result const result = sc_memory_set_monitors_contention_sampling_period(m_context, samplingPeriod);
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to set sc-element monitors contention sampling period due sc-memory context is not authorized");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to set sc-element monitors contention sampling period due sc-memory context hasn't write "
+        "permissions");
+
+  default:
+    break;
+  }
+}
+
+std::vector<utils::ScSlowOperationsLog::Entry> ScMemoryContext::GetSlowOperations() const
+{
+  CHECK_CONTEXT;
+
+  auto * manager = (sc_memory_context_manager *)sc_memory_get_context_manager();
+  if (_sc_memory_context_is_authenticated(manager, m_context) == SC_FALSE)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to get slow operations due sc-memory context is not authorized");
+
+  if (_sc_memory_context_check_global_permissions(manager, m_context, SC_CONTEXT_PERMISSIONS_READ) == SC_FALSE)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to get slow operations due sc-memory context hasn't read permissions");
+
+  return utils::ScSlowOperationsLog::GetEntries();
+}
+
+ScAddrVector ScMemoryContext::FindElementsByType(ScType const & type) const
+{
+  CHECK_CONTEXT;
+
+  ScAddrVector addrList;
+  void ** data = _MAKE_DATA(&*m_context, &addrList);
+  sc_result const result = sc_memory_find_elements_by_type_ext(m_context, *type, data, _PushLinkAddr);
+  _ERASE_DATA(data);
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_INVALID_TYPE:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified type is invalid to find sc-elements by it");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to find sc-elements by type due sc-memory context is not authorized");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to find sc-elements by type due sc-memory context hasn't read permissions");
+
+  default:
+    break;
+  }
+
+  return addrList;
+}
+
+size_t ScMemoryContext::GetElementsCountByType(ScType const & type) const
+{
+  CHECK_CONTEXT;
+
+  sc_uint64 count = 0;
+  sc_result const result = sc_memory_get_elements_count_by_type(m_context, *type, &count);
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_INVALID_TYPE:
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Specified type is invalid to count sc-elements by it");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to count sc-elements by type due sc-memory context is not authorized");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to count sc-elements by type due sc-memory context hasn't read permissions");
+
+  default:
+    break;
+  }
+
+  return count;
+}
+
 SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_END
@@ -25,7 +25,10 @@ extern "C"
 #include "sc_template.hpp"
 #include "sc_type.hpp"
 
+#include "utils/sc_slow_operations_log.hpp"
+
 class ScMemoryContext;
+class ScOrderedSetIndex;
 
 typedef struct
 {
@@ -82,6 +85,9 @@ public:
   _SC_EXTERN static void LogUnmute();
 
   static ScMemoryContext * ms_globalContext;
+
+protected:
+  static ScOrderedSetIndex * ms_orderedSetIndex;
 };
 
 //! Class used to work with memory. It provides functions to create/retrieve/erase sc-elements
@@ -100,6 +106,108 @@ public:
     }
   };
 
+  struct ScMemoryAllocations
+  {
+    std::string m_subsystem;
+    sc_uint64 m_liveBytes;
+    sc_uint64 m_liveObjects;
+  };
+
+  struct ScEventsQueueStat
+  {
+    //! Amount of emitted sc-events waiting for processing now and maximum of it
+    sc_uint64 m_size;
+    sc_uint64 m_maxSize;
+    sc_uint64 m_processedCount;
+    //! Amounts of sc-events emitted when queue was full and handled by overflow policy
+    sc_uint64 m_blockedCount;
+    sc_uint64 m_spilledCount;
+    sc_uint64 m_droppedCount;
+    //! Time in microseconds that processed sc-events waited in queue
+    sc_uint64 m_averageWaitTime;
+    sc_uint64 m_maxWaitTime;
+  };
+
+  struct ScMonitorContention
+  {
+    ScAddr m_addr;
+    //! System identifier of sc-element, it is empty if sc-element hasn't it
+    std::string m_systemIdtf;
+    //! Amount of sampled acquisitions of sc-element monitor which waited for other threads
+    sc_uint64 m_contendedCount;
+    //! Time in microseconds that sampled acquisitions waited
+    sc_uint64 m_totalWaitTime;
+    sc_uint64 m_maxWaitTime;
+    //! Maximum amount of requests queued before sampled acquisition
+    sc_uint32 m_maxWaitersCount;
+  };
+
+  struct ScLatencyHistogram
+  {
+    sc_uint64 m_count;
+    //! Latencies in microseconds
+    sc_uint64 m_averageTime;
+    sc_uint64 m_maxTime;
+    //! Upper bounds of 50% and 99% of latencies, they are estimated by histogram buckets
+    sc_uint64 m_medianTime;
+    sc_uint64 m_percentile99Time;
+    //! i-th bucket counts latencies from 2^(i-1) to 2^i - 1 microseconds, the last bucket counts all greater latencies
+    std::vector<sc_uint64> m_buckets;
+  };
+
+  struct ScEventsLatencyStat
+  {
+    ScEvent::Type m_eventType;
+    //! Priority class of sc-event subscriptions
+    ScEvent::Priority m_priority;
+    //! From emission to queueing, it includes pending of sc-events and waiting for free space in queue
+    ScLatencyHistogram m_pending;
+    //! From queueing to start of processing by worker
+    ScLatencyHistogram m_queued;
+    ScLatencyHistogram m_processing;
+    //! From emission to completion of processing
+    ScLatencyHistogram m_total;
+  };
+
+  struct ScEventsWorkersStat
+  {
+    //! Amounts of threads processing sc-events
+    sc_uint32 m_maxWorkersCount;
+    sc_uint32 m_busyWorkersCount;
+    sc_uint32 m_maxBusyWorkersCount;
+    //! Time in microseconds that threads processed sc-events
+    sc_uint64 m_busyTime;
+    //! Part of time that threads were busy since they were started, from 0 to 1
+    double m_utilization;
+  };
+
+  struct ScElementInfo
+  {
+    //! Flag that is set if sc-element exists and context has read permissions for it
+    bool m_isValid;
+    ScType m_type;
+    //! Source and target sc-elements, they are empty if sc-element isn't sc-connector
+    ScAddr m_sourceAddr;
+    ScAddr m_targetAddr;
+    size_t m_outputArcsCount;
+    size_t m_inputArcsCount;
+  };
+
+  struct ScNeighbourhoodParams
+  {
+    //! Maximum amount of sc-connectors between root and found sc-elements
+    size_t m_depth;
+    //! Flags to pass outgoing and incoming sc-connectors of found sc-elements
+    bool m_passOutput;
+    bool m_passInput;
+    //! Types of passed sc-connectors and reached sc-elements, unknown type matches any type
+    ScType m_connectorType;
+    ScType m_elementType;
+    //! Maximum amount of found sc-elements, 0 for no limit. Sc-connectors are found with their incident sc-elements
+    //! only, so neighbourhood is truncated by whole triples and can contain fewer sc-elements
+    size_t m_maxElementsCount;
+  };
+
 public:
   SC_DEPRECATED(
       0.10.0,
@@ -407,6 +515,70 @@ public:
   _SC_EXTERN bool GetEdgeInfo(ScAddr const & edgeAddr, ScAddr & outSourceAddr, ScAddr & outTargetAddr) const
       noexcept(false);
 
+  /*!
+   * @brief Returns types, incident sc-elements and sc-connectors counts of sc-elements in one call.
+   *
+   * This method reads metadata of all specified sc-elements at once. It is faster than calling `GetElementType`,
+   * `GetEdgeInfo` and `GetElementOutputArcsCount` for each sc-element, because sc-elements are grouped by segment
+   * and permissions are checked once per batch if possible.
+   *
+   * @param addrs The vector of sc-addresses of sc-elements.
+   * @return Returns the vector of metadata of sc-elements in the order of `addrs`. Metadata of sc-element is invalid
+   * if sc-element doesn't exist or the sc-memory context has not read permissions for it.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated.
+   *
+   * @code
+   * ScMemoryContext ctx;
+   * ScAddr const & nodeAddr = ctx.CreateNode(ScType::NodeConst);
+   * ScAddr const & edgeAddr = ctx.CreateEdge(ScType::EdgeAccessConstPosPerm, nodeAddr, nodeAddr);
+   * std::vector<ScMemoryContext::ScElementInfo> const & infos = ctx.GetElementsInfo({nodeAddr, edgeAddr});
+   * // infos[1].m_sourceAddr == nodeAddr
+   * @endcode
+   */
+  _SC_EXTERN std::vector<ScElementInfo> GetElementsInfo(ScAddrVector const & addrs) const noexcept(false);
+
+  /*!
+   * @brief Returns sc-elements within bounded amount of sc-connectors from the specified sc-element.
+   *
+   * This method expands neighbourhood breadth-first inside sc-storage. It is faster than nested iterators with
+   * deduplication of found sc-elements, because each found sc-element is expanded under one lock and permissions
+   * are checked once if the sc-memory context has no local permissions.
+   *
+   * @param rootAddr The sc-address of root sc-element.
+   * @param params Depth, directions and type filters of expansion.
+   * @return Returns the vector of found sc-elements, including root sc-element and found sc-connectors, in order of
+   * their distance from root sc-element.
+   * @throws ExceptionInvalidParams if the specified root sc-address is invalid.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated or has not read permissions.
+   *
+   * @code
+   * ScMemoryContext ctx;
+   * ScAddrVector const & addrs = ctx.GetNeighbourhood(
+   *     classAddr, {2, true, false, ScType::EdgeAccessConstPosPerm, ScType::Unknown, 0});
+   * @endcode
+   */
+  _SC_EXTERN ScAddrVector GetNeighbourhood(ScAddr const & rootAddr, ScNeighbourhoodParams const & params) const
+      noexcept(false);
+
+  /*!
+   * @brief Adds sc-elements within bounded amount of sc-connectors from the specified sc-element to sc-structure.
+   *
+   * This method finds neighbourhood as `GetNeighbourhood` does and generates sc-arcs from sc-structure to found
+   * sc-elements that aren't its elements yet.
+   *
+   * @param rootAddr The sc-address of root sc-element.
+   * @param structureAddr The sc-address of sc-structure.
+   * @param params Depth, directions and type filters of expansion.
+   * @return Returns amount of sc-elements added to sc-structure.
+   * @throws ExceptionInvalidParams if the specified root or sc-structure sc-address is invalid.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated or has not read or write
+   * permissions.
+   */
+  _SC_EXTERN size_t AddNeighbourhoodToStructure(
+      ScAddr const & rootAddr,
+      ScAddr const & structureAddr,
+      ScNeighbourhoodParams const & params) noexcept(false);
+
   /*!
    * @brief Sets the content of an sc-link with a stream.
    *
@@ -638,6 +810,21 @@ public:
   _SC_EXTERN ScAddrVector
   FindLinksByContentSubstring(ScStreamPtr const & stream, size_t maxLengthToSearchAsPrefix = 0) noexcept(false);
 
+  /*!
+   * @brief Estimates amount of sc-links found by content or content substring without search.
+   *
+   * Sc-links of candidate contents are counted by file memory indexes, contents aren't read and compared, so returned
+   * amount is not less than amount of sc-links found by FindLinksByContent or by prefix of content.
+   *
+   * @param stream The stream to use for content matching.
+   * @param isSubstring Whether sc-links are searched by content substring.
+   * @return Returns upper bound of amount of found sc-links.
+   * @throws ExceptionInvalidParams if the specified stream is invalid.
+   * @throws ExceptionInvalidState if the file memory state is invalid.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated.
+   */
+  _SC_EXTERN size_t EstimateLinksByContent(ScStreamPtr const & stream, bool isSubstring = false) noexcept(false);
+
   /*!
    * @brief Finds sc-links contents by content substring using a stream.
    *
@@ -993,6 +1180,75 @@ public:
       std::string const & sysIdtf,
       ScSystemIdentifierQuintuple & outQuintuple) noexcept(false);
 
+  /*!
+   * @brief Builds positional index for the specified ordered sc-set.
+   *
+   * Elements of an ordered sc-set are connected with it by sc-arcs with type `ScType::EdgeAccessConstPosPerm`. Their
+   * positions are specified by role relations `rrel_1`, `rrel_2`, ... and their order is specified by relation
+   * `nrel_basic_sequence` between these sc-arcs. The index maps positions to elements and elements to next elements,
+   * so HelperGetOrderedSetElement and HelperGetNextOrderedSetElement take constant time for indexed sc-sets. Only the
+   * indexed sc-set is subscribed to, found elements are verified and missing ones are searched by iterators, so the
+   * index should be used for sc-sets that are read often, for example, long lists and sc-sets of action arguments.
+   *
+   * @param setAddr A sc-address of sc-set to index.
+   * @return Returns true if the sc-set is indexed; otherwise, returns false if it has been indexed before.
+   * @throws ExceptionInvalidParams if the specified sc-address is invalid.
+   *
+   * @code
+   * ScMemoryContext ctx;
+   * ScAddr const & setAddr = ctx.CreateNode(ScType::NodeConst);
+   * ctx.HelperIndexOrderedSet(setAddr);
+   * @endcode
+   */
+  _SC_EXTERN bool HelperIndexOrderedSet(ScAddr const & setAddr) noexcept(false);
+
+  /*!
+   * @brief Removes positional index of the specified ordered sc-set.
+   *
+   * @param setAddr A sc-address of indexed sc-set.
+   * @return Returns true if index of the sc-set is removed; otherwise, returns false if the sc-set isn't indexed.
+   */
+  _SC_EXTERN bool HelperUnindexOrderedSet(ScAddr const & setAddr) noexcept(false);
+
+  /*!
+   * @brief Finds element of ordered sc-set with the specified position.
+   *
+   * The element is connected with the sc-set by sc-arc with type `ScType::EdgeAccessConstPosPerm` that belongs to role
+   * relation `rrel_<position>`. Not indexed sc-sets are searched by iterators.
+   *
+   * @param setAddr A sc-address of ordered sc-set.
+   * @param position A position of element starting from 1.
+   * @return Returns sc-address of found element; otherwise, returns empty sc-address.
+   * @throws ExceptionInvalidParams if the specified sc-address is invalid.
+   *
+   * @code
+   * ScMemoryContext ctx;
+   * ScAddr const & firstElementAddr = ctx.HelperGetOrderedSetElement(setAddr, 1);
+   * @endcode
+   */
+  _SC_EXTERN ScAddr HelperGetOrderedSetElement(ScAddr const & setAddr, size_t position) noexcept(false);
+
+  /*!
+   * @brief Finds element of ordered sc-set that follows the specified element.
+   *
+   * The next element is found by relation `nrel_basic_sequence` between sc-arcs from the sc-set to elements. Not
+   * indexed sc-sets are searched by iterators.
+   *
+   * @param setAddr A sc-address of ordered sc-set.
+   * @param elementAddr A sc-address of element of the sc-set.
+   * @return Returns sc-address of the next element; otherwise, returns empty sc-address.
+   * @throws ExceptionInvalidParams if the specified sc-addresses are invalid.
+   *
+   * @code
+   * ScMemoryContext ctx;
+   * ScAddr elementAddr = ctx.HelperGetOrderedSetElement(setAddr, 1);
+   * while (elementAddr.IsValid())
+   *   elementAddr = ctx.HelperGetNextOrderedSetElement(setAddr, elementAddr);
+   * @endcode
+   */
+  _SC_EXTERN ScAddr HelperGetNextOrderedSetElement(ScAddr const & setAddr, ScAddr const & elementAddr) noexcept(
+      false);
+
   /*!
    * Generates sc-constructions by isomorphic sc-template and accumulates generated sc-construction into `result`.
    * @param templ A sc-template object to find constructions by it.
@@ -1218,6 +1474,138 @@ public:
    */
   _SC_EXTERN ScMemoryStatistics CalculateStat() const;
 
+  /*! Calculate live allocations of sc-memory subsystems
+   *
+   * @return Returns names of sc-memory subsystems with counts of bytes and objects allocated by them and not freed
+   * yet. Subsystems are listed in the order of `sc_allocations_subsystem` values.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated or has not read permissions.
+   *
+   * @code
+   * ScMemoryContext ctx;
+   * for (auto const & allocations : ctx.CalculateAllocationsStat())
+   *   SC_LOG_INFO(allocations.m_subsystem << ": " << allocations.m_liveBytes << " bytes");
+   * @endcode
+   */
+  _SC_EXTERN std::vector<ScMemoryAllocations> CalculateAllocationsStat() const;
+
+  /*!
+   * @brief Calculates state of the queue of emitted sc-events.
+   *
+   * Queue size is limited by `max_events_queue_size` sc-memory param, sc-events emitted when it is full are handled by
+   * `events_queue_overflow_policy` sc-memory param.
+   *
+   * @return Returns queue depth, amounts of processed, blocked, spilled and dropped sc-events and their wait times.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated or has not read permissions.
+   *
+   * @code
+   * ScMemoryContext ctx;
+   * ScMemoryContext::ScEventsQueueStat const & stat = ctx.CalculateEventsQueueStat();
+   * SC_LOG_INFO("Waiting sc-events: " << stat.m_size << ", dropped sc-events: " << stat.m_droppedCount);
+   * @endcode
+   */
+  _SC_EXTERN ScEventsQueueStat CalculateEventsQueueStat() const;
+
+  /*!
+   * @brief Calculates latencies of processed sc-events by their types and priority classes of their subscriptions.
+   *
+   * Latencies are measured from emission to queueing, from queueing to start of processing, for processing itself and
+   * for the whole delivery. Large queueing latencies with short processing ones mean that threads processing sc-events
+   * are saturated, otherwise sc-event subscribers are slow.
+   *
+   * @return Returns latency histograms of sc-event types and priority classes with processed sc-events.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated or has not read permissions.
+   *
+   * @code
+   * ScMemoryContext ctx;
+   * for (auto const & stat : ctx.CalculateEventsLatencyStat())
+   *   SC_LOG_INFO("Queued: " << stat.m_queued.m_percentile99Time << " us, processing: "
+   *               << stat.m_processing.m_percentile99Time << " us");
+   * @endcode
+   */
+  _SC_EXTERN std::vector<ScEventsLatencyStat> CalculateEventsLatencyStat() const;
+
+  /*!
+   * @brief Calculates utilization of threads processing emitted sc-events.
+   *
+   * @return Returns maximum amount of threads, amounts of busy threads and time they were busy.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated or has not read permissions.
+   */
+  _SC_EXTERN ScEventsWorkersStat CalculateEventsWorkersStat() const;
+
+  /*!
+   * @brief Calculates the most contended monitors of sc-elements.
+   *
+   * Acquisitions of sc-element monitors which wait for other threads are sampled with period specified by
+   * `monitors_contention_sampling_period` sc-memory param or `SetMonitorsContentionSamplingPeriod`.
+   *
+   * @param maxCount Maximum amount of sc-elements to calculate.
+   * @return Returns sc-elements with their system identifiers and wait statistics ordered by total wait time
+   * descending.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated or has not read permissions.
+   *
+   * @code
+   * ScMemoryContext ctx;
+   * for (auto const & contention : ctx.CalculateMonitorsContentionStat(10))
+   *   SC_LOG_INFO(contention.m_systemIdtf << ": " << contention.m_totalWaitTime << " us");
+   * @endcode
+   */
+  _SC_EXTERN std::vector<ScMonitorContention> CalculateMonitorsContentionStat(size_t maxCount) const noexcept(false);
+
+  /*!
+   * @brief Sets period of sampling acquisitions of sc-element monitors which wait for other threads.
+   *
+   * Statistics calculated before are cleared.
+   *
+   * @param samplingPeriod Every `samplingPeriod`-th contended acquisition is sampled, 0 disables sampling.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated or has not write permissions.
+   */
+  _SC_EXTERN void SetMonitorsContentionSamplingPeriod(sc_uint32 samplingPeriod) noexcept(false);
+
+  /*!
+   * @brief Gets the last operations lasting longer than thresholds specified by sc-memory params.
+   *
+   * Descriptions of operations contain sc-templates and arguments of actions, so they are read only by sc-memory
+   * contexts having read permissions.
+   *
+   * @return Returns the last slow operations from the oldest to the newest one.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated or has not read permissions.
+   */
+  _SC_EXTERN std::vector<utils::ScSlowOperationsLog::Entry> GetSlowOperations() const noexcept(false);
+
+  /*!
+   * @brief Finds all sc-elements of the specified type.
+   *
+   * This method enumerates sc-elements through per-segment registries of sc-nodes, sc-links and sc-connectors.
+   * An sc-element is found if its type contains all subtypes of the specified type. Read permissions are checked
+   * once if the context has no local permissions, otherwise they are checked for each sc-element, and sc-elements
+   * which the context can't read aren't included in the result.
+   *
+   * @param type The type of sc-elements to find. Use ScType::Unknown to find all sc-elements.
+   * @return Returns a vector of sc-addresses of found sc-elements.
+   * @throws ExceptionInvalidParams if the specified type has invalid element class.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated or has not read permissions.
+   *
+   * @code
+   * ScMemoryContext ctx;
+   * ScAddrVector const & structures = ctx.FindElementsByType(ScType::NodeConstStruct);
+   * @endcode
+   */
+  _SC_EXTERN ScAddrVector FindElementsByType(ScType const & type) const noexcept(false);
+
+  /*!
+   * @brief Gets count of sc-elements of the specified type.
+   *
+   * Counts of all sc-elements, sc-nodes, sc-links and sc-connectors are got from registry counters without
+   * traversal of sc-elements, if the context has no local permissions. Otherwise, sc-elements which the context can't
+   * read aren't counted.
+   *
+   * @param type The type of sc-elements to count.
+   * @return Returns count of sc-elements of the specified type.
+   * @throws ExceptionInvalidParams if the specified type has invalid element class.
+   * @throws ExceptionInvalidState if the sc-memory context is not authenticated or has not read permissions.
+   */
+  _SC_EXTERN size_t GetElementsCountByType(ScType const & type) const noexcept(false);
+
 protected:
   friend class ScMemory;
   friend class ScAgent;
@@ -0,0 +1,400 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_ordered_set_index.hpp"
+
+#include "sc_memory.hpp"
+#include "sc_keynodes.hpp"
+
+#include <list>
+#include <mutex>
+
+namespace
+{
+std::string const kRoleRelationPrefix = "rrel_";
+}  // namespace
+
+ScOrderedSetIndex::ScOrderedSetIndex()
+  : m_context(std::make_unique<ScMemoryContext>())
+{
+}
+
+ScOrderedSetIndex::~ScOrderedSetIndex()
+{
+  // sc-events must be destroyed without lock, because their callbacks lock index, and before context used by them
+  std::list<std::unique_ptr<ScEventRemoveOutputEdge>> events;
+  {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    for (auto & set : m_sets)
+      events.push_back(std::move(set.second.m_accessArcRemovedEvent));
+  }
+  events.clear();
+
+  m_sets.clear();
+  m_context.reset();
+}
+
+bool ScOrderedSetIndex::AddSet(ScMemoryContext & ctx, ScAddr const & setAddr)
+{
+  std::list<std::pair<size_t, ScOrderedSetItem>> items;
+  std::list<std::pair<ScAddr, ScOrderedSetLink>> links;
+
+  ScIterator3Ptr const accessArcsIt = ctx.Iterator3(setAddr, ScType::EdgeAccessConstPosPerm, ScType::Unknown);
+  while (accessArcsIt->Next())
+  {
+    ScAddr const & accessArcAddr = accessArcsIt->Get(1);
+    ScAddr const & elementAddr = accessArcsIt->Get(2);
+
+    ScIterator3Ptr const roleArcsIt =
+        ctx.Iterator3(ScType::NodeConstRole, ScType::EdgeAccessConstPosPerm, accessArcAddr);
+    while (roleArcsIt->Next())
+    {
+      ScAddr const & roleAddr = roleArcsIt->Get(0);
+      size_t const position = GetRolePosition(ctx, roleAddr);
+      if (position == 0)
+        continue;
+
+      CacheRoleRelation(position, roleAddr);
+
+      items.push_back({position, {elementAddr, accessArcAddr, roleArcsIt->Get(1), roleAddr}});
+    }
+
+    ScIterator5Ptr const sequenceArcsIt = ctx.Iterator5(
+        accessArcAddr, ScType::Unknown, ScType::Unknown, ScType::Unknown, ScKeynodes::kNrelBasicSequence);
+    if (sequenceArcsIt->Next())
+      links.push_back({accessArcAddr, {sequenceArcsIt->Get(2), sequenceArcsIt->Get(1), sequenceArcsIt->Get(3)}});
+  }
+
+  std::unique_lock<std::shared_mutex> lock(m_mutex);
+  if (m_sets.find(setAddr) != m_sets.cend())
+    return false;
+
+  ScOrderedSet & indexedSet = m_sets[setAddr];
+  indexedSet.m_accessArcRemovedEvent = std::make_unique<ScEventRemoveOutputEdge>(
+      *m_context,
+      setAddr,
+      [this](ScAddr const & addr, ScAddr const & edgeAddr, ScAddr const & otherAddr)
+      {
+        return OnAccessArcRemoved(addr, edgeAddr, otherAddr);
+      });
+  for (auto const & item : items)
+    IndexItem(indexedSet, item.first, item.second);
+  for (auto const & link : links)
+    IndexLink(indexedSet, link.first, link.second);
+
+  return true;
+}
+
+bool ScOrderedSetIndex::RemoveSet(ScAddr const & setAddr)
+{
+  // sc-event is destroyed after lock is released, because its callback locks index
+  std::unique_ptr<ScEventRemoveOutputEdge> event;
+  std::unique_lock<std::shared_mutex> lock(m_mutex);
+
+  auto const it = m_sets.find(setAddr);
+  if (it == m_sets.cend())
+    return false;
+
+  event = std::move(it->second.m_accessArcRemovedEvent);
+  m_sets.erase(it);
+  return true;
+}
+
+bool ScOrderedSetIndex::HasSet(ScAddr const & setAddr) const
+{
+  std::shared_lock<std::shared_mutex> lock(m_mutex);
+  return m_sets.find(setAddr) != m_sets.cend();
+}
+
+ScAddr ScOrderedSetIndex::GetElement(ScMemoryContext & ctx, ScAddr const & setAddr, size_t position)
+{
+  {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+    auto const setIt = m_sets.find(setAddr);
+    if (setIt == m_sets.cend())
+    {
+      lock.unlock();
+
+      ScOrderedSetItem item;
+      FindItemByRole(ctx, setAddr, GetCachedRoleRelation(ctx, position), item);
+      return item.m_elementAddr;
+    }
+
+    auto const itemIt = setIt->second.m_positionsToItems.find(position);
+    if (itemIt != setIt->second.m_positionsToItems.cend() && IsValidItem(ctx, setAddr, itemIt->second))
+      return itemIt->second.m_elementAddr;
+  }
+
+  // index doesn't contain valid element yet, search it and repair index
+  ScOrderedSetItem item;
+  bool const isFound = FindItemByRole(ctx, setAddr, GetCachedRoleRelation(ctx, position), item);
+
+  std::unique_lock<std::shared_mutex> lock(m_mutex);
+  auto const setIt = m_sets.find(setAddr);
+  if (setIt != m_sets.cend())
+  {
+    if (isFound)
+      IndexItem(setIt->second, position, item);
+    else
+      setIt->second.m_positionsToItems.erase(position);
+  }
+
+  return item.m_elementAddr;
+}
+
+ScAddr ScOrderedSetIndex::GetNextElement(ScMemoryContext & ctx, ScAddr const & setAddr, ScAddr const & elementAddr)
+{
+  {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+
+    auto const setIt = m_sets.find(setAddr);
+    if (setIt == m_sets.cend())
+    {
+      lock.unlock();
+
+      ScAddr accessArcAddr;
+      ScOrderedSetLink link;
+      if (!FindLink(ctx, setAddr, elementAddr, accessArcAddr, link))
+        return ScAddr::Empty;
+
+      return GetLinkNextElement(ctx, link);
+    }
+
+    ScOrderedSet const & set = setIt->second;
+    auto const accessArcIt = set.m_elementsToAccessArcs.find(elementAddr);
+    if (accessArcIt != set.m_elementsToAccessArcs.cend()
+        && CheckArc(ctx, accessArcIt->second, setAddr, elementAddr))
+    {
+      auto const linkIt = set.m_accessArcsToLinks.find(accessArcIt->second);
+      if (linkIt != set.m_accessArcsToLinks.cend() && IsValidLink(ctx, accessArcIt->second, linkIt->second))
+        return GetLinkNextElement(ctx, linkIt->second);
+    }
+  }
+
+  // index doesn't contain valid link yet, search it and repair index
+  ScAddr accessArcAddr;
+  ScOrderedSetLink link;
+  bool const isFound = FindLink(ctx, setAddr, elementAddr, accessArcAddr, link);
+
+  std::unique_lock<std::shared_mutex> lock(m_mutex);
+  auto const setIt = m_sets.find(setAddr);
+  if (setIt != m_sets.cend())
+  {
+    if (isFound)
+    {
+      setIt->second.m_elementsToAccessArcs[elementAddr] = accessArcAddr;
+      IndexLink(setIt->second, accessArcAddr, link);
+    }
+    else
+      setIt->second.m_elementsToAccessArcs.erase(elementAddr);
+  }
+  lock.unlock();
+
+  return isFound ? GetLinkNextElement(ctx, link) : ScAddr::Empty;
+}
+
+bool ScOrderedSetIndex::FindItem(
+    ScMemoryContext & ctx,
+    ScAddr const & setAddr,
+    size_t position,
+    ScOrderedSetItem & item)
+{
+  return FindItemByRole(ctx, setAddr, GetRoleRelation(ctx, position), item);
+}
+
+bool ScOrderedSetIndex::FindItemByRole(
+    ScMemoryContext & ctx,
+    ScAddr const & setAddr,
+    ScAddr const & roleAddr,
+    ScOrderedSetItem & item)
+{
+  if (!roleAddr.IsValid())
+    return false;
+
+  ScIterator5Ptr const it5 = ctx.Iterator5(
+      setAddr, ScType::EdgeAccessConstPosPerm, ScType::Unknown, ScType::EdgeAccessConstPosPerm, roleAddr);
+  if (!it5->Next())
+    return false;
+
+  item = {it5->Get(2), it5->Get(1), it5->Get(3), roleAddr};
+  return true;
+}
+
+bool ScOrderedSetIndex::FindLink(
+    ScMemoryContext & ctx,
+    ScAddr const & setAddr,
+    ScAddr const & elementAddr,
+    ScAddr & accessArcAddr,
+    ScOrderedSetLink & link)
+{
+  return FindLink(ctx, setAddr, elementAddr, ScType::Unknown, ScType::Unknown, ScType::Unknown, accessArcAddr, link);
+}
+
+bool ScOrderedSetIndex::FindLink(
+    ScMemoryContext & ctx,
+    ScAddr const & setAddr,
+    ScAddr const & elementAddr,
+    ScType const & sequenceArcType,
+    ScType const & nextAccessArcType,
+    ScType const & relationArcType,
+    ScAddr & accessArcAddr,
+    ScOrderedSetLink & link)
+{
+  ScIterator3Ptr const it3 = ctx.Iterator3(setAddr, ScType::EdgeAccessConstPosPerm, elementAddr);
+  if (!it3->Next())
+    return false;
+
+  ScIterator5Ptr const it5 = ctx.Iterator5(
+      it3->Get(1), sequenceArcType, nextAccessArcType, relationArcType, ScKeynodes::kNrelBasicSequence);
+  if (!it5->Next())
+    return false;
+
+  accessArcAddr = it3->Get(1);
+  link = {it5->Get(2), it5->Get(1), it5->Get(3)};
+  return true;
+}
+
+ScAddr ScOrderedSetIndex::GetRoleRelation(ScMemoryContext & ctx, size_t position)
+{
+  if (position == 0)
+    return ScAddr::Empty;
+
+  if (position <= ScKeynodes::GetRrelIndexNum())
+    return ScKeynodes::GetRrelIndex(position - 1);
+
+  return ctx.HelperFindBySystemIdtf(kRoleRelationPrefix + std::to_string(position));
+}
+
+ScAddr ScOrderedSetIndex::GetCachedRoleRelation(ScMemoryContext & ctx, size_t position)
+{
+  if (position <= ScKeynodes::GetRrelIndexNum())
+    return GetRoleRelation(ctx, position);
+
+  {
+    std::lock_guard<std::mutex> lock(m_roleRelationsMutex);
+    auto const it = m_positionsToRoleRelations.find(position);
+    if (it != m_positionsToRoleRelations.cend() && ctx.IsElement(it->second))
+      return it->second;
+  }
+
+  ScAddr const & roleAddr = GetRoleRelation(ctx, position);
+  if (roleAddr.IsValid())
+    CacheRoleRelation(position, roleAddr);
+  return roleAddr;
+}
+
+void ScOrderedSetIndex::CacheRoleRelation(size_t position, ScAddr const & roleAddr)
+{
+  if (position <= ScKeynodes::GetRrelIndexNum())
+    return;
+
+  std::lock_guard<std::mutex> lock(m_roleRelationsMutex);
+  m_positionsToRoleRelations[position] = roleAddr;
+}
+
+ScAddr ScOrderedSetIndex::GetLinkNextElement(ScMemoryContext & ctx, ScOrderedSetLink const & link)
+{
+  ScAddr sourceAddr;
+  ScAddr targetAddr;
+  GetArcInfo(ctx, link.m_nextAccessArcAddr, sourceAddr, targetAddr);
+  return targetAddr;
+}
+
+bool ScOrderedSetIndex::OnAccessArcRemoved(
+    ScAddr const & setAddr,
+    ScAddr const & accessArcAddr,
+    ScAddr const & elementAddr)
+{
+  std::unique_lock<std::shared_mutex> lock(m_mutex);
+
+  auto const setIt = m_sets.find(setAddr);
+  if (setIt == m_sets.cend())
+    return true;
+
+  // items with removed access sc-arc aren't valid, they are replaced when their positions are searched
+  ScOrderedSet & set = setIt->second;
+  auto const accessArcIt = set.m_elementsToAccessArcs.find(elementAddr);
+  if (accessArcIt != set.m_elementsToAccessArcs.cend() && accessArcIt->second == accessArcAddr)
+    set.m_elementsToAccessArcs.erase(accessArcIt);
+  set.m_accessArcsToLinks.erase(accessArcAddr);
+
+  return true;
+}
+
+void ScOrderedSetIndex::IndexItem(ScOrderedSet & set, size_t position, ScOrderedSetItem const & item)
+{
+  set.m_positionsToItems[position] = item;
+  set.m_elementsToAccessArcs[item.m_elementAddr] = item.m_accessArcAddr;
+}
+
+void ScOrderedSetIndex::IndexLink(ScOrderedSet & set, ScAddr const & accessArcAddr, ScOrderedSetLink const & link)
+{
+  set.m_accessArcsToLinks[accessArcAddr] = link;
+}
+
+bool ScOrderedSetIndex::IsValidItem(ScMemoryContext & ctx, ScAddr const & setAddr, ScOrderedSetItem const & item)
+{
+  return CheckArc(ctx, item.m_roleArcAddr, item.m_roleAddr, item.m_accessArcAddr)
+         && CheckArc(ctx, item.m_accessArcAddr, setAddr, item.m_elementAddr);
+}
+
+bool ScOrderedSetIndex::IsValidLink(ScMemoryContext & ctx, ScAddr const & accessArcAddr, ScOrderedSetLink const & link)
+{
+  return CheckArc(ctx, link.m_relationArcAddr, ScKeynodes::kNrelBasicSequence, link.m_sequenceArcAddr)
+         && CheckArc(ctx, link.m_sequenceArcAddr, accessArcAddr, link.m_nextAccessArcAddr);
+}
+
+bool ScOrderedSetIndex::CheckArc(
+    ScMemoryContext & ctx,
+    ScAddr const & arcAddr,
+    ScAddr const & sourceAddr,
+    ScAddr const & targetAddr)
+{
+  ScAddr arcSourceAddr;
+  ScAddr arcTargetAddr;
+  return GetArcInfo(ctx, arcAddr, arcSourceAddr, arcTargetAddr) && arcSourceAddr == sourceAddr
+         && arcTargetAddr == targetAddr;
+}
+
+bool ScOrderedSetIndex::GetArcInfo(
+    ScMemoryContext & ctx,
+    ScAddr const & arcAddr,
+    ScAddr & sourceAddr,
+    ScAddr & targetAddr)
+{
+  sc_addr source;
+  sc_addr target;
+  if (sc_memory_get_arc_info(*ctx, *arcAddr, &source, &target) != SC_RESULT_OK)
+    return false;
+
+  sourceAddr = source;
+  targetAddr = target;
+  return true;
+}
+
+size_t ScOrderedSetIndex::GetRolePosition(ScMemoryContext & ctx, ScAddr const & roleAddr)
+{
+  for (size_t i = 0; i < ScKeynodes::GetRrelIndexNum(); ++i)
+  {
+    if (ScKeynodes::GetRrelIndex(i) == roleAddr)
+      return i + 1;
+  }
+
+  std::string const & idtf = ctx.HelperGetSystemIdtf(roleAddr);
+  if (idtf.size() <= kRoleRelationPrefix.size() || idtf.compare(0, kRoleRelationPrefix.size(), kRoleRelationPrefix) != 0)
+    return 0;
+
+  size_t position = 0;
+  for (size_t i = kRoleRelationPrefix.size(); i < idtf.size(); ++i)
+  {
+    if (idtf[i] < '0' || idtf[i] > '9')
+      return 0;
+    position = position * 10 + (idtf[i] - '0');
+  }
+
+  return position;
+}
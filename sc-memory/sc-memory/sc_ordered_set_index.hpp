@@ -0,0 +1,153 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc_addr.hpp"
+#include "sc_event.hpp"
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+class ScMemoryContext;
+
+/*!
+ * Positional index of ordered sets. Elements of an ordered set are connected with it by constant positive permanent
+ * access sc-arcs, positions of elements are specified by role relations `rrel_1`, `rrel_2`, ... belonging to these
+ * sc-arcs, and the order of elements is specified by `nrel_basic_sequence` between these sc-arcs.
+ *
+ * Sets are indexed on demand only. Index of set maps positions to elements and elements to next elements. Only indexed
+ * sets are subscribed to: access sc-arcs removed from them are removed from their indexes by sc-events. Role relations
+ * and sequence relation aren't subscribed to, so each found item is verified before it is returned; if it isn't valid
+ * or isn't indexed, the set is searched by iterators and the index is repaired.
+ */
+class ScOrderedSetIndex
+{
+public:
+  struct ScOrderedSetItem
+  {
+    ScAddr m_elementAddr;
+    ScAddr m_accessArcAddr;
+    ScAddr m_roleArcAddr;
+    ScAddr m_roleAddr;
+  };
+
+  struct ScOrderedSetLink
+  {
+    ScAddr m_nextAccessArcAddr;
+    ScAddr m_sequenceArcAddr;
+    ScAddr m_relationArcAddr;
+  };
+
+  explicit ScOrderedSetIndex();
+  ~ScOrderedSetIndex();
+
+  /*! Builds index for the specified set. Returns false if the set is already indexed.
+   */
+  bool AddSet(ScMemoryContext & ctx, ScAddr const & setAddr);
+
+  /*! Removes index of the specified set. Returns false if the set isn't indexed.
+   */
+  bool RemoveSet(ScAddr const & setAddr);
+
+  bool HasSet(ScAddr const & setAddr) const;
+
+  /*! Finds element with the specified position (`rrel_<position>`) in the set. Not indexed sets are searched by
+   * iterators.
+   */
+  ScAddr GetElement(ScMemoryContext & ctx, ScAddr const & setAddr, size_t position);
+
+  /*! Finds element that follows the specified element in the set by `nrel_basic_sequence`. Not indexed sets are
+   * searched by iterators.
+   */
+  ScAddr GetNextElement(ScMemoryContext & ctx, ScAddr const & setAddr, ScAddr const & elementAddr);
+
+  /*! Searches element with the specified position in the set by iterators.
+   */
+  static bool FindItem(ScMemoryContext & ctx, ScAddr const & setAddr, size_t position, ScOrderedSetItem & item);
+
+  /*! Searches element that follows the specified element in the set by iterators. Sequence sc-arc, sc-arc to the next
+   * element and sc-arc of `nrel_basic_sequence` can have any types.
+   */
+  _SC_EXTERN static bool FindLink(
+      ScMemoryContext & ctx,
+      ScAddr const & setAddr,
+      ScAddr const & elementAddr,
+      ScAddr & accessArcAddr,
+      ScOrderedSetLink & link);
+
+  /*! Searches element that follows the specified element in the set by iterators. Only sc-connectors with the
+   * specified types are matched, for example, `ScType::EdgeDCommonConst`, `ScType::EdgeAccessConstPosPerm` and
+   * `ScType::EdgeAccessConstPosPerm` for strict sequences.
+   */
+  _SC_EXTERN static bool FindLink(
+      ScMemoryContext & ctx,
+      ScAddr const & setAddr,
+      ScAddr const & elementAddr,
+      ScType const & sequenceArcType,
+      ScType const & nextAccessArcType,
+      ScType const & relationArcType,
+      ScAddr & accessArcAddr,
+      ScOrderedSetLink & link);
+
+  /*! Returns role relation for the specified position or empty sc-addr if there is no such relation.
+   */
+  static ScAddr GetRoleRelation(ScMemoryContext & ctx, size_t position);
+
+  /*! Returns role relation for the specified position. Role relations for positions above `rrel_<GetRrelIndexNum()>`
+   * aren't keynodes, they are searched by system identifiers once and cached.
+   */
+  ScAddr GetCachedRoleRelation(ScMemoryContext & ctx, size_t position);
+
+  /*! Returns the next element of link found by FindLink.
+   */
+  _SC_EXTERN static ScAddr GetLinkNextElement(ScMemoryContext & ctx, ScOrderedSetLink const & link);
+
+protected:
+  using ScAddrHashFunction = ScAddrHashFunc<ScAddr::HashType>;
+
+  struct ScOrderedSet
+  {
+    std::unordered_map<size_t, ScOrderedSetItem> m_positionsToItems;
+    std::unordered_map<ScAddr, ScAddr, ScAddrHashFunction> m_elementsToAccessArcs;
+    std::unordered_map<ScAddr, ScOrderedSetLink, ScAddrHashFunction> m_accessArcsToLinks;
+    std::unique_ptr<ScEventRemoveOutputEdge> m_accessArcRemovedEvent;
+  };
+
+  static bool FindItemByRole(
+      ScMemoryContext & ctx,
+      ScAddr const & setAddr,
+      ScAddr const & roleAddr,
+      ScOrderedSetItem & item);
+
+  void CacheRoleRelation(size_t position, ScAddr const & roleAddr);
+
+  bool OnAccessArcRemoved(ScAddr const & setAddr, ScAddr const & accessArcAddr, ScAddr const & elementAddr);
+
+  static void IndexItem(ScOrderedSet & set, size_t position, ScOrderedSetItem const & item);
+  static void IndexLink(ScOrderedSet & set, ScAddr const & accessArcAddr, ScOrderedSetLink const & link);
+
+  static bool IsValidItem(ScMemoryContext & ctx, ScAddr const & setAddr, ScOrderedSetItem const & item);
+  static bool IsValidLink(ScMemoryContext & ctx, ScAddr const & accessArcAddr, ScOrderedSetLink const & link);
+  static bool CheckArc(
+      ScMemoryContext & ctx,
+      ScAddr const & arcAddr,
+      ScAddr const & sourceAddr,
+      ScAddr const & targetAddr);
+  static bool GetArcInfo(ScMemoryContext & ctx, ScAddr const & arcAddr, ScAddr & sourceAddr, ScAddr & targetAddr);
+  static size_t GetRolePosition(ScMemoryContext & ctx, ScAddr const & roleAddr);
+
+private:
+  std::unique_ptr<ScMemoryContext> m_context;
+
+  mutable std::shared_mutex m_mutex;
+  std::unordered_map<ScAddr, ScOrderedSet, ScAddrHashFunction> m_sets;
+
+  std::mutex m_roleRelationsMutex;
+  std::unordered_map<size_t, ScAddr> m_positionsToRoleRelations;
+};
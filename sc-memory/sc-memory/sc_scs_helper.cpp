@@ -12,6 +12,7 @@
 
 #include "scs/scs_parser.hpp"
 
+#include <mutex>
 #include <regex>
 #include <utility>
 
@@ -22,9 +23,14 @@ class StructGenerator
   friend class ::SCsHelper;
 
 protected:
-  StructGenerator(ScMemoryContext & ctx, SCsFileInterfacePtr fileInterface, ScAddr const & outputStructure)
+  StructGenerator(
+      ScMemoryContext & ctx,
+      SCsFileInterfacePtr fileInterface,
+      SCsSymbolTablePtr symbolTable,
+      ScAddr const & outputStructure)
     : m_ctx(ctx)
     , m_fileInterface(std::move(fileInterface))
+    , m_symbolTable(std::move(symbolTable))
     , m_outputStructure(outputStructure)
   {
     m_kNrelSysIdtf = m_ctx.HelperResolveSystemIdtf("nrel_system_identifier", ScType::NodeConstNoRole);
@@ -167,15 +173,21 @@ private:
     }
     else
     {
-      // try to find existing
-      if (el.GetVisibility() == scs::Visibility::System)
+      bool const isShared = m_symbolTable != nullptr && el.GetVisibility() != scs::Visibility::Local;
+
+      // try to find existing, at first among sc-elements resolved by other SCs-texts
+      if (isShared)
+        FindInSymbolTable(idtf, resultAddr, result);
+
+      bool const isFoundInSymbolTable = resultAddr.IsValid();
+      if (!isFoundInSymbolTable && el.GetVisibility() == scs::Visibility::System)
       {
         ScSystemIdentifierQuintuple quintuple;
         m_ctx.HelperFindBySystemIdtf(el.GetIdtf(), quintuple);
         resultAddr = quintuple.addr1;
         result = {quintuple.addr2, quintuple.addr3, quintuple.addr4};
       }
-      else if (el.GetVisibility() == scs::Visibility::Global)
+      else if (!isFoundInSymbolTable && el.GetVisibility() == scs::Visibility::Global)
       {
         resultAddr = FindBySCsGlobalIdtf(el.GetIdtf());
       }
@@ -231,11 +243,27 @@ private:
 
       // anyway save in cache
       m_idtfCache.insert(std::make_pair(idtf, resultAddr));
+      if (isShared && !isFoundInSymbolTable)
+        m_symbolTable->Add(idtf, resultAddr, result);
     }
 
     return {resultAddr, result};
   }
 
+  void FindInSymbolTable(std::string const & idtf, ScAddr & outAddr, ScAddrVector & outIdtfConstruction)
+  {
+    if (!m_symbolTable->Find(idtf, outAddr, outIdtfConstruction))
+      return;
+
+    // sc-element could be erased after it had been added to symbol table
+    if (!m_ctx.IsElement(outAddr))
+    {
+      m_symbolTable->Remove(idtf);
+      outAddr.Reset();
+      outIdtfConstruction.clear();
+    }
+  }
+
   template <typename T>
   bool SetLinkContentT(ScAddr const & linkAddr, std::string const & value)
   {
@@ -318,6 +346,7 @@ private:
 private:
   ScMemoryContext & m_ctx;
   SCsFileInterfacePtr m_fileInterface;
+  SCsSymbolTablePtr m_symbolTable;
   ScAddr m_outputStructure;
 
   std::unordered_map<std::string, ScAddr> m_idtfCache;
@@ -327,9 +356,40 @@ private:
 
 }  // namespace impl
 
-SCsHelper::SCsHelper(ScMemoryContext & ctx, SCsFileInterfacePtr fileInterface)
+bool SCsSymbolTable::Find(std::string const & idtf, ScAddr & outAddr, ScAddrVector & outIdtfConstruction) const
+{
+  std::shared_lock<std::shared_mutex> lock(m_mutex);
+  auto const it = m_symbols.find(idtf);
+  if (it == m_symbols.cend())
+    return false;
+
+  outAddr = it->second.m_addr;
+  outIdtfConstruction = it->second.m_idtfConstruction;
+  return true;
+}
+
+void SCsSymbolTable::Add(std::string const & idtf, ScAddr const & addr, ScAddrVector const & idtfConstruction)
+{
+  std::unique_lock<std::shared_mutex> lock(m_mutex);
+  m_symbols.insert({idtf, {addr, idtfConstruction}});
+}
+
+void SCsSymbolTable::Remove(std::string const & idtf)
+{
+  std::unique_lock<std::shared_mutex> lock(m_mutex);
+  m_symbols.erase(idtf);
+}
+
+size_t SCsSymbolTable::Size() const
+{
+  std::shared_lock<std::shared_mutex> lock(m_mutex);
+  return m_symbols.size();
+}
+
+SCsHelper::SCsHelper(ScMemoryContext & ctx, SCsFileInterfacePtr fileInterface, SCsSymbolTablePtr symbolTable)
   : m_ctx(ctx)
   , m_fileInterface(std::move(fileInterface))
+  , m_symbolTable(std::move(symbolTable))
 {
 }
 
@@ -350,7 +410,7 @@ bool SCsHelper::GenerateBySCsText(std::string const & scsText, ScAddr const & ou
     }
     else
     {
-      impl::StructGenerator generate(m_ctx, m_fileInterface, outputStructure);
+      impl::StructGenerator generate(m_ctx, m_fileInterface, m_symbolTable, outputStructure);
       generate(parser);
     }
   }
@@ -374,7 +434,7 @@ void SCsHelper::GenerateBySCsTextLazy(std::string const & scsText, ScAddr const
   }
   else
   {
-    impl::StructGenerator generate(m_ctx, m_fileInterface, outputStructure);
+    impl::StructGenerator generate(m_ctx, m_fileInterface, m_symbolTable, outputStructure);
     generate(parser);
   }
 }
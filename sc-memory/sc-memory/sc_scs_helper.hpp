@@ -10,6 +10,8 @@
 #include "sc_addr.hpp"
 
 #include <memory>
+#include <shared_mutex>
+#include <unordered_map>
 
 class SCsFileInterface
 {
@@ -20,12 +22,50 @@ public:
 
 using SCsFileInterfacePtr = std::shared_ptr<SCsFileInterface>;
 
+/*!
+ * Table of sc-elements with system and global identifiers resolved by SCs-helpers. It can be shared by SCs-helpers
+ * that generate many SCs-texts into the same sc-memory, e.g. all sources of knowledge base, so that each identifier
+ * is found or created in sc-memory only once. It can be used from several threads.
+ */
+class SCsSymbolTable final
+{
+public:
+  //! Returns false if there is no sc-element with specified identifier in table
+  _SC_EXTERN bool Find(std::string const & idtf, ScAddr & outAddr, ScAddrVector & outIdtfConstruction) const;
+
+  //! Adds sc-element with its identifier construction if there is no sc-element with specified identifier in table
+  _SC_EXTERN void Add(std::string const & idtf, ScAddr const & addr, ScAddrVector const & idtfConstruction);
+
+  _SC_EXTERN void Remove(std::string const & idtf);
+
+  _SC_EXTERN size_t Size() const;
+
+private:
+  struct Symbol
+  {
+    ScAddr m_addr;
+    ScAddrVector m_idtfConstruction;
+  };
+
+  std::unordered_map<std::string, Symbol> m_symbols;
+  mutable std::shared_mutex m_mutex;
+};
+
+using SCsSymbolTablePtr = std::shared_ptr<SCsSymbolTable>;
+
 class ScMemoryContext;
 
 class SCsHelper final
 {
 public:
-  _SC_EXTERN SCsHelper(ScMemoryContext & ctx, SCsFileInterfacePtr fileInterface);
+  /*!
+   * @param symbolTable Table of sc-elements resolved by other SCs-helpers. If it isn't null, sc-elements with system
+   * and global identifiers are searched in it before sc-memory and are added to it after resolving.
+   */
+  _SC_EXTERN SCsHelper(
+      ScMemoryContext & ctx,
+      SCsFileInterfacePtr fileInterface,
+      SCsSymbolTablePtr symbolTable = nullptr);
 
   _SC_EXTERN bool GenerateBySCsText(std::string const & scsText, ScAddr const & outputStructure = ScAddr::Empty);
   _SC_EXTERN void GenerateBySCsTextLazy(std::string const & scsText, ScAddr const & outputStructure = ScAddr::Empty);
@@ -35,5 +75,6 @@ private:
   ScMemoryContext & m_ctx;
 
   SCsFileInterfacePtr m_fileInterface;
+  SCsSymbolTablePtr m_symbolTable;
   std::string m_lastError;
 };
@@ -5,6 +5,7 @@
  */
 
 #include <algorithm>
+#include <cstdlib>
 
 extern "C"
 {
@@ -40,6 +41,56 @@ ScTemplateItem operator>>(ScType const & value, std::string const & replName)
 
 // --------------------------------
 
+ScTemplateLinkContentPredicate ScTemplateLinkContentPredicate::Equal(std::string const & content)
+{
+  return {Type::Equal, content};
+}
+
+ScTemplateLinkContentPredicate ScTemplateLinkContentPredicate::Prefix(std::string const & prefix)
+{
+  return {Type::Prefix, prefix};
+}
+
+ScTemplateLinkContentPredicate ScTemplateLinkContentPredicate::Substring(std::string const & substring)
+{
+  return {Type::Substring, substring};
+}
+
+ScTemplateLinkContentPredicate ScTemplateLinkContentPredicate::NumberRange(double minValue, double maxValue)
+{
+  return {Type::NumberRange, "", minValue, maxValue};
+}
+
+bool ScTemplateLinkContentPredicate::Check(std::string const & content) const
+{
+  switch (m_type)
+  {
+  case Type::Equal:
+    return content == m_content;
+
+  case Type::Prefix:
+    return content.compare(0, m_content.size(), m_content) == 0;
+
+  case Type::Substring:
+    return content.find(m_content) != std::string::npos;
+
+  case Type::NumberRange:
+  {
+    if (content.empty())
+      return false;
+
+    char * end = nullptr;
+    double const value = std::strtod(content.c_str(), &end);
+    return end == content.c_str() + content.size() && m_minValue <= value && value <= m_maxValue;
+  }
+
+  default:
+    return false;
+  }
+}
+
+// --------------------------------
+
 ScTemplate::ScTemplate()
 {
   m_templateTriples.reserve(16);
@@ -73,6 +124,7 @@ void ScTemplate::Clear()
   m_templateTriples.clear();
 
   m_templateItemsNamesToReplacementItemsAddrs.clear();
+  m_templateItemsNamesToLinkContentPredicates.clear();
   m_priorityOrderedTemplateTriples.clear();
   m_priorityOrderedTemplateTriples.resize((size_t)ScTemplateTripleType::ScConstr3TypeCount);
 }
@@ -204,6 +256,40 @@ ScTemplate & ScTemplate::Quintuple(
   return *this;
 }
 
+ScTemplate & ScTemplate::LinkContent(std::string const & alias, ScTemplateLinkContentPredicate const & predicate)
+{
+  if (!HasReplacement(alias))
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "Alias=`" << alias << "` not found in sc-template to add link content condition");
+
+  m_templateItemsNamesToLinkContentPredicates.insert_or_assign(alias, predicate);
+  return *this;
+}
+
+ScTemplate & ScTemplate::Bind(ScTemplate const & scTemplate, ScTemplateParams const & params)
+{
+  if (!IsEmpty())
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Params can be bound to empty sc-template only");
+
+  ScAddr value;
+  for (ScTemplateTriple const * triple : scTemplate.m_templateTriples)
+  {
+    ScTemplateTriple::ScTemplateTripleItems items = triple->GetValues();
+    for (ScTemplateItem & item : items)
+    {
+      // replacements of bound items get sc-addresses of their values by names
+      if (item.IsType() && item.HasName() && params.Get(item.m_name, value))
+        item.SetAddr(value);
+    }
+
+    Triple(items[0], items[1], items[2]);
+  }
+
+  m_templateItemsNamesToLinkContentPredicates = scTemplate.m_templateItemsNamesToLinkContentPredicates;
+  return *this;
+}
+
 inline ScTemplateTripleType ScTemplate::GetPriority(ScTemplateTriple * triple)
 {
   ScTemplateItem const & item1 = triple->m_values[0];
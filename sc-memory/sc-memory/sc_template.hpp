@@ -170,6 +170,61 @@ protected:
   ScTemplateTripleItems m_values;
 };
 
+/* Condition on content of sc-link found for sc-template item.
+ * Sc-links satisfying equal predicate can be found by fs-memory dictionary. Prefix and substring predicates are compared
+ * with the whole content of sc-link, not with its terms in fs-memory dictionary, so they are checked on found sc-links
+ * only. Number range predicate is evaluated by string content of sc-link read as number.
+ */
+class ScTemplateLinkContentPredicate
+{
+public:
+  enum class Type : uint8_t
+  {
+    Equal,
+    Prefix,
+    Substring,
+    NumberRange
+  };
+
+  _SC_EXTERN static ScTemplateLinkContentPredicate Equal(std::string const & content);
+  _SC_EXTERN static ScTemplateLinkContentPredicate Prefix(std::string const & prefix);
+  _SC_EXTERN static ScTemplateLinkContentPredicate Substring(std::string const & substring);
+  _SC_EXTERN static ScTemplateLinkContentPredicate NumberRange(double minValue, double maxValue);
+
+  [[nodiscard]] inline Type GetType() const
+  {
+    return m_type;
+  }
+
+  [[nodiscard]] inline std::string const & GetContent() const
+  {
+    return m_content;
+  }
+
+  //! Returns true if sc-links which contents satisfy predicate can be found by fs-memory dictionary
+  [[nodiscard]] inline bool IsIndexed() const
+  {
+    return m_type == Type::Equal;
+  }
+
+  //! Checks if specified content of sc-link satisfies predicate
+  [[nodiscard]] _SC_EXTERN bool Check(std::string const & content) const;
+
+protected:
+  ScTemplateLinkContentPredicate(Type type, std::string content, double minValue = 0, double maxValue = 0)
+    : m_type(type)
+    , m_content(std::move(content))
+    , m_minValue(minValue)
+    , m_maxValue(maxValue)
+  {
+  }
+
+  Type m_type;
+  std::string m_content;
+  double m_minValue;
+  double m_maxValue;
+};
+
 _SC_EXTERN ScTemplateItem operator>>(ScAddr const & value, sc_char const * replName);
 _SC_EXTERN ScTemplateItem operator>>(ScAddr const & value, std::string const & replName);
 _SC_EXTERN ScTemplateItem operator>>(ScType const & value, sc_char const * replName);
@@ -386,6 +441,23 @@ public:
       ScTemplateItem const & param4,
       ScTemplateItem const & param5) noexcept(false);
 
+  /** Adds condition on content of sc-link found for item with replacement name `alias`. Conditions are checked
+   * during search only. If sc-links satisfying condition can be found by fs-memory dictionary and their estimated
+   * amount is less than amount of sc-connectors of fixed sc-elements of sc-template, then search is started from these
+   * sc-links. If `alias` is replacement name of fixed sc-address, then nothing is found unless it satisfies condition.
+   * @throws utils::ExceptionInvalidParams if sc-template has no item with replacement name `alias`.
+   */
+  _SC_EXTERN ScTemplate & LinkContent(
+      std::string const & alias,
+      ScTemplateLinkContentPredicate const & predicate) noexcept(false);
+
+  /** Fills empty sc-template with triples and conditions on contents of sc-links of `scTemplate`. Items with
+   * replacement names that have values in `params` are replaced by sc-addresses of these values, so sc-template
+   * built once can be searched with different params.
+   * @throws utils::ExceptionInvalidParams if this sc-template isn't empty.
+   */
+  _SC_EXTERN ScTemplate & Bind(ScTemplate const & scTemplate, ScTemplateParams const & params) noexcept(false);
+
 protected:
   // Begin: calls by memory context
   Result Generate(
@@ -431,6 +503,7 @@ protected:
   std::vector<ScTemplateGroupedTriples> m_priorityOrderedTemplateTriples;
   std::map<std::string, ScAddr> m_templateItemsNamesToReplacementItemsAddrs;
   std::map<std::string, ScType> m_templateItemsNamesToTypes;
+  std::map<std::string, ScTemplateLinkContentPredicate> m_templateItemsNamesToLinkContentPredicates;
 
   ScTemplateTripleType GetPriority(ScTemplateTriple * triple);
 };
@@ -34,7 +34,12 @@ public:
     result = ScTemplateResultItem{*m_context, m_replacements};
     result.m_replacementConstruction.resize(m_triples.size() * 3);
 
-    ScAddrVector createdElements;
+    // All sc-elements are created by one batch after the whole sc-template is validated, so positions of not yet
+    // created sc-elements in this batch are stored instead of their sc-addrs.
+    std::vector<sc_int32> itemsBatchIndices(m_triples.size() * 3, -1);
+    std::vector<sc_element_batch_item> batch;
+    batch.reserve(m_triples.size() * 3);
+
     size_t resultIdx = 0;
 
     for (auto const & triple : m_triples)
@@ -51,7 +56,8 @@ public:
                 << sourceItem.GetPrettyName() << ".");
 
       ScAddr sourceAddr = TryFindElementReplacement(sourceItem, result.m_replacementConstruction);
-      if (sourceItem.IsType() && sourceItem.m_typeValue.IsEdge() && !sourceAddr.IsValid())
+      sc_int32 sourceBatchIndex = TryFindElementBatchIndex(sourceItem, sourceAddr, itemsBatchIndices);
+      if (sourceItem.IsType() && sourceItem.m_typeValue.IsEdge() && !sourceAddr.IsValid() && sourceBatchIndex < 0)
         SC_THROW_EXCEPTION(
             utils::ExceptionInvalidParams,
             "You can't generate sc-connector as the first item of triple "
@@ -66,7 +72,8 @@ public:
                 << targetItem.GetPrettyName() << ".");
 
       ScAddr targetAddr = TryFindElementReplacement(targetItem, result.m_replacementConstruction);
-      if (targetItem.IsType() && targetItem.m_typeValue.IsEdge() && !targetAddr.IsValid())
+      sc_int32 targetBatchIndex = TryFindElementBatchIndex(targetItem, targetAddr, itemsBatchIndices);
+      if (targetItem.IsType() && targetItem.m_typeValue.IsEdge() && !targetAddr.IsValid() && targetBatchIndex < 0)
         SC_THROW_EXCEPTION(
             utils::ExceptionInvalidParams,
             "You can't generate sc-connector as the third item of triple "
@@ -81,25 +88,47 @@ public:
                 << connectorItem.GetPrettyName() << ".");
 
       ScAddr connectorAddr = TryFindElementReplacement(connectorItem, result.m_replacementConstruction);
+      sc_int32 connectorBatchIndex = TryFindElementBatchIndex(connectorItem, connectorAddr, itemsBatchIndices);
       if (connectorAddr.IsValid())
+      {
         CheckIncidenceBetweenConnectorAndIncidentElements(connectorItem, connectorAddr, sourceItem, targetItem);
-
-      if (connectorAddr.IsValid())
         m_context.GetEdgeInfo(connectorAddr, sourceAddr, targetAddr);
+        sourceBatchIndex = targetBatchIndex = -1;
+      }
+      else if (connectorBatchIndex >= 0)
+      {
+        sc_element_batch_item const & connector = batch[connectorBatchIndex];
+        CheckIncidenceBetweenNewConnectorAndIncidentElements(connectorItem, connector, sourceItem, targetItem);
+        sourceAddr = ScAddr(connector.begin_addr);
+        sourceBatchIndex = connector.begin_index;
+        targetAddr = ScAddr(connector.end_addr);
+        targetBatchIndex = connector.end_index;
+      }
 
-      if (!sourceAddr.IsValid())
-        sourceAddr = CreateNodeOrLink(sourceItem.m_typeValue.UpConstType());
-      if (!targetAddr.IsValid())
-        targetAddr = CreateNodeOrLink(targetItem.m_typeValue.UpConstType());
+      if (!sourceAddr.IsValid() && sourceBatchIndex < 0)
+        sourceBatchIndex = AddNodeOrLinkToBatch(sourceItem.m_typeValue.UpConstType(), batch);
+      if (!targetAddr.IsValid() && targetBatchIndex < 0)
+        targetBatchIndex = AddNodeOrLinkToBatch(targetItem.m_typeValue.UpConstType(), batch);
 
-      if (!connectorAddr.IsValid())
-        connectorAddr = CreateConnector(connectorItem.m_typeValue.UpConstType(), sourceAddr, targetAddr);
+      if (!connectorAddr.IsValid() && connectorBatchIndex < 0)
+        connectorBatchIndex = AddConnectorToBatch(
+            connectorItem.m_typeValue.UpConstType(), sourceAddr, sourceBatchIndex, targetAddr, targetBatchIndex, batch);
 
+      itemsBatchIndices[resultIdx] = sourceBatchIndex;
       result.m_replacementConstruction[resultIdx++] = sourceAddr;
+      itemsBatchIndices[resultIdx] = connectorBatchIndex;
       result.m_replacementConstruction[resultIdx++] = connectorAddr;
+      itemsBatchIndices[resultIdx] = targetBatchIndex;
       result.m_replacementConstruction[resultIdx++] = targetAddr;
     }
 
+    ScAddrVector const & createdElements = CreateElements(batch);
+    for (size_t i = 0; i < itemsBatchIndices.size(); ++i)
+    {
+      if (itemsBatchIndices[i] >= 0)
+        result.m_replacementConstruction[i] = createdElements[itemsBatchIndices[i]];
+    }
+
     return ScTemplateResultCode::Success;
   }
 
@@ -111,25 +140,77 @@ public:
   }
 
 private:
-  ScAddr CreateNodeOrLink(ScType const & type)
+  static sc_int32 AddNodeOrLinkToBatch(ScType const & type, std::vector<sc_element_batch_item> & batch)
   {
-    ScAddr addr;
-    if (type.IsLink())
-      addr = m_context.CreateLink(type);
-    else
-      addr = m_context.CreateNode(type);
+    if (type.IsEdge())
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidParams,
+          "Specified type must be sc-node type. You should provide any of ScType::Node... value as a type");
 
-    m_createdElements.push_back(addr);
+    batch.push_back({*type, SC_ADDR_EMPTY, SC_ADDR_EMPTY, -1, -1});
+    return (sc_int32)batch.size() - 1;
+  }
+
+  static sc_int32 AddConnectorToBatch(
+      ScType const & type,
+      ScAddr const & sourceAddr,
+      sc_int32 sourceBatchIndex,
+      ScAddr const & targetAddr,
+      sc_int32 targetBatchIndex,
+      std::vector<sc_element_batch_item> & batch)
+  {
+    if (!type.IsEdge())
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidParams,
+          "Specified type must be sc-connector type. You should provide any of ScType::Edge... value as a type");
 
-    return addr;
+    batch.push_back({*type, *sourceAddr, *targetAddr, sourceBatchIndex, targetBatchIndex});
+    return (sc_int32)batch.size() - 1;
   }
 
-  ScAddr CreateConnector(ScType const & type, ScAddr const & sourceAddr, ScAddr const & targetAddr)
+  ScAddrVector CreateElements(std::vector<sc_element_batch_item> const & batch)
   {
-    ScAddr const & addr = m_context.CreateEdge(type, sourceAddr, targetAddr);
-    m_createdElements.push_back(addr);
+    std::vector<sc_addr> addrs(batch.size());
+    sc_result const result =
+        sc_memory_elements_new_batch(*m_context, batch.data(), (sc_uint32)batch.size(), addrs.data());
+
+    switch (result)
+    {
+    case SC_RESULT_ERROR_ADDR_IS_NOT_VALID:
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidParams,
+          "Specified source or target sc-element sc-address is invalid to create sc-connector");
+
+    case SC_RESULT_ERROR_FULL_MEMORY:
+      SC_THROW_EXCEPTION(utils::ExceptionCritical, "Not able to generate sc-template due sc-memory is full");
+
+    case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidState, "Not able to generate sc-template due sc-memory context is not authorized");
 
-    return addr;
+    case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_WRITE_PERMISSIONS:
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidState,
+          "Not able to generate sc-template due sc-memory context hasn't write permissions");
+
+    case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_PERMISSIONS_TO_WRITE_PERMISSIONS:
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidState,
+          "Not able to generate sc-template due sc-memory context hasn't permissions to write permissions");
+
+    default:
+      break;
+    }
+
+    ScAddrVector createdElements;
+    createdElements.reserve(addrs.size());
+    for (sc_addr const & addr : addrs)
+    {
+      createdElements.emplace_back(addr);
+      m_createdElements.emplace_back(addr);
+    }
+
+    return createdElements;
   }
 
   [[nodiscard]] ScAddr GetAddrFromParams(ScTemplateItem const & itemValue) const
@@ -177,6 +258,41 @@ private:
     return ScAddr::Empty;
   }
 
+  [[nodiscard]] sc_int32 TryFindElementBatchIndex(
+      ScTemplateItem const & item,
+      ScAddr const & foundAddr,
+      std::vector<sc_int32> const & batchIndices) const
+  {
+    if (foundAddr.IsValid() || !item.IsReplacement())
+      return -1;
+
+    auto it = m_replacements.find(item.m_name);
+    if (it == m_replacements.cend())
+      return -1;
+
+    return batchIndices[it->second];
+  }
+
+  static void CheckIncidenceBetweenNewConnectorAndIncidentElements(
+      ScTemplateItem const & connectorItem,
+      sc_element_batch_item const & connector,
+      ScTemplateItem const & sourceItem,
+      ScTemplateItem const & targetItem)
+  {
+    auto const & IsIncident = [](ScTemplateItem const & item, sc_addr const & addr, sc_int32 batchIndex) -> bool
+    {
+      return !item.IsAddr() || (batchIndex < 0 && item.m_addrValue == ScAddr(addr));
+    };
+
+    if (!IsIncident(sourceItem, connector.begin_addr, connector.begin_index)
+        || !IsIncident(targetItem, connector.end_addr, connector.end_index))
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidParams,
+          "Generated sc-connector for the second item in sc-template "
+              << (connectorItem.HasName() ? (connectorItem.GetPrettyName() + " ") : "")
+              << "is not incident to specified fixed source or target sc-element in sc-template.");
+  }
+
   void CheckIncidenceBetweenConnectorAndIncidentElements(
       ScTemplateItem const & connectorItem,
       ScAddr const & connectorAddr,
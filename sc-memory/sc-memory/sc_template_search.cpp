@@ -8,8 +8,13 @@
 
 #include "sc_debug.hpp"
 #include "sc_memory.hpp"
+#include "sc_timer.hpp"
+
+#include "scs/scs_types.hpp"
+#include "utils/sc_slow_operations_log.hpp"
 
 #include <algorithm>
+#include <sstream>
 
 class ScTemplateSearch
 {
@@ -24,6 +29,7 @@ public:
 
   using ScTemplateTriples = ScTemplate::ScTemplateGroupedTriples;
   using ScReplacementTriple = ScAddrTriple;
+  using ScAddrSet = std::unordered_set<ScAddr, ScAddrHashFunc<uint32_t>>;
 
   void SetCallbackWithRequest(ScTemplateSearchResultCallbackWithRequest const & callback)
   {
@@ -51,8 +57,13 @@ private:
    */
   void PrepareSearch()
   {
+    EstimateLinkContentCandidates();
+
     if (m_template.Size() == 1)
+    {
+      FindTripleWithMostSelectiveLinkContent({m_template.m_templateTriples[0]->m_index}, 0);
       return;
+    }
 
     SetUpDependenciesBetweenTriples();
     RemoveCycledDependenciesBetweenTriples();
@@ -336,6 +347,14 @@ private:
         priorityTripleIdx = FindTripleWithMostMinimalInputArcsForThirdItem(connectivityComponentsTriples);
         if (priorityTripleIdx == -1)
           priorityTripleIdx = FindTripleWithMostMinimalOutputArcsForFirstItem(connectivityComponentsTriples);
+
+        sc_int32 const linkContentTripleIdx =
+            FindTripleWithMostSelectiveLinkContent(connectivityComponentsTriples, priorityTripleIdx);
+        if (linkContentTripleIdx != -1)
+          priorityTripleIdx = linkContentTripleIdx;
+
+        if (priorityTripleIdx == -1)
+          priorityTripleIdx = FindVariableTripleWithEnumerableItem(connectivityComponentsTriples);
       }
 
       // save triple in which the first item address has the most minimal count of input/output arcs in vector
@@ -406,6 +425,180 @@ private:
     return priorityTripleIdx;
   }
 
+  /*!
+   * Finds triple of connectivity component with fixed item, from which the least amount of sc-connectors is iterated.
+   * @param[out] minArcsCount Amount of sc-connectors iterated from fixed item of found triple.
+   * @returns Index of found triple, or -1 if connectivity component has no triples with fixed items.
+   */
+  sc_int32 FindTripleWithMostMinimalArcsForFixedItem(
+      ScTemplateTriples const & connectivityComponentsTriples,
+      size_t & minArcsCount)
+  {
+    sc_int32 priorityTripleIdx = -1;
+    for (size_t const tripleIdx : connectivityComponentsTriples)
+    {
+      ScTemplateTriple const * triple = m_template.m_templateTriples[tripleIdx];
+
+      size_t count;
+      if ((*triple)[1].IsFixed())
+        count = 1;
+      else if ((*triple)[0].IsFixed())
+        count = m_context.GetElementOutputArcsCount((*triple)[0].m_addrValue);
+      else if ((*triple)[2].IsFixed())
+        count = m_context.GetElementInputArcsCount((*triple)[2].m_addrValue);
+      else
+        continue;
+
+      if (priorityTripleIdx == -1 || count < minArcsCount)
+      {
+        priorityTripleIdx = (sc_int32)tripleIdx;
+        minArcsCount = count;
+      }
+    }
+
+    return priorityTripleIdx;
+  }
+
+  /*!
+   * Finds triple without fixed items, which first or third item type has element class. Such triple can be used as
+   * start triple, because sc-elements of its item type are enumerated by sc-memory registry. It is used only if
+   * connectivity component has no triples with fixed items, or if there are fewer sc-elements of its item element
+   * class than sc-connectors iterated from the best fixed item, otherwise triple with that fixed item is returned.
+   */
+  sc_int32 FindVariableTripleWithEnumerableItem(ScTemplateTriples const & connectivityComponentsTriples)
+  {
+    size_t minArcsCount = 0;
+    sc_int32 const fixedTripleIdx =
+        FindTripleWithMostMinimalArcsForFixedItem(connectivityComponentsTriples, minArcsCount);
+
+    auto const & variableTriples = m_template.m_priorityOrderedTemplateTriples[(size_t)ScTemplateTripleType::AAA];
+    for (size_t const tripleIdx : variableTriples)
+    {
+      // check if triple in connectivity component
+      if (connectivityComponentsTriples.find(tripleIdx) == connectivityComponentsTriples.cend())
+        continue;
+
+      ScTemplateTriple const * triple = m_template.m_templateTriples[tripleIdx];
+      ScType type = PrepareType((*triple)[0]);
+      if (!IsEnumerableType(type))
+        type = PrepareType((*triple)[2]);
+      if (!IsEnumerableType(type))
+        continue;
+
+      // counts of element classes are got from registry counters without sc-elements traversal
+      if (fixedTripleIdx == -1
+          || m_context.GetElementsCountByType(ScType(*type & sc_type_element_mask)) < minArcsCount)
+        return (sc_int32)tripleIdx;
+    }
+
+    return fixedTripleIdx;
+  }
+
+  /*!
+   * Estimates amounts of sc-links satisfying content predicates of variable sc-template items by fs-memory dictionary.
+   * Sc-links are found only for item which search is started from. Content predicates of items with fixed
+   * sc-addresses are checked once, if any of them isn't satisfied, then nothing is found.
+   */
+  void EstimateLinkContentCandidates()
+  {
+    for (auto const & [name, predicate] : m_template.m_templateItemsNamesToLinkContentPredicates)
+    {
+      auto const & replacementIt = m_template.m_templateItemsNamesToReplacementItemsAddrs.find(name);
+      if (replacementIt != m_template.m_templateItemsNamesToReplacementItemsAddrs.cend())
+      {
+        if (!IsLinkContentSatisfied(predicate, replacementIt->second))
+          m_isLinkContentUnsatisfied = true;
+        continue;
+      }
+
+      if (!predicate.IsIndexed())
+        continue;
+
+      m_templateItemsNamesToLinkContentEstimates[name] =
+          m_context.EstimateLinksByContent(ScStreamMakeRead(predicate.GetContent()), false);
+    }
+  }
+
+  //! Finds sc-links satisfying content predicate of sc-template item by fs-memory dictionary
+  void FindLinkContentCandidates(std::string const & name)
+  {
+    if (m_templateItemsNamesToLinkContentCandidates.find(name) != m_templateItemsNamesToLinkContentCandidates.cend())
+      return;
+
+    ScTemplateLinkContentPredicate const & predicate = m_template.m_templateItemsNamesToLinkContentPredicates.at(name);
+    ScAddrVector const & links = m_context.FindLinksByContent(predicate.GetContent());
+    m_templateItemsNamesToLinkContentCandidates[name].insert(links.cbegin(), links.cend());
+  }
+
+  //! Returns count of sc-connectors to iterate triple from its fixed item, or -1 if triple has no fixed items
+  sc_int32 GetFixedItemArcsCount(ScTemplateTriple const * triple)
+  {
+    auto const & values = triple->GetValues();
+    if (values[1].IsFixed())
+      return 1;
+    if (values[2].IsFixed())
+      return (sc_int32)m_context.GetElementInputArcsCount(values[2].m_addrValue);
+    if (values[0].IsFixed())
+      return (sc_int32)m_context.GetElementOutputArcsCount(values[0].m_addrValue);
+
+    return -1;
+  }
+
+  /*!
+   * Finds triple which first or third item has the fewest estimated sc-links satisfying its content predicate, if
+   * there are fewer of them than sc-connectors to iterate triple with index `priorityTripleIdx`. Such triple is
+   * iterated from these sc-links, so they are found by fs-memory dictionary.
+   */
+  sc_int32 FindTripleWithMostSelectiveLinkContent(
+      ScTemplateTriples const & connectivityComponentsTriples,
+      sc_int32 priorityTripleIdx)
+  {
+    if (m_templateItemsNamesToLinkContentEstimates.empty())
+      return -1;
+
+    sc_int32 minCount =
+        priorityTripleIdx == -1 ? -1 : GetFixedItemArcsCount(m_template.m_templateTriples[priorityTripleIdx]);
+
+    sc_int32 linkContentTripleIdx = -1;
+    size_t linkContentItemIdx = 0;
+    for (size_t const tripleIdx : connectivityComponentsTriples)
+    {
+      ScTemplateTriple const * triple = m_template.m_templateTriples[tripleIdx];
+      for (size_t const itemIdx : {2, 0})
+      {
+        ScTemplateItem const & item = (*triple)[itemIdx];
+        if (item.IsFixed())
+          continue;
+
+        auto const & found = m_templateItemsNamesToLinkContentEstimates.find(item.m_name);
+        if (found == m_templateItemsNamesToLinkContentEstimates.cend())
+          continue;
+
+        auto const count = (sc_int32)std::min<size_t>(found->second, INT32_MAX);
+        if (minCount == -1 || count < minCount)
+        {
+          linkContentTripleIdx = (sc_int32)tripleIdx;
+          linkContentItemIdx = itemIdx;
+          minCount = count;
+        }
+      }
+    }
+
+    if (linkContentTripleIdx != -1)
+    {
+      m_linkContentTemplateTriplesToStartItems[linkContentTripleIdx] = linkContentItemIdx;
+      FindLinkContentCandidates((*m_template.m_templateTriples[linkContentTripleIdx])[linkContentItemIdx].m_name);
+    }
+
+    return linkContentTripleIdx;
+  }
+
+  //! Returns true if sc-elements of specified type can be enumerated without full sc-memory traversal
+  static bool IsEnumerableType(ScType const & type)
+  {
+    return (*type & sc_type_element_mask) != 0;
+  }
+
   //! Returns key - "${item replacement name}${triple index}"
   static std::string GetKey(ScTemplateTriple const * triple, ScTemplateItem const & item)
   {
@@ -544,6 +737,112 @@ private:
     }
   }
 
+  ScType PrepareType(ScTemplateItem const & item) const
+  {
+    ScType type = item.m_typeValue;
+    if (!item.m_name.empty())
+    {
+      auto const & found = m_template.m_templateItemsNamesToTypes.find(item.m_name);
+      if (found != m_template.m_templateItemsNamesToTypes.cend())
+        type = found->second;
+    }
+
+    if (type.HasConstancyFlag())
+      return type.UpConstType();
+
+    return type;
+  }
+
+  /*!
+   * Finds sc-elements to iterate triple without fixed items from them. Sc-elements of the first item type are
+   * preferred, otherwise sc-elements of the third item type are used.
+   * @returns true if the triple items are iterated from its first item.
+   */
+  bool FindVariableTripleStartElements(ScTemplateTriple const * templateTriple, ScAddrVector & startElements)
+  {
+    ScType const & beginType = PrepareType((*templateTriple)[0]);
+    if (IsEnumerableType(beginType))
+    {
+      startElements = m_context.FindElementsByType(beginType);
+      return true;
+    }
+
+    ScType const & endType = PrepareType((*templateTriple)[2]);
+    if (IsEnumerableType(endType))
+    {
+      startElements = m_context.FindElementsByType(endType);
+      return false;
+    }
+
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Fully variable triple was selected during searching by specified sc-template. It is possible that you have "
+        "incorrect sc-template or you can't find constructions in knowledge base using this sc-template. Check "
+        "sc-template.");
+  }
+
+  /*!
+   * Finds sc-links to iterate triple from them, if triple is chosen to start search from sc-links satisfying content
+   * predicate of its first or third item and this item isn't resolved yet.
+   * @returns true if the triple is iterated from sc-links.
+   */
+  bool FindLinkContentStartElements(
+      ScTemplateTriple const * templateTriple,
+      ScAddrVector const & replacementConstruction,
+      ScTemplateSearchResult & result,
+      ScAddrVector & startElements,
+      bool & isIteratedFromBegin)
+  {
+    auto const & found = m_linkContentTemplateTriplesToStartItems.find(templateTriple->m_index);
+    if (found == m_linkContentTemplateTriplesToStartItems.cend())
+      return false;
+
+    ScTemplateItem const & item = (*templateTriple)[found->second];
+    if (ResolveAddr(item, replacementConstruction, result).IsValid())
+      return false;
+
+    auto const & candidates = m_templateItemsNamesToLinkContentCandidates.find(item.m_name)->second;
+    startElements.assign(candidates.cbegin(), candidates.cend());
+    isIteratedFromBegin = found->second == 0;
+    return true;
+  }
+
+  //! Checks if found sc-element satisfies content predicate of sc-template item
+  bool IsLinkContentSatisfied(ScTemplateItem const & item, ScAddr const & addr)
+  {
+    if (item.m_name.empty())
+      return true;
+
+    auto const & predicateIt = m_template.m_templateItemsNamesToLinkContentPredicates.find(item.m_name);
+    if (predicateIt == m_template.m_templateItemsNamesToLinkContentPredicates.cend())
+      return true;
+
+    // sc-links found by fs-memory dictionary are used if search is started from them
+    auto const & candidatesIt = m_templateItemsNamesToLinkContentCandidates.find(item.m_name);
+    if (candidatesIt != m_templateItemsNamesToLinkContentCandidates.cend())
+      return candidatesIt->second.find(addr) != candidatesIt->second.cend();
+
+    auto & checkedLinks = m_checkedLinksContents[item.m_name];
+    auto const & checkedIt = checkedLinks.find(addr);
+    if (checkedIt != checkedLinks.cend())
+      return checkedIt->second;
+
+    bool const isSatisfied = IsLinkContentSatisfied(predicateIt->second, addr);
+    checkedLinks.insert({addr, isSatisfied});
+    return isSatisfied;
+  }
+
+  //! Checks if sc-element is sc-link which content satisfies predicate
+  bool IsLinkContentSatisfied(ScTemplateLinkContentPredicate const & predicate, ScAddr const & addr)
+  {
+    if (!m_context.GetElementType(addr).IsLink())
+      return false;
+
+    std::string content;
+    m_context.GetLinkContent(addr, content);
+    return predicate.Check(content);
+  }
+
   ScIterator3Ptr CreateIterator(
       ScTemplateTriple const * templateTriple,
       ScAddrVector const & replacementConstruction,
@@ -557,22 +856,6 @@ private:
     ScAddr const & addr2 = ResolveAddr(item2, replacementConstruction, result);
     ScAddr const & addr3 = ResolveAddr(item3, replacementConstruction, result);
 
-    auto const & PrepareType = [this](ScTemplateItem const & item) -> ScType
-    {
-      ScType type = item.m_typeValue;
-      if (!item.m_name.empty())
-      {
-        auto const & found = m_template.m_templateItemsNamesToTypes.find(item.m_name);
-        if (found != m_template.m_templateItemsNamesToTypes.cend())
-          type = found->second;
-      }
-
-      if (type.HasConstancyFlag())
-        return type.UpConstType();
-
-      return type;
-    };
-
     if (addr1.IsValid())
     {
       if (!addr2.IsValid())
@@ -704,14 +987,60 @@ private:
     bool isForLastTemplateTripleAllChildrenFinished = true;
     bool isLastTemplateTripleHasNoChildren = false;
 
-    ScIterator3Ptr it =
-        CreateIterator(templateTriple, result.m_replacementConstructions[replacementConstructionIdx], result);
-    if (!it || !it->IsValid())
-      SC_THROW_EXCEPTION(
-          utils::ExceptionInvalidState,
-          "Fully variable triple was selected during searching by specified sc-template. It is possible that you have "
-          "incorrect sc-template or you can't find constructions in knowledge base using this sc-template. Check "
-          "sc-template.");
+    ScAddrVector const & startReplacementConstruction = result.m_replacementConstructions[replacementConstructionIdx];
+
+    // triple is started from sc-links satisfying content predicate or it has no fixed items, so it is iterated from
+    // each of start sc-elements
+    ScIterator3Ptr it;
+    ScAddrVector startElements;
+    size_t startElementIdx = 0;
+    bool isIteratedFromBegin = true;
+    bool isIteratedFromStartElements = FindLinkContentStartElements(
+        templateTriple, startReplacementConstruction, result, startElements, isIteratedFromBegin);
+    if (!isIteratedFromStartElements)
+    {
+      it = CreateIterator(templateTriple, startReplacementConstruction, result);
+      isIteratedFromStartElements = !it;
+      if (isIteratedFromStartElements)
+        isIteratedFromBegin = FindVariableTripleStartElements(templateTriple, startElements);
+      else if (!it->IsValid())
+        SC_THROW_EXCEPTION(
+            utils::ExceptionInvalidState,
+            "Fully variable triple was selected during searching by specified sc-template. It is possible that you "
+            "have incorrect sc-template or you can't find constructions in knowledge base using this sc-template. "
+            "Check sc-template.");
+    }
+
+    ScAddr const otherStartAddr =
+        isIteratedFromStartElements
+            ? ResolveAddr((*templateTriple)[isIteratedFromBegin ? 2 : 0], startReplacementConstruction, result)
+            : ScAddr::Empty;
+
+    auto const & IteratorNext = [&]() -> bool
+    {
+      while (true)
+      {
+        if (it && it->Next())
+        {
+          ++m_iterationsCount;
+          return true;
+        }
+
+        if (!isIteratedFromStartElements || startElementIdx == startElements.size())
+          return false;
+
+        ScAddr const & startElement = startElements[startElementIdx++];
+        ScType const & connectorType = PrepareType((*templateTriple)[1]);
+        if (isIteratedFromBegin && otherStartAddr.IsValid())
+          it = m_context.Iterator3(startElement, connectorType, otherStartAddr);
+        else if (isIteratedFromBegin)
+          it = m_context.Iterator3(startElement, connectorType, PrepareType((*templateTriple)[2]));
+        else if (otherStartAddr.IsValid())
+          it = m_context.Iterator3(otherStartAddr, connectorType, startElement);
+        else
+          it = m_context.Iterator3(PrepareType((*templateTriple)[0]), connectorType, startElement);
+      }
+    };
 
     size_t checkedCurrentResultEqualTemplateTriplesCount = 0;
 
@@ -725,7 +1054,7 @@ private:
     do
     {
       ScReplacementTriple replacementTriple;
-      if (it->Next())
+      if (IteratorNext())
       {
         replacementTriple = it->Get();
         auto copiedTemplateTriplesIterator = templateTriplesIterator;
@@ -837,7 +1166,8 @@ private:
         for (size_t i = 0; i < items.size(); ++i)
         {
           ScAddr const & resolvedAddr = ResolveAddr(items[i], replacementConstruction, result);
-          if (resolvedAddr.IsValid() && resolvedAddr != replacementTriple[i])
+          if ((resolvedAddr.IsValid() && resolvedAddr != replacementTriple[i])
+              || (!resolvedAddr.IsValid() && !IsLinkContentSatisfied(items[i], replacementTriple[i])))
           {
             isForLastTemplateTripleAllChildrenFinished = false;
             isFinished = false;
@@ -978,6 +1308,7 @@ private:
 
   void AppendFoundReplacementConstruction(ScTemplateSearchResult & result, size_t & resultIdx)
   {
+    ++m_foundCount;
     if (m_callback)
     {
       m_callback(
@@ -1023,7 +1354,7 @@ private:
 
   void DoIterations(ScTemplateSearchResult & result)
   {
-    if (m_template.IsEmpty())
+    if (m_template.IsEmpty() || m_isLinkContentUnsatisfied)
       return;
 
     ScAddrVector newResult;
@@ -1063,6 +1394,7 @@ public:
     result.m_context = *m_context;
     result.m_replacementConstructions.assign(checkedResults.cbegin(), checkedResults.cend());
 
+    LogIfSlow(result.Size());
     return ScTemplate::Result(result.Size() > 0);
   }
 
@@ -1070,6 +1402,7 @@ public:
   {
     ScTemplateSearchResult result;
     DoIterations(result);
+    LogIfSlow(m_foundCount);
   }
 
   size_t CalculateOneResultSize() const
@@ -1078,6 +1411,58 @@ public:
   }
 
 private:
+  std::string ItemToSCs(ScTemplateItem const & item)
+  {
+    if (item.IsAddr() && m_context.IsElement(item.m_addrValue))
+    {
+      std::string const & systemIdtf = m_context.HelperGetSystemIdtf(item.m_addrValue);
+      if (!systemIdtf.empty())
+        return systemIdtf;
+    }
+
+    return item.HasName() ? item.m_name : "...";
+  }
+
+  std::string TripleToSCs(ScTemplateTriple const * triple)
+  {
+    ScTemplateItem const & connector = (*triple)[1];
+    std::string const & connectorAlias =
+        connector.IsType() ? scs::TypeResolver::GetConnectorAlias(connector.m_typeValue) : "";
+    if (connectorAlias.empty())
+      return ItemToSCs((*triple)[0]) + " | " + ItemToSCs(connector) + " | " + ItemToSCs((*triple)[2]) + ";;";
+
+    std::string const & sentence = ItemToSCs((*triple)[0]) + " " + connectorAlias + " " + ItemToSCs((*triple)[2]);
+    return connector.HasName() ? connector.m_name + " = (" + sentence + ");;" : sentence + ";;";
+  }
+
+  /*!
+   * Logs search if it lasts longer than threshold of template searches. Sc-template is described in SCs form together
+   * with triples which search was started from.
+   */
+  void LogIfSlow(size_t resultsCount)
+  {
+    double const duration = m_timer.Seconds() * 1000;
+    if (!utils::ScSlowOperationsLog::IsSlow(utils::ScSlowOperationsLog::Type::TemplateSearch, duration))
+      return;
+
+    std::stringstream description;
+    description << "template: {";
+    for (ScTemplateTriple const * triple : m_template.m_templateTriples)
+      description << " " << TripleToSCs(triple);
+
+    description << " }, start triples: {";
+    auto const & startTriples = m_template.Size() == 1 ? ScTemplateTriples{m_template.m_templateTriples[0]->m_index}
+                                                       : m_connectivityComponentPriorityTemplateTriples;
+    for (size_t const tripleIdx : startTriples)
+      description << " " << TripleToSCs(m_template.m_templateTriples[tripleIdx]);
+
+    description << " }, iterations: " << m_iterationsCount << ", results: " << resultsCount;
+    if (m_structure.IsValid())
+      description << ", structure: " << m_structure.Hash();
+
+    utils::ScSlowOperationsLog::Add(utils::ScSlowOperationsLog::Type::TemplateSearch, duration, description.str());
+  }
+
   ScTemplate & m_template;
   ScMemoryContext & m_context;
 
@@ -1086,6 +1471,11 @@ private:
   ScTemplateTriples m_cycledTemplateTriples;
   std::vector<ScTemplateTriples> m_connectivityComponentsTemplateTriples;
   ScTemplateTriples m_connectivityComponentPriorityTemplateTriples;
+  std::map<std::string, size_t> m_templateItemsNamesToLinkContentEstimates;
+  std::map<std::string, ScAddrSet> m_templateItemsNamesToLinkContentCandidates;
+  std::unordered_map<size_t, size_t> m_linkContentTemplateTriplesToStartItems;
+  std::map<std::string, std::unordered_map<ScAddr, bool, ScAddrHashFunc<uint32_t>>> m_checkedLinksContents;
+  bool m_isLinkContentUnsatisfied = false;
 
   // fields search by template
   std::vector<UsedEdges> m_notUsedEdgesInTemplateTriples;
@@ -1101,6 +1491,11 @@ private:
   // fields for append result handling
   bool isStopped = false;
 
+  // fields for logging of slow search
+  ScTimer m_timer;
+  size_t m_iterationsCount = 0;
+  size_t m_foundCount = 0;
+
   ScAddr const m_structure;
   ScTemplateSearchResultCallback m_callback;
   ScTemplateSearchResultCallbackWithRequest m_callbackWithRequest;
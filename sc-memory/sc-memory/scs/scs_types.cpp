@@ -102,6 +102,17 @@ ScType const & TypeResolver::GetKeynodeType(std::string const & keynodeAlias)
   return it != ms_keynodeToType.cend() ? it->second : ScType::Unknown;
 }
 
+std::string TypeResolver::GetConnectorAlias(ScType const & connectorType)
+{
+  for (auto const & it : ms_connectorToType)
+  {
+    if (it.second == connectorType && !IsConnectorReversed(it.first))
+      return it.first;
+  }
+
+  return "";
+}
+
 bool TypeResolver::IsConnectorReversed(std::string const & connectorAlias)
 {
   return ms_reversedConnectors.find(connectorAlias) != ms_reversedConnectors.cend();
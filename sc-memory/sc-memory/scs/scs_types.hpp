@@ -17,6 +17,8 @@ class TypeResolver final
 public:
   static ScType const & GetConnectorType(std::string const & connectorAlias);
   static ScType const & GetKeynodeType(std::string const & keynodeAlias);
+  //! Returns not reversed connector alias of the specified sc-connector type, or empty string if there isn't it
+  static std::string GetConnectorAlias(ScType const & connectorType);
 
   static bool IsConnectorReversed(std::string const & connectorAlias);
   static bool IsConst(std::string const & idtf);
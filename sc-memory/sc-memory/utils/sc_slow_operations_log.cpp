@@ -0,0 +1,124 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_slow_operations_log.hpp"
+
+#include <iomanip>
+
+namespace
+{
+// should be synced with ScSlowOperationsLog::Type
+std::string const kTypeToStr[] = {"TemplateSearch", "AgentAction", "ServerRequest"};
+
+//! Period in seconds to flush log file, entries are written without flush not to do it under lock for each of them
+std::time_t constexpr kFileFlushPeriod = 5;
+
+}  // namespace
+
+namespace utils
+{
+std::atomic<double> ScSlowOperationsLog::ms_thresholds[size_t(Type::Count)] = {{0}, {0}, {0}};
+
+std::mutex ScSlowOperationsLog::ms_mutex;
+std::vector<ScSlowOperationsLog::Entry> ScSlowOperationsLog::ms_entries;
+size_t ScSlowOperationsLog::ms_maxEntriesCount = DEFAULT_SLOW_OPERATIONS_LOG_SIZE;
+size_t ScSlowOperationsLog::ms_nextEntryIdx = 0;
+std::ofstream ScSlowOperationsLog::ms_fileStream;
+std::time_t ScSlowOperationsLog::ms_lastFileFlushTime = 0;
+
+void ScSlowOperationsLog::SetUp(sc_memory_params const & params)
+{
+  Shutdown();
+
+  std::lock_guard<std::mutex> lock(ms_mutex);
+  ms_maxEntriesCount = params.slow_operations_log_size;
+  ms_entries.reserve(ms_maxEntriesCount);
+
+  if (params.slow_operations_log_file != nullptr && *params.slow_operations_log_file != '\0')
+    ms_fileStream.open(params.slow_operations_log_file, std::ofstream::out | std::ofstream::app);
+  ms_lastFileFlushTime = std::time(nullptr);
+
+  SetThreshold(Type::TemplateSearch, params.slow_template_search_threshold);
+  SetThreshold(Type::AgentAction, params.slow_agent_threshold);
+  SetThreshold(Type::ServerRequest, params.slow_server_request_threshold);
+}
+
+void ScSlowOperationsLog::Shutdown()
+{
+  for (auto & threshold : ms_thresholds)
+    threshold.store(0, std::memory_order_relaxed);
+
+  std::lock_guard<std::mutex> lock(ms_mutex);
+  ms_entries.clear();
+  ms_entries.shrink_to_fit();
+  ms_nextEntryIdx = 0;
+
+  if (ms_fileStream.is_open())
+  {
+    ms_fileStream.flush();
+    ms_fileStream.close();
+  }
+}
+
+void ScSlowOperationsLog::SetThreshold(Type type, double threshold)
+{
+  ms_thresholds[size_t(type)].store(threshold, std::memory_order_relaxed);
+}
+
+bool ScSlowOperationsLog::IsSlow(Type type, double duration)
+{
+  double const threshold = ms_thresholds[size_t(type)].load(std::memory_order_relaxed);
+  return threshold > 0 && duration >= threshold;
+}
+
+void ScSlowOperationsLog::Add(Type type, double duration, std::string const & description)
+{
+  Entry entry{type, std::time(nullptr), duration, description};
+
+  std::lock_guard<std::mutex> lock(ms_mutex);
+  if (ms_fileStream.is_open())
+  {
+    std::tm tm = *std::localtime(&entry.m_time);
+    ms_fileStream << "[" << std::put_time(&tm, "%Y-%m-%d %H:%M:%S") << "][" << GetTypeName(type) << "][" << std::fixed
+                  << std::setprecision(3) << duration << " ms]: " << description << '\n';
+
+    if (entry.m_time - ms_lastFileFlushTime >= kFileFlushPeriod)
+    {
+      ms_fileStream.flush();
+      ms_lastFileFlushTime = entry.m_time;
+    }
+  }
+
+  if (ms_maxEntriesCount == 0)
+    return;
+
+  // the oldest entry is replaced when buffer is full
+  if (ms_entries.size() < ms_maxEntriesCount)
+    ms_entries.push_back(std::move(entry));
+  else
+    ms_entries[ms_nextEntryIdx] = std::move(entry);
+  ms_nextEntryIdx = (ms_nextEntryIdx + 1) % ms_maxEntriesCount;
+}
+
+std::vector<ScSlowOperationsLog::Entry> ScSlowOperationsLog::GetEntries()
+{
+  std::lock_guard<std::mutex> lock(ms_mutex);
+  if (ms_entries.size() < ms_maxEntriesCount)
+    return ms_entries;
+
+  std::vector<Entry> entries;
+  entries.reserve(ms_entries.size());
+  entries.insert(entries.end(), ms_entries.cbegin() + ms_nextEntryIdx, ms_entries.cend());
+  entries.insert(entries.end(), ms_entries.cbegin(), ms_entries.cbegin() + ms_nextEntryIdx);
+  return entries;
+}
+
+std::string const & ScSlowOperationsLog::GetTypeName(Type type)
+{
+  return kTypeToStr[size_t(type)];
+}
+
+}  // namespace utils
@@ -0,0 +1,82 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+#pragma once
+
+#include "../sc_defines.hpp"
+
+extern "C"
+{
+#include "sc-core/sc_memory_params.h"
+}
+
+#include <atomic>
+#include <ctime>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace utils
+{
+/*!
+ * Log of operations lasting longer than thresholds specified by sc-memory params. Only durations of operations are
+ * compared with thresholds while operations are processed, so the log can stay enabled under load; descriptions are
+ * formed for slow operations only. The last slow operations are kept in ring buffer, and they are appended into log
+ * file if it is specified. Log file is flushed periodically and on shutdown.
+ */
+class ScSlowOperationsLog final
+{
+public:
+  // should be synced with kTypeToStr in cpp
+  enum class Type : uint8_t
+  {
+    TemplateSearch = 0,
+    AgentAction,
+    ServerRequest,
+    Count
+  };
+
+  struct Entry
+  {
+    Type m_type;
+    //! Time when operation was finished
+    std::time_t m_time;
+    //! Duration of operation in milliseconds
+    double m_duration;
+    std::string m_description;
+  };
+
+  _SC_EXTERN static void SetUp(sc_memory_params const & params);
+
+  _SC_EXTERN static void Shutdown();
+
+  /*! Sets duration (in milliseconds) after which operations of the specified type are logged, 0 disables logging
+   * of them.
+   */
+  _SC_EXTERN static void SetThreshold(Type type, double threshold);
+
+  //! Returns true if operation of the specified type with the specified duration (in milliseconds) should be logged
+  _SC_EXTERN static bool IsSlow(Type type, double duration);
+
+  _SC_EXTERN static void Add(Type type, double duration, std::string const & description);
+
+  //! Returns the last slow operations from the oldest to the newest one
+  _SC_EXTERN static std::vector<Entry> GetEntries();
+
+  _SC_EXTERN static std::string const & GetTypeName(Type type);
+
+private:
+  static std::atomic<double> ms_thresholds[size_t(Type::Count)];
+
+  static std::mutex ms_mutex;
+  static std::vector<Entry> ms_entries;
+  static size_t ms_maxEntriesCount;
+  static size_t ms_nextEntryIdx;
+  static std::ofstream ms_fileStream;
+  static std::time_t ms_lastFileFlushTime;
+};
+
+}  // namespace utils
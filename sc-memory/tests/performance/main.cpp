@@ -9,16 +9,26 @@
 #include "units/memory_create_edge.hpp"
 #include "units/memory_create_node.hpp"
 #include "units/memory_create_link.hpp"
+#include "units/memory_elements_info.hpp"
+#include "units/memory_event_delivery.hpp"
+#include "units/memory_hash_table.hpp"
 #include "units/memory_iterator_search.hpp"
+#include "units/memory_load.hpp"
+#include "units/memory_neighbourhood.hpp"
+#include "units/memory_ordered_set.hpp"
 #include "units/memory_search_link_by_content.hpp"
+#include "units/memory_search_link_by_exact_content.hpp"
 #include "units/memory_remove_diff_elements.hpp"
 #include "units/memory_remove_set_elements.hpp"
+#include "units/memory_scs_build.hpp"
 
 #include "units/memory_remove_elements.hpp"
 
 #include "units/sc_code_base_vs_extend.hpp"
 
+#include "units/template_generate.hpp"
 #include "units/template_search_complex.hpp"
+#include "units/template_search_link_content.hpp"
 #include "units/template_search_smoke.hpp"
 
 #include <atomic>
@@ -373,6 +383,33 @@ BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestIteratorSearch)
 ->Arg(kSetPower)
 ->Unit(benchmark::TimeUnit::kMicrosecond);
 
+// each iteration walks over the whole shuffled set
+int constexpr kSetWalksNum = 10;
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestIteratorSearchShuffled)
+->Threads(1)
+->Iterations(kSetWalksNum)
+->Arg(kSetPower)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestIteratorSearchShuffled)
+->Threads(4)
+->Iterations(kSetWalksNum)
+->Arg(kSetPower)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestIteratorSearchBatched)
+->Threads(1)
+->Iterations(kSetWalksNum)
+->Arg(kSetPower)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestIteratorSearchBatched)
+->Threads(4)
+->Iterations(kSetWalksNum)
+->Arg(kSetPower)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
 BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestSearchLinkByContent)
 ->Threads(1)
 ->Iterations(kSetPower)
@@ -500,6 +537,23 @@ void BM_MemoryRanged(benchmark::State & state)
   test.Shutdown();
 }
 
+//! Runs load benchmark and reports growth of resident memory after load, while sc-links aren't searched yet
+template <class BMType>
+void BM_MemoryLoadResident(benchmark::State & state)
+{
+  BMType test;
+  test.Initialize(state.range(0));
+  double idleResidentSize = 0;
+  for (auto t : state)
+  {
+    test.Run();
+    idleResidentSize += (double)test.GetIdleResidentSize();
+  }
+  state.counters["idle_rss"] = benchmark::Counter(
+      idleResidentSize / (double)state.iterations(), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+  test.Shutdown();
+}
+
 BENCHMARK_TEMPLATE(BM_MemoryRanged, TestCreateEdge)
 ->Unit(benchmark::TimeUnit::kMicrosecond)
 ->Arg(1000)
@@ -510,6 +564,131 @@ BENCHMARK_TEMPLATE(BM_MemoryRanged, TestRemoveElements)
 ->Arg(10)->Arg(100)->Arg(1000)
 ->Iterations(5000);
 
+int constexpr kOrderedSetElementsNum = 100000;
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestOrderedSetGetElement)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(kOrderedSetElementsNum)
+->Iterations(10000);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestIndexedOrderedSetGetElement)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(kOrderedSetElementsNum)
+->Iterations(10000);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestOrderedSetGetNextElement)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(kOrderedSetElementsNum)
+->Iterations(kOrderedSetElementsNum);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestIndexedOrderedSetGetNextElement)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(kOrderedSetElementsNum)
+->Iterations(kOrderedSetElementsNum);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestLoadMemory)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(100000)->Arg(1000000)
+->Iterations(5);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestLoadTermsDictionary)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(100000)->Arg(1000000)
+->Iterations(5);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestLoadSortedTermsDictionary)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(100000)->Arg(1000000)
+->Iterations(5);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestLoadLazyDictionaries)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(100000)->Arg(1000000)
+->Iterations(5);
+
+// resident memory of idle sc-memory is compared with memory of sc-memory which dictionaries are loaded on startup
+BENCHMARK_TEMPLATE(BM_MemoryLoadResident, TestLoadSortedTermsDictionary)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(100000)->Arg(1000000)
+->Iterations(5);
+
+BENCHMARK_TEMPLATE(BM_MemoryLoadResident, TestLoadLazyDictionaries)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(100000)->Arg(1000000)
+->Iterations(5);
+
+// sources are generated with new sc-elements on each iteration, identifiers are resolved in sc-memory or symbol table
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestBuildScsSources)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(100)->Arg(1000)
+->Iterations(5);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestBuildScsSourcesWithSymbolTable)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(100)->Arg(1000)
+->Iterations(5);
+
+int constexpr kElementsInfoNum = 10000;
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestGetElementsInfoByElement)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(kElementsInfoNum)
+->Iterations(100);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestGetElementsInfoByBatch)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(kElementsInfoNum)
+->Iterations(100);
+
+int constexpr kEventsNum = 10000;
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestEventDeliveryByElement)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(kEventsNum)
+->Iterations(20);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestEventDeliveryByBatch)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(kEventsNum)
+->Iterations(20);
+
+// contents longer than max searchable string size are found by content hash only
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestSearchLinkByExactContent)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(10)->Arg(1000)->Arg(100000)
+->Iterations(10000);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestNeighbourhoodByIterators)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(10)->Arg(100)->Arg(1000)
+->Iterations(1000);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestNeighbourhoodByStorage)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(10)->Arg(100)->Arg(1000)
+->Iterations(1000);
+
+// sc-hash-table vs GLib hash table
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestScHashTableGet)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(1000)->Arg(100000)->Arg(1000000)
+->Iterations(1000000);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestGHashTableGet)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(1000)->Arg(100000)->Arg(1000000)
+->Iterations(1000000);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestScHashTableInsertRemove)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(1000)->Arg(100000)->Arg(1000000)
+->Iterations(1000000);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestGHashTableInsertRemove)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(1000)->Arg(100000)->Arg(1000000)
+->Iterations(1000000);
+
 // ------------------------------------
 template <class BMType>
 void BM_Template(benchmark::State & state)
@@ -536,6 +715,19 @@ BENCHMARK_TEMPLATE(BM_Template, TestTemplateSearchComplex)
 ->Unit(benchmark::TimeUnit::kMicrosecond)
 ->Arg(5)->Arg(50);
 
+// link content predicates evaluated by fs-memory dictionary vs checked for each found sc-link
+BENCHMARK_TEMPLATE(BM_Template, TestTemplateSearchByIndexedLinkContent)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(50)->Arg(500)->Arg(5000);
+
+BENCHMARK_TEMPLATE(BM_Template, TestTemplateSearchByLinkContentRange)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(50)->Arg(500)->Arg(5000);
+
+BENCHMARK_TEMPLATE(BM_Template, TestTemplateGenerate)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(5)->Arg(50)->Arg(500);
+
 // SC-code base vs extended
 BENCHMARK_TEMPLATE(BM_Template, TestScCodeBase)
 ->Unit(benchmark::TimeUnit::kMicrosecond)
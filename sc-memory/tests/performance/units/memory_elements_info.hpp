@@ -0,0 +1,54 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+#include <algorithm>
+#include <random>
+
+class TestGetElementsInfoByElement : public TestMemory
+{
+public:
+  void Run()
+  {
+    ScAddr sourceAddr, targetAddr;
+    for (ScAddr const & addr : m_addrs)
+    {
+      ScType const & type = m_ctx->GetElementType(addr);
+      if (type.IsEdge())
+        m_ctx->GetEdgeInfo(addr, sourceAddr, targetAddr);
+      m_ctx->GetElementOutputArcsCount(addr);
+    }
+  }
+
+  void Setup(size_t elementsNum) override
+  {
+    ScAddr const & setAddr = m_ctx->CreateNode(ScType::NodeConst);
+    for (size_t i = 0; i < elementsNum / 2; ++i)
+    {
+      ScAddr const & nodeAddr = m_ctx->CreateNode(ScType::NodeConst);
+      m_addrs.push_back(nodeAddr);
+      m_addrs.push_back(m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, setAddr, nodeAddr));
+    }
+
+    // addresses come in arbitrary order, as in requests of sc-server clients
+    std::shuffle(m_addrs.begin(), m_addrs.end(), std::mt19937{0});
+  }
+
+protected:
+  ScAddrVector m_addrs;
+};
+
+class TestGetElementsInfoByBatch : public TestGetElementsInfoByElement
+{
+public:
+  void Run()
+  {
+    BENCHMARK_BUILTIN_EXPECT(m_ctx->GetElementsInfo(m_addrs).size() == m_addrs.size(), SC_TRUE);
+  }
+};
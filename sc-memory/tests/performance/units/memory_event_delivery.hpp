@@ -0,0 +1,82 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+#include "sc-memory/sc_event.hpp"
+
+#include <atomic>
+#include <thread>
+
+class TestEventDeliveryByElement : public TestMemory
+{
+public:
+  void Run()
+  {
+    m_deliveredCount = 0;
+    ScEventAddOutputEdge event(
+        *m_ctx,
+        m_nodeAddr,
+        [this](ScAddr const &, ScAddr const &, ScAddr const &)
+        {
+          ++m_deliveredCount;
+          return true;
+        });
+
+    EmitAndWait();
+  }
+
+  void Setup(size_t eventsNum) override
+  {
+    m_eventsNum = eventsNum;
+    m_nodeAddr = m_ctx->CreateNode(ScType::NodeConst);
+    m_otherAddr = m_ctx->CreateNode(ScType::NodeConst);
+  }
+
+protected:
+  void EmitAndWait()
+  {
+    for (size_t i = 0; i < m_eventsNum; ++i)
+      m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_nodeAddr, m_otherAddr);
+
+    while (m_deliveredCount.load() < m_eventsNum)
+      std::this_thread::yield();
+  }
+
+  size_t m_eventsNum = 0;
+  ScAddr m_nodeAddr;
+  ScAddr m_otherAddr;
+  std::atomic_size_t m_deliveredCount = 0;
+};
+
+class TestEventDeliveryByBatch : public TestEventDeliveryByElement
+{
+public:
+  void Run()
+  {
+    m_deliveredCount = 0;
+    ScEvent event(
+        *m_ctx,
+        m_nodeAddr,
+        ScEvent::Type::AddOutputEdge,
+        ScEvent::DelegateBatchFunc(
+            [this](ScAddr const &, ScEvent::Batch const & batch)
+            {
+              m_deliveredCount += batch.size();
+              return true;
+            }),
+        kMaxBatchSize,
+        kMaxBatchDelayMs);
+
+    EmitAndWait();
+  }
+
+private:
+  static sc_uint32 constexpr kMaxBatchSize = 256;
+  static sc_uint32 constexpr kMaxBatchDelayMs = 5;
+};
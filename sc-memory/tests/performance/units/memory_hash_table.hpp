@@ -0,0 +1,156 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+#include <vector>
+
+extern "C"
+{
+#include "sc-core/sc-store/sc-container/sc-hash-table/sc_hash_table.h"
+}
+
+/*!
+ * Compares sc-hash-table with GLib hash table on sc-addr hashes keys, as they are used in sc-memory tables.
+ * Tables aren't thread-safe, so these tests are run only in one thread.
+ */
+class TestHashTable : public TestMemory
+{
+public:
+  void Setup(size_t keysNum) override
+  {
+    m_keys.reserve(keysNum);
+    for (size_t i = 0; i < keysNum; ++i)
+    {
+      sc_addr addr;
+      addr.seg = i / SC_SEGMENT_ELEMENTS_COUNT + 1;
+      addr.offset = i % SC_SEGMENT_ELEMENTS_COUNT + 1;
+      m_keys.push_back(GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(addr)));
+    }
+  }
+
+protected:
+  std::vector<void *> m_keys;
+  size_t m_position = 0;
+
+  void * NextKey()
+  {
+    m_position = (m_position + 1) % m_keys.size();
+    return m_keys[m_position];
+  }
+};
+
+class TestScHashTableGet : public TestHashTable
+{
+public:
+  ~TestScHashTableGet()
+  {
+    sc_hash_table_destroy(m_table);
+  }
+
+  void Run()
+  {
+    BENCHMARK_BUILTIN_EXPECT(sc_hash_table_get(m_table, NextKey()) != nullptr, true);
+  }
+
+  void Setup(size_t keysNum) override
+  {
+    TestHashTable::Setup(keysNum);
+    m_table = sc_hash_table_init(
+        sc_hash_table_default_hash_func, sc_hash_table_default_equal_func, nullptr, nullptr);
+    for (void * key : m_keys)
+      sc_hash_table_insert(m_table, key, key);
+  }
+
+private:
+  sc_hash_table * m_table = nullptr;
+};
+
+class TestGHashTableGet : public TestHashTable
+{
+public:
+  ~TestGHashTableGet()
+  {
+    if (m_table != nullptr)
+      g_hash_table_destroy(m_table);
+  }
+
+  void Run()
+  {
+    BENCHMARK_BUILTIN_EXPECT(g_hash_table_lookup(m_table, NextKey()) != nullptr, true);
+  }
+
+  void Setup(size_t keysNum) override
+  {
+    TestHashTable::Setup(keysNum);
+    m_table = g_hash_table_new(g_direct_hash, g_direct_equal);
+    for (void * key : m_keys)
+      g_hash_table_insert(m_table, key, key);
+  }
+
+private:
+  GHashTable * m_table = nullptr;
+};
+
+class TestScHashTableInsertRemove : public TestHashTable
+{
+public:
+  ~TestScHashTableInsertRemove()
+  {
+    sc_hash_table_destroy(m_table);
+  }
+
+  void Run()
+  {
+    void * key = NextKey();
+    if (m_position == 0)
+      sc_hash_table_remove_all(m_table);
+
+    sc_hash_table_insert(m_table, key, key);
+    sc_hash_table_remove(m_table, m_keys[m_position / 2]);
+  }
+
+  void Setup(size_t keysNum) override
+  {
+    TestHashTable::Setup(keysNum);
+    m_table = sc_hash_table_init(
+        sc_hash_table_default_hash_func, sc_hash_table_default_equal_func, nullptr, nullptr);
+  }
+
+private:
+  sc_hash_table * m_table = nullptr;
+};
+
+class TestGHashTableInsertRemove : public TestHashTable
+{
+public:
+  ~TestGHashTableInsertRemove()
+  {
+    if (m_table != nullptr)
+      g_hash_table_destroy(m_table);
+  }
+
+  void Run()
+  {
+    void * key = NextKey();
+    if (m_position == 0)
+      g_hash_table_remove_all(m_table);
+
+    g_hash_table_insert(m_table, key, key);
+    g_hash_table_remove(m_table, m_keys[m_position / 2]);
+  }
+
+  void Setup(size_t keysNum) override
+  {
+    TestHashTable::Setup(keysNum);
+    m_table = g_hash_table_new(g_direct_hash, g_direct_equal);
+  }
+
+private:
+  GHashTable * m_table = nullptr;
+};
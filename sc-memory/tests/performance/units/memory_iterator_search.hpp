@@ -6,6 +6,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <random>
+
 #include "memory_test.hpp"
 
 class TestIteratorSearch : public TestMemory
@@ -37,3 +40,73 @@ private:
 };
 
 ScAddr TestIteratorSearch::m_node;
+
+/*!
+ * Walks over all sc-arcs of a set, sc-arcs and targets of which are scattered over sc-memory. Iterator is created for
+ * each walk, so each run walks over the whole set. It is baseline for `TestIteratorSearchBatched`, so that both walk
+ * over the same shuffled set in the same order.
+ */
+class TestIteratorSearchShuffled : public TestMemory
+{
+public:
+  void Run()
+  {
+    auto const it = m_ctx->Iterator3(m_node, ScType::EdgeAccessConstPosPerm, ScType::NodeConst);
+    if (GetBatchSize() != 0)
+      it->SetBatchSize(GetBatchSize());
+
+    size_t count = 0;
+    while (it->Next())
+      ++count;
+
+    BENCHMARK_BUILTIN_EXPECT(count == m_edgesNum, true);
+  }
+
+  void Setup(size_t edgesNum) override
+  {
+    std::mt19937 random(edgesNum);
+    std::vector<ScAddr> targets;
+    for (size_t i = 0; i < edgesNum; ++i)
+      targets.push_back(m_ctx->CreateNode(ScType::NodeConst));
+    std::shuffle(targets.begin(), targets.end(), random);
+
+    // released sc-elements are reused by new ones, so sc-arcs take places of shuffled erased sc-elements
+    std::vector<ScAddr> places;
+    for (size_t i = 0; i < edgesNum; ++i)
+      places.push_back(m_ctx->CreateNode(ScType::NodeConst));
+    std::shuffle(places.begin(), places.end(), random);
+    for (ScAddr const & place : places)
+      m_ctx->EraseElement(place);
+
+    m_node = m_ctx->CreateNode(ScType::NodeConstClass);
+    for (ScAddr const & target : targets)
+      m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_node, target);
+    m_edgesNum = edgesNum;
+  }
+
+protected:
+  virtual size_t GetBatchSize() const
+  {
+    return 0;
+  }
+
+private:
+  static ScAddr m_node;
+  static size_t m_edgesNum;
+};
+
+ScAddr TestIteratorSearchShuffled::m_node;
+size_t TestIteratorSearchShuffled::m_edgesNum = 0;
+
+/*!
+ * Walks over sc-arcs of the same shuffled set as `TestIteratorSearchShuffled` in batch mode of sc-iterator3.
+ * Run with `--benchmark_perf_counters=CYCLES,CACHE-MISSES` to compare cache misses with `TestIteratorSearchShuffled`.
+ */
+class TestIteratorSearchBatched : public TestIteratorSearchShuffled
+{
+protected:
+  size_t GetBatchSize() const override
+  {
+    return 16;
+  }
+};
@@ -0,0 +1,169 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+#include <fstream>
+#include <unistd.h>
+
+#if defined(__GLIBC__)
+#  include <malloc.h>
+#endif
+
+class TestLoadMemory : public TestMemory
+{
+public:
+  void Run()
+  {
+    // memory is loaded from dump saved by Setup
+    ScMemory::Shutdown(false);
+    LoadMemory();
+  }
+
+  void Setup(size_t elementsNum) override
+  {
+    ScAddr const & classAddr = m_ctx->CreateNode(ScType::NodeConstClass);
+    for (size_t i = 0; i < elementsNum; ++i)
+    {
+      ScAddr const & nodeAddr = m_ctx->CreateNode(ScType::NodeConst);
+      ScAddr const & linkAddr = m_ctx->CreateLink(ScType::LinkConst);
+      m_ctx->SetLinkContent(linkAddr, "content " + std::to_string(i));
+
+      m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, classAddr, nodeAddr);
+      m_ctx->CreateEdge(ScType::EdgeDCommonConst, nodeAddr, linkAddr);
+    }
+
+    m_ctx.reset();
+    ScMemory::Shutdown(true);
+    LoadMemory();
+  }
+
+private:
+  void LoadMemory()
+  {
+    sc_memory_params params;
+    sc_memory_params_clear(&params);
+    params.clear = SC_FALSE;
+    params.repo_path = "test_repo";
+
+    ScMemory::Initialize(params);
+  }
+};
+
+//! Loads memory with text links, so its load time depends on the format of `term - offsets` dictionary
+class TestLoadTextMemory : public TestMemory
+{
+public:
+  void Run()
+  {
+    ScMemory::Shutdown(false);
+    size_t const residentSize = GetResidentMemorySize();
+    LoadMemory(SC_FALSE);
+    size_t const loadedResidentSize = GetResidentMemorySize();
+    m_idleResidentSize = loadedResidentSize > residentSize ? loadedResidentSize - residentSize : 0;
+  }
+
+  //! Returns growth of resident memory of process after the last load, while sc-links aren't searched yet
+  size_t GetIdleResidentSize() const
+  {
+    return m_idleResidentSize;
+  }
+
+  void Setup(size_t linksNum) override
+  {
+    // memory is reinitialized to save `term - offsets` dictionary in the tested format
+    m_ctx.reset();
+    ScMemory::Shutdown(false);
+    LoadMemory(SC_TRUE);
+    InitContext();
+
+    for (size_t i = 0; i < linksNum; ++i)
+    {
+      ScAddr const & linkAddr = m_ctx->CreateLink(ScType::LinkConst);
+      m_ctx->SetLinkContent(
+          linkAddr,
+          "text " + std::to_string(i) + " describes concept_" + std::to_string(i % 5000) + " of subject domain "
+              + std::to_string(i % 97) + " with term_" + std::to_string(i * 7));
+    }
+
+    m_ctx.reset();
+    ScMemory::Shutdown(true);
+    LoadMemory(SC_FALSE);
+  }
+
+protected:
+  virtual sc_bool IsTermsDictionarySorted() const = 0;
+
+  virtual sc_bool IsDictionariesLoadingLazy() const
+  {
+    return SC_FALSE;
+  }
+
+private:
+  void LoadMemory(sc_bool clear)
+  {
+    sc_memory_params params;
+    sc_memory_params_clear(&params);
+    params.clear = clear;
+    params.repo_path = "test_repo";
+    params.sorted_terms_dictionary = IsTermsDictionarySorted();
+    params.lazy_dictionaries_loading = IsDictionariesLoadingLazy();
+
+    ScMemory::Initialize(params);
+  }
+
+  //! Returns resident memory size of process in bytes, memory freed on shutdown is returned to system before
+  static size_t GetResidentMemorySize()
+  {
+#if defined(__GLIBC__)
+    malloc_trim(0);
+#endif
+    size_t totalPages = 0;
+    size_t residentPages = 0;
+    std::ifstream statm("/proc/self/statm");
+    if (!(statm >> totalPages >> residentPages))
+      return 0;
+
+    return residentPages * (size_t)sysconf(_SC_PAGESIZE);
+  }
+
+  size_t m_idleResidentSize = 0;
+};
+
+class TestLoadSortedTermsDictionary : public TestLoadTextMemory
+{
+protected:
+  sc_bool IsTermsDictionarySorted() const override
+  {
+    return SC_TRUE;
+  }
+};
+
+class TestLoadTermsDictionary : public TestLoadTextMemory
+{
+protected:
+  sc_bool IsTermsDictionarySorted() const override
+  {
+    return SC_FALSE;
+  }
+};
+
+//! Measures time to ready and resident memory if dictionaries are loaded on first search
+class TestLoadLazyDictionaries : public TestLoadTextMemory
+{
+protected:
+  sc_bool IsTermsDictionarySorted() const override
+  {
+    return SC_TRUE;
+  }
+
+  sc_bool IsDictionariesLoadingLazy() const override
+  {
+    return SC_TRUE;
+  }
+};
@@ -0,0 +1,87 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include <queue>
+#include <set>
+
+#include "memory_test.hpp"
+
+/*!
+ * Finds two-hop neighbourhood of a class node, which elements have subclasses and role sc-arcs, as UI translators
+ * and search agents do.
+ */
+class TestNeighbourhood : public TestMemory
+{
+public:
+  void Setup(size_t elementsNum) override
+  {
+    m_root = m_ctx->CreateNode(ScType::NodeConstClass);
+    ScAddr const & roleAddr = m_ctx->CreateNode(ScType::NodeConstRole);
+    for (size_t i = 0; i < elementsNum; ++i)
+    {
+      ScAddr const & elementAddr = m_ctx->CreateNode(ScType::NodeConst);
+      ScAddr const & arcAddr = m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_root, elementAddr);
+      m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, roleAddr, arcAddr);
+
+      ScAddr const & classAddr = m_ctx->CreateNode(ScType::NodeConstClass);
+      m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, classAddr, elementAddr);
+    }
+  }
+
+protected:
+  static size_t constexpr kDepth = 2;
+  ScAddr m_root;
+};
+
+class TestNeighbourhoodByIterators : public TestNeighbourhood
+{
+public:
+  void Run()
+  {
+    std::set<ScAddr, ScAddrLessFunc> found{m_root};
+    std::queue<std::pair<ScAddr, size_t>> queue;
+    queue.push({m_root, 0});
+    while (!queue.empty())
+    {
+      ScAddr const addr = queue.front().first;
+      size_t const depth = queue.front().second;
+      queue.pop();
+      if (depth == kDepth)
+        continue;
+
+      auto const & add = [&](ScAddr const & connectorAddr, ScAddr const & otherAddr)
+      {
+        if (found.insert(connectorAddr).second)
+          queue.push({connectorAddr, depth + 1});
+        if (found.insert(otherAddr).second)
+          queue.push({otherAddr, depth + 1});
+      };
+
+      ScIterator3Ptr it = m_ctx->Iterator3(addr, ScType::Unknown, ScType::Unknown);
+      while (it->Next())
+        add(it->Get(1), it->Get(2));
+
+      it = m_ctx->Iterator3(ScType::Unknown, ScType::Unknown, addr);
+      while (it->Next())
+        add(it->Get(1), it->Get(0));
+    }
+
+    BENCHMARK_BUILTIN_EXPECT(found.size() > 1, true);
+  }
+};
+
+class TestNeighbourhoodByStorage : public TestNeighbourhood
+{
+public:
+  void Run()
+  {
+    ScAddrVector const & found =
+        m_ctx->GetNeighbourhood(m_root, {kDepth, true, true, ScType::Unknown, ScType::Unknown, 0});
+    BENCHMARK_BUILTIN_EXPECT(found.size() > 1, true);
+  }
+};
@@ -0,0 +1,85 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+#include "sc-memory/sc_keynodes.hpp"
+
+class TestOrderedSetGetElement : public TestMemory
+{
+public:
+  void Run()
+  {
+    m_position = m_position % ScKeynodes::GetRrelIndexNum() + 1;
+    BENCHMARK_BUILTIN_EXPECT(m_ctx->HelperGetOrderedSetElement(m_set, m_position).IsValid(), SC_TRUE);
+  }
+
+  void Setup(size_t elementsNum) override
+  {
+    m_set = m_ctx->CreateNode(ScType::NodeConst);
+
+    ScAddr previousArcAddr;
+    for (size_t i = 0; i < elementsNum; ++i)
+    {
+      ScAddr const & elementAddr = m_ctx->CreateNode(ScType::NodeConst);
+      ScAddr const & arcAddr = m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_set, elementAddr);
+      if (i < ScKeynodes::GetRrelIndexNum())
+        m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, ScKeynodes::GetRrelIndex(i), arcAddr);
+
+      if (previousArcAddr.IsValid())
+      {
+        ScAddr const & sequenceArcAddr = m_ctx->CreateEdge(ScType::EdgeDCommonConst, previousArcAddr, arcAddr);
+        m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, ScKeynodes::kNrelBasicSequence, sequenceArcAddr);
+      }
+      else
+        m_first = elementAddr;
+
+      previousArcAddr = arcAddr;
+    }
+  }
+
+protected:
+  ScAddr m_set;
+  ScAddr m_first;
+  size_t m_position = 0;
+};
+
+class TestOrderedSetGetNextElement : public TestOrderedSetGetElement
+{
+public:
+  void Run()
+  {
+    if (!m_current.IsValid())
+      m_current = m_first;
+
+    m_current = m_ctx->HelperGetNextOrderedSetElement(m_set, m_current);
+  }
+
+private:
+  ScAddr m_current;
+};
+
+class TestIndexedOrderedSetGetElement : public TestOrderedSetGetElement
+{
+public:
+  void Setup(size_t elementsNum) override
+  {
+    TestOrderedSetGetElement::Setup(elementsNum);
+    m_ctx->HelperIndexOrderedSet(m_set);
+  }
+};
+
+class TestIndexedOrderedSetGetNextElement : public TestOrderedSetGetNextElement
+{
+public:
+  void Setup(size_t elementsNum) override
+  {
+    TestOrderedSetGetNextElement::Setup(elementsNum);
+    m_ctx->HelperIndexOrderedSet(m_set);
+  }
+};
@@ -0,0 +1,72 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+#include "sc-memory/sc_scs_helper.hpp"
+
+#include <sstream>
+
+//! Generates SCs-sources that use the same system identifiers, as sc-builder does for sources of knowledge base
+class TestBuildScsSources : public TestMemory
+{
+public:
+  void Run()
+  {
+    SCsSymbolTablePtr const symbolTable = IsSymbolTableShared() ? std::make_shared<SCsSymbolTable>() : nullptr;
+    for (std::string const & source : m_sources)
+    {
+      // sc-builder creates new helper for each source
+      SCsHelper helper(*m_ctx, std::make_shared<TestScsFileInterface>(), symbolTable);
+      BENCHMARK_BUILTIN_EXPECT(helper.GenerateBySCsText(source), true);
+    }
+  }
+
+  void Setup(size_t sourcesNum) override
+  {
+    size_t const conceptsNum = 500;
+    for (size_t i = 0; i < sourcesNum; ++i)
+    {
+      std::stringstream stream;
+      for (size_t j = 0; j < 50; ++j)
+      {
+        size_t const conceptNum = (i * 31 + j * 17) % conceptsNum;
+        stream << "concept_" << conceptNum << " -> element_" << i << "_" << j << ";;\n";
+        stream << "element_" << i << "_" << j << " => nrel_relation_" << j % 10 << ": concept_"
+               << (conceptNum + 1) % conceptsNum << ";;\n";
+      }
+      m_sources.push_back(stream.str());
+    }
+  }
+
+protected:
+  class TestScsFileInterface : public SCsFileInterface
+  {
+  public:
+    ScStreamPtr GetFileContent(std::string const &) override
+    {
+      return {};
+    }
+  };
+
+  virtual bool IsSymbolTableShared() const
+  {
+    return false;
+  }
+
+  std::vector<std::string> m_sources;
+};
+
+class TestBuildScsSourcesWithSymbolTable : public TestBuildScsSources
+{
+protected:
+  bool IsSymbolTableShared() const override
+  {
+    return true;
+  }
+};
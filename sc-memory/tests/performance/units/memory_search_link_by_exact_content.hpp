@@ -0,0 +1,50 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+#include "sc-memory/sc_link.hpp"
+
+#include <random>
+
+class TestSearchLinkByExactContent : public TestMemory
+{
+public:
+  void Run()
+  {
+    std::string const & content = m_contents[m_nextContent];
+    m_nextContent = (m_nextContent + 1) % m_contents.size();
+
+    BENCHMARK_BUILTIN_EXPECT(m_ctx->FindLinksByContent(content).size() == 1, SC_TRUE);
+  }
+
+  void Setup(size_t contentSize) override
+  {
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<char> charDistribution(33, 126);
+
+    // all contents start with the same term, so search by terms has to read each of them
+    for (size_t i = 0; i < kLinksNum; ++i)
+    {
+      std::string content = "content " + std::to_string(i) + " ";
+      while (content.size() < contentSize)
+        content.push_back(charDistribution(gen));
+
+      ScLink link(*m_ctx, m_ctx->CreateLink());
+      BENCHMARK_BUILTIN_EXPECT(link.Set(content), SC_TRUE);
+
+      m_contents.push_back(content);
+    }
+  }
+
+private:
+  static size_t constexpr kLinksNum = 1000;
+
+  std::vector<std::string> m_contents;
+  size_t m_nextContent = 0;
+};
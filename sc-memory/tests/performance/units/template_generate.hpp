@@ -0,0 +1,42 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "template_test.hpp"
+
+#include <string>
+
+class TestTemplateGenerate : public TestTemplate
+{
+public:
+  void Setup(size_t constrCount) override
+  {
+    ScAddr const node = m_ctx->CreateNode(ScType::NodeConstClass);
+    ScAddr const relation = m_ctx->CreateNode(ScType::NodeConstNoRole);
+
+    for (size_t i = 0; i < constrCount; ++i)
+    {
+      std::string const alias = "_node" + std::to_string(i);
+      m_templ.Quintuple(
+            node,
+            ScType::EdgeDCommonVar,
+            ScType::NodeVar >> alias,
+            ScType::EdgeAccessVarPosPerm,
+            relation);
+      m_templ.Triple(
+            alias,
+            ScType::EdgeAccessVarPosPerm,
+            ScType::LinkVar);
+    }
+  }
+
+  bool Run()
+  {
+    ScTemplateGenResult result;
+    return m_ctx->HelperGenTemplate(m_templ, result);
+  }
+};
@@ -0,0 +1,62 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "template_test.hpp"
+
+#include <string>
+
+/*!
+ * Finds sc-element by content of its identifier sc-link. Equal predicate is evaluated by fs-memory dictionary, so
+ * search is started from found sc-links. Number range predicate isn't indexed, so search is started from relation
+ * and contents of all identifiers are checked.
+ */
+class TestTemplateSearchLinkContent : public TestTemplate
+{
+public:
+  void Setup(size_t constrCount) override
+  {
+    ScAddr const relation = m_ctx->CreateNode(ScType::NodeConstNoRole);
+    for (size_t i = 0; i < constrCount; ++i)
+    {
+      ScAddr const node = m_ctx->CreateNode(ScType::NodeConst);
+      ScAddr const link = m_ctx->CreateLink();
+      m_ctx->SetLinkContent(link, std::to_string(i));
+      ScAddr const edge = m_ctx->CreateEdge(ScType::EdgeDCommonConst, node, link);
+      m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, relation, edge);
+    }
+
+    m_templ.Quintuple(
+        ScType::NodeVar >> "_node",
+        ScType::EdgeDCommonVar,
+        ScType::LinkVar >> "_link",
+        ScType::EdgeAccessVarPosPerm,
+        relation);
+    m_templ.LinkContent("_link", GetPredicate(constrCount / 2));
+  }
+
+protected:
+  virtual ScTemplateLinkContentPredicate GetPredicate(size_t value) const = 0;
+};
+
+class TestTemplateSearchByIndexedLinkContent : public TestTemplateSearchLinkContent
+{
+protected:
+  ScTemplateLinkContentPredicate GetPredicate(size_t value) const override
+  {
+    return ScTemplateLinkContentPredicate::Equal(std::to_string(value));
+  }
+};
+
+class TestTemplateSearchByLinkContentRange : public TestTemplateSearchLinkContent
+{
+protected:
+  ScTemplateLinkContentPredicate GetPredicate(size_t value) const override
+  {
+    return ScTemplateLinkContentPredicate::NumberRange((double)value, (double)value);
+  }
+};
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <filesystem>
+#include <thread>
 
 #include "sc-memory/sc_memory.hpp"
 
@@ -140,6 +142,75 @@ TEST_F(ScMemoryTest, NotLink)
   EXPECT_THROW(ctx.GetLinkContent(node), utils::ExceptionInvalidParams);
 }
 
+TEST_F(ScMemoryTest, ReadEdgesInfoWhileChangingEdges)
+{
+  ScMemoryContext ctx;
+
+  ScAddr const sourceAddr = ctx.CreateNode(ScType::NodeConst);
+  ScAddr const targetAddr = ctx.CreateNode(ScType::NodeConst);
+
+  size_t const edgesCount = 64;
+  std::vector<ScAddr> edges;
+  for (size_t i = 0; i < edgesCount; ++i)
+    edges.push_back(ctx.CreateEdge(ScType::EdgeAccessConstPosPerm, sourceAddr, targetAddr));
+
+  std::vector<ScAddr> const readEdges = edges;
+  std::atomic_bool isFinished = false;
+  std::atomic_size_t invalidReadsCount = 0;
+
+  // sc-edges are erased and recreated in opposite direction, so their sc-addresses are reused by sc-memory
+  std::thread writer(
+      [&]()
+      {
+        ScMemoryContext writerCtx;
+        for (size_t round = 0; round < 100; ++round)
+        {
+          for (size_t i = 0; i < edgesCount; ++i)
+          {
+            writerCtx.SetElementSubtype(
+                edges[i], round % 2 == 0 ? ScType::EdgeAccessConstNegPerm : ScType::EdgeAccessConstPosPerm);
+            writerCtx.EraseElement(edges[i]);
+            edges[i] = round % 2 == 0 ? writerCtx.CreateEdge(ScType::EdgeAccessConstPosPerm, targetAddr, sourceAddr)
+                                      : writerCtx.CreateEdge(ScType::EdgeAccessConstPosPerm, sourceAddr, targetAddr);
+          }
+        }
+        isFinished = true;
+      });
+
+  std::vector<std::thread> readers;
+  for (size_t r = 0; r < 4; ++r)
+    readers.emplace_back(
+        [&]()
+        {
+          sc_memory_context * context = ctx.GetRealContext();
+          while (!isFinished)
+          {
+            for (ScAddr const & edgeAddr : readEdges)
+            {
+              sc_addr begin, end;
+              if (sc_memory_get_arc_info(context, *edgeAddr, &begin, &end) != SC_RESULT_OK)
+                continue;
+
+              sc_type type;
+              bool const isValidType = sc_memory_get_element_type(context, *edgeAddr, &type) != SC_RESULT_OK
+                                       || sc_type_has_subtype_in_mask(type, sc_type_arc_mask);
+              bool const isValidEdge = (SC_ADDR_IS_EQUAL(begin, *sourceAddr) && SC_ADDR_IS_EQUAL(end, *targetAddr))
+                                       || (SC_ADDR_IS_EQUAL(begin, *targetAddr) && SC_ADDR_IS_EQUAL(end, *sourceAddr));
+              if (!isValidType || !isValidEdge)
+                ++invalidReadsCount;
+            }
+          }
+        });
+
+  writer.join();
+  for (auto & reader : readers)
+    reader.join();
+
+  EXPECT_EQ(invalidReadsCount, 0u);
+  for (ScAddr const & edgeAddr : edges)
+    EXPECT_TRUE(ctx.IsElement(edgeAddr));
+}
+
 TEST_F(ScMemoryTest, CreateDeleteCountArcs)
 {
   ScMemoryContext ctx;
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include "sc-memory/sc_memory.hpp"
 
 #include "sc_test.hpp"
@@ -272,6 +274,65 @@ TEST_F(ScIterator3Test, FFF)
   EXPECT_EQ(iter3->Get(2), ScAddr::Empty);
 }
 
+TEST_F(ScIterator3Test, FAAWithBatch)
+{
+  std::vector<ScAddr> edges = {m_edge};
+  for (size_t i = 0; i < 10; ++i)
+    edges.push_back(
+        m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_source, m_ctx->CreateNode(ScType::NodeConst)));
+
+  auto const iter3 = m_ctx->Iterator3(m_source, ScType::EdgeAccessConstPosPerm, ScType::Node);
+  EXPECT_TRUE(iter3->SetBatchSize(4));
+  EXPECT_FALSE(iter3->SetBatchSize(4));
+
+  std::vector<ScAddr> foundEdges;
+  while (iter3->Next())
+  {
+    EXPECT_EQ(iter3->Get(0), m_source);
+    EXPECT_EQ(iter3->Get(2), m_ctx->GetEdgeTarget(iter3->Get(1)));
+    foundEdges.push_back(iter3->Get(1));
+  }
+
+  EXPECT_EQ(iter3->Get(1), ScAddr::Empty);
+  EXPECT_FALSE(iter3->Next());
+
+  std::sort(edges.begin(), edges.end(), ScAddrLessFunc());
+  std::sort(foundEdges.begin(), foundEdges.end(), ScAddrLessFunc());
+  EXPECT_EQ(foundEdges, edges);
+}
+
+TEST_F(ScIterator3Test, AAFWithBatch)
+{
+  std::vector<ScAddr> edges = {m_edge};
+  for (size_t i = 0; i < 10; ++i)
+    edges.push_back(
+        m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, m_ctx->CreateNode(ScType::NodeConst), m_target));
+
+  auto const iter3 = m_ctx->Iterator3(ScType::Node, ScType::EdgeAccessConstPosPerm, m_target);
+  EXPECT_TRUE(iter3->SetBatchSize(3));
+
+  std::vector<ScAddr> foundEdges;
+  while (iter3->Next())
+  {
+    EXPECT_EQ(iter3->Get(0), m_ctx->GetEdgeSource(iter3->Get(1)));
+    EXPECT_EQ(iter3->Get(2), m_target);
+    foundEdges.push_back(iter3->Get(1));
+  }
+
+  std::sort(edges.begin(), edges.end(), ScAddrLessFunc());
+  std::sort(foundEdges.begin(), foundEdges.end(), ScAddrLessFunc());
+  EXPECT_EQ(foundEdges, edges);
+}
+
+TEST_F(ScIterator3Test, BatchIsNotSupported)
+{
+  auto const iter3 = m_ctx->Iterator3(m_source, ScType::EdgeAccessConstPosPerm, m_target);
+  EXPECT_FALSE(iter3->SetBatchSize(4));
+  EXPECT_TRUE(iter3->Next());
+  EXPECT_EQ(iter3->Get(1), m_edge);
+  EXPECT_FALSE(iter3->Next());
+}
+
 class ScEdgeTest : public ScMemoryTest
 {
 protected:
@@ -265,6 +265,26 @@ TEST_F(ScLinkTest, find_links_by_substr)
   ctx.Destroy();
 }
 
+TEST_F(ScLinkTest, estimate_links_by_content)
+{
+  ScMemoryContext ctx;
+
+  for (std::string const & content : {"content1", "ton_content", "cotents_25"})
+  {
+    ScAddr const & linkAddr = ctx.CreateLink();
+    EXPECT_TRUE(ScLink(ctx, linkAddr).Set(content));
+  }
+
+  EXPECT_EQ(ctx.EstimateLinksByContent(ScStreamMakeRead(std::string("content1"))), 1u);
+  EXPECT_EQ(ctx.EstimateLinksByContent(ScStreamMakeRead(std::string("content2"))), 0u);
+  EXPECT_GE(
+      ctx.EstimateLinksByContent(ScStreamMakeRead(std::string("cont")), true),
+      ctx.FindLinksByContentSubstring("cont").size());
+  EXPECT_EQ(ctx.EstimateLinksByContent(ScStreamMakeRead(std::string("banana")), true), 0u);
+
+  ctx.Destroy();
+}
+
 TEST_F(ScLinkTest, find_strings_by_substr)
 {
   ScMemoryContext ctx;
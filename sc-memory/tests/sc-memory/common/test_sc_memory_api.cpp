@@ -1,7 +1,15 @@
 #include <gtest/gtest.h>
 
 #include "sc-memory/sc_memory.hpp"
+#include "sc-memory/sc_event.hpp"
 #include <algorithm>
+#include <set>
+#include <thread>
+
+extern "C"
+{
+#include "sc-core/sc-store/sc_storage_private.h"
+}
 
 #include "sc_test.hpp"
 
@@ -120,3 +128,270 @@ TEST_F(ScMemoryTest, ResolveGetSystemIdentifierWithOutFiver)
   EXPECT_TRUE(resolveQuintuple.addr4.IsValid());
   EXPECT_TRUE(resolveQuintuple.addr5.IsValid());
 }
+
+TEST_F(ScMemoryTest, FindElementsByType)
+{
+  size_t const structuresCount = m_ctx->GetElementsCountByType(ScType::NodeConstStruct);
+  size_t const linksCount = m_ctx->GetElementsCountByType(ScType::Link);
+
+  ScAddr const & structureAddr = m_ctx->CreateNode(ScType::NodeConstStruct);
+  ScAddr const & nodeAddr = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const & linkAddr = m_ctx->CreateLink(ScType::LinkConst);
+  ScAddr const & edgeAddr = m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, structureAddr, nodeAddr);
+
+  EXPECT_EQ(m_ctx->GetElementsCountByType(ScType::NodeConstStruct), structuresCount + 1);
+  EXPECT_EQ(m_ctx->GetElementsCountByType(ScType::Link), linksCount + 1);
+
+  ScAddrVector const & structures = m_ctx->FindElementsByType(ScType::NodeConstStruct);
+  EXPECT_EQ(structures.size(), structuresCount + 1);
+  EXPECT_NE(std::find(structures.cbegin(), structures.cend(), structureAddr), structures.cend());
+  EXPECT_EQ(std::find(structures.cbegin(), structures.cend(), nodeAddr), structures.cend());
+
+  ScAddrVector const & links = m_ctx->FindElementsByType(ScType::Link);
+  EXPECT_NE(std::find(links.cbegin(), links.cend(), linkAddr), links.cend());
+
+  ScAddrVector const & edges = m_ctx->FindElementsByType(ScType::EdgeAccessConstPosPerm);
+  EXPECT_NE(std::find(edges.cbegin(), edges.cend(), edgeAddr), edges.cend());
+
+  EXPECT_TRUE(m_ctx->SetElementSubtype(nodeAddr, ScType::NodeConstStruct));
+  EXPECT_EQ(m_ctx->GetElementsCountByType(ScType::NodeConstStruct), structuresCount + 2);
+
+  EXPECT_TRUE(m_ctx->EraseElement(structureAddr));
+  EXPECT_TRUE(m_ctx->EraseElement(linkAddr));
+  EXPECT_EQ(m_ctx->GetElementsCountByType(ScType::NodeConstStruct), structuresCount + 1);
+  EXPECT_EQ(m_ctx->GetElementsCountByType(ScType::Link), linksCount);
+
+  ScAddrVector const & foundEdges = m_ctx->FindElementsByType(ScType::EdgeAccessConstPosPerm);
+  EXPECT_EQ(std::find(foundEdges.cbegin(), foundEdges.cend(), edgeAddr), foundEdges.cend());
+}
+
+TEST_F(ScMemoryTest, GetElementsCountByType)
+{
+  ScMemoryContext::ScMemoryStatistics const & stat = m_ctx->CalculateStat();
+
+  EXPECT_EQ(m_ctx->GetElementsCountByType(ScType::Node), stat.m_nodesNum);
+  EXPECT_EQ(m_ctx->GetElementsCountByType(ScType::Link), stat.m_linksNum);
+  EXPECT_EQ(m_ctx->GetElementsCountByType(ScType(sc_type_arc_mask)), stat.m_edgesNum);
+  EXPECT_EQ(m_ctx->GetElementsCountByType(ScType::Unknown), stat.GetAllNum());
+}
+
+TEST_F(ScMemoryTest, GetElementsInfo)
+{
+  ScAddr const & nodeAddr = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const & linkAddr = m_ctx->CreateLink(ScType::LinkConst);
+  ScAddr const & edgeAddr = m_ctx->CreateEdge(ScType::EdgeDCommonConst, nodeAddr, linkAddr);
+  ScAddr const & erasedAddr = m_ctx->CreateNode(ScType::NodeConst);
+  m_ctx->EraseElement(erasedAddr);
+
+  std::vector<ScMemoryContext::ScElementInfo> const & infos =
+      m_ctx->GetElementsInfo({edgeAddr, ScAddr::Empty, linkAddr, erasedAddr, nodeAddr});
+  EXPECT_EQ(infos.size(), 5u);
+
+  EXPECT_TRUE(infos[0].m_isValid);
+  EXPECT_EQ(infos[0].m_type, ScType::EdgeDCommonConst);
+  EXPECT_EQ(infos[0].m_sourceAddr, nodeAddr);
+  EXPECT_EQ(infos[0].m_targetAddr, linkAddr);
+
+  EXPECT_FALSE(infos[1].m_isValid);
+
+  EXPECT_TRUE(infos[2].m_isValid);
+  EXPECT_EQ(infos[2].m_type, ScType::LinkConst);
+  EXPECT_FALSE(infos[2].m_sourceAddr.IsValid());
+  EXPECT_FALSE(infos[2].m_targetAddr.IsValid());
+  EXPECT_EQ(infos[2].m_inputArcsCount, m_ctx->GetElementInputArcsCount(linkAddr));
+
+  EXPECT_FALSE(infos[3].m_isValid);
+
+  EXPECT_TRUE(infos[4].m_isValid);
+  EXPECT_EQ(infos[4].m_type, ScType::NodeConst);
+  EXPECT_EQ(infos[4].m_outputArcsCount, m_ctx->GetElementOutputArcsCount(nodeAddr));
+
+  EXPECT_TRUE(m_ctx->GetElementsInfo({}).empty());
+}
+
+using TestAddrSet = std::set<ScAddr, ScAddrLessFunc>;
+
+TEST_F(ScMemoryTest, GetNeighbourhood)
+{
+  ScAddr const & rootAddr = m_ctx->CreateNode(ScType::NodeConstClass);
+  ScAddr const & elementAddr = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const & arcAddr = m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, rootAddr, elementAddr);
+  ScAddr const & relationAddr = m_ctx->CreateNode(ScType::NodeConstRole);
+  ScAddr const & relationArcAddr = m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, relationAddr, arcAddr);
+  ScAddr const & linkAddr = m_ctx->CreateLink(ScType::LinkConst);
+  ScAddr const & commonArcAddr = m_ctx->CreateEdge(ScType::EdgeDCommonConst, linkAddr, elementAddr);
+  ScAddr const & loopArcAddr = m_ctx->CreateEdge(ScType::EdgeAccessConstPosTemp, rootAddr, rootAddr);
+
+  ScAddrVector addrs = m_ctx->GetNeighbourhood(rootAddr, {1, true, true, ScType::Unknown, ScType::Unknown, 0});
+  EXPECT_EQ(addrs.size(), 4u);
+  EXPECT_EQ(addrs[0], rootAddr);
+  EXPECT_EQ(
+      TestAddrSet(addrs.begin(), addrs.end()), TestAddrSet({rootAddr, arcAddr, elementAddr, loopArcAddr}));
+
+  addrs = m_ctx->GetNeighbourhood(rootAddr, {2, true, true, ScType::Unknown, ScType::Unknown, 0});
+  EXPECT_EQ(
+      TestAddrSet(addrs.begin(), addrs.end()),
+      TestAddrSet({
+          rootAddr, arcAddr, elementAddr, loopArcAddr, relationArcAddr, relationAddr, commonArcAddr, linkAddr}));
+  EXPECT_EQ(addrs.size(), 8u);
+
+  addrs = m_ctx->GetNeighbourhood(elementAddr, {1, false, true, ScType::Unknown, ScType::Unknown, 0});
+  EXPECT_EQ(
+      TestAddrSet(addrs.begin(), addrs.end()),
+      TestAddrSet({elementAddr, arcAddr, rootAddr, commonArcAddr, linkAddr}));
+
+  addrs = m_ctx->GetNeighbourhood(elementAddr, {1, true, false, ScType::Unknown, ScType::Unknown, 0});
+  EXPECT_EQ(addrs, ScAddrVector{elementAddr});
+
+  addrs = m_ctx->GetNeighbourhood(rootAddr, {3, true, true, ScType::EdgeAccessConstPosPerm, ScType::Unknown, 0});
+  EXPECT_EQ(
+      TestAddrSet(addrs.begin(), addrs.end()),
+      TestAddrSet({rootAddr, arcAddr, elementAddr, relationArcAddr, relationAddr}));
+
+  addrs = m_ctx->GetNeighbourhood(rootAddr, {2, true, true, ScType::Unknown, ScType::NodeConst, 0});
+  EXPECT_EQ(
+      TestAddrSet(addrs.begin(), addrs.end()),
+      TestAddrSet({rootAddr, arcAddr, elementAddr, loopArcAddr, relationArcAddr, relationAddr}));
+
+  addrs = m_ctx->GetNeighbourhood(rootAddr, {2, true, true, ScType::Unknown, ScType::Unknown, 3});
+  EXPECT_EQ(addrs.size(), 3u);
+
+  // sc-connector isn't found without its other incident sc-element
+  addrs = m_ctx->GetNeighbourhood(rootAddr, {2, true, true, ScType::Unknown, ScType::Unknown, 2});
+  EXPECT_EQ(addrs, ScAddrVector{rootAddr});
+
+  for (size_t maxElementsCount = 1; maxElementsCount <= 8; ++maxElementsCount)
+  {
+    addrs = m_ctx->GetNeighbourhood(rootAddr, {2, true, true, ScType::Unknown, ScType::Unknown, maxElementsCount});
+    EXPECT_LE(addrs.size(), maxElementsCount);
+
+    TestAddrSet const foundAddrs(addrs.begin(), addrs.end());
+    for (ScAddr const & addr : addrs)
+    {
+      if (!m_ctx->GetElementType(addr).IsEdge())
+        continue;
+
+      ScAddr sourceAddr, targetAddr;
+      EXPECT_TRUE(m_ctx->GetEdgeInfo(addr, sourceAddr, targetAddr));
+      EXPECT_TRUE(foundAddrs.count(sourceAddr));
+      EXPECT_TRUE(foundAddrs.count(targetAddr));
+    }
+  }
+
+  addrs = m_ctx->GetNeighbourhood(rootAddr, {0, true, true, ScType::Unknown, ScType::Unknown, 0});
+  EXPECT_EQ(addrs, ScAddrVector{rootAddr});
+
+  EXPECT_THROW(
+      m_ctx->GetNeighbourhood(ScAddr::Empty, {1, true, true, ScType::Unknown, ScType::Unknown, 0}),
+      utils::ExceptionInvalidParams);
+}
+
+TEST_F(ScMemoryTest, AddNeighbourhoodToStructure)
+{
+  ScAddr const & rootAddr = m_ctx->CreateNode(ScType::NodeConstClass);
+  ScAddr const & elementAddr = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const & arcAddr = m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, rootAddr, elementAddr);
+  ScAddr const & structureAddr = m_ctx->CreateNode(ScType::NodeConstStruct);
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, structureAddr, rootAddr);
+
+  ScMemoryContext::ScNeighbourhoodParams const params{1, true, false, ScType::Unknown, ScType::Unknown, 0};
+  EXPECT_EQ(m_ctx->AddNeighbourhoodToStructure(rootAddr, structureAddr, params), 2u);
+  EXPECT_TRUE(m_ctx->HelperCheckEdge(structureAddr, rootAddr, ScType::EdgeAccessConstPosPerm));
+  EXPECT_TRUE(m_ctx->HelperCheckEdge(structureAddr, arcAddr, ScType::EdgeAccessConstPosPerm));
+  EXPECT_TRUE(m_ctx->HelperCheckEdge(structureAddr, elementAddr, ScType::EdgeAccessConstPosPerm));
+  EXPECT_EQ(m_ctx->GetElementOutputArcsCount(structureAddr), 3u);
+
+  EXPECT_EQ(m_ctx->AddNeighbourhoodToStructure(rootAddr, structureAddr, params), 0u);
+  EXPECT_EQ(m_ctx->GetElementOutputArcsCount(structureAddr), 3u);
+
+  EXPECT_THROW(m_ctx->AddNeighbourhoodToStructure(rootAddr, ScAddr::Empty, params), utils::ExceptionInvalidParams);
+}
+
+TEST_F(ScMemoryTest, CalculateAllocationsStat)
+{
+  std::vector<ScMemoryContext::ScMemoryAllocations> const & allocations = m_ctx->CalculateAllocationsStat();
+  EXPECT_EQ(allocations.size(), (size_t)SC_ALLOCATIONS_SUBSYSTEMS_COUNT);
+  EXPECT_EQ(allocations[SC_ALLOCATIONS_SEGMENTS].m_subsystem, "segments");
+  EXPECT_GT(allocations[SC_ALLOCATIONS_SEGMENTS].m_liveObjects, 0u);
+  EXPECT_GT(allocations[SC_ALLOCATIONS_SEGMENTS].m_liveBytes, 0u);
+
+  sc_uint64 const contextsCount = allocations[SC_ALLOCATIONS_CONTEXTS].m_liveObjects;
+  sc_uint64 const eventsCount = allocations[SC_ALLOCATIONS_EVENTS].m_liveObjects;
+  {
+    ScMemoryContext context;
+    ScAddr const & nodeAddr = context.CreateNode(ScType::NodeConst);
+    ScEventAddOutputEdge event(
+        context,
+        nodeAddr,
+        [](ScAddr const &, ScAddr const &, ScAddr const &)
+        {
+          return true;
+        });
+
+    std::vector<ScMemoryContext::ScMemoryAllocations> const & newAllocations = m_ctx->CalculateAllocationsStat();
+    EXPECT_GT(newAllocations[SC_ALLOCATIONS_CONTEXTS].m_liveObjects, contextsCount);
+    EXPECT_GT(newAllocations[SC_ALLOCATIONS_EVENTS].m_liveObjects, eventsCount);
+    EXPECT_GT(newAllocations[SC_ALLOCATIONS_DICTIONARIES].m_liveBytes, 0u);
+  }
+
+  sc_uint64 const dictionariesBytes =
+      m_ctx->CalculateAllocationsStat()[SC_ALLOCATIONS_DICTIONARIES].m_liveBytes;
+  ScAddr const & linkAddr = m_ctx->CreateLink(ScType::LinkConst);
+  EXPECT_TRUE(m_ctx->SetLinkContent(linkAddr, "content of sc-link accounted in sc-dictionaries"));
+  EXPECT_GT(m_ctx->CalculateAllocationsStat()[SC_ALLOCATIONS_DICTIONARIES].m_liveBytes, dictionariesBytes);
+}
+
+TEST_F(ScMemoryTest, CalculateMonitorsContentionStat)
+{
+  m_ctx->SetMonitorsContentionSamplingPeriod(1);
+
+  ScAddr const & nodeAddr = m_ctx->CreateNode(ScType::NodeConst);
+  EXPECT_TRUE(m_ctx->HelperSetSystemIdtf("contended_node", nodeAddr));
+
+  // monitor of sc-element is held while all threads are queued on it, so contention doesn't depend on scheduling
+  sc_monitor * monitor = sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, *nodeAddr);
+  sc_monitor_acquire_write(monitor);
+
+  size_t const threadsCount = 8;
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < threadsCount; ++i)
+  {
+    threads.emplace_back(
+        [&nodeAddr]()
+        {
+          ScMemoryContext context;
+          context.CreateEdge(ScType::EdgeAccessConstPosPerm, nodeAddr, context.CreateNode(ScType::NodeConst));
+        });
+  }
+
+  size_t waitersCount = 0;
+  while (waitersCount < threadsCount)
+  {
+    std::this_thread::yield();
+    sc_mutex_lock(&monitor->rw_mutex);
+    waitersCount = monitor->queue.size;
+    sc_mutex_unlock(&monitor->rw_mutex);
+  }
+
+  sc_monitor_release_write(monitor);
+  for (auto & thread : threads)
+    thread.join();
+
+  std::vector<ScMemoryContext::ScMonitorContention> const & contentions = m_ctx->CalculateMonitorsContentionStat(10);
+  ASSERT_FALSE(contentions.empty());
+  EXPECT_LE(contentions.size(), 10u);
+  EXPECT_EQ(contentions[0].m_addr, nodeAddr);
+  EXPECT_EQ(contentions[0].m_systemIdtf, "contended_node");
+  EXPECT_GT(contentions[0].m_contendedCount, 0u);
+  EXPECT_GE(contentions[0].m_totalWaitTime, contentions[0].m_maxWaitTime);
+  EXPECT_GE(contentions[0].m_contendedCount, threadsCount);
+  EXPECT_GE(contentions[0].m_maxWaitersCount, threadsCount - 1);
+  for (size_t i = 1; i < contentions.size(); ++i)
+    EXPECT_GE(contentions[i - 1].m_totalWaitTime, contentions[i].m_totalWaitTime);
+
+  EXPECT_EQ(m_ctx->CalculateMonitorsContentionStat(1).size(), 1u);
+  EXPECT_TRUE(m_ctx->CalculateMonitorsContentionStat(0).empty());
+
+  m_ctx->SetMonitorsContentionSamplingPeriod(0);
+  EXPECT_TRUE(m_ctx->CalculateMonitorsContentionStat(10).empty());
+}
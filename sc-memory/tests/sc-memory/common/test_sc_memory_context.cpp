@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <thread>
 
 #include "sc-memory/sc_memory.hpp"
@@ -202,6 +203,10 @@ void TestReadActionsSuccessfully(std::unique_ptr<ScMemoryContext> const & contex
   EXPECT_EQ(nodeAddr2, linkAddr);
   EXPECT_EQ(userContext.GetElementType(nodeAddr), ScType::NodeConst);
   EXPECT_NO_THROW(userContext.CalculateStat());
+  EXPECT_NO_THROW(userContext.CalculateAllocationsStat());
+  EXPECT_NO_THROW(userContext.GetSlowOperations());
+  EXPECT_NO_THROW(userContext.FindElementsByType(ScType::NodeConst));
+  EXPECT_NO_THROW(userContext.GetElementsCountByType(ScType::NodeConst));
   std::string content;
   EXPECT_FALSE(userContext.GetLinkContent(linkAddr, content));
   EXPECT_TRUE(content.empty());
@@ -227,6 +232,10 @@ void TestReadActionsUnsuccessfully(std::unique_ptr<ScMemoryContext> const & cont
   EXPECT_THROW(userContext.GetEdgeInfo(edgeAddr, nodeAddr1, nodeAddr2), utils::ExceptionInvalidState);
   EXPECT_THROW(userContext.GetElementType(nodeAddr), utils::ExceptionInvalidState);
   EXPECT_THROW(userContext.CalculateStat(), utils::ExceptionInvalidState);
+  EXPECT_THROW(userContext.CalculateAllocationsStat(), utils::ExceptionInvalidState);
+  EXPECT_THROW(userContext.GetSlowOperations(), utils::ExceptionInvalidState);
+  EXPECT_THROW(userContext.FindElementsByType(ScType::NodeConst), utils::ExceptionInvalidState);
+  EXPECT_THROW(userContext.GetElementsCountByType(ScType::NodeConst), utils::ExceptionInvalidState);
   std::string content;
   EXPECT_THROW(userContext.GetLinkContent(linkAddr, content), utils::ExceptionInvalidState);
 }
@@ -1633,6 +1642,36 @@ TEST_F(ScMemoryTestWithUserMode, HandleElementsByAuthenticatedUserWithLocalReadP
   EXPECT_TRUE(isAuthenticated.load());
 }
 
+TEST_F(ScMemoryTestWithUserMode, FindElementsByTypeByAuthenticatedUserWithLocalReadPermissions)
+{
+  ScAddr const & userAddr = m_ctx->CreateNode(ScType::NodeConst);
+
+  ScAddr nodeAddr1, edgeAddr, linkAddr, relationEdgeAddr, relationAddr, nodeAddr2;
+  ScAddr const & structureAddr = TestCreateStructureWithConnectorAndIncidentElements(
+      m_ctx, nodeAddr1, edgeAddr, linkAddr, relationEdgeAddr, relationAddr, nodeAddr2);
+
+  TestScMemoryContext userContext{userAddr};
+  ScAddr const & conceptAuthenticatedUserAddr{concept_authenticated_user_addr};
+  std::atomic_bool isAuthenticated = false;
+  ScEventAddOutputEdge event(
+      *m_ctx,
+      conceptAuthenticatedUserAddr,
+      [&](ScAddr const & addr, ScAddr const &, ScAddr const & userAddr)
+      {
+        ScAddrVector const & nodes = userContext.FindElementsByType(ScType::NodeConst);
+        EXPECT_NE(std::find(nodes.cbegin(), nodes.cend(), nodeAddr1), nodes.cend());
+        EXPECT_EQ(std::find(nodes.cbegin(), nodes.cend(), nodeAddr2), nodes.cend());
+        EXPECT_EQ(userContext.GetElementsCountByType(ScType::NodeConst), nodes.size());
+
+        return isAuthenticated = true;
+      });
+  TestAddPermissionsForUserToInitReadActionsWithinStructure(m_ctx, userAddr, structureAddr);
+  TestAuthenticationRequestUser(m_ctx, userAddr);
+
+  SC_LOCK_WAIT_WHILE_TRUE(!isAuthenticated.load());
+  EXPECT_TRUE(isAuthenticated.load());
+}
+
 TEST_F(ScMemoryTestWithUserMode, HandleElementsByAuthenticatedUserHavingClassWithLocalReadPermissions)
 {
   ScAddr const & userAddr = m_ctx->CreateNode(ScType::NodeConst);
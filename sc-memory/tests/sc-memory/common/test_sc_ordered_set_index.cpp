@@ -0,0 +1,195 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <gtest/gtest.h>
+
+#include "sc-memory/sc_memory.hpp"
+#include "sc-memory/sc_keynodes.hpp"
+#include "sc-memory/sc_ordered_set_index.hpp"
+
+#include "sc_test.hpp"
+
+namespace
+{
+ScAddrVector CreateOrderedSet(ScMemoryContext & ctx, ScAddr const & setAddr, size_t count)
+{
+  ScAddrVector elements;
+  ScAddr previousArcAddr;
+  for (size_t i = 0; i < count; ++i)
+  {
+    ScAddr const & elementAddr = ctx.CreateNode(ScType::NodeConst);
+    ScAddr const & arcAddr = ctx.CreateEdge(ScType::EdgeAccessConstPosPerm, setAddr, elementAddr);
+    ScAddr const & roleAddr =
+        ctx.HelperResolveSystemIdtf("rrel_" + std::to_string(i + 1), ScType::NodeConstRole);
+    ctx.CreateEdge(ScType::EdgeAccessConstPosPerm, roleAddr, arcAddr);
+
+    if (previousArcAddr.IsValid())
+    {
+      ScAddr const & sequenceArcAddr = ctx.CreateEdge(ScType::EdgeDCommonConst, previousArcAddr, arcAddr);
+      ctx.CreateEdge(ScType::EdgeAccessConstPosPerm, ScKeynodes::kNrelBasicSequence, sequenceArcAddr);
+    }
+
+    previousArcAddr = arcAddr;
+    elements.push_back(elementAddr);
+  }
+
+  return elements;
+}
+
+}  // namespace
+
+TEST_F(ScMemoryTest, IndexOrderedSet)
+{
+  ScAddr const & setAddr = m_ctx->CreateNode(ScType::NodeConst);
+
+  EXPECT_FALSE(m_ctx->HelperUnindexOrderedSet(setAddr));
+  EXPECT_TRUE(m_ctx->HelperIndexOrderedSet(setAddr));
+  EXPECT_FALSE(m_ctx->HelperIndexOrderedSet(setAddr));
+  EXPECT_TRUE(m_ctx->HelperUnindexOrderedSet(setAddr));
+  EXPECT_FALSE(m_ctx->HelperUnindexOrderedSet(setAddr));
+
+  EXPECT_THROW(m_ctx->HelperIndexOrderedSet(ScAddr::Empty), utils::ExceptionInvalidParams);
+  EXPECT_THROW(m_ctx->HelperGetOrderedSetElement(ScAddr::Empty, 1), utils::ExceptionInvalidParams);
+  EXPECT_THROW(m_ctx->HelperGetNextOrderedSetElement(setAddr, ScAddr::Empty), utils::ExceptionInvalidParams);
+}
+
+TEST_F(ScMemoryTest, GetOrderedSetElement)
+{
+  ScAddr const & setAddr = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddrVector const & elements = CreateOrderedSet(*m_ctx, setAddr, 25);
+
+  for (size_t i = 0; i < elements.size(); ++i)
+    EXPECT_EQ(m_ctx->HelperGetOrderedSetElement(setAddr, i + 1), elements[i]);
+  EXPECT_FALSE(m_ctx->HelperGetOrderedSetElement(setAddr, 0).IsValid());
+  EXPECT_FALSE(m_ctx->HelperGetOrderedSetElement(setAddr, elements.size() + 1).IsValid());
+
+  EXPECT_TRUE(m_ctx->HelperIndexOrderedSet(setAddr));
+  for (size_t i = 0; i < elements.size(); ++i)
+    EXPECT_EQ(m_ctx->HelperGetOrderedSetElement(setAddr, i + 1), elements[i]);
+  EXPECT_FALSE(m_ctx->HelperGetOrderedSetElement(setAddr, elements.size() + 1).IsValid());
+
+  EXPECT_TRUE(m_ctx->HelperUnindexOrderedSet(setAddr));
+}
+
+TEST_F(ScMemoryTest, GetOrderedSetElementAfterSetChanged)
+{
+  ScAddr const & setAddr = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddrVector const & elements = CreateOrderedSet(*m_ctx, setAddr, 3);
+
+  EXPECT_TRUE(m_ctx->HelperIndexOrderedSet(setAddr));
+  EXPECT_EQ(m_ctx->HelperGetOrderedSetElement(setAddr, 2), elements[1]);
+
+  EXPECT_TRUE(m_ctx->EraseElement(elements[1]));
+  EXPECT_FALSE(m_ctx->HelperGetOrderedSetElement(setAddr, 2).IsValid());
+
+  ScAddr const & elementAddr = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const & arcAddr = m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, setAddr, elementAddr);
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, ScKeynodes::GetRrelIndex(1), arcAddr);
+  EXPECT_EQ(m_ctx->HelperGetOrderedSetElement(setAddr, 2), elementAddr);
+
+  EXPECT_EQ(m_ctx->HelperGetOrderedSetElement(setAddr, 1), elements[0]);
+  EXPECT_EQ(m_ctx->HelperGetOrderedSetElement(setAddr, 3), elements[2]);
+
+  EXPECT_TRUE(m_ctx->HelperUnindexOrderedSet(setAddr));
+}
+
+TEST_F(ScMemoryTest, GetNextOrderedSetElement)
+{
+  ScAddr const & setAddr = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddrVector const & elements = CreateOrderedSet(*m_ctx, setAddr, 10);
+
+  for (size_t i = 0; i + 1 < elements.size(); ++i)
+    EXPECT_EQ(m_ctx->HelperGetNextOrderedSetElement(setAddr, elements[i]), elements[i + 1]);
+  EXPECT_FALSE(m_ctx->HelperGetNextOrderedSetElement(setAddr, elements.back()).IsValid());
+
+  EXPECT_TRUE(m_ctx->HelperIndexOrderedSet(setAddr));
+
+  size_t count = 0;
+  ScAddr elementAddr = m_ctx->HelperGetOrderedSetElement(setAddr, 1);
+  while (elementAddr.IsValid())
+  {
+    EXPECT_EQ(elementAddr, elements[count]);
+    elementAddr = m_ctx->HelperGetNextOrderedSetElement(setAddr, elementAddr);
+    ++count;
+  }
+  EXPECT_EQ(count, elements.size());
+
+  ScAddr const & otherSetAddr = m_ctx->CreateNode(ScType::NodeConst);
+  EXPECT_FALSE(m_ctx->HelperGetNextOrderedSetElement(otherSetAddr, elements[0]).IsValid());
+
+  EXPECT_TRUE(m_ctx->HelperUnindexOrderedSet(setAddr));
+}
+
+TEST_F(ScMemoryTest, GetNextOrderedSetElementAfterSequenceChanged)
+{
+  ScAddr const & setAddr = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddrVector const & elements = CreateOrderedSet(*m_ctx, setAddr, 3);
+
+  EXPECT_TRUE(m_ctx->HelperIndexOrderedSet(setAddr));
+  EXPECT_EQ(m_ctx->HelperGetNextOrderedSetElement(setAddr, elements[0]), elements[1]);
+
+  ScIterator3Ptr const it3 = m_ctx->Iterator3(setAddr, ScType::EdgeAccessConstPosPerm, elements[0]);
+  EXPECT_TRUE(it3->Next());
+  ScAddr const & firstArcAddr = it3->Get(1);
+
+  ScIterator5Ptr const it5 = m_ctx->Iterator5(
+      firstArcAddr, ScType::EdgeDCommonConst, ScType::Unknown, ScType::EdgeAccessConstPosPerm, ScKeynodes::kNrelBasicSequence);
+  EXPECT_TRUE(it5->Next());
+  EXPECT_TRUE(m_ctx->EraseElement(it5->Get(1)));
+  EXPECT_FALSE(m_ctx->HelperGetNextOrderedSetElement(setAddr, elements[0]).IsValid());
+
+  ScIterator3Ptr const lastIt3 = m_ctx->Iterator3(setAddr, ScType::EdgeAccessConstPosPerm, elements[2]);
+  EXPECT_TRUE(lastIt3->Next());
+  ScAddr const & sequenceArcAddr = m_ctx->CreateEdge(ScType::EdgeDCommonConst, firstArcAddr, lastIt3->Get(1));
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, ScKeynodes::kNrelBasicSequence, sequenceArcAddr);
+  EXPECT_EQ(m_ctx->HelperGetNextOrderedSetElement(setAddr, elements[0]), elements[2]);
+
+  EXPECT_TRUE(m_ctx->HelperUnindexOrderedSet(setAddr));
+}
+
+TEST_F(ScMemoryTest, GetNextOrderedSetElementBySequenceOfAnyArcTypes)
+{
+  ScAddr const & setAddr = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const & firstElementAddr = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const & secondElementAddr = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const & firstArcAddr = m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, setAddr, firstElementAddr);
+  ScAddr const & secondArcAddr = m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, setAddr, secondElementAddr);
+  ScAddr const & sequenceArcAddr = m_ctx->CreateEdge(ScType::EdgeDCommon, firstArcAddr, secondArcAddr);
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosTemp, ScKeynodes::kNrelBasicSequence, sequenceArcAddr);
+
+  EXPECT_EQ(m_ctx->HelperGetNextOrderedSetElement(setAddr, firstElementAddr), secondElementAddr);
+
+  ScAddr accessArcAddr;
+  ScOrderedSetIndex::ScOrderedSetLink link;
+  EXPECT_FALSE(ScOrderedSetIndex::FindLink(
+      *m_ctx,
+      setAddr,
+      firstElementAddr,
+      ScType::EdgeDCommonConst,
+      ScType::EdgeAccessConstPosPerm,
+      ScType::EdgeAccessConstPosPerm,
+      accessArcAddr,
+      link));
+  EXPECT_TRUE(ScOrderedSetIndex::FindLink(
+      *m_ctx,
+      setAddr,
+      firstElementAddr,
+      ScType::EdgeDCommon,
+      ScType::EdgeAccessConstPosPerm,
+      ScType::EdgeAccessConstPosTemp,
+      accessArcAddr,
+      link));
+  EXPECT_EQ(accessArcAddr, firstArcAddr);
+  EXPECT_EQ(ScOrderedSetIndex::GetLinkNextElement(*m_ctx, link), secondElementAddr);
+
+  EXPECT_TRUE(m_ctx->HelperIndexOrderedSet(setAddr));
+  EXPECT_EQ(m_ctx->HelperGetNextOrderedSetElement(setAddr, firstElementAddr), secondElementAddr);
+
+  EXPECT_TRUE(m_ctx->EraseElement(secondArcAddr));
+  EXPECT_FALSE(m_ctx->HelperGetNextOrderedSetElement(setAddr, firstElementAddr).IsValid());
+
+  EXPECT_TRUE(m_ctx->HelperUnindexOrderedSet(setAddr));
+}
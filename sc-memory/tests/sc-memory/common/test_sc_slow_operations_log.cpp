@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include "sc-memory/sc_memory.hpp"
+#include "sc-memory/utils/sc_slow_operations_log.hpp"
+
+#include "sc_test.hpp"
+
+using ScSlowOperationsLog = utils::ScSlowOperationsLog;
+
+TEST_F(ScMemoryTest, SlowOperationsLogIsDisabledByDefault)
+{
+  EXPECT_FALSE(ScSlowOperationsLog::IsSlow(ScSlowOperationsLog::Type::TemplateSearch, 1e9));
+  EXPECT_FALSE(ScSlowOperationsLog::IsSlow(ScSlowOperationsLog::Type::AgentAction, 1e9));
+  EXPECT_FALSE(ScSlowOperationsLog::IsSlow(ScSlowOperationsLog::Type::ServerRequest, 1e9));
+
+  ScAddr const & classAddr = m_ctx->CreateNode(ScType::NodeConstClass);
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, classAddr, m_ctx->CreateNode(ScType::NodeConst));
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::EdgeAccessVarPosPerm, ScType::NodeVar);
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->HelperSearchTemplate(templ, result));
+
+  EXPECT_TRUE(ScSlowOperationsLog::GetEntries().empty());
+}
+
+TEST_F(ScMemoryTest, SlowOperationsLogThreshold)
+{
+  ScSlowOperationsLog::SetThreshold(ScSlowOperationsLog::Type::AgentAction, 10);
+  EXPECT_FALSE(ScSlowOperationsLog::IsSlow(ScSlowOperationsLog::Type::AgentAction, 9.5));
+  EXPECT_TRUE(ScSlowOperationsLog::IsSlow(ScSlowOperationsLog::Type::AgentAction, 10));
+  EXPECT_FALSE(ScSlowOperationsLog::IsSlow(ScSlowOperationsLog::Type::TemplateSearch, 10));
+
+  ScSlowOperationsLog::SetThreshold(ScSlowOperationsLog::Type::AgentAction, 0);
+  EXPECT_FALSE(ScSlowOperationsLog::IsSlow(ScSlowOperationsLog::Type::AgentAction, 10));
+}
+
+TEST_F(ScMemoryTest, SlowOperationsLogKeepsLastEntries)
+{
+  size_t const entriesCount = DEFAULT_SLOW_OPERATIONS_LOG_SIZE + 5;
+  for (size_t i = 0; i < entriesCount; ++i)
+    ScSlowOperationsLog::Add(ScSlowOperationsLog::Type::ServerRequest, double(i), std::to_string(i));
+
+  std::vector<ScSlowOperationsLog::Entry> const & entries = ScSlowOperationsLog::GetEntries();
+  EXPECT_EQ(entries.size(), size_t(DEFAULT_SLOW_OPERATIONS_LOG_SIZE));
+  EXPECT_EQ(entries.front().m_description, "5");
+  EXPECT_EQ(entries.back().m_description, std::to_string(entriesCount - 1));
+  EXPECT_EQ(entries.back().m_type, ScSlowOperationsLog::Type::ServerRequest);
+  EXPECT_EQ(ScSlowOperationsLog::GetTypeName(entries.back().m_type), "ServerRequest");
+}
+
+TEST_F(ScMemoryTest, SlowTemplateSearch)
+{
+  ScSlowOperationsLog::SetThreshold(ScSlowOperationsLog::Type::TemplateSearch, 1e-6);
+
+  ScAddr const & classAddr = m_ctx->HelperResolveSystemIdtf("slow_class", ScType::NodeConstClass);
+  for (size_t i = 0; i < 3; ++i)
+    m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, classAddr, m_ctx->CreateNode(ScType::NodeConst));
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::EdgeAccessVarPosPerm >> "_arc", ScType::NodeVar >> "_element");
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->HelperSearchTemplate(templ, result));
+  EXPECT_EQ(result.Size(), 3u);
+
+  std::vector<ScSlowOperationsLog::Entry> const & entries = ScSlowOperationsLog::GetEntries();
+  ASSERT_EQ(entries.size(), 1u);
+  EXPECT_EQ(entries[0].m_type, ScSlowOperationsLog::Type::TemplateSearch);
+  EXPECT_GT(entries[0].m_duration, 0.0);
+  EXPECT_EQ(
+      entries[0].m_description,
+      "template: { _arc = (slow_class _-> _element);; }, start triples: { _arc = (slow_class _-> _element);; }, "
+      "iterations: 3, results: 3");
+}
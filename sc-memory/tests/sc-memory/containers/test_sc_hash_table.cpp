@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+
+extern "C"
+{
+#include "sc-core/sc-store/sc-container/sc-hash-table/sc_hash_table.h"
+}
+
+namespace
+{
+sc_uint32 destroyedValuesCount = 0;
+
+void _test_sc_hash_table_destroy_value(void *)
+{
+  ++destroyedValuesCount;
+}
+
+guint _test_sc_hash_table_string_hash(gconstpointer key)
+{
+  return g_str_hash(key);
+}
+
+gboolean _test_sc_hash_table_string_equal(gconstpointer key, gconstpointer other)
+{
+  return g_str_equal(key, other);
+}
+
+void * _test_sc_hash_table_key(sc_uint32 i)
+{
+  sc_addr addr;
+  addr.seg = i / SC_SEGMENT_ELEMENTS_COUNT + 1;
+  addr.offset = i % SC_SEGMENT_ELEMENTS_COUNT + 1;
+  return GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(addr));
+}
+
+}  // namespace
+
+TEST(ScHashTableTest, InsertGetRemove)
+{
+  sc_hash_table * table = sc_hash_table_init(
+      sc_hash_table_default_hash_func, sc_hash_table_default_equal_func, nullptr, nullptr);
+  EXPECT_EQ(sc_hash_table_size(table), 0u);
+
+  sc_uint32 const count = 10000;
+  for (sc_uint32 i = 0; i < count; ++i)
+    EXPECT_TRUE(sc_hash_table_insert(table, _test_sc_hash_table_key(i), GUINT_TO_POINTER(i + 1)));
+  EXPECT_EQ(sc_hash_table_size(table), count);
+
+  for (sc_uint32 i = 0; i < count; ++i)
+    EXPECT_EQ(sc_hash_table_get(table, _test_sc_hash_table_key(i)), GUINT_TO_POINTER(i + 1));
+  EXPECT_EQ(sc_hash_table_get(table, _test_sc_hash_table_key(count)), nullptr);
+
+  for (sc_uint32 i = 0; i < count; i += 2)
+    EXPECT_TRUE(sc_hash_table_remove(table, _test_sc_hash_table_key(i)));
+  EXPECT_FALSE(sc_hash_table_remove(table, _test_sc_hash_table_key(0)));
+  EXPECT_EQ(sc_hash_table_size(table), count / 2);
+
+  for (sc_uint32 i = 0; i < count; ++i)
+    EXPECT_EQ(
+        sc_hash_table_get(table, _test_sc_hash_table_key(i)), i % 2 == 0 ? nullptr : GUINT_TO_POINTER(i + 1));
+
+  sc_hash_table_remove_all(table);
+  EXPECT_EQ(sc_hash_table_size(table), 0u);
+  EXPECT_EQ(sc_hash_table_get(table, _test_sc_hash_table_key(1)), nullptr);
+
+  sc_hash_table_destroy(table);
+}
+
+TEST(ScHashTableTest, ReplaceValue)
+{
+  destroyedValuesCount = 0;
+  sc_hash_table * table = sc_hash_table_init(
+      sc_hash_table_default_hash_func,
+      sc_hash_table_default_equal_func,
+      nullptr,
+      _test_sc_hash_table_destroy_value);
+
+  EXPECT_TRUE(sc_hash_table_insert(table, GUINT_TO_POINTER(1), GUINT_TO_POINTER(1)));
+  EXPECT_FALSE(sc_hash_table_insert(table, GUINT_TO_POINTER(1), GUINT_TO_POINTER(2)));
+  EXPECT_EQ(destroyedValuesCount, 1u);
+  EXPECT_EQ(sc_hash_table_size(table), 1u);
+  EXPECT_EQ(sc_hash_table_get(table, GUINT_TO_POINTER(1)), GUINT_TO_POINTER(2));
+
+  sc_hash_table_insert(table, GUINT_TO_POINTER(2), GUINT_TO_POINTER(3));
+  sc_hash_table_remove(table, GUINT_TO_POINTER(2));
+  EXPECT_EQ(destroyedValuesCount, 2u);
+
+  sc_hash_table_destroy(table);
+  EXPECT_EQ(destroyedValuesCount, 3u);
+}
+
+TEST(ScHashTableTest, CustomHashFunc)
+{
+  sc_hash_table * table =
+      sc_hash_table_init(_test_sc_hash_table_string_hash, _test_sc_hash_table_string_equal, nullptr, nullptr);
+
+  std::string const key = "concept_set";
+  sc_hash_table_insert(table, (void *)"concept_set", GUINT_TO_POINTER(1));
+  sc_hash_table_insert(table, (void *)"concept_relation", GUINT_TO_POINTER(2));
+
+  EXPECT_EQ(sc_hash_table_get(table, key.c_str()), GUINT_TO_POINTER(1));
+  EXPECT_EQ(sc_hash_table_get(table, "concept_relation"), GUINT_TO_POINTER(2));
+  EXPECT_EQ(sc_hash_table_get(table, "concept"), nullptr);
+
+  sc_hash_table_destroy(table);
+}
+
+TEST(ScHashTableTest, IterateAndRemove)
+{
+  sc_hash_table * table = sc_hash_table_init(
+      sc_hash_table_default_hash_func, sc_hash_table_default_equal_func, nullptr, nullptr);
+
+  sc_uint32 const count = 1000;
+  for (sc_uint32 i = 0; i < count; ++i)
+    sc_hash_table_insert(table, _test_sc_hash_table_key(i), GUINT_TO_POINTER(i + 1));
+
+  std::map<void *, void *> iterated;
+  sc_hash_table_iterator iterator;
+  sc_hash_table_iterator_init(&iterator, table);
+  void *key, *value;
+  while (sc_hash_table_iterator_next(&iterator, &key, &value))
+  {
+    EXPECT_TRUE(iterated.insert({key, value}).second);
+    if (GPOINTER_TO_UINT(value) % 2 == 0)
+      sc_hash_table_iterator_remove(&iterator);
+  }
+  EXPECT_EQ(iterated.size(), count);
+  EXPECT_EQ(sc_hash_table_size(table), count / 2);
+
+  for (auto const & item : iterated)
+    EXPECT_EQ(sc_hash_table_get(table, item.first), GPOINTER_TO_UINT(item.second) % 2 == 0 ? nullptr : item.second);
+
+  sc_hash_table_destroy(table);
+}
+
+TEST(ScHashTableTest, RandomOperations)
+{
+  sc_hash_table * table = sc_hash_table_init(
+      sc_hash_table_default_hash_func, sc_hash_table_default_equal_func, nullptr, nullptr);
+  std::map<void *, void *> expected;
+
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<sc_uint32> keys(0, 5000);
+  for (sc_uint32 i = 1; i < 200000; ++i)
+  {
+    void * key = _test_sc_hash_table_key(keys(generator));
+    switch (i % 3)
+    {
+    case 0:
+      EXPECT_EQ(sc_hash_table_insert(table, key, GUINT_TO_POINTER(i)), expected.count(key) == 0);
+      expected[key] = GUINT_TO_POINTER(i);
+      break;
+    case 1:
+      EXPECT_EQ(sc_hash_table_remove(table, key), expected.erase(key) == 1);
+      break;
+    default:
+    {
+      auto const it = expected.find(key);
+      EXPECT_EQ(sc_hash_table_get(table, key), it == expected.cend() ? nullptr : it->second);
+    }
+    }
+    ASSERT_EQ(sc_hash_table_size(table), expected.size());
+  }
+
+  sc_hash_table_destroy(table);
+}
@@ -9,6 +9,7 @@
 #include <atomic>
 #include <thread>
 #include <mutex>
+#include <optional>
 
 TEST(ScEventQueueTest, EventsQueueDestroy)
 {
@@ -89,6 +90,78 @@ TEST(ScEventQueueTest, EventsQueueDestroy)
   ScMemory::Shutdown();
 }
 
+TEST(ScEventQueueTest, EventsQueueInvalidOverflowPolicy)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  params.clear = SC_TRUE;
+  params.repo_path = "repo";
+  params.log_level = "Debug";
+  params.max_events_queue_size = 1;
+  params.events_queue_overflow_policy = "Spil";
+
+  sc_memory_context * context = nullptr;
+  EXPECT_EQ(sc_memory_initialize(&params, &context), nullptr);
+  EXPECT_EQ(context, nullptr);
+}
+
+TEST(ScEventQueueTest, EventsQueueDropsEventsWhenFull)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  params.clear = SC_TRUE;
+  params.repo_path = "repo";
+  params.log_level = "Debug";
+  params.limit_max_threads_by_max_physical_cores = SC_FALSE;
+  params.max_events_and_agents_threads = 1;
+  params.max_events_queue_size = 1;
+  params.events_queue_overflow_policy = "Drop";
+
+  ScMemory::Initialize(params);
+
+  ScMemoryContext ctx;
+
+  ScAddr const node = ctx.CreateNode(ScType::NodeConst);
+  ScAddr const node2 = ctx.CreateNode(ScType::NodeConst);
+
+  std::atomic_uint deliveredCount = 0;
+  ScEventAddOutputEdge evt(
+      ctx,
+      node,
+      [&deliveredCount](ScAddr const &, ScAddr const &, ScAddr const &)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        ++deliveredCount;
+        return true;
+      });
+
+  size_t const count = 10;
+  for (size_t i = 0; i < count; ++i)
+    ctx.CreateEdge(ScType::EdgeAccessConstPosPerm, node, node2);
+
+  ScMemoryContext::ScEventsQueueStat stat = ctx.CalculateEventsQueueStat();
+  ScTimer timer(5.0);
+  while (stat.m_processedCount + stat.m_droppedCount < count && !timer.IsTimeOut())
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    stat = ctx.CalculateEventsQueueStat();
+  }
+
+  // the only worker is busy with the first sc-event, so queue is full before it is freed
+  EXPECT_EQ(stat.m_processedCount + stat.m_droppedCount, count);
+  EXPECT_GT(stat.m_droppedCount, 0u);
+  EXPECT_LE(stat.m_maxSize, 1u);
+  EXPECT_EQ(stat.m_blockedCount, 0u);
+
+  timer = ScTimer(5.0);
+  while (deliveredCount.load() < stat.m_processedCount && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(deliveredCount.load(), stat.m_processedCount);
+
+  ctx.Destroy();
+  ScMemory::Shutdown();
+}
+
 namespace
 {
 double const kTestTimeout = 5.0;
@@ -513,3 +586,191 @@ TEST_F(ScEventTest, BlockEventsGuardAndEmitAfter)
   std::this_thread::sleep_for(std::chrono::milliseconds(10));
   EXPECT_TRUE(isCalled);
 }
+
+TEST_F(ScEventTest, BatchEventsDeliveredBySizeInOrder)
+{
+  ScAddr const nodeAddr = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const nodeAddr2 = m_ctx->CreateNode(ScType::NodeConst);
+
+  sc_uint32 const maxBatchSize = 100;
+  size_t const edgesCount = 1000;
+
+  std::mutex mutex;
+  ScAddrVector deliveredEdges;
+  std::atomic_bool isBatchTooBig = false;
+  ScEvent event(
+      *m_ctx,
+      nodeAddr,
+      ScEvent::Type::AddOutputEdge,
+      ScEvent::DelegateBatchFunc(
+          [&](ScAddr const & addr, ScEvent::Batch const & batch)
+          {
+            EXPECT_EQ(addr, nodeAddr);
+            if (batch.size() > maxBatchSize)
+              isBatchTooBig = true;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto const & item : batch)
+            {
+              EXPECT_EQ(item.m_otherAddr, nodeAddr2);
+              EXPECT_TRUE(item.m_connectorType.IsEdge());
+              deliveredEdges.push_back(item.m_connectorAddr);
+            }
+            return true;
+          }),
+      maxBatchSize,
+      10000);
+
+  ScAddrVector edges;
+  for (size_t i = 0; i < edgesCount; ++i)
+    edges.push_back(m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, nodeAddr, nodeAddr2));
+
+  // all batches are full, so they are delivered without waiting for time window
+  ScTimer timer(kTestTimeout);
+  while (!timer.IsTimeOut())
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (deliveredEdges.size() == edgesCount)
+        break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  EXPECT_FALSE(isBatchTooBig);
+  EXPECT_EQ(deliveredEdges, edges);
+}
+
+TEST_F(ScEventTest, BatchEventsDeliveredByTime)
+{
+  ScAddr const nodeAddr = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const nodeAddr2 = m_ctx->CreateNode(ScType::NodeConst);
+
+  std::atomic_uint batchesCount = 0;
+  std::atomic_uint eventsCount = 0;
+  ScEvent event(
+      *m_ctx,
+      nodeAddr2,
+      ScEvent::Type::AddInputEdge,
+      ScEvent::DelegateBatchFunc(
+          [&](ScAddr const &, ScEvent::Batch const & batch)
+          {
+            ++batchesCount;
+            eventsCount += batch.size();
+            return true;
+          }),
+      1000,
+      50);
+
+  for (size_t i = 0; i < 5; ++i)
+    m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, nodeAddr, nodeAddr2);
+
+  // batch isn't full, so it is delivered when its time window is over
+  ScTimer timer(kTestTimeout);
+  while (eventsCount.load() < 5 && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  EXPECT_EQ(eventsCount.load(), 5u);
+  EXPECT_GE(batchesCount.load(), 1u);
+  EXPECT_LE(batchesCount.load(), 5u);
+}
+
+TEST_F(ScEventTest, EventsQueueStatCountsPrioritizedEvents)
+{
+  ScAddr const nodeAddr = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const nodeAddr2 = m_ctx->CreateNode(ScType::NodeConst);
+
+  std::atomic_uint eventsCount = 0;
+  ScEventAddInputEdge event(
+      *m_ctx,
+      nodeAddr2,
+      [&eventsCount](ScAddr const &, ScAddr const &, ScAddr const &)
+      {
+        ++eventsCount;
+        return true;
+      });
+  event.SetPriority(ScEvent::Priority::Interactive);
+
+  ScMemoryContext::ScEventsQueueStat const statBefore = m_ctx->CalculateEventsQueueStat();
+
+  size_t const count = 5;
+  for (size_t i = 0; i < count; ++i)
+    m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, nodeAddr, nodeAddr2);
+
+  ScTimer timer(kTestTimeout);
+  while (eventsCount.load() < count && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  EXPECT_EQ(eventsCount.load(), count);
+
+  ScMemoryContext::ScEventsQueueStat const statAfter = m_ctx->CalculateEventsQueueStat();
+  EXPECT_GE(statAfter.m_processedCount - statBefore.m_processedCount, count);
+  EXPECT_GE(statAfter.m_maxSize, 1u);
+  EXPECT_GE(statAfter.m_maxWaitTime, statAfter.m_averageWaitTime);
+  EXPECT_EQ(statAfter.m_droppedCount, 0u);
+}
+
+TEST_F(ScEventTest, EventsLatencyStatSeparatesPendingAndProcessing)
+{
+  ScAddr const nodeAddr = m_ctx->CreateNode(ScType::NodeConst);
+
+  ScEventAddOutputEdge event(
+      *m_ctx,
+      nodeAddr,
+      [](ScAddr const &, ScAddr const &, ScAddr const &)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return true;
+      });
+  event.SetPriority(ScEvent::Priority::Background);
+
+  size_t const count = 3;
+  {
+    ScMemoryContextEventsPendingGuard guard(*m_ctx);
+    for (size_t i = 0; i < count; ++i)
+      m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, nodeAddr, m_ctx->CreateNode(ScType::NodeConst));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+
+  auto const findStat = [this]() -> std::optional<ScMemoryContext::ScEventsLatencyStat>
+  {
+    for (auto const & stat : m_ctx->CalculateEventsLatencyStat())
+    {
+      if (stat.m_eventType == ScEvent::Type::AddOutputEdge && stat.m_priority == ScEvent::Priority::Background)
+        return stat;
+    }
+    return std::nullopt;
+  };
+
+  std::optional<ScMemoryContext::ScEventsLatencyStat> stat = findStat();
+  ScTimer timer(kTestTimeout);
+  while ((!stat || stat->m_total.m_count < count) && !timer.IsTimeOut())
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    stat = findStat();
+  }
+
+  ASSERT_TRUE(stat);
+  EXPECT_EQ(stat->m_pending.m_count, count);
+  EXPECT_EQ(stat->m_queued.m_count, count);
+  EXPECT_EQ(stat->m_processing.m_count, count);
+  EXPECT_EQ(stat->m_total.m_count, count);
+  // sc-events were pending until the end of guard
+  EXPECT_GE(stat->m_pending.m_maxTime, 20000u);
+  EXPECT_GE(stat->m_processing.m_averageTime, 20000u);
+  EXPECT_GE(stat->m_total.m_maxTime, stat->m_pending.m_maxTime + 20000u);
+  EXPECT_LE(stat->m_processing.m_medianTime, stat->m_processing.m_percentile99Time);
+  EXPECT_LE(stat->m_processing.m_percentile99Time, stat->m_processing.m_maxTime);
+  ASSERT_EQ(stat->m_processing.m_buckets.size(), size_t(SC_LATENCY_HISTOGRAM_BUCKETS_COUNT));
+  // callbacks take from 2^14 to 2^16 - 1 microseconds
+  EXPECT_GT(stat->m_processing.m_buckets[15] + stat->m_processing.m_buckets[16], 0u);
+
+  ScMemoryContext::ScEventsWorkersStat const & workersStat = m_ctx->CalculateEventsWorkersStat();
+  EXPECT_GE(workersStat.m_maxWorkersCount, 1u);
+  EXPECT_GE(workersStat.m_maxBusyWorkersCount, 1u);
+  EXPECT_LE(workersStat.m_maxBusyWorkersCount, workersStat.m_maxWorkersCount);
+  EXPECT_GE(workersStat.m_busyTime, count * 20000u);
+  EXPECT_GT(workersStat.m_utilization, 0.0);
+  EXPECT_LE(workersStat.m_utilization, 1.0);
+}
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <string>
+
 #include "test_defines.hpp"
 
 extern "C"
@@ -822,6 +824,127 @@ TEST(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_link_hashes_by_string
   EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
 }
 
+TEST(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_link_hashes_by_big_string_save_load)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  // big strings aren't divided into terms, but they are found by content hash
+  std::string const bigString1 = std::string(3000, 'a') + TEXT_EXAMPLE_1;
+  std::string const bigString2 = std::string(3000, 'a') + TEXT_EXAMPLE_2;
+  sc_addr_hash hash1 = 112;
+  sc_addr_hash hash2 = 518;
+  sc_addr_hash hash3 = 734;
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, hash1, bigString1.c_str(), bigString1.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, hash2, bigString2.c_str(), bigString2.size()), SC_FS_MEMORY_OK);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_link_string(memory, hash3, bigString1.c_str(), bigString1.size()), SC_FS_MEMORY_OK);
+
+  auto const & checkLinkHashes = [&memory](std::string const & string, sc_uint32 expectedSize)
+  {
+    sc_list * found_link_hashes;
+    sc_list_init(&found_link_hashes);
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_link_hashes_by_string(
+            memory, string.c_str(), string.size(), found_link_hashes, _test_push_link_hash),
+        SC_FS_MEMORY_OK);
+    EXPECT_EQ(found_link_hashes->size, expectedSize);
+    sc_list_destroy(found_link_hashes);
+  };
+
+  checkLinkHashes(bigString1, 2u);
+  checkLinkHashes(bigString2, 1u);
+  checkLinkHashes(std::string(3000, 'a'), 0u);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+
+  checkLinkHashes(bigString1, 2u);
+  checkLinkHashes(bigString2, 1u);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+TEST(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_link_hashes_by_string_load_without_content_hashes)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  sc_char string1[] = TEXT_EXAMPLE_1;
+  sc_addr_hash hash1 = 112;
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash1, string1, sc_str_len(string1)), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  // repos saved before content hashes were introduced have only `term - offsets` dictionary
+  EXPECT_TRUE(sc_fs_remove_file(SC_DICTIONARY_FS_MEMORY_PATH "/content_hashes_string_offsets" SC_FS_EXT));
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+
+  {
+    sc_list * found_link_hashes;
+    sc_list_init(&found_link_hashes);
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_link_hashes_by_string(
+            memory, string1, sc_str_len(string1), found_link_hashes, _test_push_link_hash),
+        SC_FS_MEMORY_OK);
+    EXPECT_EQ(found_link_hashes->size, 1u);
+
+    sc_iterator * it = sc_list_iterator(found_link_hashes);
+    EXPECT_TRUE(sc_iterator_next(it));
+    EXPECT_EQ((sc_addr_hash)sc_iterator_get(it), hash1);
+    sc_iterator_destroy(it);
+    sc_list_destroy(found_link_hashes);
+  }
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
+TEST(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_link_hashes_by_binary_string_load_without_content_hashes)
+{
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+
+  sc_char string1[] = "binary\0string";
+  sc_uint64 const string1_size = sizeof(string1) - 1;
+  sc_addr_hash hash1 = 112;
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, hash1, string1, string1_size), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  // content hashes of strings with null characters are rebuilt by their sizes in strings file
+  EXPECT_TRUE(sc_fs_remove_file(SC_DICTIONARY_FS_MEMORY_PATH "/content_hashes_string_offsets" SC_FS_EXT));
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+
+  {
+    sc_list * found_link_hashes;
+    sc_list_init(&found_link_hashes);
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_link_hashes_by_string(
+            memory, string1, string1_size, found_link_hashes, _test_push_link_hash),
+        SC_FS_MEMORY_OK);
+    EXPECT_EQ(found_link_hashes->size, 1u);
+
+    sc_iterator * it = sc_list_iterator(found_link_hashes);
+    EXPECT_TRUE(sc_iterator_next(it));
+    EXPECT_EQ((sc_addr_hash)sc_iterator_get(it), hash1);
+    sc_iterator_destroy(it);
+    sc_list_destroy(found_link_hashes);
+  }
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+}
+
 TEST(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_get_link_hashes_by_substring)
 {
   sc_dictionary_fs_memory * memory;
@@ -1099,6 +1222,61 @@ TEST(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_link_unlink_strings)
   EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
 }
 
+#define SC_DICTIONARY_FS_MEMORY_COMPACTED_PATH "fs-memory-compacted"
+
+TEST(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_compact_binary_strings)
+{
+  sc_fs_remove_directory(SC_DICTIONARY_FS_MEMORY_COMPACTED_PATH);
+
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize(&memory, SC_DICTIONARY_FS_MEMORY_PATH), SC_FS_MEMORY_OK);
+  sc_dictionary_fs_memory * compacted_memory;
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_initialize(&compacted_memory, SC_DICTIONARY_FS_MEMORY_COMPACTED_PATH), SC_FS_MEMORY_OK);
+
+  {
+    sc_char const binary_string[] = {'b', 'i', 'n', '\0', 'a', 'r', 'y', '\0', '\0', '!'};
+    sc_uint64 const binary_string_size = sizeof(binary_string);
+    sc_char text_string[] = TEXT_EXAMPLE_1;
+
+    sc_addr_hash const link_hashes[] = {112, 518};
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_link_string(memory, link_hashes[0], binary_string, binary_string_size),
+        SC_FS_MEMORY_OK);
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_link_string(memory, link_hashes[1], text_string, sc_str_len(text_string)),
+        SC_FS_MEMORY_OK);
+
+    sc_addr_hash const compacted_link_hashes[] = {12, 18};
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_compact(memory, compacted_memory, link_hashes, compacted_link_hashes, 2),
+        SC_FS_MEMORY_OK);
+
+    sc_char * found_string;
+    sc_uint64 found_string_size;
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_string_by_link_hash(
+            compacted_memory, compacted_link_hashes[0], &found_string, &found_string_size),
+        SC_FS_MEMORY_OK);
+    EXPECT_EQ(found_string_size, binary_string_size);
+    EXPECT_EQ(std::string(found_string, found_string_size), std::string(binary_string, binary_string_size));
+    sc_mem_free(found_string);
+
+    EXPECT_EQ(
+        sc_dictionary_fs_memory_get_string_by_link_hash(
+            compacted_memory, compacted_link_hashes[1], &found_string, &found_string_size),
+        SC_FS_MEMORY_OK);
+    EXPECT_EQ(found_string_size, sc_str_len(text_string));
+    EXPECT_STREQ(found_string, text_string);
+    sc_mem_free(found_string);
+  }
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(compacted_memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  sc_fs_remove_directory(SC_DICTIONARY_FS_MEMORY_COMPACTED_PATH);
+}
+
 TEST(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_intersect_strings_by_terms)
 {
   sc_dictionary_fs_memory * memory;
@@ -1471,3 +1649,280 @@ TEST(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_mutiple_link_strings_with
 
   EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
 }
+
+sc_uint32 _test_count_link_hashes_by_substring(sc_dictionary_fs_memory * memory, sc_char const * substring)
+{
+  sc_list * found_link_hashes;
+  sc_list_init(&found_link_hashes);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_get_link_hashes_by_substring(
+          memory, substring, sc_str_len(substring), found_link_hashes, _test_push_link_hash),
+      SC_FS_MEMORY_OK);
+  sc_uint32 const size = found_link_hashes->size;
+  sc_list_destroy(found_link_hashes);
+  return size;
+}
+
+sc_uint32 _test_count_link_hashes_by_terms(sc_dictionary_fs_memory * memory, sc_bool intersect)
+{
+  sc_list * terms;
+  sc_list_init(&terms);
+  sc_list_push_back(terms, (void *)"first");
+  sc_list_push_back(terms, (void *)"third");
+
+  sc_list * found_link_hashes;
+  if (intersect)
+    sc_dictionary_fs_memory_intersect_link_hashes_by_terms(memory, terms, &found_link_hashes);
+  else
+    sc_dictionary_fs_memory_unite_link_hashes_by_terms(memory, terms, &found_link_hashes);
+  sc_list_destroy(terms);
+
+  sc_uint32 const size = found_link_hashes->size;
+  sc_list_destroy(found_link_hashes);
+  return size;
+}
+
+#define SC_DICTIONARY_FS_MEMORY_TERMS_PATH SC_DICTIONARY_FS_MEMORY_PATH "/term_string_offsets" SC_FS_EXT
+#define SC_DICTIONARY_FS_MEMORY_SORTED_TERMS_PATH SC_DICTIONARY_FS_MEMORY_PATH "/sorted_term_string_offsets" SC_FS_EXT
+
+TEST(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_sorted_terms_dictionary_save_load)
+{
+  sc_memory_params * params = _sc_dictionary_fs_memory_get_default_params(SC_DICTIONARY_FS_MEMORY_PATH, SC_TRUE);
+  params->sorted_terms_dictionary = SC_TRUE;
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, params), SC_FS_MEMORY_OK);
+  params->clear = SC_FALSE;
+
+  sc_char string1[] = "it is the first string";
+  sc_char string2[] = "it is the second string";
+  sc_char string3[] = "it is the third string";
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 112, string1, sc_str_len(string1)), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 518, string2, sc_str_len(string2)), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+  EXPECT_TRUE(sc_fs_is_file(SC_DICTIONARY_FS_MEMORY_SORTED_TERMS_PATH));
+  EXPECT_FALSE(sc_fs_is_file(SC_DICTIONARY_FS_MEMORY_TERMS_PATH));
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, params), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_NE(memory->terms_string_offsets_file, nullptr);
+
+  // terms of the third string are added after sorted dictionary file is loaded
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 734, string3, sc_str_len(string3)), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_count_link_hashes_by_substring(memory, "it is the"), 3u);
+  EXPECT_EQ(_test_count_link_hashes_by_substring(memory, "the sec"), 1u);
+  EXPECT_EQ(_test_count_link_hashes_by_substring(memory, "thi"), 1u);
+  EXPECT_EQ(_test_count_link_hashes_by_terms(memory, SC_TRUE), 0u);
+  EXPECT_EQ(_test_count_link_hashes_by_terms(memory, SC_FALSE), 2u);
+
+  // saved terms are searched in the new file, so they aren't kept in memory and merged again
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_sorted_dictionary_file_get_records_count(memory->terms_string_offsets_file), 7u);
+  EXPECT_EQ(sc_dictionary_get_by_key(memory->terms_string_offsets_dictionary, "third", 5), nullptr);
+  EXPECT_EQ(_test_count_link_hashes_by_substring(memory, "it is the"), 3u);
+  EXPECT_EQ(_test_count_link_hashes_by_substring(memory, "thi"), 1u);
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, params), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_sorted_dictionary_file_get_records_count(memory->terms_string_offsets_file), 7u);
+  EXPECT_EQ(_test_count_link_hashes_by_substring(memory, "it is the"), 3u);
+  EXPECT_EQ(_test_count_link_hashes_by_substring(memory, "thi"), 1u);
+  EXPECT_EQ(_test_count_link_hashes_by_terms(memory, SC_FALSE), 2u);
+
+  // strings are appended after the last string saved in sorted dictionary file
+  sc_char string4[] = "it is the fourth string";
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 903, string4, sc_str_len(string4)), SC_FS_MEMORY_OK);
+  sc_char * found_string;
+  sc_uint64 found_string_size;
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_get_string_by_link_hash(memory, 112, &found_string, &found_string_size),
+      SC_FS_MEMORY_OK);
+  EXPECT_TRUE(sc_str_cmp(found_string, string1));
+  sc_mem_free(found_string);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+  sc_mem_free(params);
+}
+
+TEST(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_convert_terms_dictionary)
+{
+  sc_memory_params * params = _sc_dictionary_fs_memory_get_default_params(SC_DICTIONARY_FS_MEMORY_PATH, SC_TRUE);
+  params->sorted_terms_dictionary = SC_FALSE;
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, params), SC_FS_MEMORY_OK);
+  params->clear = SC_FALSE;
+
+  sc_char string1[] = "it is the first string";
+  sc_char string2[] = "it is the third string";
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 112, string1, sc_str_len(string1)), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 518, string2, sc_str_len(string2)), SC_FS_MEMORY_OK);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+  EXPECT_TRUE(sc_fs_is_file(SC_DICTIONARY_FS_MEMORY_TERMS_PATH));
+  EXPECT_FALSE(sc_fs_is_file(SC_DICTIONARY_FS_MEMORY_SORTED_TERMS_PATH));
+
+  // dictionary in the previous format is converted into sorted dictionary file
+  params->sorted_terms_dictionary = SC_TRUE;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, params), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->terms_string_offsets_file, nullptr);
+  EXPECT_EQ(_test_count_link_hashes_by_terms(memory, SC_FALSE), 2u);
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+  EXPECT_FALSE(sc_fs_is_file(SC_DICTIONARY_FS_MEMORY_TERMS_PATH));
+  EXPECT_TRUE(sc_fs_is_file(SC_DICTIONARY_FS_MEMORY_SORTED_TERMS_PATH));
+
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, params), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_count_link_hashes_by_substring(memory, "it is the"), 2u);
+  EXPECT_EQ(_test_count_link_hashes_by_terms(memory, SC_FALSE), 2u);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  // and back if sorted dictionary file isn't used
+  params->sorted_terms_dictionary = SC_FALSE;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, params), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->terms_string_offsets_file, nullptr);
+  EXPECT_EQ(_test_count_link_hashes_by_substring(memory, "it is the"), 2u);
+  EXPECT_EQ(_test_count_link_hashes_by_terms(memory, SC_FALSE), 2u);
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+  EXPECT_TRUE(sc_fs_is_file(SC_DICTIONARY_FS_MEMORY_TERMS_PATH));
+  EXPECT_FALSE(sc_fs_is_file(SC_DICTIONARY_FS_MEMORY_SORTED_TERMS_PATH));
+
+  sc_mem_free(params);
+}
+
+sc_uint32 _test_count_link_hashes_by_string(sc_dictionary_fs_memory * memory, sc_char const * string)
+{
+  sc_list * found_link_hashes;
+  sc_list_init(&found_link_hashes);
+  EXPECT_EQ(
+      sc_dictionary_fs_memory_get_link_hashes_by_string(
+          memory, string, sc_str_len(string), found_link_hashes, _test_push_link_hash),
+      SC_FS_MEMORY_OK);
+  sc_uint32 const size = found_link_hashes->size;
+  sc_list_destroy(found_link_hashes);
+  return size;
+}
+
+sc_bool _test_is_link_string(sc_dictionary_fs_memory * memory, sc_addr_hash link_hash, sc_char const * string)
+{
+  sc_char * found_string;
+  sc_uint64 found_string_size;
+  if (sc_dictionary_fs_memory_get_string_by_link_hash(memory, link_hash, &found_string, &found_string_size)
+      != SC_FS_MEMORY_OK)
+    return string == nullptr;
+
+  sc_bool const is_equal = string != nullptr && sc_str_cmp(found_string, string);
+  sc_mem_free(found_string);
+  return is_equal;
+}
+
+TEST(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_lazy_dictionaries_loading)
+{
+  sc_memory_params * params = _sc_dictionary_fs_memory_get_default_params(SC_DICTIONARY_FS_MEMORY_PATH, SC_TRUE);
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, params), SC_FS_MEMORY_OK);
+  params->clear = SC_FALSE;
+
+  sc_char string1[] = "it is the first string";
+  sc_char string2[] = "it is the second string";
+  sc_char string3[] = "it is the third string";
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 112, string1, sc_str_len(string1)), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 518, string2, sc_str_len(string2)), SC_FS_MEMORY_OK);
+  sc_uint64 const last_string_offset = memory->last_string_offset;
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  params->lazy_dictionaries_loading = SC_TRUE;
+  params->dictionaries_unload_period = 0;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, params), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->loaded_dictionaries, 0u);
+  EXPECT_EQ(memory->last_string_offset, last_string_offset);
+
+  // strings are written and unlinked before dictionaries are loaded
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 734, string3, sc_str_len(string3)), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_unlink_string(memory, 518), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->journal->size, 2u);
+
+  // only dictionaries of sc-links are loaded to get strings
+  EXPECT_TRUE(_test_is_link_string(memory, 734, string3));
+  EXPECT_TRUE(_test_is_link_string(memory, 518, nullptr));
+  EXPECT_TRUE(_test_is_link_string(memory, 112, string1));
+  EXPECT_EQ(memory->loaded_dictionaries, SC_DICTIONARY_FS_MEMORY_LINKS);
+  EXPECT_EQ(_test_count_link_hashes_by_string(memory, string3), 1u);
+
+  EXPECT_EQ(_test_count_link_hashes_by_substring(memory, "it is the"), 2u);
+  EXPECT_EQ(_test_count_link_hashes_by_terms(memory, SC_FALSE), 2u);
+  EXPECT_EQ(memory->loaded_dictionaries, SC_DICTIONARY_FS_MEMORY_ALL);
+  EXPECT_EQ(memory->journal->size, 0u);
+
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  params->lazy_dictionaries_loading = SC_FALSE;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, params), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_count_link_hashes_by_substring(memory, "it is the"), 2u);
+  EXPECT_TRUE(_test_is_link_string(memory, 734, string3));
+  EXPECT_TRUE(_test_is_link_string(memory, 518, nullptr));
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  sc_mem_free(params);
+}
+
+TEST(ScDictionaryFSMemoryTest, sc_dictionary_fs_memory_lazy_dictionaries_unloading)
+{
+  sc_memory_params * params = _sc_dictionary_fs_memory_get_default_params(SC_DICTIONARY_FS_MEMORY_PATH, SC_TRUE);
+  params->lazy_dictionaries_loading = SC_TRUE;
+  // dictionaries are unloaded by test, not by unloader
+  params->dictionaries_unload_period = 3600;
+  sc_dictionary_fs_memory * memory;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, params), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  params->clear = SC_FALSE;
+
+  sc_char string1[] = "it is the first string";
+  sc_char string2[] = "it is the second string";
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 112, string1, sc_str_len(string1)), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_count_link_hashes_by_substring(memory, "it is the"), 1u);
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 518, string2, sc_str_len(string2)), SC_FS_MEMORY_OK);
+
+  // changed dictionaries are saved before they are unloaded
+  sc_mutex_lock(&memory->dictionaries_mutex);
+  EXPECT_NE(memory->loaded_dictionaries, 0u);
+  _sc_dictionary_fs_memory_unload_dictionaries(memory);
+  EXPECT_EQ(memory->loaded_dictionaries, 0u);
+  EXPECT_EQ(memory->changed_dictionaries, 0u);
+  sc_mutex_unlock(&memory->dictionaries_mutex);
+
+  EXPECT_EQ(_test_count_link_hashes_by_substring(memory, "it is the"), 2u);
+  EXPECT_TRUE(_test_is_link_string(memory, 518, string2));
+
+  sc_mutex_lock(&memory->dictionaries_mutex);
+  _sc_dictionary_fs_memory_unload_dictionaries(memory);
+  EXPECT_EQ(memory->loaded_dictionaries, 0u);
+  sc_mutex_unlock(&memory->dictionaries_mutex);
+
+  // the same string is written again because existing strings can't be found without dictionaries
+  EXPECT_EQ(sc_dictionary_fs_memory_link_string(memory, 734, string1, sc_str_len(string1)), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_save(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(memory->journal_dictionaries, 0u);
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  params->lazy_dictionaries_loading = SC_FALSE;
+  EXPECT_EQ(sc_dictionary_fs_memory_initialize_ext(&memory, params), SC_FS_MEMORY_OK);
+  EXPECT_EQ(sc_dictionary_fs_memory_load(memory), SC_FS_MEMORY_OK);
+  EXPECT_EQ(_test_count_link_hashes_by_substring(memory, "it is the"), 3u);
+  EXPECT_EQ(_test_count_link_hashes_by_string(memory, string1), 2u);
+  EXPECT_TRUE(_test_is_link_string(memory, 734, string1));
+  EXPECT_EQ(sc_dictionary_fs_memory_shutdown(memory), SC_FS_MEMORY_OK);
+
+  sc_mem_free(params);
+}
@@ -69,6 +69,54 @@ TEST(ScFSMemoryTest, sc_fs_memory_save_load)
   EXPECT_EQ(sc_fs_memory_shutdown(), SC_FS_MEMORY_OK);
 }
 
+TEST(ScFSMemoryTest, sc_fs_memory_save_load_segments_elements)
+{
+  EXPECT_EQ(sc_fs_memory_initialize(SC_FS_MEMORY_PATH, SC_TRUE), SC_FS_MEMORY_OK);
+
+  sc_addr_seg const segments_count = 3;
+  sc_storage * storage = sc_mem_new(sc_storage, 1);
+  storage->segments = sc_mem_new(sc_segment *, segments_count);
+
+  storage->segments_count = segments_count;
+  for (sc_addr_seg i = 0; i < segments_count; ++i)
+  {
+    sc_segment * segment = sc_segment_new(i + 1);
+    segment->elements[1].flags.type = sc_type_node | sc_type_const;
+    segment->elements[1].flags.states = SC_STATE_ELEMENT_EXIST;
+    segment->elements[2].flags.type = sc_type_link | sc_type_const;
+    segment->elements[2].flags.states = SC_STATE_ELEMENT_EXIST;
+    segment->elements[3].flags.type = sc_type_arc_pos_const_perm;
+    segment->elements[3].flags.states = SC_STATE_ELEMENT_EXIST;
+    segment->elements[3].output_arcs_count = i;
+    segment->last_engaged_offset = 3;
+    storage->segments[i] = segment;
+  }
+  EXPECT_EQ(sc_fs_memory_save(storage), SC_FS_MEMORY_OK);
+  for (sc_addr_seg i = 0; i < segments_count; ++i)
+    sc_segment_free(storage->segments[i]);
+
+  EXPECT_EQ(sc_fs_memory_load(storage), SC_FS_MEMORY_OK);
+  EXPECT_EQ(storage->segments_count, segments_count);
+  for (sc_addr_seg i = 0; i < segments_count; ++i)
+  {
+    sc_segment * segment = storage->segments[i];
+    EXPECT_EQ(segment->last_engaged_offset, 3u);
+    EXPECT_EQ(segment->elements[1].flags.type, sc_type_node | sc_type_const);
+    EXPECT_EQ(segment->elements[2].flags.type, sc_type_link | sc_type_const);
+    EXPECT_EQ(segment->elements[3].flags.type, sc_type_arc_pos_const_perm);
+    EXPECT_EQ(segment->elements[3].output_arcs_count, i);
+    EXPECT_EQ(segment->registry_counts[SC_SEGMENT_ELEMENT_CLASS_NODE], 1u);
+    EXPECT_EQ(segment->registry_counts[SC_SEGMENT_ELEMENT_CLASS_LINK], 1u);
+    EXPECT_EQ(segment->registry_counts[SC_SEGMENT_ELEMENT_CLASS_CONNECTOR], 1u);
+    sc_segment_free(segment);
+  }
+
+  sc_mem_free(storage->segments);
+  sc_mem_free(storage);
+
+  EXPECT_EQ(sc_fs_memory_shutdown(), SC_FS_MEMORY_OK);
+}
+
 TEST(ScFSMemoryTest, sc_fs_memory_save_load_deprecated_segments)
 {
   EXPECT_TRUE(sc_fs_copy_file(
@@ -277,6 +277,64 @@ TEST_F(SCsHelperTest, GenerateBySCs_Visibility_Local)
   EXPECT_NE(res[0]["_trg"], res[1]["_trg"]);
 }
 
+TEST_F(SCsHelperTest, GenerateBySCs_SymbolTable)
+{
+  auto const symbolTable = std::make_shared<SCsSymbolTable>();
+
+  SCsHelper helper(*m_ctx, std::make_shared<DummyFileInterface>(), symbolTable);
+  EXPECT_TRUE(helper.GenerateBySCsText("x_symbol -> .y_symbol;; x_symbol -> ..z_symbol;;"));
+
+  ScAddr const xAddr = m_ctx->HelperFindBySystemIdtf("x_symbol");
+  EXPECT_TRUE(xAddr.IsValid());
+
+  ScAddr addr;
+  ScAddrVector idtfConstruction;
+  EXPECT_TRUE(symbolTable->Find("x_symbol", addr, idtfConstruction));
+  EXPECT_EQ(addr, xAddr);
+  EXPECT_EQ(idtfConstruction.size(), 3u);
+
+  SCsHelper otherHelper(*m_ctx, std::make_shared<DummyFileInterface>(), symbolTable);
+  EXPECT_TRUE(otherHelper.GenerateBySCsText("x_symbol -> .y_symbol;; x_symbol -> ..z_symbol;;"));
+
+  ScTemplate templ;
+  templ.Triple(xAddr, ScType::EdgeAccessVarPosPerm >> "_edge", ScType::Unknown >> "_trg");
+
+  ScTemplateSearchResult res;
+  EXPECT_TRUE(m_ctx->HelperSearchTemplate(templ, res));
+  EXPECT_EQ(res.Size(), 4u);
+
+  std::set<ScAddr, ScAddrLessFunc> targets;
+  for (size_t i = 0; i < res.Size(); ++i)
+    targets.insert(res[i]["_trg"]);
+  // global sc-element is shared by both SCs-texts, local ones aren't
+  EXPECT_EQ(targets.size(), 3u);
+}
+
+TEST_F(SCsHelperTest, GenerateBySCs_SymbolTableWithErasedElement)
+{
+  auto const symbolTable = std::make_shared<SCsSymbolTable>();
+
+  SCsHelper helper(*m_ctx, std::make_shared<DummyFileInterface>(), symbolTable);
+  EXPECT_TRUE(helper.GenerateBySCsText("x_erased -> y_erased;;"));
+
+  ScAddr const xAddr = m_ctx->HelperFindBySystemIdtf("x_erased");
+  EXPECT_TRUE(xAddr.IsValid());
+  EXPECT_TRUE(m_ctx->EraseElement(xAddr));
+
+  SCsHelper otherHelper(*m_ctx, std::make_shared<DummyFileInterface>(), symbolTable);
+  EXPECT_TRUE(otherHelper.GenerateBySCsText("x_erased -> y_erased;;"));
+
+  ScAddr const newXAddr = m_ctx->HelperFindBySystemIdtf("x_erased");
+  EXPECT_TRUE(newXAddr.IsValid());
+  EXPECT_TRUE(m_ctx->HelperCheckEdge(
+      newXAddr, m_ctx->HelperFindBySystemIdtf("y_erased"), ScType::EdgeAccessConstPosPerm));
+
+  ScAddr addr;
+  ScAddrVector idtfConstruction;
+  EXPECT_TRUE(symbolTable->Find("x_erased", addr, idtfConstruction));
+  EXPECT_EQ(addr, newXAddr);
+}
+
 TEST_F(SCsHelperTest, GenerateAppendToStructure)
 {
   SCsHelper helper(*m_ctx, std::make_shared<DummyFileInterface>());
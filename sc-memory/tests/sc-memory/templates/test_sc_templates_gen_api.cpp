@@ -433,3 +433,38 @@ TEST_F(ScTemplateGenApiTest, GenTemplateWithReplacedTargetHavingUnextendableType
   ScTemplateGenResult result;
   EXPECT_THROW(m_ctx->HelperGenTemplate(templ, result, params), utils::ExceptionInvalidParams);
 }
+
+TEST_F(ScTemplateGenApiTest, GenTemplateWithInvalidLastTripleDoesNotCreateElements)
+{
+  ScTemplate templ;
+  templ.Triple(ScType::NodeVar >> "_addr1", ScType::EdgeDCommonVar >> "_edge", ScType::NodeVar >> "_addr2");
+  templ.Triple("_addr2", ScType::EdgeAccessVarPosTemp, "_edge");
+  templ.Triple("_addr1", "_other_edge", ScType::LinkVar);
+
+  size_t const elementsCount = m_ctx->GetElementsCountByType(ScType::Unknown);
+
+  ScTemplateGenResult result;
+  EXPECT_THROW(m_ctx->HelperGenTemplate(templ, result), utils::ExceptionInvalidParams);
+  EXPECT_EQ(m_ctx->GetElementsCountByType(ScType::Unknown), elementsCount);
+}
+
+TEST_F(ScTemplateGenApiTest, GenTemplateWithConnectorsBetweenGeneratedElements)
+{
+  ScAddr const & classAddr = m_ctx->CreateNode(ScType::NodeConstClass);
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::EdgeAccessVarPosPerm >> "_class_edge", ScType::NodeVar >> "_addr");
+  templ.Triple("_addr", ScType::EdgeDCommonVar >> "_edge", ScType::LinkVar >> "_link");
+  templ.Triple(ScType::NodeVarNoRole >> "_relation", ScType::EdgeAccessVarPosPerm, "_edge");
+
+  ScTemplateGenResult result;
+  EXPECT_TRUE(m_ctx->HelperGenTemplate(templ, result));
+  EXPECT_EQ(result.Size(), 9u);
+
+  EXPECT_TRUE(m_ctx->HelperCheckEdge(classAddr, result["_addr"], ScType::EdgeAccessConstPosPerm));
+  EXPECT_TRUE(m_ctx->HelperCheckEdge(result["_addr"], result["_link"], ScType::EdgeDCommonConst));
+  EXPECT_TRUE(m_ctx->HelperCheckEdge(result["_relation"], result["_edge"], ScType::EdgeAccessConstPosPerm));
+  EXPECT_EQ(m_ctx->GetElementType(result["_link"]), ScType::LinkConst);
+  EXPECT_EQ(m_ctx->GetEdgeSource(result["_class_edge"]), classAddr);
+  EXPECT_EQ(m_ctx->GetEdgeTarget(result["_class_edge"]), result["_addr"]);
+}
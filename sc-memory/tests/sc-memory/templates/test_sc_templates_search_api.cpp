@@ -3,6 +3,8 @@
 #include "sc-memory/sc_memory.hpp"
 #include "sc-memory/sc_struct.hpp"
 
+#include <algorithm>
+
 #include "template_test_utils.hpp"
 
 using ScTemplateSearchApiTest = ScTemplateTest;
@@ -294,6 +296,60 @@ TEST_F(ScTemplateSearchApiTest, SearchVarTriple)
   EXPECT_EQ(count, 0u);
 }
 
+TEST_F(ScTemplateSearchApiTest, SearchVarTripleWithTypedItem)
+{
+  ScAddr const structureAddr = m_ctx->CreateNode(ScType::NodeConstStruct);
+  ScAddr const nodeAddr = m_ctx->CreateNode(ScType::NodeConstClass);
+  ScAddr const edgeAddr = m_ctx->CreateEdge(ScType::EdgeAccessConstFuzPerm, structureAddr, nodeAddr);
+
+  ScTemplate templ;
+  templ.Triple(
+      ScType::NodeVarStruct >> "_structure", ScType::EdgeAccessVarFuzPerm >> "_edge", ScType::NodeVarClass >> "_node");
+
+  size_t count = 0;
+  m_ctx->HelperSearchTemplate(
+      templ,
+      [&](ScTemplateSearchResultItem const & item)
+      {
+        EXPECT_EQ(item["_structure"], structureAddr);
+        EXPECT_EQ(item["_edge"], edgeAddr);
+        EXPECT_EQ(item["_node"], nodeAddr);
+        ++count;
+      });
+
+  EXPECT_EQ(count, 1u);
+}
+
+TEST_F(ScTemplateSearchApiTest, SearchVarTripleWithTypedItemAndFixedTriple)
+{
+  ScAddr const structureAddr = m_ctx->CreateNode(ScType::NodeConstStruct);
+  ScAddr const nodeAddr = m_ctx->CreateNode(ScType::NodeConstClass);
+  ScAddr const edgeAddr = m_ctx->CreateEdge(ScType::EdgeAccessConstFuzPerm, structureAddr, nodeAddr);
+  m_ctx->CreateEdge(ScType::EdgeAccessConstFuzPerm, m_ctx->CreateNode(ScType::NodeConstStruct), nodeAddr);
+
+  ScAddr const classAddr = m_ctx->CreateNode(ScType::NodeConstClass);
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, classAddr, structureAddr);
+
+  // search is started from the fixed item, rather than from all structures
+  ScTemplate templ;
+  templ.Triple(
+      ScType::NodeVarStruct >> "_structure", ScType::EdgeAccessVarFuzPerm >> "_edge", ScType::NodeVarClass >> "_node");
+  templ.Triple(classAddr, ScType::EdgeAccessVarPosPerm, "_structure");
+
+  size_t count = 0;
+  m_ctx->HelperSearchTemplate(
+      templ,
+      [&](ScTemplateSearchResultItem const & item)
+      {
+        EXPECT_EQ(item["_structure"], structureAddr);
+        EXPECT_EQ(item["_edge"], edgeAddr);
+        EXPECT_EQ(item["_node"], nodeAddr);
+        ++count;
+      });
+
+  EXPECT_EQ(count, 1u);
+}
+
 TEST_F(ScTemplateSearchApiTest, SearchEmpty)
 {
   ScTemplate templ;
@@ -454,3 +510,210 @@ TEST_F(ScTemplateSearchApiTest, SearchTemplateWithConstantTriple)
   for (ScAddr const & addr : result[0])
     EXPECT_TRUE(m_ctx->IsElement(addr));
 }
+
+namespace
+{
+ScAddr CreateNodeWithIdtf(ScMemoryContext & ctx, ScAddr const & relationAddr, std::string const & idtf)
+{
+  ScAddr const & nodeAddr = ctx.CreateNode(ScType::NodeConst);
+  ScAddr const & linkAddr = ctx.CreateLink();
+  ctx.SetLinkContent(linkAddr, idtf);
+  ScAddr const & edgeAddr = ctx.CreateEdge(ScType::EdgeDCommonConst, nodeAddr, linkAddr);
+  ctx.CreateEdge(ScType::EdgeAccessConstPosPerm, relationAddr, edgeAddr);
+  return nodeAddr;
+}
+
+ScAddrVector SearchNodesByIdtf(
+    ScMemoryContext & ctx,
+    ScAddr const & relationAddr,
+    ScTemplateLinkContentPredicate const & predicate)
+{
+  ScTemplate templ;
+  templ.Quintuple(
+      ScType::NodeVar >> "_node",
+      ScType::EdgeDCommonVar,
+      ScType::LinkVar >> "_link",
+      ScType::EdgeAccessVarPosPerm,
+      relationAddr);
+  templ.LinkContent("_link", predicate);
+
+  ScAddrVector nodes;
+  ctx.HelperSearchTemplate(
+      templ,
+      [&nodes](ScTemplateResultItem const & item)
+      {
+        nodes.push_back(item["_node"]);
+      });
+  std::sort(nodes.begin(), nodes.end(), ScAddrLessFunc());
+  return nodes;
+}
+
+}  // namespace
+
+TEST_F(ScTemplateSearchApiTest, SearchWithLinkContentPredicates)
+{
+  ScAddr const & relationAddr = m_ctx->CreateNode(ScType::NodeConstNoRole);
+  ScAddr const & setAddr = CreateNodeWithIdtf(*m_ctx, relationAddr, "concept_set");
+  ScAddr const & setTheoryAddr = CreateNodeWithIdtf(*m_ctx, relationAddr, "concept_set_theory");
+  ScAddr const & relationConceptAddr = CreateNodeWithIdtf(*m_ctx, relationAddr, "concept_relation");
+  ScAddr const & numberAddr = CreateNodeWithIdtf(*m_ctx, relationAddr, "42.5");
+  // link with equal content, which isn't identifier
+  ScAddr const & otherLinkAddr = m_ctx->CreateLink();
+  m_ctx->SetLinkContent(otherLinkAddr, "concept_set");
+  m_ctx->CreateEdge(ScType::EdgeDCommonConst, m_ctx->CreateNode(ScType::NodeConst), otherLinkAddr);
+
+  auto const & Sorted = [](ScAddrVector addrs)
+  {
+    std::sort(addrs.begin(), addrs.end(), ScAddrLessFunc());
+    return addrs;
+  };
+
+  EXPECT_EQ(
+      SearchNodesByIdtf(*m_ctx, relationAddr, ScTemplateLinkContentPredicate::Equal("concept_set")),
+      ScAddrVector{setAddr});
+  EXPECT_EQ(
+      SearchNodesByIdtf(*m_ctx, relationAddr, ScTemplateLinkContentPredicate::Prefix("concept_set")),
+      Sorted({setAddr, setTheoryAddr}));
+  EXPECT_EQ(
+      SearchNodesByIdtf(*m_ctx, relationAddr, ScTemplateLinkContentPredicate::Substring("relation")),
+      ScAddrVector{relationConceptAddr});
+  // substring in the middle of term
+  EXPECT_EQ(
+      SearchNodesByIdtf(*m_ctx, relationAddr, ScTemplateLinkContentPredicate::Substring("elatio")),
+      ScAddrVector{relationConceptAddr});
+  EXPECT_EQ(
+      SearchNodesByIdtf(*m_ctx, relationAddr, ScTemplateLinkContentPredicate::NumberRange(40, 50)),
+      ScAddrVector{numberAddr});
+  EXPECT_TRUE(SearchNodesByIdtf(*m_ctx, relationAddr, ScTemplateLinkContentPredicate::NumberRange(0, 10)).empty());
+  EXPECT_TRUE(SearchNodesByIdtf(*m_ctx, relationAddr, ScTemplateLinkContentPredicate::Equal("concept")).empty());
+}
+
+TEST_F(ScTemplateSearchApiTest, SearchTripleWithLinkContentPredicate)
+{
+  ScAddr const & setAddr = m_ctx->CreateNode(ScType::NodeConstClass);
+  ScAddrVector links;
+  for (std::string const & content : {"apple", "apricot", "banana"})
+  {
+    ScAddr const & linkAddr = m_ctx->CreateLink();
+    m_ctx->SetLinkContent(linkAddr, content);
+    m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, setAddr, linkAddr);
+    links.push_back(linkAddr);
+  }
+
+  ScTemplate templ;
+  templ.Triple(setAddr, ScType::EdgeAccessVarPosPerm, ScType::LinkVar >> "_link");
+  templ.LinkContent("_link", ScTemplateLinkContentPredicate::Prefix("ap"));
+
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->HelperSearchTemplate(templ, result));
+  EXPECT_EQ(result.Size(), 2u);
+
+  ScAddrVector foundLinks;
+  result.ForEach(
+      [&foundLinks](ScTemplateResultItem const & item)
+      {
+        foundLinks.push_back(item["_link"]);
+      });
+  std::sort(foundLinks.begin(), foundLinks.end(), ScAddrLessFunc());
+  ScAddrVector expectedLinks{links[0], links[1]};
+  std::sort(expectedLinks.begin(), expectedLinks.end(), ScAddrLessFunc());
+  EXPECT_EQ(foundLinks, expectedLinks);
+}
+
+TEST_F(ScTemplateSearchApiTest, SearchLinksWithPrefixPredicateByWholeContent)
+{
+  ScAddr const & setAddr = m_ctx->CreateNode(ScType::NodeConstClass);
+  ScAddr const & searchableLinkAddr = m_ctx->CreateLink();
+  m_ctx->SetLinkContent(searchableLinkAddr, "hello world");
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, setAddr, searchableLinkAddr);
+  ScAddr const & notSearchableLinkAddr = m_ctx->CreateLink();
+  m_ctx->SetLinkContent(notSearchableLinkAddr, "hello wide world", false);
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, setAddr, notSearchableLinkAddr);
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, setAddr, m_ctx->CreateNode(ScType::NodeConst));
+
+  // prefix consists of several terms, and one of sc-links isn't in fs-memory dictionary
+  ScTemplate templ;
+  templ.Triple(setAddr, ScType::EdgeAccessVarPosPerm, ScType::LinkVar >> "_link");
+  templ.LinkContent("_link", ScTemplateLinkContentPredicate::Prefix("hello w"));
+
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->HelperSearchTemplate(templ, result));
+  EXPECT_EQ(result.Size(), 2u);
+
+  // search started from variable sc-links gives the same results
+  ScTemplate linkTempl;
+  linkTempl.Triple(ScType::NodeVar >> "_set", ScType::EdgeAccessVarPosPerm, ScType::LinkVar >> "_link");
+  linkTempl.LinkContent("_link", ScTemplateLinkContentPredicate::Prefix("hello w"));
+
+  EXPECT_TRUE(m_ctx->HelperSearchTemplate(linkTempl, result));
+  EXPECT_EQ(result.Size(), 2u);
+}
+
+TEST_F(ScTemplateSearchApiTest, SearchWithLinkContentPredicateForFixedItem)
+{
+  ScAddr const & setAddr = m_ctx->CreateNode(ScType::NodeConstClass);
+  ScAddr const & linkAddr = m_ctx->CreateLink();
+  m_ctx->SetLinkContent(linkAddr, "apple");
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, setAddr, linkAddr);
+
+  ScTemplate satisfiedTempl;
+  satisfiedTempl.Triple(setAddr, ScType::EdgeAccessVarPosPerm, linkAddr >> "_link");
+  satisfiedTempl.LinkContent("_link", ScTemplateLinkContentPredicate::Prefix("ap"));
+
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->HelperSearchTemplate(satisfiedTempl, result));
+  EXPECT_EQ(result.Size(), 1u);
+
+  ScTemplate unsatisfiedTempl;
+  unsatisfiedTempl.Triple(setAddr, ScType::EdgeAccessVarPosPerm, linkAddr >> "_link");
+  unsatisfiedTempl.LinkContent("_link", ScTemplateLinkContentPredicate::Equal("banana"));
+
+  EXPECT_FALSE(m_ctx->HelperSearchTemplate(unsatisfiedTempl, result));
+  EXPECT_EQ(result.Size(), 0u);
+}
+
+TEST_F(ScTemplateSearchApiTest, LinkContentPredicateForUnknownAlias)
+{
+  ScTemplate templ;
+  templ.Triple(ScType::NodeVar >> "_node", ScType::EdgeAccessVarPosPerm, ScType::LinkVar >> "_link");
+
+  EXPECT_THROW(
+      templ.LinkContent("_other_link", ScTemplateLinkContentPredicate::Equal("content")),
+      utils::ExceptionInvalidParams);
+  EXPECT_NO_THROW(templ.LinkContent("_link", ScTemplateLinkContentPredicate::Equal("content")));
+}
+
+TEST_F(ScTemplateSearchApiTest, SearchTemplateWithBoundParams)
+{
+  ScAddr const & setAddr = m_ctx->CreateNode(ScType::NodeConstClass);
+  ScAddr const & itemAddr = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const & otherItemAddr = m_ctx->CreateNode(ScType::NodeConst);
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, setAddr, itemAddr);
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, setAddr, otherItemAddr);
+
+  ScTemplate templ;
+  templ.Triple(setAddr, ScType::EdgeAccessVarPosPerm >> "_edge", ScType::NodeVar >> "_item");
+  templ.Triple("_item", ScType::EdgeAccessVarPosPerm, ScType::NodeVar);
+
+  ScTemplateParams params;
+  params.Add("_item", itemAddr);
+
+  ScTemplate boundTempl;
+  boundTempl.Bind(templ, params);
+  EXPECT_EQ(boundTempl.Size(), templ.Size());
+  EXPECT_THROW(boundTempl.Bind(templ, params), utils::ExceptionInvalidParams);
+
+  ScTemplateSearchResult result;
+  EXPECT_FALSE(m_ctx->HelperSearchTemplate(boundTempl, result));
+
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, itemAddr, m_ctx->CreateNode(ScType::NodeConst));
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, otherItemAddr, m_ctx->CreateNode(ScType::NodeConst));
+
+  EXPECT_TRUE(m_ctx->HelperSearchTemplate(templ, result));
+  EXPECT_EQ(result.Size(), 2u);
+
+  EXPECT_TRUE(m_ctx->HelperSearchTemplate(boundTempl, result));
+  EXPECT_EQ(result.Size(), 1u);
+  EXPECT_EQ(result[0]["_item"], itemAddr);
+  EXPECT_TRUE(result[0]["_edge"].IsValid());
+}
@@ -47,7 +47,11 @@ bool Builder::Run(BuilderParams const & params, sc_memory_params const & memoryP
 bool Builder::BuildSources(ScRepoPathCollector::Sources const & buildSources, ScAddr const & outputStructure)
 {
   ScMemoryContextEventsBlockingGuard guard{*m_ctx};
-  m_translators = {{"scs", std::make_shared<SCsTranslator>(*m_ctx)}, {"gwf", std::make_shared<GWFTranslator>(*m_ctx)}};
+  // identifiers resolved in one source are reused by all next ones without searching them in sc-memory
+  auto const symbolTable = std::make_shared<SCsSymbolTable>();
+  m_translators = {
+      {"scs", std::make_shared<SCsTranslator>(*m_ctx, symbolTable)},
+      {"gwf", std::make_shared<GWFTranslator>(*m_ctx, symbolTable)}};
 
   // process founded files
   bool status = true;
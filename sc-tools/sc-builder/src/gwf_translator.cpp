@@ -16,9 +16,9 @@
 #define GWF_TRANSLATOR_INPUT_FILE_PARAM "--input="
 #define GWF_TRANSLATOR_ERRORS_LOG_PARAM "--errors_file="
 
-GWFTranslator::GWFTranslator(ScMemoryContext & context)
+GWFTranslator::GWFTranslator(ScMemoryContext & context, SCsSymbolTablePtr symbolTable)
   : Translator(context)
-  , m_scsTranslator(context)
+  , m_scsTranslator(context, std::move(symbolTable))
 {
 }
 
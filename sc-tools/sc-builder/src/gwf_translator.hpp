@@ -13,7 +13,7 @@
 class GWFTranslator : public Translator
 {
 public:
-  explicit GWFTranslator(class ScMemoryContext & context);
+  explicit GWFTranslator(class ScMemoryContext & context, SCsSymbolTablePtr symbolTable = nullptr);
   ~GWFTranslator() override = default;
 
   bool TranslateImpl(Params const & params) override;
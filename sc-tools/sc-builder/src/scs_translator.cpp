@@ -60,8 +60,9 @@ private:
 
 } // namespace impl
 
-SCsTranslator::SCsTranslator(ScMemoryContext & context)
+SCsTranslator::SCsTranslator(ScMemoryContext & context, SCsSymbolTablePtr symbolTable)
   : Translator(context)
+  , m_symbolTable(std::move(symbolTable))
 {
 }
 
@@ -70,7 +71,7 @@ bool SCsTranslator::TranslateImpl(Params const & params)
   std::string data;
   GetFileContent(params.m_fileName, data);
 
-  SCsHelper scs(m_ctx, std::make_shared<impl::FileProvider>(params.m_fileName));
+  SCsHelper scs(m_ctx, std::make_shared<impl::FileProvider>(params.m_fileName), m_symbolTable);
 
   if (!scs.GenerateBySCsText(data, params.m_outputStructure))
     SC_THROW_EXCEPTION(utils::ExceptionParseError, scs.GetLastError());
@@ -8,11 +8,20 @@
 
 #include "translator.hpp"
 
+#include "sc-memory/sc_scs_helper.hpp"
+
 class SCsTranslator : public Translator
 {
 public:
-  explicit SCsTranslator(class ScMemoryContext & context);
+  /*!
+   * @param symbolTable Table of identified sc-elements shared by translators of one build, so each identifier is
+   * searched in sc-memory only once per build instead of once per file. It may be null.
+   */
+  explicit SCsTranslator(class ScMemoryContext & context, SCsSymbolTablePtr symbolTable = nullptr);
   ~SCsTranslator() override = default;
 
   bool TranslateImpl(Params const & params) override;
+
+private:
+  SCsSymbolTablePtr m_symbolTable;
 };
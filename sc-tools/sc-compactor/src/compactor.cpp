@@ -0,0 +1,167 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "compactor.hpp"
+
+#include "sc-memory/sc_timer.hpp"
+#include "sc-memory/utils/sc_console.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+extern "C"
+{
+#include "sc-core/sc-store/sc_storage.h"
+#include "sc-core/sc-store/sc_storage_compaction.h"
+}
+
+namespace
+{
+void WriteMappingLine(void * data, sc_addr oldAddr, sc_addr newAddr)
+{
+  auto * stream = static_cast<std::ofstream *>(data);
+  *stream << SC_ADDR_LOCAL_TO_INT(oldAddr) << " " << SC_ADDR_LOCAL_TO_INT(newAddr) << "\n";
+}
+
+size_t CalculateDirectorySize(std::string const & path)
+{
+  std::error_code error;
+  size_t size = 0;
+  for (auto const & entry : std::filesystem::recursive_directory_iterator(path, error))
+  {
+    if (entry.is_regular_file(error))
+      size += entry.file_size(error);
+  }
+  return size;
+}
+
+void PrintDumpStat(std::string const & name, CompactorDumpStat const & stat)
+{
+  ScConsole::PrintLine() << ScConsole::Color::LightBlue << name << ":";
+  ScConsole::PrintLine() << ScConsole::Color::Grey << "\tSize: " << stat.m_size << " bytes";
+  ScConsole::PrintLine() << ScConsole::Color::Grey << "\tLoad time: " << stat.m_loadTime << " seconds";
+  ScConsole::PrintLine() << ScConsole::Color::Grey << "\tIteration throughput: " << stat.m_iterationThroughput
+                         << " sc-elements per second";
+}
+
+}  // namespace
+
+bool Compactor::Run(CompactorParams const & params, sc_memory_params const & memoryParams)
+{
+  m_params = params;
+
+  if (m_params.m_inputPath.empty() || m_params.m_outputPath.empty())
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Input and output repo paths must be specified");
+
+  std::error_code error;
+  if (std::filesystem::equivalent(m_params.m_inputPath, m_params.m_outputPath, error))
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Compacted repo must be saved to another repo path");
+
+  ScConsole::PrintLine() << ScConsole::Color::Blue << "Measure repo before compaction... ";
+  CompactorDumpStat const & inputStat = MeasureDump(m_params.m_inputPath, memoryParams);
+
+  ScConsole::PrintLine() << ScConsole::Color::Blue << "Compact repo... ";
+  if (!Compact(memoryParams))
+  {
+    ScConsole::PrintLine() << ScConsole::Color::Red << "Repo isn't compacted";
+    return false;
+  }
+
+  ScConsole::PrintLine() << ScConsole::Color::Blue << "Measure repo after compaction... ";
+  CompactorDumpStat const & outputStat = MeasureDump(m_params.m_outputPath, memoryParams);
+
+  PrintDumpStat("Before compaction", inputStat);
+  PrintDumpStat("After compaction", outputStat);
+
+  return true;
+}
+
+bool Compactor::Compact(sc_memory_params const & memoryParams)
+{
+  sc_memory_params inputParams = memoryParams;
+  inputParams.repo_path = m_params.m_inputPath.c_str();
+  inputParams.clear = SC_FALSE;
+
+  sc_memory_params outputParams = memoryParams;
+  outputParams.repo_path = m_params.m_outputPath.c_str();
+  outputParams.clear = SC_TRUE;
+
+  std::ofstream mappingStream;
+  if (!m_params.m_mappingPath.empty())
+  {
+    mappingStream.open(m_params.m_mappingPath);
+    if (!mappingStream.is_open())
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidParams, "Unable to open mapping file `" << m_params.m_mappingPath << "`");
+  }
+
+  if (sc_storage_initialize(&inputParams) != SC_RESULT_OK)
+  {
+    sc_storage_shutdown(SC_FALSE);
+    return false;
+  }
+
+  sc_storage_compaction_stat stat;
+  sc_result const result = sc_storage_compact(
+      &outputParams,
+      mappingStream.is_open() ? &mappingStream : nullptr,
+      mappingStream.is_open() ? WriteMappingLine : nullptr,
+      &stat);
+
+  // compacted sc-storage is saved to output repo path
+  bool const status = sc_storage_shutdown(result == SC_RESULT_OK) == SC_RESULT_OK && result == SC_RESULT_OK;
+  if (!status)
+    return false;
+
+  ScConsole::PrintLine() << ScConsole::Color::Grey << "\tLive sc-elements: " << stat.live_elements_count;
+  ScConsole::PrintLine() << ScConsole::Color::Grey << "\tRemoved freed sc-element slots: "
+                         << stat.freed_elements_count;
+  ScConsole::PrintLine() << ScConsole::Color::Grey << "\tMoved sc-link contents: " << stat.links_count;
+  ScConsole::PrintLine() << ScConsole::Color::Grey << "\tSegments: " << stat.segments_count << " -> "
+                         << stat.compacted_segments_count;
+
+  return true;
+}
+
+CompactorDumpStat Compactor::MeasureDump(std::string const & repoPath, sc_memory_params const & memoryParams)
+{
+  CompactorDumpStat stat;
+  stat.m_size = CalculateDirectorySize(repoPath);
+
+  sc_memory_params params = memoryParams;
+  params.repo_path = repoPath.c_str();
+  params.clear = SC_FALSE;
+
+  ScTimer loadTimer;
+  if (!ScMemory::Initialize(params))
+    SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Error while sc-memory initialize");
+  stat.m_loadTime = loadTimer.Seconds();
+
+  {
+    ScMemoryContext ctx;
+    ScAddrVector const & elements = ctx.FindElementsByType(ScType::Unknown);
+
+    // each sc-element is visited with its outgoing and incoming sc-connectors, as search agents usually do
+    size_t traversedCount = 0;
+    ScTimer iterationTimer;
+    for (ScAddr const & elementAddr : elements)
+    {
+      ScIterator3Ptr it = ctx.Iterator3(elementAddr, ScType::Unknown, ScType::Unknown);
+      while (it->Next())
+        ++traversedCount;
+
+      it = ctx.Iterator3(ScType::Unknown, ScType::Unknown, elementAddr);
+      while (it->Next())
+        ++traversedCount;
+    }
+    double const iterationTime = iterationTimer.Seconds();
+    stat.m_iterationThroughput = iterationTime > 0 ? traversedCount / iterationTime : 0;
+  }
+
+  ScMemory::Shutdown(SC_FALSE);
+
+  return stat;
+}
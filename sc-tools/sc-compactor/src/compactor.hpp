@@ -0,0 +1,44 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc-memory/sc_memory.hpp"
+
+#include <string>
+
+struct CompactorParams
+{
+  //! Path to repository to compact
+  std::string m_inputPath;
+  //! Path to compacted repository
+  std::string m_outputPath;
+  //! Path to file to write old and new sc-addresses hashes of sc-elements, may be empty
+  std::string m_mappingPath;
+};
+
+struct CompactorDumpStat
+{
+  //! Size of repository files in bytes
+  size_t m_size = 0;
+  //! Time of repository loading in seconds
+  double m_loadTime = 0;
+  //! Amount of sc-elements and their outgoing and incoming sc-connectors traversed by iterators per second
+  double m_iterationThroughput = 0;
+};
+
+class Compactor
+{
+public:
+  bool Run(CompactorParams const & params, sc_memory_params const & memoryParams);
+
+protected:
+  CompactorParams m_params;
+
+  bool Compact(sc_memory_params const & memoryParams);
+
+  static CompactorDumpStat MeasureDump(std::string const & repoPath, sc_memory_params const & memoryParams);
+};
@@ -0,0 +1,15 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_compactor_setup.hpp"
+
+// LCOV_EXCL_START
+sc_int main(sc_int argc, sc_char * argv[])
+{
+  return BuildAndRunCompactor(argc, argv);
+}
+
+// LCOV_EXCL_STOP
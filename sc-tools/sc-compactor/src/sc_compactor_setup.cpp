@@ -0,0 +1,71 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_compactor_setup.hpp"
+
+#include <iostream>
+
+#include "compactor.hpp"
+
+void PrintStartMessage()
+{
+  std::cout << "SC-COMPACTOR USAGE\n\n"
+            << "--config|-c -- Path to configuration file\n"
+            << "--input_path|-i -- Path to repository to compact\n"
+            << "--output_path|-o -- Path to output directory for compacted repository\n"
+            << "--mapping|-m -- Path to file to write old and new sc-addresses hashes of sc-elements\n"
+            << "--help -- Display this message\n\n";
+}
+
+sc_int BuildAndRunCompactor(sc_int argc, sc_char * argv[])
+try
+{
+  ScOptions options{argc, argv};
+
+  if (options.Has({"help"}))
+  {
+    PrintStartMessage();
+    return EXIT_SUCCESS;
+  }
+
+  CompactorParams params;
+  if (options.Has({"input_path", "i"}))
+    params.m_inputPath = options[{"input_path", "i"}].second;
+
+  if (options.Has({"output_path", "o"}))
+    params.m_outputPath = options[{"output_path", "o"}].second;
+
+  if (options.Has({"mapping", "m"}))
+    params.m_mappingPath = options[{"mapping", "m"}].second;
+
+  std::string configPath;
+  if (options.Has({"config", "c"}))
+    configPath = options[{"config", "c"}].second;
+
+  ScParams memoryParams{options, {}};
+  if (!params.m_inputPath.empty())
+    memoryParams.Insert({"repo_path", params.m_inputPath});
+
+  ScConfig config{configPath, {"repo_path", "log_file"}, {"extensions_path"}};
+  ScMemoryConfig memoryConfig{config, memoryParams};
+
+  sc_memory_params formedMemoryParams = memoryConfig.GetParams();
+  if (params.m_inputPath.empty() && formedMemoryParams.repo_path != nullptr)
+    params.m_inputPath = formedMemoryParams.repo_path;
+
+  formedMemoryParams.dump_memory = SC_FALSE;
+  formedMemoryParams.dump_memory_statistics = SC_FALSE;
+  formedMemoryParams.user_mode = SC_FALSE;
+
+  Compactor compactor;
+  return compactor.Run(params, formedMemoryParams) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+catch (utils::ScException const & ex)
+{
+  SC_LOG_ERROR(ex.Message());
+  return EXIT_FAILURE;
+}
@@ -0,0 +1,13 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc_memory_config.hpp"
+
+void PrintStartMessage();
+
+sc_int BuildAndRunCompactor(sc_int argc, sc_char * argv[]);
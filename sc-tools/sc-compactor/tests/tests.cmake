@@ -0,0 +1,13 @@
+configure_file(
+    "${CMAKE_CURRENT_LIST_DIR}/test_defines.hpp.in"
+    "${CMAKE_CURRENT_LIST_DIR}/test_defines.hpp"
+)
+
+make_tests_from_folder(${CMAKE_CURRENT_LIST_DIR}/units
+    NAME sc-compactor-tests
+    DEPENDS sc-compactor-lib
+)
+
+if(${SC_CLANG_FORMAT_CODE})
+    target_clangformat_setup(sc-compactor-tests)
+endif()
@@ -0,0 +1,183 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <gtest/gtest.h>
+
+#include "../test_defines.hpp"
+
+#include "../../src/compactor.hpp"
+#include "../../src/sc_compactor_setup.hpp"
+
+#include "sc-memory/sc_memory.hpp"
+
+#include <fstream>
+
+namespace
+{
+void InitializeMemory(std::string const & repoPath, sc_bool clear)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+
+  params.dump_memory = SC_FALSE;
+  params.dump_memory_statistics = SC_FALSE;
+
+  params.clear = clear;
+  params.repo_path = repoPath.c_str();
+
+  ScMemory::LogMute();
+  ScMemory::Initialize(params);
+  ScMemory::LogUnmute();
+}
+
+void ShutdownMemory(sc_bool saveState)
+{
+  ScMemory::LogMute();
+  ScMemory::Shutdown(saveState);
+  ScMemory::LogUnmute();
+}
+
+void CreateFragmentedRepo()
+{
+  InitializeMemory(SC_COMPACTOR_INPUT_REPO_PATH, SC_TRUE);
+  {
+    ScMemoryContext ctx;
+    ScAddr const & setAddr = ctx.CreateNode(ScType::NodeConstClass);
+    for (size_t i = 0; i < 100; ++i)
+    {
+      ScAddr const & nodeAddr = ctx.CreateNode(ScType::NodeConst);
+      ScAddr const & linkAddr = ctx.CreateLink();
+      ctx.SetLinkContent(linkAddr, "compacted content " + std::to_string(i));
+      ctx.CreateEdge(ScType::EdgeAccessConstPosPerm, setAddr, nodeAddr);
+      ctx.CreateEdge(ScType::EdgeDCommonConst, nodeAddr, linkAddr);
+
+      if (i % 2 == 0)
+        ctx.EraseElement(nodeAddr);
+    }
+
+    ScAddr const & linkAddr = ctx.CreateLink();
+    ctx.SetLinkContent(linkAddr, "shared content");
+    ctx.CreateEdge(ScType::EdgeAccessConstPosPerm, setAddr, linkAddr);
+    ctx.SetLinkContent(ctx.CreateLink(), "shared content");
+  }
+  ShutdownMemory(SC_TRUE);
+}
+
+size_t CalculateElementsCount(std::string const & repoPath, ScType const & type)
+{
+  InitializeMemory(repoPath, SC_FALSE);
+  size_t count;
+  {
+    ScMemoryContext ctx;
+    count = ctx.GetElementsCountByType(type);
+  }
+  ShutdownMemory(SC_FALSE);
+  return count;
+}
+
+}  // namespace
+
+TEST(ScCompactor, RunMain)
+{
+  CreateFragmentedRepo();
+
+  sc_uint32 const argsNumber = 9;
+  sc_char const * args[argsNumber] = {
+      "sc-compactor",
+      "-c",
+      SC_COMPACTOR_INI,
+      "-i",
+      SC_COMPACTOR_INPUT_REPO_PATH,
+      "-o",
+      SC_COMPACTOR_OUTPUT_REPO_PATH,
+      "-m",
+      SC_COMPACTOR_MAPPING_PATH};
+  EXPECT_EQ(BuildAndRunCompactor(argsNumber, (sc_char **)args), EXIT_SUCCESS);
+
+  std::ifstream mappingStream{SC_COMPACTOR_MAPPING_PATH};
+  size_t mappedCount = 0;
+  sc_uint32 oldHash, newHash;
+  while (mappingStream >> oldHash >> newHash)
+    ++mappedCount;
+
+  EXPECT_EQ(CalculateElementsCount(SC_COMPACTOR_OUTPUT_REPO_PATH, ScType::Unknown), mappedCount);
+}
+
+TEST(ScCompactor, InvalidRunMain)
+{
+  sc_uint32 const argsNumber = 1;
+  sc_char const * args[argsNumber] = {"sc-compactor"};
+  EXPECT_EQ(BuildAndRunCompactor(argsNumber, (sc_char **)args), EXIT_FAILURE);
+}
+
+TEST(ScCompactor, RunMainHelp)
+{
+  sc_uint32 const argsNumber = 2;
+  sc_char const * args[argsNumber] = {"sc-compactor", "--help"};
+  EXPECT_EQ(BuildAndRunCompactor(argsNumber, (sc_char **)args), EXIT_SUCCESS);
+}
+
+TEST(ScCompactor, CompactToSameRepo)
+{
+  CreateFragmentedRepo();
+
+  sc_memory_params memoryParams;
+  sc_memory_params_clear(&memoryParams);
+
+  CompactorParams params;
+  params.m_inputPath = SC_COMPACTOR_INPUT_REPO_PATH;
+  params.m_outputPath = SC_COMPACTOR_INPUT_REPO_PATH;
+
+  Compactor compactor;
+  EXPECT_THROW(compactor.Run(params, memoryParams), utils::ExceptionInvalidParams);
+}
+
+TEST(ScCompactor, CompactPreservesKnowledgeBase)
+{
+  CreateFragmentedRepo();
+
+  size_t const nodesCount = CalculateElementsCount(SC_COMPACTOR_INPUT_REPO_PATH, ScType::Node);
+  size_t const linksCount = CalculateElementsCount(SC_COMPACTOR_INPUT_REPO_PATH, ScType::Link);
+  size_t const connectorsCount = CalculateElementsCount(SC_COMPACTOR_INPUT_REPO_PATH, ScType::EdgeAccess);
+
+  sc_memory_params memoryParams;
+  sc_memory_params_clear(&memoryParams);
+  memoryParams.dump_memory = SC_FALSE;
+  memoryParams.dump_memory_statistics = SC_FALSE;
+
+  CompactorParams params;
+  params.m_inputPath = SC_COMPACTOR_INPUT_REPO_PATH;
+  params.m_outputPath = SC_COMPACTOR_OUTPUT_REPO_PATH;
+
+  Compactor compactor;
+  EXPECT_TRUE(compactor.Run(params, memoryParams));
+
+  EXPECT_EQ(CalculateElementsCount(SC_COMPACTOR_OUTPUT_REPO_PATH, ScType::Node), nodesCount);
+  EXPECT_EQ(CalculateElementsCount(SC_COMPACTOR_OUTPUT_REPO_PATH, ScType::Link), linksCount);
+  EXPECT_EQ(CalculateElementsCount(SC_COMPACTOR_OUTPUT_REPO_PATH, ScType::EdgeAccess), connectorsCount);
+
+  InitializeMemory(SC_COMPACTOR_OUTPUT_REPO_PATH, SC_FALSE);
+  {
+    ScMemoryContext ctx;
+
+    ScAddrVector const & linkAddrs = ctx.FindLinksByContent("compacted content 1");
+    EXPECT_EQ(linkAddrs.size(), 1u);
+    ScIterator3Ptr it = ctx.Iterator3(ScType::NodeConst, ScType::EdgeDCommonConst, linkAddrs[0]);
+    EXPECT_TRUE(it->Next());
+
+    ScAddr const & nodeAddr = it->Get(0);
+    it = ctx.Iterator3(ScType::NodeConstClass, ScType::EdgeAccessConstPosPerm, nodeAddr);
+    EXPECT_TRUE(it->Next());
+
+    EXPECT_EQ(ctx.FindLinksByContent("compacted content 0").size(), 1u);
+    EXPECT_EQ(ctx.FindLinksByContent("shared content").size(), 2u);
+
+    std::string content;
+    EXPECT_TRUE(ctx.GetLinkContent(linkAddrs[0], content));
+    EXPECT_EQ(content, "compacted content 1");
+  }
+  ShutdownMemory(SC_FALSE);
+}
@@ -93,6 +93,11 @@ sc_memory_params ScMemoryConfig::GetParams()
       GetBoolByKey("limit_max_threads_by_max_physical_cores", DEFAULT_LIMIT_MAX_THREADS_BY_MAX_PHYSICAL_CORES);
   m_memoryParams.max_events_and_agents_threads =
       GetIntByKey("max_events_and_agents_threads", DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS);
+  m_memoryParams.max_events_queue_size = GetIntByKey("max_events_queue_size", DEFAULT_MAX_EVENTS_QUEUE_SIZE);
+  m_memoryParams.events_queue_overflow_policy =
+      GetStringByKey("events_queue_overflow_policy", DEFAULT_EVENTS_QUEUE_OVERFLOW_POLICY);
+  m_memoryParams.monitors_contention_sampling_period =
+      GetIntByKey("monitors_contention_sampling_period", DEFAULT_MONITORS_CONTENTION_SAMPLING_PERIOD);
 
   m_memoryParams.dump_memory = GetBoolByKey("dump_memory", DEFAULT_DUMP_MEMORY);
   if (HasKey("save_period"))
@@ -135,6 +140,20 @@ sc_memory_params ScMemoryConfig::GetParams()
       GetIntByKey("max_searchable_string_size", DEFAULT_MAX_SEARCHABLE_STRING_SIZE);
   m_memoryParams.term_separators = GetStringByKey("term_separators", DEFAULT_TERM_SEPARATORS);
   m_memoryParams.search_by_substring = GetBoolByKey("search_by_substring", DEFAULT_SEARCH_BY_SUBSTRING);
+  m_memoryParams.sorted_terms_dictionary = GetBoolByKey("sorted_terms_dictionary", DEFAULT_SORTED_TERMS_DICTIONARY);
+  m_memoryParams.lazy_dictionaries_loading =
+      GetBoolByKey("lazy_dictionaries_loading", DEFAULT_LAZY_DICTIONARIES_LOADING);
+  m_memoryParams.dictionaries_unload_period =
+      GetIntByKey("dictionaries_unload_period", DEFAULT_DICTIONARIES_UNLOAD_PERIOD);
+
+  m_memoryParams.slow_operations_log_file =
+      GetStringByKey("slow_operations_log_file", DEFAULT_SLOW_OPERATIONS_LOG_FILE);
+  m_memoryParams.slow_operations_log_size = GetIntByKey("slow_operations_log_size", DEFAULT_SLOW_OPERATIONS_LOG_SIZE);
+  m_memoryParams.slow_template_search_threshold =
+      GetIntByKey("slow_template_search_threshold", DEFAULT_SLOW_TEMPLATE_SEARCH_THRESHOLD);
+  m_memoryParams.slow_agent_threshold = GetIntByKey("slow_agent_threshold", DEFAULT_SLOW_AGENT_THRESHOLD);
+  m_memoryParams.slow_server_request_threshold =
+      GetIntByKey("slow_server_request_threshold", DEFAULT_SLOW_SERVER_REQUEST_THRESHOLD);
 
   return m_memoryParams;
 }
@@ -0,0 +1,31 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc_memory_json_action.hpp"
+
+class ScMemoryAllocationsStatJsonAction : public ScMemoryJsonAction
+{
+public:
+  ScMemoryJsonPayload Complete(
+      ScMemoryContext * context,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload) override
+  {
+    ScMemoryJsonPayload responsePayload = ScMemoryJsonPayload::array({});
+
+    for (auto const & allocations : context->CalculateAllocationsStat())
+    {
+      responsePayload.push_back(
+          {{"subsystem", allocations.m_subsystem},
+           {"bytes", allocations.m_liveBytes},
+           {"objects", allocations.m_liveObjects}});
+    }
+
+    return responsePayload;
+  }
+};
@@ -0,0 +1,130 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <map>
+
+#include "sc_memory_json_action.hpp"
+
+#include "../../sc_server_defines.hpp"
+
+/*!
+ * Action that completes ordered list of sub-requests in one dispatch with sc-memory context of session and answers
+ * with one response. Sub-request payloads may contain objects `{"$ref": "<json-pointer>"}`, they are replaced by
+ * values from responses of earlier sub-requests, e.g. `{"$ref": "/0/payload/1"}` is the second value in payload of
+ * the first sub-request response.
+ *
+ * Request payload:
+ * @code
+ * {
+ *   "abort_on_error": true,
+ *   "requests": [
+ *     {"type": "keynodes", "payload": [{"command": "find", "idtf": "concept_set"}]},
+ *     {"type": "check_elements", "payload": [{"$ref": "/0/payload/0"}]}
+ *   ]
+ * }
+ * @endcode
+ *
+ * Response payload is a list of sub-request responses `{"status": ..., "errors": ..., "payload": ...}` in order of
+ * sub-requests. If `abort_on_error` is true, sub-requests after the first failed one aren't completed and aren't
+ * listed in response.
+ */
+class ScMemoryBatchJsonAction : public ScMemoryJsonAction
+{
+public:
+  explicit ScMemoryBatchJsonAction(std::map<std::string, ScMemoryJsonAction *> const & actions)
+    : m_actions(actions)
+  {
+  }
+
+  ScMemoryJsonPayload Complete(
+      ScMemoryContext * context,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload) override
+  {
+    ScMemoryJsonPayload responsePayload = ScMemoryJsonPayload::array({});
+    if (!requestPayload.contains("requests") || !requestPayload["requests"].is_array())
+    {
+      errorsPayload = "Batch request must contain list of sub-requests";
+      return responsePayload;
+    }
+
+    sc_bool const abortOnError = requestPayload.value("abort_on_error", false);
+
+    ScMemoryJsonPayload & subRequests = requestPayload["requests"];
+    for (size_t i = 0; i < subRequests.size(); ++i)
+    {
+      ScMemoryJsonPayload subResponse = CompleteSubRequest(context, subRequests[i], responsePayload);
+      sc_bool const status = subResponse["status"].get<sc_bool>();
+      responsePayload.push_back(std::move(subResponse));
+
+      if (status == SC_FALSE && abortOnError)
+      {
+        errorsPayload = "Batch request is aborted on sub-request " + std::to_string(i);
+        break;
+      }
+    }
+
+    return responsePayload;
+  }
+
+private:
+  std::map<std::string, ScMemoryJsonAction *> const & m_actions;
+
+  ScMemoryJsonPayload CompleteSubRequest(
+      ScMemoryContext * context,
+      ScMemoryJsonPayload & subRequest,
+      ScMemoryJsonPayload const & previousResponses)
+  {
+    ScMemoryJsonPayload responsePayload;
+    ScMemoryJsonPayload errorsPayload = ScMemoryJsonPayload::array({});
+
+    try
+    {
+      std::string const & type = subRequest.value("type", "");
+      auto const & it = m_actions.find(type);
+      if (it == m_actions.cend() || it->second == this)
+        errorsPayload = "Unsupported sub-request type: " + type;
+      else
+      {
+        ScMemoryJsonPayload & payload = subRequest["payload"];
+        ResolveReferences(payload, previousResponses);
+        responsePayload = it->second->Complete(context, std::move(payload), errorsPayload);
+      }
+    }
+    catch (ScServerException const & e)
+    {
+      errorsPayload = e.m_msg;
+    }
+    catch (utils::ScException const & e)
+    {
+      errorsPayload = e.Description();
+    }
+    catch (std::exception const & e)
+    {
+      errorsPayload = e.what();
+    }
+
+    return {{"status", errorsPayload.empty()}, {"errors", errorsPayload}, {"payload", responsePayload}};
+  }
+
+  static void ResolveReferences(ScMemoryJsonPayload & payload, ScMemoryJsonPayload const & previousResponses)
+  {
+    if (payload.is_object() && payload.size() == 1 && payload.contains("$ref") && payload["$ref"].is_string())
+    {
+      // throws if reference points to sub-request that isn't completed yet or to not existing value
+      payload = previousResponses.at(ScMemoryJsonPayload::json_pointer(payload["$ref"].get<std::string>()));
+      return;
+    }
+
+    if (payload.is_structured())
+    {
+      for (auto & item : payload)
+        ResolveReferences(item, previousResponses);
+    }
+  }
+};
@@ -16,18 +16,15 @@ public:
       ScMemoryJsonPayload requestPayload,
       ScMemoryJsonPayload & errorsPayload) override
   {
-    ScMemoryJsonPayload responsePayload;
-
+    ScAddrVector addrs;
+    addrs.reserve(requestPayload.size());
     for (auto & hash : requestPayload)
-    {
-      ScAddr const addr{hash.get<size_t>()};
-
-      size_t type = 0;
-      if (addr.IsValid())
-        type = context->GetElementType(addr);
+      addrs.emplace_back(hash.get<size_t>());
 
-      responsePayload.push_back(type);
-    }
+    // types of all sc-elements are read in one call, not existing sc-elements have empty type
+    ScMemoryJsonPayload responsePayload = ScMemoryJsonPayload::array({});
+    for (ScMemoryContext::ScElementInfo const & info : context->GetElementsInfo(addrs))
+      responsePayload.push_back(info.m_isValid ? size_t(info.m_type) : 0);
 
     return responsePayload;
   }
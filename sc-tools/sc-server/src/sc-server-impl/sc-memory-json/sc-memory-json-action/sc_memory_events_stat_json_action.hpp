@@ -0,0 +1,101 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc_memory_json_action.hpp"
+
+class ScMemoryEventsStatJsonAction : public ScMemoryJsonAction
+{
+public:
+  ScMemoryJsonPayload Complete(
+      ScMemoryContext * context,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload) override
+  {
+    ScMemoryContext::ScEventsQueueStat const & queueStat = context->CalculateEventsQueueStat();
+    ScMemoryContext::ScEventsWorkersStat const & workersStat = context->CalculateEventsWorkersStat();
+
+    ScMemoryJsonPayload latenciesPayload = ScMemoryJsonPayload::array({});
+    for (auto const & stat : context->CalculateEventsLatencyStat())
+    {
+      latenciesPayload.push_back(
+          {{"event_type", GetEventTypeName(stat.m_eventType)},
+           {"priority", GetPriorityName(stat.m_priority)},
+           {"pending", ToPayload(stat.m_pending)},
+           {"queued", ToPayload(stat.m_queued)},
+           {"processing", ToPayload(stat.m_processing)},
+           {"total", ToPayload(stat.m_total)}});
+    }
+
+    return {
+        {"queue",
+         {{"size", queueStat.m_size},
+          {"max_size", queueStat.m_maxSize},
+          {"processed_count", queueStat.m_processedCount},
+          {"blocked_count", queueStat.m_blockedCount},
+          {"spilled_count", queueStat.m_spilledCount},
+          {"dropped_count", queueStat.m_droppedCount},
+          {"average_wait_time", queueStat.m_averageWaitTime},
+          {"max_wait_time", queueStat.m_maxWaitTime}}},
+        {"workers",
+         {{"max_count", workersStat.m_maxWorkersCount},
+          {"busy_count", workersStat.m_busyWorkersCount},
+          {"max_busy_count", workersStat.m_maxBusyWorkersCount},
+          {"busy_time", workersStat.m_busyTime},
+          {"utilization", workersStat.m_utilization}}},
+        {"latencies", latenciesPayload}};
+  }
+
+private:
+  static ScMemoryJsonPayload ToPayload(ScMemoryContext::ScLatencyHistogram const & histogram)
+  {
+    return {
+        {"count", histogram.m_count},
+        {"average_time", histogram.m_averageTime},
+        {"max_time", histogram.m_maxTime},
+        {"median_time", histogram.m_medianTime},
+        {"percentile_99_time", histogram.m_percentile99Time},
+        {"buckets", histogram.m_buckets}};
+  }
+
+  // names should be synced with sc-event types of ScMemoryJsonEventsHandler
+  static std::string GetEventTypeName(ScEvent::Type type)
+  {
+    switch (type)
+    {
+    case ScEvent::Type::AddOutputEdge:
+      return "add_outgoing_edge";
+    case ScEvent::Type::AddInputEdge:
+      return "add_ingoing_edge";
+    case ScEvent::Type::RemoveOutputEdge:
+      return "remove_outgoing_edge";
+    case ScEvent::Type::RemoveInputEdge:
+      return "remove_ingoing_edge";
+    case ScEvent::Type::EraseElement:
+      return "delete_element";
+    case ScEvent::Type::ContentChanged:
+      return "content_change";
+    }
+
+    return "unknown";
+  }
+
+  static std::string GetPriorityName(ScEvent::Priority priority)
+  {
+    switch (priority)
+    {
+    case ScEvent::Priority::Interactive:
+      return "interactive";
+    case ScEvent::Priority::Normal:
+      return "normal";
+    case ScEvent::Priority::Background:
+      return "background";
+    }
+
+    return "unknown";
+  }
+};
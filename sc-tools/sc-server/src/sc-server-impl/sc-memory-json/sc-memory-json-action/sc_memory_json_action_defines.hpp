@@ -8,11 +8,18 @@
 
 #include "../sc_memory_json_payload.hpp"
 #include "sc_memory_connection_info_json_action.hpp"
+#include "sc_memory_allocations_stat_json_action.hpp"
+#include "sc_memory_batch_json_action.hpp"
 #include "sc_memory_check_elements_json_action.hpp"
 #include "sc_memory_create_elements_json_action.hpp"
 #include "sc_memory_create_elements_by_scs_json_action.hpp"
 #include "sc_memory_delete_elements_json_action.hpp"
+#include "sc_memory_events_stat_json_action.hpp"
 #include "sc_memory_handle_link_content_json_action.hpp"
 #include "sc_memory_handle_keynodes_json_action.hpp"
+#include "sc_memory_monitors_contention_json_action.hpp"
+#include "sc_memory_slow_operations_json_action.hpp"
 #include "sc_memory_template_generate_json_action.hpp"
+#include "sc_memory_template_prepare_json_action.hpp"
+#include "sc_memory_template_release_json_action.hpp"
 #include "sc_memory_template_search_json_action.hpp"
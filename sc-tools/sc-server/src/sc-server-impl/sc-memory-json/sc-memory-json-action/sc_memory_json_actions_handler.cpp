@@ -29,7 +29,14 @@ void ScMemoryJsonActionsHandler::InitializeActionClasses()
       {"delete_elements", new ScMemoryDeleteElementsJsonAction()},
       {"search_template", new ScMemoryTemplateSearchJsonAction()},
       {"generate_template", new ScMemoryTemplateGenerateJsonAction()},
+      {"prepare_template", new ScMemoryTemplatePrepareJsonAction()},
+      {"release_template", new ScMemoryTemplateReleaseJsonAction()},
       {"content", new ScMemoryHandleLinkContentJsonAction()},
+      {"allocations_stat", new ScMemoryAllocationsStatJsonAction()},
+      {"monitors_contention", new ScMemoryMonitorsContentionJsonAction()},
+      {"slow_operations", new ScMemorySlowOperationsJsonAction()},
+      {"events_stat", new ScMemoryEventsStatJsonAction()},
+      {"batch", new ScMemoryBatchJsonAction(m_actions)},
   };
 }
 
@@ -40,6 +47,8 @@ void ScMemoryJsonActionsHandler::ClearActionClasses()
     delete it.second;
     it.second = nullptr;
   }
+
+  ScMemoryJsonPreparedTemplates::ClearAll();
 }
 
 ScMemoryJsonPayload ScMemoryJsonActionsHandler::HandleRequestPayload(
@@ -0,0 +1,92 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_memory_json_prepared_templates.hpp"
+
+extern "C"
+{
+#include "sc-core/sc-store/sc-base/sc_allocator.h"
+}
+
+namespace
+{
+// names of sc-template items are short and are stored in their objects, so they aren't counted
+size_t GetTemplateBytes(ScTemplate const & scTemplate)
+{
+  return sizeof(ScTemplate) + scTemplate.Size() * (sizeof(ScTemplateTriple) + sizeof(ScTemplateTriple *));
+}
+
+void AccountTemplatesFree(std::map<size_t, std::shared_ptr<ScTemplate>> const & templates)
+{
+  for (auto const & it : templates)
+    sc_mem_account_free(SC_ALLOCATIONS_SERVER_SESSIONS, 0, GetTemplateBytes(*it.second));
+}
+}  // namespace
+
+std::map<ScMemoryContext const *, ScMemoryJsonPreparedTemplates::ScSessionTemplates>
+    ScMemoryJsonPreparedTemplates::m_sessionsTemplates;
+std::mutex ScMemoryJsonPreparedTemplates::m_mutex;
+
+size_t ScMemoryJsonPreparedTemplates::Add(
+    ScMemoryContext const * context,
+    std::shared_ptr<ScTemplate> const & scTemplate)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  ScSessionTemplates & sessionTemplates = m_sessionsTemplates[context];
+  if (sessionTemplates.m_templates.size() >= SC_SERVER_MAX_PREPARED_TEMPLATES)
+    return 0;
+
+  size_t const handle = ++sessionTemplates.m_lastHandle;
+  sessionTemplates.m_templates.insert({handle, scTemplate});
+  sc_mem_account_new(SC_ALLOCATIONS_SERVER_SESSIONS, 0, GetTemplateBytes(*scTemplate));
+  return handle;
+}
+
+std::shared_ptr<ScTemplate> ScMemoryJsonPreparedTemplates::Get(ScMemoryContext const * context, size_t handle)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto const sessionIt = m_sessionsTemplates.find(context);
+  if (sessionIt == m_sessionsTemplates.cend())
+    return nullptr;
+
+  auto const it = sessionIt->second.m_templates.find(handle);
+  return it == sessionIt->second.m_templates.cend() ? nullptr : it->second;
+}
+
+sc_bool ScMemoryJsonPreparedTemplates::Remove(ScMemoryContext const * context, size_t handle)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto const sessionIt = m_sessionsTemplates.find(context);
+  if (sessionIt == m_sessionsTemplates.cend())
+    return SC_FALSE;
+
+  auto const it = sessionIt->second.m_templates.find(handle);
+  if (it == sessionIt->second.m_templates.cend())
+    return SC_FALSE;
+
+  sc_mem_account_free(SC_ALLOCATIONS_SERVER_SESSIONS, 0, GetTemplateBytes(*it->second));
+  sessionIt->second.m_templates.erase(it);
+  return SC_TRUE;
+}
+
+void ScMemoryJsonPreparedTemplates::Clear(ScMemoryContext const * context)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto const sessionIt = m_sessionsTemplates.find(context);
+  if (sessionIt == m_sessionsTemplates.cend())
+    return;
+
+  AccountTemplatesFree(sessionIt->second.m_templates);
+  m_sessionsTemplates.erase(sessionIt);
+}
+
+void ScMemoryJsonPreparedTemplates::ClearAll()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (auto const & it : m_sessionsTemplates)
+    AccountTemplatesFree(it.second.m_templates);
+  m_sessionsTemplates.clear();
+}
@@ -0,0 +1,50 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "sc-memory/sc_memory.hpp"
+
+//! Maximum amount of prepared sc-templates that can be held by one session at the same time
+#define SC_SERVER_MAX_PREPARED_TEMPLATES 1024
+
+/*!
+ * Storage of sc-templates prepared by sessions. A sc-template is built once, when it is prepared, and it is got then
+ * by its handle on each search or generation request of the same session. Handles are unique within session, other
+ * sessions can't use them. All sc-templates of session are removed when session is closed.
+ */
+class ScMemoryJsonPreparedTemplates
+{
+public:
+  //! Stores sc-template for session and returns its handle. Returns 0 if session has too many prepared sc-templates
+  static size_t Add(ScMemoryContext const * context, std::shared_ptr<ScTemplate> const & scTemplate);
+
+  //! Returns nullptr if session has no sc-template with specified handle
+  static std::shared_ptr<ScTemplate> Get(ScMemoryContext const * context, size_t handle);
+
+  //! Returns SC_FALSE if session has no sc-template with specified handle
+  static sc_bool Remove(ScMemoryContext const * context, size_t handle);
+
+  //! Removes all sc-templates prepared by session
+  static void Clear(ScMemoryContext const * context);
+
+  //! Removes sc-templates of all sessions
+  static void ClearAll();
+
+private:
+  struct ScSessionTemplates
+  {
+    size_t m_lastHandle = 0;
+    std::map<size_t, std::shared_ptr<ScTemplate>> m_templates;
+  };
+
+  static std::map<ScMemoryContext const *, ScSessionTemplates> m_sessionsTemplates;
+  static std::mutex m_mutex;
+};
@@ -6,37 +6,46 @@
 
 #pragma once
 
+#include <memory>
+
 #include "sc_memory_json_action.hpp"
+#include "sc_memory_json_prepared_templates.hpp"
 
 class ScMemoryMakeTemplateJsonAction : public ScMemoryJsonAction
 {
 protected:
-  std::pair<ScTemplate *, ScTemplateParams> GetTemplate(ScMemoryContext * context, ScMemoryJsonPayload payload)
+  //! Returns SC_TRUE if payload refers to sc-template prepared by session before
+  static sc_bool IsPreparedTemplate(ScMemoryJsonPayload const & payload)
+  {
+    return payload.is_object() && payload.contains("handle");
+  }
+
+  std::pair<std::shared_ptr<ScTemplate>, ScTemplateParams> GetTemplate(
+      ScMemoryContext * context,
+      ScMemoryJsonPayload payload)
   {
     ScTemplateParams templParams;
     if (payload.is_object())
     {
-      auto const rowParams = payload["params"];
-      payload = payload["templ"];
-
-      for (auto it = rowParams.cbegin(); it != rowParams.cend(); it++)
+      templParams = GetTemplateParams(context, payload["params"]);
+      if (IsPreparedTemplate(payload))
       {
-        auto const & key = it.key();
-        auto const & value = it.value();
-        if (value.is_string())
-        {
-          ScAddr const & addr = context->HelperFindBySystemIdtf(value.get<std::string>());
-          templParams.Add(key, addr);
-        }
-        else
-          templParams.Add(key, ScAddr(value.get<size_t>()));
+        size_t const handle = payload["handle"].get<size_t>();
+        std::shared_ptr<ScTemplate> const & scTemplate = ScMemoryJsonPreparedTemplates::Get(context, handle);
+        if (scTemplate == nullptr)
+          SC_THROW_EXCEPTION(
+              utils::ExceptionInvalidParams, "Template with handle " << handle << " isn't prepared by session");
+
+        return {scTemplate, templParams};
       }
+
+      payload = payload["templ"];
     }
 
-    ScTemplate * scTemplate;
+    std::shared_ptr<ScTemplate> scTemplate;
     if (payload.is_string())
     {
-      scTemplate = new ScTemplate();
+      scTemplate = std::make_shared<ScTemplate>();
       std::string templateStr = payload.get<std::string>();
       context->HelperBuildTemplate(*scTemplate, templateStr);
     }
@@ -45,7 +54,7 @@ protected:
       std::string const & type = payload["type"].get<std::string>();
       auto const & value = payload["value"];
 
-      scTemplate = new ScTemplate();
+      scTemplate = std::make_shared<ScTemplate>();
       if (type == "addr")
         context->HelperBuildTemplate(*scTemplate, ScAddr(value.get<size_t>()), templParams);
       else if (type == "idtf")
@@ -60,7 +69,26 @@ protected:
     return {scTemplate, templParams};
   }
 
-  ScTemplate * MakeTemplate(ScMemoryJsonPayload const & triples)
+  static ScTemplateParams GetTemplateParams(ScMemoryContext * context, ScMemoryJsonPayload const & rowParams)
+  {
+    ScTemplateParams templParams;
+    for (auto it = rowParams.cbegin(); it != rowParams.cend(); it++)
+    {
+      auto const & key = it.key();
+      auto const & value = it.value();
+      if (value.is_string())
+      {
+        ScAddr const & addr = context->HelperFindBySystemIdtf(value.get<std::string>());
+        templParams.Add(key, addr);
+      }
+      else
+        templParams.Add(key, ScAddr(value.get<size_t>()));
+    }
+
+    return templParams;
+  }
+
+  std::shared_ptr<ScTemplate> MakeTemplate(ScMemoryJsonPayload const & triples)
   {
     auto const & convertItemToParam = [](ScMemoryJsonPayload paramItem) -> ScTemplateItem
     {
@@ -89,7 +117,7 @@ protected:
       return param;
     };
 
-    auto * scTemplate = new ScTemplate();
+    auto scTemplate = std::make_shared<ScTemplate>();
     for (auto const & triple : triples)
     {
       auto const & srcParam = convertItemToParam(triple[0]);
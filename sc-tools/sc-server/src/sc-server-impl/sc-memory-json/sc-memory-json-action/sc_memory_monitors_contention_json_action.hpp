@@ -0,0 +1,55 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc_memory_json_action.hpp"
+
+class ScMemoryMonitorsContentionJsonAction : public ScMemoryJsonAction
+{
+public:
+  ScMemoryJsonPayload Complete(
+      ScMemoryContext * context,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload) override
+  {
+    ScMemoryJsonPayload responsePayload = ScMemoryJsonPayload::array({});
+
+    if (requestPayload.contains("sampling_period"))
+    {
+      if (!requestPayload["sampling_period"].is_number_unsigned())
+      {
+        errorsPayload = "Sampling period of sc-element monitors contention must be non-negative number";
+        return responsePayload;
+      }
+
+      context->SetMonitorsContentionSamplingPeriod(requestPayload["sampling_period"].get<sc_uint32>());
+    }
+
+    ScMemoryJsonPayload const & count = requestPayload.value("count", ScMemoryJsonPayload(kDefaultCount));
+    if (!count.is_number_unsigned())
+    {
+      errorsPayload = "Count of the most contended sc-elements must be non-negative number";
+      return responsePayload;
+    }
+
+    for (auto const & contention : context->CalculateMonitorsContentionStat(count.get<size_t>()))
+    {
+      responsePayload.push_back(
+          {{"addr", contention.m_addr.Hash()},
+           {"idtf", contention.m_systemIdtf},
+           {"contended_count", contention.m_contendedCount},
+           {"total_wait_time", contention.m_totalWaitTime},
+           {"max_wait_time", contention.m_maxWaitTime},
+           {"max_waiters_count", contention.m_maxWaitersCount}});
+    }
+
+    return responsePayload;
+  }
+
+private:
+  static size_t constexpr kDefaultCount = 10;
+};
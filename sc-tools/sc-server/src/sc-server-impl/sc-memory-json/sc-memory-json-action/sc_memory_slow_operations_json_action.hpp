@@ -0,0 +1,32 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc_memory_json_action.hpp"
+
+class ScMemorySlowOperationsJsonAction : public ScMemoryJsonAction
+{
+public:
+  ScMemoryJsonPayload Complete(
+      ScMemoryContext * context,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload) override
+  {
+    ScMemoryJsonPayload responsePayload = ScMemoryJsonPayload::array({});
+
+    for (auto const & entry : context->GetSlowOperations())
+    {
+      responsePayload.push_back(
+          {{"type", utils::ScSlowOperationsLog::GetTypeName(entry.m_type)},
+           {"time", entry.m_time},
+           {"duration", entry.m_duration},
+           {"description", entry.m_description}});
+    }
+
+    return responsePayload;
+  }
+};
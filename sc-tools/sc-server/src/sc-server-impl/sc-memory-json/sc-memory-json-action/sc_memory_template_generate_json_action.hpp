@@ -27,7 +27,6 @@ public:
     SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_BEGIN
     ScMemoryJsonPayload const & resultPayload = {{"aliases", result.GetReplacements()}, {"addrs", hashesVectors}};
     SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_END
-    delete pair.first;
     return resultPayload;
   }
 };
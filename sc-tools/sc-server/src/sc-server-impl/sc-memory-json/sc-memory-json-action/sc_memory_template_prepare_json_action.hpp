@@ -0,0 +1,42 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc_memory_make_template_json_action.hpp"
+
+/*!
+ * Action that builds sc-template once and stores it for session. Request payload is the same as one of
+ * `search_template` and `generate_template` requests, response payload is handle of prepared sc-template. Then
+ * session can search or generate by this sc-template with payload `{"handle": <handle>, "params": {...}}` without
+ * parsing and building it again.
+ */
+class ScMemoryTemplatePrepareJsonAction : public ScMemoryMakeTemplateJsonAction
+{
+public:
+  ScMemoryJsonPayload Complete(
+      ScMemoryContext * context,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload) override
+  {
+    if (IsPreparedTemplate(requestPayload))
+    {
+      errorsPayload = "Template is already prepared";
+      return {};
+    }
+
+    auto const & pair = GetTemplate(context, requestPayload);
+    size_t const handle = ScMemoryJsonPreparedTemplates::Add(context, pair.first);
+    if (handle == 0)
+    {
+      errorsPayload = "Session can't prepare more than " + std::to_string(SC_SERVER_MAX_PREPARED_TEMPLATES)
+                      + " templates, release unused ones";
+      return {};
+    }
+
+    return {{"handle", handle}};
+  }
+};
@@ -0,0 +1,26 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc_memory_json_action.hpp"
+#include "sc_memory_json_prepared_templates.hpp"
+
+class ScMemoryTemplateReleaseJsonAction : public ScMemoryJsonAction
+{
+public:
+  ScMemoryJsonPayload Complete(
+      ScMemoryContext * context,
+      ScMemoryJsonPayload requestPayload,
+      ScMemoryJsonPayload & errorsPayload) override
+  {
+    ScMemoryJsonPayload responsePayload = ScMemoryJsonPayload::array({});
+    for (auto & handle : requestPayload)
+      responsePayload.push_back(ScMemoryJsonPreparedTemplates::Remove(context, handle.get<size_t>()));
+
+    return responsePayload;
+  }
+};
@@ -17,7 +17,14 @@ public:
       ScMemoryJsonPayload & errorsPayload) override
   {
     ScTemplateSearchResult result;
-    auto const & pair = GetTemplate(context, requestPayload);
+    auto pair = GetTemplate(context, requestPayload);
+    // prepared sc-template is shared by requests of session, so params are bound to its copy for this request
+    if (IsPreparedTemplate(requestPayload) && !pair.second.IsEmpty())
+    {
+      auto boundTemplate = std::make_shared<ScTemplate>();
+      boundTemplate->Bind(*pair.first, pair.second);
+      pair.first = boundTemplate;
+    }
     context->HelperSearchTemplate(*pair.first, result);
 
     std::vector<std::vector<size_t>> hashesVectors;
@@ -35,7 +42,6 @@ public:
     SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_BEGIN
     ScMemoryJsonPayload const & resultPayload = {{"aliases", result.GetReplacements()}, {"addrs", hashesVectors}};
     SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_END
-    delete pair.first;
     return resultPayload;
   }
 };
@@ -6,17 +6,37 @@
 
 #include "sc_memory_json_handler.hpp"
 
+#include "sc-memory/sc_timer.hpp"
+
 std::string ScMemoryJsonHandler::Handle(ScServerSessionId const & sessionId, std::string const & requestMessage)
 {
+  ScMemoryJsonHandlingTimings timings;
+  return Handle(sessionId, requestMessage, timings);
+}
+
+std::string ScMemoryJsonHandler::Handle(
+    ScServerSessionId const & sessionId,
+    std::string const & requestMessage,
+    ScMemoryJsonHandlingTimings & timings)
+{
+  ScTimer timer;
   std::vector<ScMemoryJsonPayload> requestData = ParseRequestMessage(requestMessage);
+  timings.m_parseTime = timer.Seconds() * 1000;
   if (requestData.empty())
     return ScMemoryJsonPayload("Invalid request message").dump();
 
   std::string const & requestType = requestData.at(0).get<std::string>();
   ScMemoryJsonPayload const & requestPayload = requestData.at(1);
   size_t const & requestId = requestData.at(2).get<size_t>();
+  timings.m_requestType = requestType;
+
+  ScMemoryJsonPayload const & responseMessage =
+      ResponseRequestMessage(sessionId, requestId, requestType, requestPayload);
+  timings.m_handleTime = timer.Seconds() * 1000 - timings.m_parseTime;
 
-  return ResponseRequestMessage(sessionId, requestId, requestType, requestPayload).dump();
+  std::string responseText = responseMessage.dump();
+  timings.m_serializeTime = timer.Seconds() * 1000 - timings.m_parseTime - timings.m_handleTime;
+  return responseText;
 }
 
 std::vector<ScMemoryJsonPayload> ScMemoryJsonHandler::ParseRequestMessage(std::string const & requestMessage)
@@ -23,8 +23,22 @@ public:
 
   virtual ~ScMemoryJsonHandler() = default;
 
+  //! Durations (in milliseconds) of phases of request message handling
+  struct ScMemoryJsonHandlingTimings
+  {
+    std::string m_requestType;
+    double m_parseTime = 0;
+    double m_handleTime = 0;
+    double m_serializeTime = 0;
+  };
+
   virtual std::string Handle(ScServerSessionId const & sessionId, std::string const & requestMessage);
 
+  std::string Handle(
+      ScServerSessionId const & sessionId,
+      std::string const & requestMessage,
+      ScMemoryJsonHandlingTimings & timings);
+
 protected:
   ScServer * m_server;
 
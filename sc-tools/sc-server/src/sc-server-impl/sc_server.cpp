@@ -8,10 +8,24 @@
 
 #include "sc-memory/sc_keynodes.hpp"
 
-ScServer::ScServer(std::string hostName, size_t port)
+extern "C"
+{
+#include "sc-core/sc-store/sc-base/sc_allocator.h"
+}
+
+namespace
+{
+// session holds sc-memory context object, connection object and node of sessions map with color and three links
+size_t const kSessionBytes = sizeof(ScMemoryContext) + sizeof(ScServerCore::connection_type)
+                             + sizeof(ScServerSessionContexts::value_type) + 4 * sizeof(void *);
+}  // namespace
+
+ScServer::ScServer(std::string hostName, size_t port, std::string socketPath)
   : m_hostName(std::move(hostName))
   , m_port(port)
+  , m_socketPath(std::move(socketPath))
   , m_logger(nullptr)
+  , m_localTransport(nullptr)
 {
   m_instance = new ScServerCore();
   ResetLogger();
@@ -21,6 +35,8 @@ ScServer::ScServer(std::string hostName, size_t port)
     LogMessage(ScServerErrorLevel::info, "Socket data:");
     LogMessage(ScServerErrorLevel::info, "\tHost name: " + m_hostName);
     LogMessage(ScServerErrorLevel::info, "\tPort: " + std::to_string(m_port));
+    if (!m_socketPath.empty())
+      LogMessage(ScServerErrorLevel::info, "\tUnix socket path: " + m_socketPath);
   }
 
   m_connections = new ScServerSessionContexts();
@@ -34,11 +50,17 @@ void ScServer::Run()
   m_isServerRun = SC_TRUE;
   m_instance->set_reuse_addr(SC_TRUE);
 
+  if (!m_socketPath.empty())
+    m_localTransport = new ScServerLocalTransport(m_instance->get_io_service(), m_socketPath);
+
   Initialize();
 
   m_instance->listen({boost::asio::ip::address::from_string(m_hostName), sc_uint16(m_port)});
   m_instance->start_accept();
 
+  if (m_localTransport != nullptr)
+    m_localTransport->Listen();
+
   LogMessage(ScServerErrorLevel::info, "Start actions processing");
   m_actionsThread = std::thread(&ScServer::EmitActions, &*this);
 
@@ -53,6 +75,14 @@ void ScServer::Stop()
 {
   m_isServerRun = SC_FALSE;
   LogMessage(ScServerErrorLevel::info, "Stop sc-server");
+
+  // local sessions are closed by io-service thread, so it is done before io-service is stopped
+  if (m_localTransport != nullptr)
+  {
+    LogMessage(ScServerErrorLevel::info, "Stop Unix socket processing");
+    m_localTransport->Stop();
+  }
+
   m_instance->stop();
 
   if (m_instance->is_listening())
@@ -74,7 +104,7 @@ void ScServer::Stop()
     {
       try
       {
-        m_instance->close(it.first, websocketpp::close::status::normal, "Sc-server is finishing work");
+        CloseConnection(it.first, websocketpp::close::status::normal, "Sc-server is finishing work");
       }
       catch (std::exception const & ex)
       {
@@ -100,6 +130,9 @@ void ScServer::Shutdown()
 
   LogMessage(ScServerErrorLevel::info, "Sc-server shutdown");
 
+  delete m_localTransport;
+  m_localTransport = nullptr;
+
   delete m_instance;
   m_instance = nullptr;
 }
@@ -109,6 +142,11 @@ std::string ScServer::GetUri()
   return "ws://" + m_hostName + ":" + std::to_string(m_port);
 }
 
+std::string ScServer::GetSocketPath()
+{
+  return m_socketPath;
+}
+
 bool ScServer::IsSessionValid(ScServerSessionId const & sessionId)
 {
   ScServerLock lock(m_connectionsMutex);
@@ -119,6 +157,7 @@ void ScServer::AddSessionContext(ScServerSessionId const & sessionId, ScMemoryCo
 {
   ScServerLock lock(m_connectionsMutex);
   m_connections->insert({sessionId, sessionCtx});
+  sc_mem_account_new(SC_ALLOCATIONS_SERVER_SESSIONS, 1, kSessionBytes);
 }
 
 ScMemoryContext * ScServer::PopSessionContext(ScServerSessionId const & sessionId)
@@ -126,6 +165,7 @@ ScMemoryContext * ScServer::PopSessionContext(ScServerSessionId const & sessionI
   ScServerLock lock(m_connectionsMutex);
   ScMemoryContext * sessionCtx = m_connections->at(sessionId);
   m_connections->erase(sessionId);
+  sc_mem_account_free(SC_ALLOCATIONS_SERVER_SESSIONS, 1, kSessionBytes);
   return sessionCtx;
 }
 
@@ -137,6 +177,9 @@ ScMemoryContext * ScServer::GetSessionContext(ScServerSessionId const & sessionI
 
 void ScServer::Send(ScServerSessionId const & sessionId, std::string const & message, ScServerMessageType type)
 {
+  if (m_localTransport != nullptr && m_localTransport->Send(sessionId, message))
+    return;
+
   m_instance->send(sessionId, message, type);
 }
 
@@ -181,6 +224,9 @@ void ScServer::CloseConnection(
     ScServerCloseCode const code,
     std::string const & reason)
 {
+  if (m_localTransport != nullptr && m_localTransport->Close(sessionId))
+    return;
+
   m_instance->close(sessionId, code, reason);
 }
 
@@ -13,6 +13,7 @@
 #include "sc_server_defines.hpp"
 
 #include "sc_server_action.hpp"
+#include "sc_server_local_transport.hpp"
 #include "sc_server_logger.hpp"
 
 using ScServerMutex = std::mutex;
@@ -21,7 +22,7 @@ using ScServerLock = std::lock_guard<ScServerMutex>;
 class ScServer
 {
 public:
-  explicit ScServer(std::string hostName, size_t port);
+  explicit ScServer(std::string hostName, size_t port, std::string socketPath = "");
 
   void Run();
 
@@ -35,6 +36,8 @@ public:
 
   std::string GetUri();
 
+  std::string GetSocketPath();
+
   bool IsSessionValid(ScServerSessionId const & sessionId);
 
   void AddSessionContext(ScServerSessionId const & sessionId, ScMemoryContext * sessionCtx);
@@ -63,9 +66,12 @@ protected:
   std::atomic<sc_bool> m_isServerRun = SC_FALSE;
   std::string m_hostName;
   ScServerPort m_port;
+  //! Path to Unix domain socket for co-located clients, it is empty if they connect through websocket only
+  std::string m_socketPath;
 
   ScServerLogger * m_logger;
   ScServerCore * m_instance;
+  ScServerLocalTransport * m_localTransport;
   ScServerSessionContexts * m_connections;
   ScServerMutex m_connectionsMutex;
 
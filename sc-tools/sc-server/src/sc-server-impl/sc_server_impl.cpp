@@ -15,8 +15,12 @@ extern "C"
 #include "sc-core/sc-store/sc-base/sc_thread.h"
 }
 
-ScServerImpl::ScServerImpl(std::string const & host, ScServerPort port, sc_bool parallelActions)
-  : ScServer(host, port)
+ScServerImpl::ScServerImpl(
+    std::string const & host,
+    ScServerPort port,
+    sc_bool parallelActions,
+    std::string const & socketPath)
+  : ScServer(host, port, socketPath)
   , m_parallelActions(parallelActions)
   , m_actionsRun(SC_TRUE)
   , m_actions(new ScServerActions())
@@ -29,6 +33,13 @@ void ScServerImpl::Initialize()
   m_instance->set_open_handler(bind(&ScServerImpl::OnOpen, this, ::_1));
   m_instance->set_close_handler(bind(&ScServerImpl::OnClose, this, ::_1));
   m_instance->set_message_handler(bind(&ScServerImpl::OnMessage, this, ::_1, ::_2));
+
+  if (m_localTransport != nullptr)
+  {
+    m_localTransport->SetOpenHandler(bind(&ScServerImpl::OnOpen, this, ::_1));
+    m_localTransport->SetCloseHandler(bind(&ScServerImpl::OnClose, this, ::_1));
+    m_localTransport->SetMessageHandler(bind(&ScServerImpl::OnMessage, this, ::_1, ::_2));
+  }
 }
 
 void ScServerImpl::AfterInitialize()
@@ -16,7 +16,11 @@ using ScServerActions = std::queue<ScServerAction *>;
 class ScServerImpl : public ScServer
 {
 public:
-  explicit ScServerImpl(std::string const & host, ScServerPort port, sc_bool parallelActions);
+  explicit ScServerImpl(
+      std::string const & host,
+      ScServerPort port,
+      sc_bool parallelActions,
+      std::string const & socketPath = "");
 
   void EmitActions() override;
 
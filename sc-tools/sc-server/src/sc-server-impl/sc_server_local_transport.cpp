@@ -0,0 +1,310 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_server_local_transport.hpp"
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+
+#include <array>
+#include <cstdio>
+#include <deque>
+#include <future>
+
+class ScServerLocalSession : public std::enable_shared_from_this<ScServerLocalSession>
+{
+public:
+  ScServerLocalSession(ScServerLocalTransport * transport, ScServerLocalProtocol::socket socket)
+    : m_transport(transport)
+    , m_socket(std::move(socket))
+    , m_isOpen(SC_TRUE)
+  {
+  }
+
+  void Start()
+  {
+    m_transport->OnOpen(shared_from_this());
+    ReadHeader();
+  }
+
+  void Write(std::string const & message)
+  {
+    auto frame = std::make_shared<std::string>(EncodeHeader(message.size()));
+    frame->append(message);
+
+    auto self = shared_from_this();
+    boost::asio::post(
+        m_transport->m_ioService,
+        [self, frame]()
+        {
+          if (self->m_isOpen == SC_FALSE)
+            return;
+
+          self->m_frames.push_back(frame);
+          if (self->m_frames.size() == 1)
+            self->WriteFrame();
+        });
+  }
+
+  void Close()
+  {
+    auto self = shared_from_this();
+    boost::asio::post(
+        m_transport->m_ioService,
+        [self]()
+        {
+          self->OnError();
+        });
+  }
+
+  //! Closes socket without notifying transport, it is used on transport stop
+  void Shutdown()
+  {
+    m_isOpen = SC_FALSE;
+    boost::system::error_code code;
+    m_socket.close(code);
+  }
+
+private:
+  ScServerLocalTransport * m_transport;
+  ScServerLocalProtocol::socket m_socket;
+  sc_bool m_isOpen;
+
+  std::array<sc_uchar, 4> m_header{};
+  std::string m_payload;
+  std::deque<std::shared_ptr<std::string>> m_frames;
+
+  static std::string EncodeHeader(size_t size)
+  {
+    std::string header(4, '\0');
+    for (size_t i = 0; i < 4; ++i)
+      header[i] = (sc_char)((size >> (8 * (3 - i))) & 0xff);
+    return header;
+  }
+
+  void ReadHeader()
+  {
+    auto self = shared_from_this();
+    boost::asio::async_read(
+        m_socket,
+        boost::asio::buffer(m_header),
+        [self](boost::system::error_code const & code, size_t)
+        {
+          if (code)
+            return self->OnError();
+
+          size_t size = 0;
+          for (sc_uchar const byte : self->m_header)
+            size = (size << 8) | byte;
+
+          if (size > SC_SERVER_LOCAL_MAX_MESSAGE_SIZE)
+            return self->OnError();
+
+          self->m_payload.resize(size);
+          self->ReadPayload();
+        });
+  }
+
+  void ReadPayload()
+  {
+    auto self = shared_from_this();
+    boost::asio::async_read(
+        m_socket,
+        boost::asio::buffer(m_payload),
+        [self](boost::system::error_code const & code, size_t)
+        {
+          if (code)
+            return self->OnError();
+
+          self->m_transport->OnMessage(self, self->m_payload);
+          self->ReadHeader();
+        });
+  }
+
+  void WriteFrame()
+  {
+    auto self = shared_from_this();
+    boost::asio::async_write(
+        m_socket,
+        boost::asio::buffer(*m_frames.front()),
+        [self](boost::system::error_code const & code, size_t)
+        {
+          if (code)
+            return self->OnError();
+
+          self->m_frames.pop_front();
+          if (!self->m_frames.empty())
+            self->WriteFrame();
+        });
+  }
+
+  void OnError()
+  {
+    if (m_isOpen == SC_FALSE)
+      return;
+
+    Shutdown();
+    m_frames.clear();
+    m_transport->OnClose(shared_from_this());
+  }
+};
+
+ScServerLocalTransport::ScServerLocalTransport(boost::asio::io_service & ioService, std::string socketPath)
+  : m_ioService(ioService)
+  , m_socketPath(std::move(socketPath))
+{
+}
+
+void ScServerLocalTransport::SetOpenHandler(ScServerOpenHandler handler)
+{
+  m_openHandler = std::move(handler);
+}
+
+void ScServerLocalTransport::SetCloseHandler(ScServerCloseHandler handler)
+{
+  m_closeHandler = std::move(handler);
+}
+
+void ScServerLocalTransport::SetMessageHandler(ScServerMessageHandler handler)
+{
+  m_messageHandler = std::move(handler);
+}
+
+void ScServerLocalTransport::Listen()
+{
+  std::remove(m_socketPath.c_str());
+
+  m_acceptor = std::make_unique<ScServerLocalProtocol::acceptor>(m_ioService);
+  ScServerLocalProtocol::endpoint const endpoint(m_socketPath);
+  m_acceptor->open(endpoint.protocol());
+  m_acceptor->bind(endpoint);
+  m_acceptor->listen();
+
+  Accept();
+}
+
+void ScServerLocalTransport::Stop()
+{
+  if (m_acceptor == nullptr)
+    return;
+
+  // sockets aren't thread-safe, so they are closed by io-service thread, if it is still running
+  if (m_ioService.stopped())
+    return StopSessions();
+
+  std::promise<void> stopped;
+  boost::asio::post(
+      m_ioService,
+      [this, &stopped]()
+      {
+        StopSessions();
+        stopped.set_value();
+      });
+  stopped.get_future().wait();
+}
+
+void ScServerLocalTransport::StopSessions()
+{
+  if (m_acceptor == nullptr)
+    return;
+
+  boost::system::error_code code;
+  m_acceptor->close(code);
+  m_acceptor = nullptr;
+
+  ScServerLocalSessions sessions;
+  {
+    std::lock_guard<std::mutex> lock(m_sessionsMutex);
+    sessions.swap(m_sessions);
+  }
+  for (auto const & it : sessions)
+    it.second->Shutdown();
+
+  std::remove(m_socketPath.c_str());
+}
+
+std::string const & ScServerLocalTransport::GetSocketPath() const
+{
+  return m_socketPath;
+}
+
+sc_bool ScServerLocalTransport::Send(ScServerSessionId const & sessionId, std::string const & message)
+{
+  std::shared_ptr<ScServerLocalSession> const & session = FindSession(sessionId);
+  if (session == nullptr)
+    return SC_FALSE;
+
+  session->Write(message);
+  return SC_TRUE;
+}
+
+sc_bool ScServerLocalTransport::Close(ScServerSessionId const & sessionId)
+{
+  std::shared_ptr<ScServerLocalSession> const & session = FindSession(sessionId);
+  if (session == nullptr)
+    return SC_FALSE;
+
+  session->Close();
+  return SC_TRUE;
+}
+
+ScServerLocalTransport::~ScServerLocalTransport()
+{
+  Stop();
+}
+
+void ScServerLocalTransport::Accept()
+{
+  m_acceptor->async_accept(
+      [this](boost::system::error_code const & code, ScServerLocalProtocol::socket socket)
+      {
+        if (code)
+          return;
+
+        std::make_shared<ScServerLocalSession>(this, std::move(socket))->Start();
+        Accept();
+      });
+}
+
+std::shared_ptr<ScServerLocalSession> ScServerLocalTransport::FindSession(ScServerSessionId const & sessionId)
+{
+  std::lock_guard<std::mutex> lock(m_sessionsMutex);
+  auto const it = m_sessions.find(sessionId);
+  return it == m_sessions.cend() ? nullptr : it->second;
+}
+
+void ScServerLocalTransport::OnOpen(std::shared_ptr<ScServerLocalSession> const & session)
+{
+  ScServerSessionId const sessionId = session;
+  {
+    std::lock_guard<std::mutex> lock(m_sessionsMutex);
+    m_sessions.insert({sessionId, session});
+  }
+
+  if (m_openHandler)
+    m_openHandler(sessionId);
+}
+
+void ScServerLocalTransport::OnClose(std::shared_ptr<ScServerLocalSession> const & session)
+{
+  ScServerSessionId const sessionId = session;
+  if (m_closeHandler)
+    m_closeHandler(sessionId);
+
+  std::lock_guard<std::mutex> lock(m_sessionsMutex);
+  m_sessions.erase(sessionId);
+}
+
+void ScServerLocalTransport::OnMessage(std::shared_ptr<ScServerLocalSession> const & session, std::string & payload)
+{
+  if (!m_messageHandler)
+    return;
+
+  auto const message = std::make_shared<ScServerConfig::message_type>(nullptr, websocketpp::frame::opcode::text, 0);
+  message->get_raw_payload().swap(payload);
+  m_messageHandler(ScServerSessionId(session), message);
+}
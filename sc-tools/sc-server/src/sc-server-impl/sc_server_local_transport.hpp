@@ -0,0 +1,91 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <boost/asio/local/stream_protocol.hpp>
+
+#include <functional>
+#include <mutex>
+
+#include "sc_server_defines.hpp"
+
+//! Maximum size of message payload in bytes that can be received through Unix domain socket
+#define SC_SERVER_LOCAL_MAX_MESSAGE_SIZE (256 * 1024 * 1024)
+
+class ScServerLocalSession;
+
+using ScServerLocalProtocol = boost::asio::local::stream_protocol;
+using ScServerLocalSessions =
+    std::map<ScServerSessionId, std::shared_ptr<ScServerLocalSession>, std::owner_less<ScServerSessionId>>;
+
+using ScServerOpenHandler = std::function<void(ScServerSessionId const &)>;
+using ScServerCloseHandler = std::function<void(ScServerSessionId const &)>;
+using ScServerMessageHandler = std::function<void(ScServerSessionId const &, ScServerMessage const &)>;
+
+/*!
+ * Transport that accepts sc-server connections of co-located clients on a Unix domain socket. Each message is framed
+ * as 4-byte big-endian payload size followed by payload in sc-json, so requests and responses have the same semantics
+ * as ones sent through websocket, but they don't pass through TCP stack and websocket framing. Sessions of this
+ * transport are handled by the same handlers as websocket connections and are served by the same io-service. Large
+ * payloads are sent through the socket as well, there is no shared-memory transport for them.
+ */
+class ScServerLocalTransport
+{
+  friend class ScServerLocalSession;
+
+public:
+  ScServerLocalTransport(boost::asio::io_service & ioService, std::string socketPath);
+
+  void SetOpenHandler(ScServerOpenHandler handler);
+
+  void SetCloseHandler(ScServerCloseHandler handler);
+
+  void SetMessageHandler(ScServerMessageHandler handler);
+
+  //! Removes stale socket file, binds socket and starts accepting connections
+  void Listen();
+
+  /*!
+   * Stops accepting connections, closes all sessions and removes socket file. It should be called before io-service is
+   * stopped, then sessions are closed by io-service thread and it waits for that.
+   */
+  void Stop();
+
+  std::string const & GetSocketPath() const;
+
+  //! Returns SC_FALSE if specified session isn't a session of this transport
+  sc_bool Send(ScServerSessionId const & sessionId, std::string const & message);
+
+  //! Returns SC_FALSE if specified session isn't a session of this transport
+  sc_bool Close(ScServerSessionId const & sessionId);
+
+  ~ScServerLocalTransport();
+
+protected:
+  boost::asio::io_service & m_ioService;
+  std::string m_socketPath;
+  std::unique_ptr<ScServerLocalProtocol::acceptor> m_acceptor;
+
+  ScServerOpenHandler m_openHandler;
+  ScServerCloseHandler m_closeHandler;
+  ScServerMessageHandler m_messageHandler;
+
+  ScServerLocalSessions m_sessions;
+  std::mutex m_sessionsMutex;
+
+  void Accept();
+
+  void StopSessions();
+
+  std::shared_ptr<ScServerLocalSession> FindSession(ScServerSessionId const & sessionId);
+
+  void OnOpen(std::shared_ptr<ScServerLocalSession> const & session);
+
+  void OnClose(std::shared_ptr<ScServerLocalSession> const & session);
+
+  void OnMessage(std::shared_ptr<ScServerLocalSession> const & session, std::string & payload);
+};
@@ -6,9 +6,13 @@
 
 #pragma once
 
+#include <iomanip>
+#include <sstream>
 #include <utility>
 
 #include "sc-memory/sc_keynodes.hpp"
+#include "sc-memory/sc_timer.hpp"
+#include "sc-memory/utils/sc_slow_operations_log.hpp"
 
 #include "sc_server_action.hpp"
 #include "sc_server.hpp"
@@ -62,20 +66,50 @@ public:
 
   void OnAction(ScServerSessionId const & sessionId, ScServerMessage const & msg)
   {
+    double const waitTime = m_timer.Seconds() * 1000;
     m_server->LogMessage(ScServerErrorLevel::debug, "[request] " + msg->get_payload());
-    auto const & responseText = m_actionsHandler->Handle(sessionId, msg->get_payload());
+    ScMemoryJsonHandler::ScMemoryJsonHandlingTimings timings;
+    auto const & responseText = m_actionsHandler->Handle(sessionId, msg->get_payload(), timings);
 
     m_server->LogMessage(ScServerErrorLevel::debug, "[response] " + responseText);
+    ScTimer sendTimer;
     m_server->Send(sessionId, responseText, ScServerMessageType::text);
+    LogIfSlow(sessionId, msg, waitTime, timings, sendTimer.Seconds() * 1000);
   }
 
   void OnEvent(ScServerSessionId const & sessionId, ScServerMessage const & msg)
   {
+    double const waitTime = m_timer.Seconds() * 1000;
     m_server->LogMessage(ScServerErrorLevel::debug, "[event] " + msg->get_payload());
-    auto const & responseText = m_eventsHandler->Handle(sessionId, msg->get_payload());
+    ScMemoryJsonHandler::ScMemoryJsonHandlingTimings timings;
+    auto const & responseText = m_eventsHandler->Handle(sessionId, msg->get_payload(), timings);
 
     m_server->LogMessage(ScServerErrorLevel::debug, "[event response] " + responseText);
+    ScTimer sendTimer;
     m_server->Send(sessionId, responseText, ScServerMessageType::text);
+    LogIfSlow(sessionId, msg, waitTime, timings, sendTimer.Seconds() * 1000);
+  }
+
+  //! Logs request if it lasts longer than threshold of sc-server requests since it was received
+  void LogIfSlow(
+      ScServerSessionId const & sessionId,
+      ScServerMessage const & msg,
+      double waitTime,
+      ScMemoryJsonHandler::ScMemoryJsonHandlingTimings const & timings,
+      double sendTime)
+  {
+    double const duration = m_timer.Seconds() * 1000;
+    if (!utils::ScSlowOperationsLog::IsSlow(utils::ScSlowOperationsLog::Type::ServerRequest, duration))
+      return;
+
+    std::stringstream description;
+    description << "type: " << timings.m_requestType << ", payload size: " << msg->get_payload().size()
+                << ", session: " << (sc_uint64)sessionId.lock().get() << std::fixed << std::setprecision(3)
+                << ", wait: " << waitTime << " ms, parse: " << timings.m_parseTime
+                << " ms, handle: " << timings.m_handleTime << " ms, serialize: " << timings.m_serializeTime
+                << " ms, send: " << sendTime << " ms";
+
+    utils::ScSlowOperationsLog::Add(utils::ScSlowOperationsLog::Type::ServerRequest, duration, description.str());
   }
 
   void OnHealthCheck(ScServerSessionId const & sessionId, ScServerMessage const & msg)
@@ -125,6 +159,8 @@ public:
 protected:
   ScServer * m_server;
   ScServerMessage m_msg;
+  //! Timer started when message was received, so time message waited in queue of actions is logged too
+  ScTimer m_timer;
 
   ScMemoryJsonHandler * m_actionsHandler;
   ScMemoryJsonHandler * m_eventsHandler;
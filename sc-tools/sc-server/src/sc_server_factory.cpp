@@ -13,7 +13,10 @@ std::shared_ptr<ScServer> ScServerFactory::ConfigureScServer(ScParams const & se
   if (serverParams.Has("parallel_actions"))
     parallelActions = serverParams.Get<std::string>("parallel_actions") == "true";
   std::unique_ptr<ScServer> server = std::unique_ptr<ScServer>(new ScServerImpl(
-      serverParams.Get<std::string>("host", "127.0.0.1"), serverParams.Get("port", 8090), parallelActions));
+      serverParams.Get<std::string>("host", "127.0.0.1"),
+      serverParams.Get("port", 8090),
+      parallelActions,
+      serverParams.Get<std::string>("unix_socket_path", "")));
 
   return server;
 }
@@ -34,7 +34,7 @@ protected:
     Shutdown();
   }
 
-  void Initialize(sc_bool parallel_actions)
+  void Initialize(sc_bool parallel_actions, std::string const & socketPath = "")
   {
     sc_memory_params params;
     sc_memory_params_clear(&params);
@@ -47,7 +47,7 @@ protected:
 
     ScMemory::LogMute();
     ScMemory::Initialize(params);
-    m_server = std::make_unique<ScServerImpl>("127.0.0.1", 8865, parallel_actions);
+    m_server = std::make_unique<ScServerImpl>("127.0.0.1", 8865, parallel_actions, socketPath);
     m_server->ClearChannels();
     m_server->Run();
     ScMemory::LogUnmute();
@@ -76,3 +76,13 @@ protected:
     m_ctx = std::make_unique<ScMemoryContext>();
   }
 };
+
+class ScServerTestWithLocalTransport : public ScServerTest
+{
+protected:
+  void SetUp() override
+  {
+    Initialize(SC_TRUE, "sc-server-test.sock");
+    m_ctx = std::make_unique<ScMemoryContext>();
+  }
+};
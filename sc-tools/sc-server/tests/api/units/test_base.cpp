@@ -7,7 +7,9 @@
 #include "sc_server_test.hpp"
 
 #include "sc-core/sc-store/sc_types.h"
+#include "sc-memory/sc_timer.hpp"
 #include "sc-memory/sc_type.hpp"
+#include "sc-memory/utils/sc_slow_operations_log.hpp"
 #include "../../sc_client.hpp"
 
 #include "../../sc_memory_json_converter.hpp"
@@ -305,6 +307,367 @@ TEST_F(ScServerTest, CheckElements)
   client.Stop();
 }
 
+TEST_F(ScServerTest, CheckNotExistingElements)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScAddr const & node = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const & erasedNode = m_ctx->CreateNode(ScType::NodeConst);
+  m_ctx->EraseElement(erasedNode);
+
+  std::string const payloadString = ScMemoryJsonConverter::From(
+      0,
+      "check_elements",
+      ScMemoryJsonPayload::array({
+          erasedNode.Hash(),
+          0,
+          node.Hash(),
+      }));
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  auto const & responsePayload = response["payload"];
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["errors"].empty());
+
+  EXPECT_EQ(responsePayload.size(), 3u);
+  EXPECT_EQ(responsePayload[0].get<size_t>(), 0u);
+  EXPECT_EQ(responsePayload[1].get<size_t>(), 0u);
+  EXPECT_TRUE(ScType(responsePayload[2].get<size_t>()) == ScType::NodeConst);
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, AllocationsStat)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  std::string const payloadString =
+      ScMemoryJsonConverter::From(0, "allocations_stat", ScMemoryJsonPayload::object({}));
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  auto const & responsePayload = response["payload"];
+  EXPECT_FALSE(responsePayload.is_null());
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["errors"].empty());
+
+  EXPECT_EQ(responsePayload.size(), (size_t)SC_ALLOCATIONS_SUBSYSTEMS_COUNT);
+  EXPECT_EQ(responsePayload[SC_ALLOCATIONS_SEGMENTS]["subsystem"].get<std::string>(), "segments");
+  EXPECT_GT(responsePayload[SC_ALLOCATIONS_SEGMENTS]["bytes"].get<sc_uint64>(), 0u);
+  EXPECT_EQ(responsePayload[SC_ALLOCATIONS_SERVER_SESSIONS]["subsystem"].get<std::string>(), "server sessions");
+  EXPECT_GE(responsePayload[SC_ALLOCATIONS_SERVER_SESSIONS]["objects"].get<sc_uint64>(), 1u);
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, MonitorsContention)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  std::string payloadString = ScMemoryJsonConverter::From(0, "monitors_contention", {{"sampling_period", 1}});
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["errors"].empty());
+  EXPECT_TRUE(response["payload"].is_array());
+
+  payloadString = ScMemoryJsonConverter::From(0, "monitors_contention", {{"count", -1}});
+  EXPECT_TRUE(client.Send(payloadString));
+
+  response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_FALSE(response["status"].get<sc_bool>());
+  EXPECT_FALSE(response["errors"].empty());
+
+  payloadString = ScMemoryJsonConverter::From(0, "monitors_contention", {{"sampling_period", 0}, {"count", 5}});
+  EXPECT_TRUE(client.Send(payloadString));
+
+  response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["payload"].empty());
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, SlowOperations)
+{
+  utils::ScSlowOperationsLog::SetThreshold(utils::ScSlowOperationsLog::Type::TemplateSearch, 1e-6);
+
+  ScAddr const & classAddr = m_ctx->HelperResolveSystemIdtf("slow_class", ScType::NodeConstClass);
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, classAddr, m_ctx->CreateNode(ScType::NodeConst));
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScMemoryJsonPayload payload;
+  payload["templ"] = "slow_class _-> _element;;";
+  std::string payloadString = ScMemoryJsonConverter::From(0, "search_template", payload);
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+
+  payloadString = ScMemoryJsonConverter::From(0, "slow_operations", ScMemoryJsonPayload::object({}));
+  EXPECT_TRUE(client.Send(payloadString));
+
+  response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["errors"].empty());
+
+  auto const & responsePayload = response["payload"];
+  ASSERT_FALSE(responsePayload.empty());
+  auto const & entry = responsePayload.back();
+  EXPECT_EQ(entry["type"].get<std::string>(), "TemplateSearch");
+  EXPECT_GE(entry["duration"].get<double>(), 0.0);
+  std::string const & description = entry["description"].get<std::string>();
+  EXPECT_NE(description.find("slow_class _-> _element"), std::string::npos);
+  EXPECT_NE(description.find("results: 1"), std::string::npos);
+
+  utils::ScSlowOperationsLog::SetThreshold(utils::ScSlowOperationsLog::Type::TemplateSearch, 0);
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, EventsStat)
+{
+  ScAddr const & nodeAddr = m_ctx->CreateNode(ScType::NodeConst);
+  ScEventAddOutputEdge event(
+      *m_ctx,
+      nodeAddr,
+      [](ScAddr const &, ScAddr const &, ScAddr const &)
+      {
+        return true;
+      });
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, nodeAddr, m_ctx->CreateNode(ScType::NodeConst));
+
+  // latency of sc-event is recorded in all stages after its processing is completed
+  auto const isEventCompleted = [this]()
+  {
+    for (auto const & stat : m_ctx->CalculateEventsLatencyStat())
+    {
+      if (stat.m_eventType == ScEvent::Type::AddOutputEdge && stat.m_total.m_count > 0)
+        return true;
+    }
+    return false;
+  };
+
+  ScTimer timer(5.0);
+  while (!isEventCompleted() && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  std::string const payloadString = ScMemoryJsonConverter::From(0, "events_stat", ScMemoryJsonPayload::object({}));
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["errors"].empty());
+
+  auto const & responsePayload = response["payload"];
+  EXPECT_GE(responsePayload["queue"]["processed_count"].get<sc_uint64>(), 1u);
+  EXPECT_GE(responsePayload["workers"]["max_count"].get<sc_uint32>(), 1u);
+  EXPECT_LE(responsePayload["workers"]["utilization"].get<double>(), 1.0);
+
+  auto const & latencies = responsePayload["latencies"];
+  auto const it = std::find_if(
+      latencies.cbegin(),
+      latencies.cend(),
+      [](ScMemoryJsonPayload const & latency)
+      {
+        return latency["event_type"].get<std::string>() == "add_outgoing_edge";
+      });
+  ASSERT_NE(it, latencies.cend());
+  EXPECT_EQ((*it)["priority"].get<std::string>(), "normal");
+  EXPECT_EQ((*it)["total"]["count"].get<sc_uint64>(), 1u);
+  EXPECT_EQ((*it)["queued"]["buckets"].size(), size_t(SC_LATENCY_HISTOGRAM_BUCKETS_COUNT));
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, BatchRequest)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  std::string const payloadString = ScMemoryJsonConverter::From(
+      0,
+      "batch",
+      {
+          {"requests",
+           ScMemoryJsonPayload::array({
+               {
+                   {"type", "keynodes"},
+                   {"payload",
+                    ScMemoryJsonPayload::array({
+                        {
+                            {"command", "resolve"},
+                            {"idtf", "batch_system_identifier"},
+                            {"elType", sc_type_node | sc_type_const | sc_type_node_class},
+                        },
+                    })},
+               },
+               {
+                   {"type", "create_elements"},
+                   {"payload",
+                    ScMemoryJsonPayload::array({
+                        {
+                            {"el", "node"},
+                            {"type", sc_type_node | sc_type_const},
+                        },
+                        {
+                            {"el", "edge"},
+                            {"src",
+                             {
+                                 {"type", "addr"},
+                                 {"value", {{"$ref", "/0/payload/0"}}},
+                             }},
+                            {"trg",
+                             {
+                                 {"type", "ref"},
+                                 {"value", 0},
+                             }},
+                            {"type", sc_type_arc_pos_const_perm},
+                        },
+                    })},
+               },
+               {
+                   {"type", "check_elements"},
+                   {"payload", ScMemoryJsonPayload::array({{{"$ref", "/1/payload/1"}}})},
+               },
+           })},
+      });
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  auto const & responsePayload = response["payload"];
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["errors"].empty());
+  EXPECT_EQ(responsePayload.size(), 3u);
+  for (auto const & subResponse : responsePayload)
+  {
+    EXPECT_TRUE(subResponse["status"].get<sc_bool>());
+    EXPECT_TRUE(subResponse["errors"].empty());
+  }
+
+  ScAddr const & classAddr = ScAddr(responsePayload[0]["payload"][0].get<size_t>());
+  EXPECT_EQ(m_ctx->HelperFindBySystemIdtf("batch_system_identifier"), classAddr);
+
+  ScAddr const & nodeAddr = ScAddr(responsePayload[1]["payload"][0].get<size_t>());
+  ScAddr const & edgeAddr = ScAddr(responsePayload[1]["payload"][1].get<size_t>());
+  EXPECT_EQ(m_ctx->GetEdgeSource(edgeAddr), classAddr);
+  EXPECT_EQ(m_ctx->GetEdgeTarget(edgeAddr), nodeAddr);
+
+  EXPECT_TRUE(ScType(responsePayload[2]["payload"][0].get<size_t>()) == ScType::EdgeAccessConstPosPerm);
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, BatchRequestAbortOnError)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  std::string const payloadString = ScMemoryJsonConverter::From(
+      0,
+      "batch",
+      {
+          {"abort_on_error", true},
+          {"requests",
+           ScMemoryJsonPayload::array({
+               {
+                   {"type", "check_elements"},
+                   {"payload", ScMemoryJsonPayload::array({{{"$ref", "/1/payload/0"}}})},
+               },
+               {
+                   {"type", "keynodes"},
+                   {"payload",
+                    ScMemoryJsonPayload::array({
+                        {
+                            {"command", "find"},
+                            {"idtf", "batch_system_identifier"},
+                        },
+                    })},
+               },
+           })},
+      });
+  EXPECT_TRUE(client.Send(payloadString));
+
+  // the first sub-request refers to result of sub-request that isn't completed yet
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  auto const & responsePayload = response["payload"];
+  EXPECT_FALSE(response["status"].get<sc_bool>());
+  EXPECT_FALSE(response["errors"].empty());
+  EXPECT_EQ(responsePayload.size(), 1u);
+  EXPECT_FALSE(responsePayload[0]["status"].get<sc_bool>());
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, BatchRequestWithUnsupportedSubRequests)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  std::string const payloadString = ScMemoryJsonConverter::From(
+      0,
+      "batch",
+      {
+          {"requests",
+           ScMemoryJsonPayload::array({
+               {
+                   {"type", "batch"},
+                   {"payload", {{"requests", ScMemoryJsonPayload::array({})}}},
+               },
+               {
+                   {"type", "unknown"},
+                   {"payload", ScMemoryJsonPayload::array({})},
+               },
+               {
+                   {"type", "allocations_stat"},
+                   {"payload", ScMemoryJsonPayload::object({})},
+               },
+           })},
+      });
+  EXPECT_TRUE(client.Send(payloadString));
+
+  // sub-requests are completed independently without abort on error
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  auto const & responsePayload = response["payload"];
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_EQ(responsePayload.size(), 3u);
+  EXPECT_FALSE(responsePayload[0]["status"].get<sc_bool>());
+  EXPECT_FALSE(responsePayload[1]["status"].get<sc_bool>());
+  EXPECT_TRUE(responsePayload[2]["status"].get<sc_bool>());
+  EXPECT_EQ(responsePayload[2]["payload"].size(), (size_t)SC_ALLOCATIONS_SUBSYSTEMS_COUNT);
+
+  client.Stop();
+}
+
 TEST_F(ScServerTest, DeleteElements)
 {
   ScClient client;
@@ -1124,6 +1487,113 @@ TEST_F(ScServerTest, GenerateTemplateByAddr)
   client.Stop();
 }
 
+TEST_F(ScServerTest, PrepareTemplate)
+{
+  ScAddr const & setAddr = m_ctx->HelperResolveSystemIdtf("prepared_set", ScType::NodeConst);
+  ScAddr const & item1 = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const & item2 = m_ctx->CreateNode(ScType::NodeConst);
+  ScAddr const & item3 = m_ctx->CreateNode(ScType::NodeConst);
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, setAddr, item1);
+  m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, setAddr, item2);
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScMemoryJsonPayload payload;
+  payload["templ"] = "prepared_set _-> _item;;";
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "prepare_template", payload)));
+
+  auto response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["errors"].empty());
+  size_t const handle = response["payload"]["handle"].get<size_t>();
+
+  payload = {{"handle", handle}};
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "search_template", payload)));
+
+  response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_EQ(response["payload"]["addrs"].size(), 2u);
+
+  payload["params"]["_item"] = item1.Hash();
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "search_template", payload)));
+
+  response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_EQ(response["payload"]["addrs"].size(), 1u);
+  auto addrs = response["payload"]["addrs"][0].get<std::vector<size_t>>();
+  EXPECT_TRUE(ScAddr(addrs[0]) == setAddr);
+  EXPECT_TRUE(ScAddr(addrs[2]) == item1);
+
+  payload["params"]["_item"] = item3.Hash();
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "generate_template", payload)));
+
+  response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  addrs = response["payload"]["addrs"].get<std::vector<size_t>>();
+  EXPECT_TRUE(ScAddr(addrs[0]) == setAddr);
+  EXPECT_TRUE(ScAddr(addrs[2]) == item3);
+  EXPECT_TRUE(m_ctx->HelperCheckEdge(setAddr, item3, ScType::EdgeAccessConstPosPerm));
+
+  payload = {{"handle", handle}};
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "search_template", payload)));
+
+  response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_EQ(response["payload"]["addrs"].size(), 3u);
+
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "release_template", ScMemoryJsonPayload{handle, handle + 1})));
+
+  response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["payload"][0].get<sc_bool>());
+  EXPECT_FALSE(response["payload"][1].get<sc_bool>());
+
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "search_template", payload)));
+
+  response = client.GetResponseMessage();
+  EXPECT_FALSE(response["status"].get<sc_bool>());
+  EXPECT_FALSE(response["errors"].empty());
+
+  client.Stop();
+}
+
+TEST_F(ScServerTest, PreparedTemplateIsBoundToSession)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScClient otherClient;
+  EXPECT_TRUE(otherClient.Connect(m_server->GetUri()));
+  otherClient.Run();
+
+  ScMemoryJsonPayload payload;
+  payload["templ"] = "_node1 _=> _node2;;";
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "prepare_template", payload)));
+
+  auto response = client.GetResponseMessage();
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+
+  payload = {{"handle", response["payload"]["handle"].get<size_t>()}};
+  EXPECT_TRUE(otherClient.Send(ScMemoryJsonConverter::From(0, "search_template", payload)));
+
+  response = otherClient.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_FALSE(response["status"].get<sc_bool>());
+  EXPECT_FALSE(response["errors"].empty());
+
+  EXPECT_TRUE(client.Send(ScMemoryJsonConverter::From(0, "prepare_template", payload)));
+
+  response = client.GetResponseMessage();
+  EXPECT_FALSE(response["status"].get<sc_bool>());
+
+  otherClient.Stop();
+  client.Stop();
+}
+
 TEST_F(ScServerTest, HandleEvents)
 {
   ScClient client;
@@ -0,0 +1,108 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <gtest/gtest.h>
+
+#include "sc_server_test.hpp"
+#include "../../sc_client.hpp"
+#include "../../sc_local_client.hpp"
+#include "../../sc_memory_json_converter.hpp"
+
+TEST_F(ScServerTestWithLocalTransport, ConnectAndGetUser)
+{
+  ScLocalClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetSocketPath()));
+
+  std::string const payloadString = R"({"type": "connection_info"})";
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto const response = client.GetResponseMessage();
+
+  EXPECT_FALSE(response.is_null());
+  ScAddr const & userAddr = ScAddr(response["user_addr"].get<sc_addr_hash>());
+  EXPECT_TRUE(userAddr.IsValid());
+  client.Stop();
+}
+
+TEST_F(ScServerTestWithLocalTransport, CreateElements)
+{
+  ScLocalClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetSocketPath()));
+
+  std::string const content(1024 * 1024, 'a');
+  std::string const payloadString = ScMemoryJsonConverter::From(
+      0,
+      "create_elements",
+      ScMemoryJsonPayload::array({
+          {
+              {"el", "node"},
+              {"type", sc_type_node | sc_type_const},
+          },
+          {
+              {"el", "link"},
+              {"type", sc_type_link | sc_type_const},
+              {"content", content},
+          },
+      }));
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["errors"].empty());
+
+  auto const & responsePayload = response["payload"];
+  EXPECT_EQ(responsePayload.size(), 2u);
+
+  ScAddr const & nodeAddr = ScAddr(responsePayload[0].get<sc_addr_hash>());
+  EXPECT_EQ(m_ctx->GetElementType(nodeAddr), ScType::NodeConst);
+
+  ScAddr const & linkAddr = ScAddr(responsePayload[1].get<sc_addr_hash>());
+  std::string linkContent;
+  EXPECT_TRUE(m_ctx->GetLinkContent(linkAddr, linkContent));
+  EXPECT_EQ(linkContent, content);
+
+  client.Stop();
+}
+
+TEST_F(ScServerTestWithLocalTransport, HealthcheckOK)
+{
+  ScLocalClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetSocketPath()));
+
+  std::string const payloadString = R"({"type": "healthcheck"})";
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_EQ(response.get<std::string>(), "OK");
+
+  // sc-server closes connection after health check
+  EXPECT_TRUE(client.GetResponseMessage().is_null());
+}
+
+TEST_F(ScServerTestWithLocalTransport, WebsocketAndLocalClients)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScLocalClient localClient;
+  EXPECT_TRUE(localClient.Connect(m_server->GetSocketPath()));
+
+  std::string const payloadString = R"({"type": "connection_info"})";
+  EXPECT_TRUE(client.Send(payloadString));
+  EXPECT_TRUE(localClient.Send(payloadString));
+
+  auto const response = client.GetResponseMessage();
+  auto const localResponse = localClient.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  EXPECT_FALSE(localResponse.is_null());
+  EXPECT_NE(response["connection_id"].get<sc_uint64>(), localResponse["connection_id"].get<sc_uint64>());
+
+  localClient.Stop();
+  client.Stop();
+}
@@ -10,7 +10,9 @@
 #include "units/sc_server_create_edge.hpp"
 #include "units/sc_server_create_node.hpp"
 #include "units/sc_server_create_link.hpp"
+#include "units/sc_server_prepared_template.hpp"
 #include "units/sc_server_remove_elements.hpp"
+#include "units/sc_server_round_trip.hpp"
 #include "units/sc_server_search_template.hpp"
 
 #include <atomic>
@@ -186,4 +188,66 @@ BENCHMARK_TEMPLATE(BM_ServerRanged, TestRemoveElements)->Unit(benchmark::TimeUni
 
 BENCHMARK_TEMPLATE(BM_ServerRanged, TestSearchTemplate)->Unit(benchmark::TimeUnit::kMicrosecond)->Iterations(1000);
 
+// ------------------------------------
+template <class BMType>
+void BM_ServerRoundTrip(benchmark::State & state)
+{
+  BMType test;
+  test.Initialize(state.range(0));
+  test.Connect();
+
+  for (auto t : state)
+  {
+    SC_UNUSED(t);
+    test.Run();
+  }
+
+  test.Disconnect();
+  test.WaitServer();
+  test.Shutdown();
+}
+
+BENCHMARK_TEMPLATE(BM_ServerRoundTrip, TestWebsocketRoundTrip)
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Arg(16)
+    ->Arg(1024 * 1024)
+    ->Iterations(1000);
+
+BENCHMARK_TEMPLATE(BM_ServerRoundTrip, TestLocalRoundTrip)
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Arg(16)
+    ->Arg(1024 * 1024)
+    ->Iterations(1000);
+
+// ------------------------------------
+template <class BMType>
+void BM_ServerTemplateRoundTrip(benchmark::State & state)
+{
+  BMType test;
+  test.Initialize(state.range(0));
+  test.Connect();
+
+  for (auto t : state)
+  {
+    SC_UNUSED(t);
+    test.Run();
+  }
+
+  test.Disconnect();
+  test.WaitServer();
+  test.Shutdown();
+}
+
+BENCHMARK_TEMPLATE(BM_ServerTemplateRoundTrip, TestStringTemplateRoundTrip)
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Arg(1)
+    ->Arg(16)
+    ->Iterations(1000);
+
+BENCHMARK_TEMPLATE(BM_ServerTemplateRoundTrip, TestPreparedTemplateRoundTrip)
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Arg(1)
+    ->Arg(16)
+    ->Iterations(1000);
+
 BENCHMARK_MAIN();
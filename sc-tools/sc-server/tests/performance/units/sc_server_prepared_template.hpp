@@ -0,0 +1,77 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc_server_test.hpp"
+#include "../../sc_memory_json_converter.hpp"
+
+class TestTemplateRoundTrip : public TestScServer
+{
+public:
+  void Setup(size_t edgeNum) override
+  {
+    ScAddr const & setAddr = m_ctx->HelperResolveSystemIdtf("performance_set", ScType::NodeConst);
+    for (size_t i = 0; i < edgeNum; ++i)
+      m_ctx->CreateEdge(ScType::EdgeAccessConstPosPerm, setAddr, m_ctx->CreateNode(ScType::NodeConst));
+  }
+
+  void Connect()
+  {
+    m_client = std::make_unique<ScClient>();
+    m_client->Connect(m_server->GetUri());
+    m_client->Run();
+  }
+
+  void Run()
+  {
+    m_client->Send(m_payloadString, std::chrono::milliseconds(0));
+    m_client->GetResponseMessage();
+  }
+
+  void Disconnect()
+  {
+    m_client->Stop();
+    m_client = nullptr;
+  }
+
+protected:
+  std::unique_ptr<ScClient> m_client;
+  std::string m_payloadString;
+
+  std::string const TEMPLATE = "performance_set _-> _item;;";
+};
+
+// Client sends SCs-text of template with each request, so sc-server parses and builds it each time
+class TestStringTemplateRoundTrip : public TestTemplateRoundTrip
+{
+public:
+  void Connect()
+  {
+    TestTemplateRoundTrip::Connect();
+
+    ScMemoryJsonPayload payload;
+    payload["templ"] = TEMPLATE;
+    m_payloadString = ScMemoryJsonConverter::From(0, "search_template", payload);
+  }
+};
+
+// Client prepares template once and sends only its handle with each request
+class TestPreparedTemplateRoundTrip : public TestTemplateRoundTrip
+{
+public:
+  void Connect()
+  {
+    TestTemplateRoundTrip::Connect();
+
+    ScMemoryJsonPayload payload;
+    payload["templ"] = TEMPLATE;
+    m_client->Send(ScMemoryJsonConverter::From(0, "prepare_template", payload), std::chrono::milliseconds(0));
+    size_t const handle = m_client->GetResponseMessage()["payload"]["handle"].get<size_t>();
+
+    m_payloadString = ScMemoryJsonConverter::From(0, "search_template", ScMemoryJsonPayload{{"handle", handle}});
+  }
+};
@@ -0,0 +1,87 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc_server_test.hpp"
+#include "../../sc_local_client.hpp"
+#include "../../sc_memory_json_converter.hpp"
+
+template <class ClientT>
+class TestRoundTrip : public TestScServer
+{
+public:
+  void Setup(size_t contentSize) override
+  {
+    m_payloadString = ScMemoryJsonConverter::From(
+        0,
+        "create_elements",
+        ScMemoryJsonPayload::array({
+            {
+                {"el", "node"},
+                {"type", sc_type_node | sc_type_const},
+            },
+            {
+                {"el", "link"},
+                {"type", sc_type_link | sc_type_const},
+                {"content", std::string(contentSize, 'a')},
+            },
+        }));
+  }
+
+  void Run()
+  {
+    Send();
+    m_client->GetResponseMessage();
+  }
+
+  void Disconnect()
+  {
+    m_client->Stop();
+    m_client = nullptr;
+  }
+
+protected:
+  std::unique_ptr<ClientT> m_client;
+  std::string m_payloadString;
+
+  virtual void Send() = 0;
+};
+
+// Client sends requests through TCP loopback and websocket
+class TestWebsocketRoundTrip : public TestRoundTrip<ScClient>
+{
+public:
+  void Connect()
+  {
+    m_client = std::make_unique<ScClient>();
+    m_client->Connect(m_server->GetUri());
+    m_client->Run();
+  }
+
+protected:
+  void Send() override
+  {
+    m_client->Send(m_payloadString, std::chrono::milliseconds(0));
+  }
+};
+
+// Client sends the same requests through Unix domain socket
+class TestLocalRoundTrip : public TestRoundTrip<ScLocalClient>
+{
+public:
+  void Connect()
+  {
+    m_client = std::make_unique<ScLocalClient>();
+    m_client->Connect(m_server->GetSocketPath());
+  }
+
+protected:
+  void Send() override
+  {
+    m_client->Send(m_payloadString);
+  }
+};
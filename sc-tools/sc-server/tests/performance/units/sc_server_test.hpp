@@ -32,7 +32,7 @@ public:
     std::mt19937 generator(random_device());
 
     ScMemory::Initialize(params);
-    m_server = std::make_unique<ScServerImpl>("127.0.0.1", distribution(generator), SC_TRUE);
+    m_server = std::make_unique<ScServerImpl>("127.0.0.1", distribution(generator), SC_TRUE, SOCKET_PATH);
     m_server->ClearChannels();
     m_server->Run();
     ScMemory::LogUnmute();
@@ -78,6 +78,7 @@ public:
 protected:
   static std::unique_ptr<ScMemoryContext> m_ctx;
 
+  std::string const SOCKET_PATH = "sc-server-performance-tests.sock";
   sc_int const MAX_TEST_SERVER_PORT = 30000;
   sc_int const MIN_TEST_SERVER_PORT = 20000;
 };
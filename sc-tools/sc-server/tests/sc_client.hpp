@@ -8,6 +8,9 @@
 
 #include <nlohmann/json.hpp>
 
+#include <condition_variable>
+#include <mutex>
+
 #include "sc_client_defines.hpp"
 
 using ScMemoryJsonPayload = nlohmann::json;
@@ -47,9 +50,9 @@ public:
     m_thread.join();
   }
 
-  sc_bool Send(std::string const & msg)
+  sc_bool Send(std::string const & msg, std::chrono::milliseconds delay = std::chrono::milliseconds(400))
   {
-    std::this_thread::sleep_for(std::chrono::milliseconds(400));
+    std::this_thread::sleep_for(delay);
 
     ScClientErrorCode code;
     m_instance.send(m_connection, msg, ScServerMessageType::text, code);
@@ -59,16 +62,21 @@ public:
 
   void OnMessage(ScServerSessionId const & sessionId, ScServerMessage const & msg)
   {
+    std::lock_guard<std::mutex> lock(m_messageMutex);
     m_currentPayload = ScMemoryJsonPayload::parse(msg->get_payload());
     m_isNewMessage = SC_TRUE;
+    m_messageCond.notify_one();
   }
 
   ScMemoryJsonPayload GetResponseMessage()
   {
-    while (!m_isNewMessage)
-    {
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
-    }
+    std::unique_lock<std::mutex> lock(m_messageMutex);
+    m_messageCond.wait(
+        lock,
+        [this]
+        {
+          return m_isNewMessage;
+        });
 
     m_isNewMessage = SC_FALSE;
     return m_currentPayload;
@@ -81,6 +89,8 @@ private:
   ScClientConnection m_connection;
   std::thread m_thread;
 
+  std::mutex m_messageMutex;
+  std::condition_variable m_messageCond;
   sc_bool m_isNewMessage;
   ScMemoryJsonPayload m_currentPayload;
 
@@ -0,0 +1,82 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include "sc-memory/sc_memory.hpp"
+
+using ScMemoryJsonPayload = nlohmann::json;
+
+/* Client of sc-server connecting through Unix domain socket. Each message is sent and received as 4-byte big-endian
+ * payload size followed by payload. */
+class ScLocalClient
+{
+public:
+  ScLocalClient()
+    : m_socket(m_ioService)
+  {
+  }
+
+  sc_bool Connect(std::string const & socketPath)
+  {
+    boost::system::error_code code;
+    m_socket.connect(boost::asio::local::stream_protocol::endpoint(socketPath), code);
+    return !code;
+  }
+
+  void Stop()
+  {
+    boost::system::error_code code;
+    m_socket.close(code);
+  }
+
+  sc_bool Send(std::string const & msg)
+  {
+    std::string frame(4, '\0');
+    for (size_t i = 0; i < 4; ++i)
+      frame[i] = (sc_char)((msg.size() >> (8 * (3 - i))) & 0xff);
+    frame.append(msg);
+
+    boost::system::error_code code;
+    boost::asio::write(m_socket, boost::asio::buffer(frame), code);
+    return !code;
+  }
+
+  ScMemoryJsonPayload GetResponseMessage()
+  {
+    sc_uchar header[4];
+    boost::system::error_code code;
+    boost::asio::read(m_socket, boost::asio::buffer(header), code);
+    if (code)
+      return ScMemoryJsonPayload();
+
+    size_t size = 0;
+    for (sc_uchar const byte : header)
+      size = (size << 8) | byte;
+
+    std::string payload(size, '\0');
+    boost::asio::read(m_socket, boost::asio::buffer(payload), code);
+    if (code)
+      return ScMemoryJsonPayload();
+
+    return ScMemoryJsonPayload::parse(payload);
+  }
+
+  ~ScLocalClient()
+  {
+    Stop();
+  }
+
+private:
+  boost::asio::io_service m_ioService;
+  boost::asio::local::stream_protocol::socket m_socket;
+};